@@ -0,0 +1,203 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/embedded/cJSON/cJSON.c" "CMakeFiles/chucho.dir/embedded/cJSON/cJSON.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/cJSON/cJSON.c.o.d"
+  "/root/repo/embedded/fnv/hash_64a.c" "CMakeFiles/chucho.dir/embedded/fnv/hash_64a.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/fnv/hash_64a.c.o.d"
+  "/root/repo/embedded/libyaml/api.c" "CMakeFiles/chucho.dir/embedded/libyaml/api.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/libyaml/api.c.o.d"
+  "/root/repo/embedded/libyaml/dumper.c" "CMakeFiles/chucho.dir/embedded/libyaml/dumper.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/libyaml/dumper.c.o.d"
+  "/root/repo/embedded/libyaml/emitter.c" "CMakeFiles/chucho.dir/embedded/libyaml/emitter.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/libyaml/emitter.c.o.d"
+  "/root/repo/embedded/libyaml/loader.c" "CMakeFiles/chucho.dir/embedded/libyaml/loader.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/libyaml/loader.c.o.d"
+  "/root/repo/embedded/libyaml/parser.c" "CMakeFiles/chucho.dir/embedded/libyaml/parser.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/libyaml/parser.c.o.d"
+  "/root/repo/embedded/libyaml/reader.c" "CMakeFiles/chucho.dir/embedded/libyaml/reader.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/libyaml/reader.c.o.d"
+  "/root/repo/embedded/libyaml/scanner.c" "CMakeFiles/chucho.dir/embedded/libyaml/scanner.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/libyaml/scanner.c.o.d"
+  "/root/repo/embedded/libyaml/writer.c" "CMakeFiles/chucho.dir/embedded/libyaml/writer.c.o" "gcc" "CMakeFiles/chucho.dir/embedded/libyaml/writer.c.o.d"
+  "/root/repo/async_writer.cpp" "CMakeFiles/chucho.dir/async_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/async_writer.cpp.o.d"
+  "/root/repo/async_writer_factory.cpp" "CMakeFiles/chucho.dir/async_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/async_writer_factory.cpp.o.d"
+  "/root/repo/async_writer_memento.cpp" "CMakeFiles/chucho.dir/async_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/async_writer_memento.cpp.o.d"
+  "/root/repo/binary_file_reader.cpp" "CMakeFiles/chucho.dir/binary_file_reader.cpp.o" "gcc" "CMakeFiles/chucho.dir/binary_file_reader.cpp.o.d"
+  "/root/repo/binary_file_writer.cpp" "CMakeFiles/chucho.dir/binary_file_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/binary_file_writer.cpp.o.d"
+  "/root/repo/binary_file_writer_factory.cpp" "CMakeFiles/chucho.dir/binary_file_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/binary_file_writer_factory.cpp.o.d"
+  "/root/repo/binary_file_writer_memento.cpp" "CMakeFiles/chucho.dir/binary_file_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/binary_file_writer_memento.cpp.o.d"
+  "/root/repo/c_configuration.cpp" "CMakeFiles/chucho.dir/c_configuration.cpp.o" "gcc" "CMakeFiles/chucho.dir/c_configuration.cpp.o.d"
+  "/root/repo/c_finalize.cpp" "CMakeFiles/chucho.dir/c_finalize.cpp.o" "gcc" "CMakeFiles/chucho.dir/c_finalize.cpp.o.d"
+  "/root/repo/c_log.cpp" "CMakeFiles/chucho.dir/c_log.cpp.o" "gcc" "CMakeFiles/chucho.dir/c_log.cpp.o.d"
+  "/root/repo/c_logger.cpp" "CMakeFiles/chucho.dir/c_logger.cpp.o" "gcc" "CMakeFiles/chucho.dir/c_logger.cpp.o.d"
+  "/root/repo/cache_and_release_filter.cpp" "CMakeFiles/chucho.dir/cache_and_release_filter.cpp.o" "gcc" "CMakeFiles/chucho.dir/cache_and_release_filter.cpp.o.d"
+  "/root/repo/cache_and_release_filter_factory.cpp" "CMakeFiles/chucho.dir/cache_and_release_filter_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/cache_and_release_filter_factory.cpp.o.d"
+  "/root/repo/cache_and_release_filter_memento.cpp" "CMakeFiles/chucho.dir/cache_and_release_filter_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/cache_and_release_filter_memento.cpp.o.d"
+  "/root/repo/calendar.cpp" "CMakeFiles/chucho.dir/calendar.cpp.o" "gcc" "CMakeFiles/chucho.dir/calendar.cpp.o.d"
+  "/root/repo/callsite.cpp" "CMakeFiles/chucho.dir/callsite.cpp.o" "gcc" "CMakeFiles/chucho.dir/callsite.cpp.o.d"
+  "/root/repo/cerr_writer_factory.cpp" "CMakeFiles/chucho.dir/cerr_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/cerr_writer_factory.cpp.o.d"
+  "/root/repo/config_file_configurator.cpp" "CMakeFiles/chucho.dir/config_file_configurator.cpp.o" "gcc" "CMakeFiles/chucho.dir/config_file_configurator.cpp.o.d"
+  "/root/repo/config_watcher.cpp" "CMakeFiles/chucho.dir/config_watcher.cpp.o" "gcc" "CMakeFiles/chucho.dir/config_watcher.cpp.o.d"
+  "/root/repo/configurable.cpp" "CMakeFiles/chucho.dir/configurable.cpp.o" "gcc" "CMakeFiles/chucho.dir/configurable.cpp.o.d"
+  "/root/repo/configurable_factory.cpp" "CMakeFiles/chucho.dir/configurable_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/configurable_factory.cpp.o.d"
+  "/root/repo/configuration.cpp" "CMakeFiles/chucho.dir/configuration.cpp.o" "gcc" "CMakeFiles/chucho.dir/configuration.cpp.o.d"
+  "/root/repo/configurator.cpp" "CMakeFiles/chucho.dir/configurator.cpp.o" "gcc" "CMakeFiles/chucho.dir/configurator.cpp.o.d"
+  "/root/repo/cout_writer_factory.cpp" "CMakeFiles/chucho.dir/cout_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/cout_writer_factory.cpp.o.d"
+  "/root/repo/curl.cpp" "CMakeFiles/chucho.dir/curl.cpp.o" "gcc" "CMakeFiles/chucho.dir/curl.cpp.o.d"
+  "/root/repo/demangle.cpp" "CMakeFiles/chucho.dir/demangle.cpp.o" "gcc" "CMakeFiles/chucho.dir/demangle.cpp.o.d"
+  "/root/repo/diagnostic_context.cpp" "CMakeFiles/chucho.dir/diagnostic_context.cpp.o" "gcc" "CMakeFiles/chucho.dir/diagnostic_context.cpp.o.d"
+  "/root/repo/duplicate_message_filter.cpp" "CMakeFiles/chucho.dir/duplicate_message_filter.cpp.o" "gcc" "CMakeFiles/chucho.dir/duplicate_message_filter.cpp.o.d"
+  "/root/repo/duplicate_message_filter_factory.cpp" "CMakeFiles/chucho.dir/duplicate_message_filter_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/duplicate_message_filter_factory.cpp.o.d"
+  "/root/repo/duplicate_message_filter_memento.cpp" "CMakeFiles/chucho.dir/duplicate_message_filter_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/duplicate_message_filter_memento.cpp.o.d"
+  "/root/repo/email_writer.cpp" "CMakeFiles/chucho.dir/email_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/email_writer.cpp.o.d"
+  "/root/repo/email_writer_factory.cpp" "CMakeFiles/chucho.dir/email_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/email_writer_factory.cpp.o.d"
+  "/root/repo/email_writer_memento.cpp" "CMakeFiles/chucho.dir/email_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/email_writer_memento.cpp.o.d"
+  "/root/repo/event.cpp" "CMakeFiles/chucho.dir/event.cpp.o" "gcc" "CMakeFiles/chucho.dir/event.cpp.o.d"
+  "/root/repo/event_cache.cpp" "CMakeFiles/chucho.dir/event_cache.cpp.o" "gcc" "CMakeFiles/chucho.dir/event_cache.cpp.o.d"
+  "/root/repo/event_cache_provider.cpp" "CMakeFiles/chucho.dir/event_cache_provider.cpp.o" "gcc" "CMakeFiles/chucho.dir/event_cache_provider.cpp.o.d"
+  "/root/repo/exception.cpp" "CMakeFiles/chucho.dir/exception.cpp.o" "gcc" "CMakeFiles/chucho.dir/exception.cpp.o.d"
+  "/root/repo/expression_filter.cpp" "CMakeFiles/chucho.dir/expression_filter.cpp.o" "gcc" "CMakeFiles/chucho.dir/expression_filter.cpp.o.d"
+  "/root/repo/expression_filter_factory.cpp" "CMakeFiles/chucho.dir/expression_filter_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/expression_filter_factory.cpp.o.d"
+  "/root/repo/expression_filter_memento.cpp" "CMakeFiles/chucho.dir/expression_filter_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/expression_filter_memento.cpp.o.d"
+  "/root/repo/file_compressor.cpp" "CMakeFiles/chucho.dir/file_compressor.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_compressor.cpp.o.d"
+  "/root/repo/file_compressor_factory.cpp" "CMakeFiles/chucho.dir/file_compressor_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_compressor_factory.cpp.o.d"
+  "/root/repo/file_compressor_memento.cpp" "CMakeFiles/chucho.dir/file_compressor_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_compressor_memento.cpp.o.d"
+  "/root/repo/file_descriptor_writer.cpp" "CMakeFiles/chucho.dir/file_descriptor_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_descriptor_writer.cpp.o.d"
+  "/root/repo/file_exception.cpp" "CMakeFiles/chucho.dir/file_exception.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_exception.cpp.o.d"
+  "/root/repo/file_roller.cpp" "CMakeFiles/chucho.dir/file_roller.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_roller.cpp.o.d"
+  "/root/repo/file_roller_memento.cpp" "CMakeFiles/chucho.dir/file_roller_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_roller_memento.cpp.o.d"
+  "/root/repo/file_writer.cpp" "CMakeFiles/chucho.dir/file_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_writer.cpp.o.d"
+  "/root/repo/file_writer_factory.cpp" "CMakeFiles/chucho.dir/file_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_writer_factory.cpp.o.d"
+  "/root/repo/file_writer_memento.cpp" "CMakeFiles/chucho.dir/file_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/file_writer_memento.cpp.o.d"
+  "/root/repo/filter_memento.cpp" "CMakeFiles/chucho.dir/filter_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/filter_memento.cpp.o.d"
+  "/root/repo/finalize.cpp" "CMakeFiles/chucho.dir/finalize.cpp.o" "gcc" "CMakeFiles/chucho.dir/finalize.cpp.o.d"
+  "/root/repo/format_memo.cpp" "CMakeFiles/chucho.dir/format_memo.cpp.o" "gcc" "CMakeFiles/chucho.dir/format_memo.cpp.o.d"
+  "/root/repo/formatted_message_serializer.cpp" "CMakeFiles/chucho.dir/formatted_message_serializer.cpp.o" "gcc" "CMakeFiles/chucho.dir/formatted_message_serializer.cpp.o.d"
+  "/root/repo/formatted_message_serializer_factory.cpp" "CMakeFiles/chucho.dir/formatted_message_serializer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/formatted_message_serializer_factory.cpp.o.d"
+  "/root/repo/garbage_cleaner.cpp" "CMakeFiles/chucho.dir/garbage_cleaner.cpp.o" "gcc" "CMakeFiles/chucho.dir/garbage_cleaner.cpp.o.d"
+  "/root/repo/host.cpp" "CMakeFiles/chucho.dir/host.cpp.o" "gcc" "CMakeFiles/chucho.dir/host.cpp.o.d"
+  "/root/repo/http_bulk_sender.cpp" "CMakeFiles/chucho.dir/http_bulk_sender.cpp.o" "gcc" "CMakeFiles/chucho.dir/http_bulk_sender.cpp.o.d"
+  "/root/repo/interval_file_roll_trigger.cpp" "CMakeFiles/chucho.dir/interval_file_roll_trigger.cpp.o" "gcc" "CMakeFiles/chucho.dir/interval_file_roll_trigger.cpp.o.d"
+  "/root/repo/interval_file_roll_trigger_factory.cpp" "CMakeFiles/chucho.dir/interval_file_roll_trigger_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/interval_file_roll_trigger_factory.cpp.o.d"
+  "/root/repo/interval_file_roll_trigger_memento.cpp" "CMakeFiles/chucho.dir/interval_file_roll_trigger_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/interval_file_roll_trigger_memento.cpp.o.d"
+  "/root/repo/io_uring_file_writer.cpp" "CMakeFiles/chucho.dir/io_uring_file_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/io_uring_file_writer.cpp.o.d"
+  "/root/repo/io_uring_file_writer_factory.cpp" "CMakeFiles/chucho.dir/io_uring_file_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/io_uring_file_writer_factory.cpp.o.d"
+  "/root/repo/io_uring_file_writer_memento.cpp" "CMakeFiles/chucho.dir/io_uring_file_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/io_uring_file_writer_memento.cpp.o.d"
+  "/root/repo/json_configurator.cpp" "CMakeFiles/chucho.dir/json_configurator.cpp.o" "gcc" "CMakeFiles/chucho.dir/json_configurator.cpp.o.d"
+  "/root/repo/json_formatter.cpp" "CMakeFiles/chucho.dir/json_formatter.cpp.o" "gcc" "CMakeFiles/chucho.dir/json_formatter.cpp.o.d"
+  "/root/repo/json_formatter_factory.cpp" "CMakeFiles/chucho.dir/json_formatter_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/json_formatter_factory.cpp.o.d"
+  "/root/repo/level.cpp" "CMakeFiles/chucho.dir/level.cpp.o" "gcc" "CMakeFiles/chucho.dir/level.cpp.o.d"
+  "/root/repo/level_filter.cpp" "CMakeFiles/chucho.dir/level_filter.cpp.o" "gcc" "CMakeFiles/chucho.dir/level_filter.cpp.o.d"
+  "/root/repo/level_filter_factory.cpp" "CMakeFiles/chucho.dir/level_filter_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/level_filter_factory.cpp.o.d"
+  "/root/repo/level_filter_memento.cpp" "CMakeFiles/chucho.dir/level_filter_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/level_filter_memento.cpp.o.d"
+  "/root/repo/level_threshold_email_trigger.cpp" "CMakeFiles/chucho.dir/level_threshold_email_trigger.cpp.o" "gcc" "CMakeFiles/chucho.dir/level_threshold_email_trigger.cpp.o.d"
+  "/root/repo/level_threshold_email_trigger_factory.cpp" "CMakeFiles/chucho.dir/level_threshold_email_trigger_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/level_threshold_email_trigger_factory.cpp.o.d"
+  "/root/repo/level_threshold_email_trigger_memento.cpp" "CMakeFiles/chucho.dir/level_threshold_email_trigger_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/level_threshold_email_trigger_memento.cpp.o.d"
+  "/root/repo/level_threshold_filter.cpp" "CMakeFiles/chucho.dir/level_threshold_filter.cpp.o" "gcc" "CMakeFiles/chucho.dir/level_threshold_filter.cpp.o.d"
+  "/root/repo/level_threshold_filter_factory.cpp" "CMakeFiles/chucho.dir/level_threshold_filter_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/level_threshold_filter_factory.cpp.o.d"
+  "/root/repo/level_threshold_filter_memento.cpp" "CMakeFiles/chucho.dir/level_threshold_filter_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/level_threshold_filter_memento.cpp.o.d"
+  "/root/repo/log_stream.cpp" "CMakeFiles/chucho.dir/log_stream.cpp.o" "gcc" "CMakeFiles/chucho.dir/log_stream.cpp.o.d"
+  "/root/repo/log_streambuf.cpp" "CMakeFiles/chucho.dir/log_streambuf.cpp.o" "gcc" "CMakeFiles/chucho.dir/log_streambuf.cpp.o.d"
+  "/root/repo/logger.cpp" "CMakeFiles/chucho.dir/logger.cpp.o" "gcc" "CMakeFiles/chucho.dir/logger.cpp.o.d"
+  "/root/repo/logger_factory.cpp" "CMakeFiles/chucho.dir/logger_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/logger_factory.cpp.o.d"
+  "/root/repo/logger_memento.cpp" "CMakeFiles/chucho.dir/logger_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/logger_memento.cpp.o.d"
+  "/root/repo/loggly_writer.cpp" "CMakeFiles/chucho.dir/loggly_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/loggly_writer.cpp.o.d"
+  "/root/repo/loggly_writer_factory.cpp" "CMakeFiles/chucho.dir/loggly_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/loggly_writer_factory.cpp.o.d"
+  "/root/repo/loggly_writer_memento.cpp" "CMakeFiles/chucho.dir/loggly_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/loggly_writer_memento.cpp.o.d"
+  "/root/repo/marker.cpp" "CMakeFiles/chucho.dir/marker.cpp.o" "gcc" "CMakeFiles/chucho.dir/marker.cpp.o.d"
+  "/root/repo/memento.cpp" "CMakeFiles/chucho.dir/memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/memento.cpp.o.d"
+  "/root/repo/memento_key_set.cpp" "CMakeFiles/chucho.dir/memento_key_set.cpp.o" "gcc" "CMakeFiles/chucho.dir/memento_key_set.cpp.o.d"
+  "/root/repo/message_queue_writer.cpp" "CMakeFiles/chucho.dir/message_queue_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/message_queue_writer.cpp.o.d"
+  "/root/repo/message_queue_writer_memento.cpp" "CMakeFiles/chucho.dir/message_queue_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/message_queue_writer_memento.cpp.o.d"
+  "/root/repo/nameable_memento.cpp" "CMakeFiles/chucho.dir/nameable_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/nameable_memento.cpp.o.d"
+  "/root/repo/named_pipe_writer.cpp" "CMakeFiles/chucho.dir/named_pipe_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/named_pipe_writer.cpp.o.d"
+  "/root/repo/named_pipe_writer_factory.cpp" "CMakeFiles/chucho.dir/named_pipe_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/named_pipe_writer_factory.cpp.o.d"
+  "/root/repo/named_pipe_writer_memento.cpp" "CMakeFiles/chucho.dir/named_pipe_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/named_pipe_writer_memento.cpp.o.d"
+  "/root/repo/noop_compressor.cpp" "CMakeFiles/chucho.dir/noop_compressor.cpp.o" "gcc" "CMakeFiles/chucho.dir/noop_compressor.cpp.o.d"
+  "/root/repo/noop_compressor_factory.cpp" "CMakeFiles/chucho.dir/noop_compressor_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/noop_compressor_factory.cpp.o.d"
+  "/root/repo/numbered_file_roller.cpp" "CMakeFiles/chucho.dir/numbered_file_roller.cpp.o" "gcc" "CMakeFiles/chucho.dir/numbered_file_roller.cpp.o.d"
+  "/root/repo/numbered_file_roller_factory.cpp" "CMakeFiles/chucho.dir/numbered_file_roller_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/numbered_file_roller_factory.cpp.o.d"
+  "/root/repo/numbered_file_roller_memento.cpp" "CMakeFiles/chucho.dir/numbered_file_roller_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/numbered_file_roller_memento.cpp.o.d"
+  "/root/repo/on_start_file_roll_trigger.cpp" "CMakeFiles/chucho.dir/on_start_file_roll_trigger.cpp.o" "gcc" "CMakeFiles/chucho.dir/on_start_file_roll_trigger.cpp.o.d"
+  "/root/repo/on_start_file_roll_trigger_factory.cpp" "CMakeFiles/chucho.dir/on_start_file_roll_trigger_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/on_start_file_roll_trigger_factory.cpp.o.d"
+  "/root/repo/optional_features.cpp" "CMakeFiles/chucho.dir/optional_features.cpp.o" "gcc" "CMakeFiles/chucho.dir/optional_features.cpp.o.d"
+  "/root/repo/overload_governor.cpp" "CMakeFiles/chucho.dir/overload_governor.cpp.o" "gcc" "CMakeFiles/chucho.dir/overload_governor.cpp.o.d"
+  "/root/repo/parallel_compressor.cpp" "CMakeFiles/chucho.dir/parallel_compressor.cpp.o" "gcc" "CMakeFiles/chucho.dir/parallel_compressor.cpp.o.d"
+  "/root/repo/pattern_formatter.cpp" "CMakeFiles/chucho.dir/pattern_formatter.cpp.o" "gcc" "CMakeFiles/chucho.dir/pattern_formatter.cpp.o.d"
+  "/root/repo/pattern_formatter_factory.cpp" "CMakeFiles/chucho.dir/pattern_formatter_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/pattern_formatter_factory.cpp.o.d"
+  "/root/repo/pattern_formatter_memento.cpp" "CMakeFiles/chucho.dir/pattern_formatter_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/pattern_formatter_memento.cpp.o.d"
+  "/root/repo/pipe_writer_factory.cpp" "CMakeFiles/chucho.dir/pipe_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/pipe_writer_factory.cpp.o.d"
+  "/root/repo/pipe_writer_memento.cpp" "CMakeFiles/chucho.dir/pipe_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/pipe_writer_memento.cpp.o.d"
+  "/root/repo/platform/posix/calendar_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/calendar_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/calendar_posix.cpp.o.d"
+  "/root/repo/platform/posix/cerr_writer_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/cerr_writer_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/cerr_writer_posix.cpp.o.d"
+  "/root/repo/platform/posix/cout_writer_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/cout_writer_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/cout_writer_posix.cpp.o.d"
+  "/root/repo/platform/posix/diagnostic_context_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/diagnostic_context_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/diagnostic_context_posix.cpp.o.d"
+  "/root/repo/platform/posix/environment_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/environment_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/environment_posix.cpp.o.d"
+  "/root/repo/platform/posix/file_descriptor_writer_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/file_descriptor_writer_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/file_descriptor_writer_posix.cpp.o.d"
+  "/root/repo/platform/posix/file_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/file_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/file_posix.cpp.o.d"
+  "/root/repo/platform/posix/file_writer_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/file_writer_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/file_writer_posix.cpp.o.d"
+  "/root/repo/platform/posix/host_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/host_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/host_posix.cpp.o.d"
+  "/root/repo/platform/posix/line_ending_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/line_ending_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/line_ending_posix.cpp.o.d"
+  "/root/repo/platform/posix/named_pipe_writer_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/named_pipe_writer_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/named_pipe_writer_posix.cpp.o.d"
+  "/root/repo/platform/posix/pipe_writer_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/pipe_writer_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/pipe_writer_posix.cpp.o.d"
+  "/root/repo/platform/posix/process_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/process_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/process_posix.cpp.o.d"
+  "/root/repo/platform/posix/shm_ring_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/shm_ring_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/shm_ring_posix.cpp.o.d"
+  "/root/repo/platform/posix/syslog_writer_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/syslog_writer_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/syslog_writer_posix.cpp.o.d"
+  "/root/repo/platform/posix/text_util_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/text_util_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/text_util_posix.cpp.o.d"
+  "/root/repo/platform/posix/thread_util_posix.cpp" "CMakeFiles/chucho.dir/platform/posix/thread_util_posix.cpp.o" "gcc" "CMakeFiles/chucho.dir/platform/posix/thread_util_posix.cpp.o.d"
+  "/root/repo/properties.cpp" "CMakeFiles/chucho.dir/properties.cpp.o" "gcc" "CMakeFiles/chucho.dir/properties.cpp.o.d"
+  "/root/repo/regex.cpp" "CMakeFiles/chucho.dir/regex.cpp.o" "gcc" "CMakeFiles/chucho.dir/regex.cpp.o.d"
+  "/root/repo/regex_exception.cpp" "CMakeFiles/chucho.dir/regex_exception.cpp.o" "gcc" "CMakeFiles/chucho.dir/regex_exception.cpp.o.d"
+  "/root/repo/regex_filter.cpp" "CMakeFiles/chucho.dir/regex_filter.cpp.o" "gcc" "CMakeFiles/chucho.dir/regex_filter.cpp.o.d"
+  "/root/repo/regex_filter_factory.cpp" "CMakeFiles/chucho.dir/regex_filter_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/regex_filter_factory.cpp.o.d"
+  "/root/repo/regex_filter_memento.cpp" "CMakeFiles/chucho.dir/regex_filter_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/regex_filter_memento.cpp.o.d"
+  "/root/repo/rolling_file_writer.cpp" "CMakeFiles/chucho.dir/rolling_file_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/rolling_file_writer.cpp.o.d"
+  "/root/repo/rolling_file_writer_factory.cpp" "CMakeFiles/chucho.dir/rolling_file_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/rolling_file_writer_factory.cpp.o.d"
+  "/root/repo/rolling_file_writer_memento.cpp" "CMakeFiles/chucho.dir/rolling_file_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/rolling_file_writer_memento.cpp.o.d"
+  "/root/repo/security_policy.cpp" "CMakeFiles/chucho.dir/security_policy.cpp.o" "gcc" "CMakeFiles/chucho.dir/security_policy.cpp.o.d"
+  "/root/repo/serialization_formatter.cpp" "CMakeFiles/chucho.dir/serialization_formatter.cpp.o" "gcc" "CMakeFiles/chucho.dir/serialization_formatter.cpp.o.d"
+  "/root/repo/serialization_formatter_memento.cpp" "CMakeFiles/chucho.dir/serialization_formatter_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/serialization_formatter_memento.cpp.o.d"
+  "/root/repo/shm_ring.cpp" "CMakeFiles/chucho.dir/shm_ring.cpp.o" "gcc" "CMakeFiles/chucho.dir/shm_ring.cpp.o.d"
+  "/root/repo/shm_ring_reader.cpp" "CMakeFiles/chucho.dir/shm_ring_reader.cpp.o" "gcc" "CMakeFiles/chucho.dir/shm_ring_reader.cpp.o.d"
+  "/root/repo/shm_ring_writer.cpp" "CMakeFiles/chucho.dir/shm_ring_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/shm_ring_writer.cpp.o.d"
+  "/root/repo/shm_ring_writer_factory.cpp" "CMakeFiles/chucho.dir/shm_ring_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/shm_ring_writer_factory.cpp.o.d"
+  "/root/repo/shm_ring_writer_memento.cpp" "CMakeFiles/chucho.dir/shm_ring_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/shm_ring_writer_memento.cpp.o.d"
+  "/root/repo/size_file_roll_trigger.cpp" "CMakeFiles/chucho.dir/size_file_roll_trigger.cpp.o" "gcc" "CMakeFiles/chucho.dir/size_file_roll_trigger.cpp.o.d"
+  "/root/repo/size_file_roll_trigger_factory.cpp" "CMakeFiles/chucho.dir/size_file_roll_trigger_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/size_file_roll_trigger_factory.cpp.o.d"
+  "/root/repo/size_file_roll_trigger_memento.cpp" "CMakeFiles/chucho.dir/size_file_roll_trigger_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/size_file_roll_trigger_memento.cpp.o.d"
+  "/root/repo/sliding_numbered_file_roller.cpp" "CMakeFiles/chucho.dir/sliding_numbered_file_roller.cpp.o" "gcc" "CMakeFiles/chucho.dir/sliding_numbered_file_roller.cpp.o.d"
+  "/root/repo/sliding_numbered_file_roller_factory.cpp" "CMakeFiles/chucho.dir/sliding_numbered_file_roller_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/sliding_numbered_file_roller_factory.cpp.o.d"
+  "/root/repo/sliding_numbered_file_roller_memento.cpp" "CMakeFiles/chucho.dir/sliding_numbered_file_roller_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/sliding_numbered_file_roller_memento.cpp.o.d"
+  "/root/repo/staged_configurator.cpp" "CMakeFiles/chucho.dir/staged_configurator.cpp.o" "gcc" "CMakeFiles/chucho.dir/staged_configurator.cpp.o.d"
+  "/root/repo/status.cpp" "CMakeFiles/chucho.dir/status.cpp.o" "gcc" "CMakeFiles/chucho.dir/status.cpp.o.d"
+  "/root/repo/status_manager.cpp" "CMakeFiles/chucho.dir/status_manager.cpp.o" "gcc" "CMakeFiles/chucho.dir/status_manager.cpp.o.d"
+  "/root/repo/status_observer.cpp" "CMakeFiles/chucho.dir/status_observer.cpp.o" "gcc" "CMakeFiles/chucho.dir/status_observer.cpp.o.d"
+  "/root/repo/status_reporter.cpp" "CMakeFiles/chucho.dir/status_reporter.cpp.o" "gcc" "CMakeFiles/chucho.dir/status_reporter.cpp.o.d"
+  "/root/repo/syslog_constants.cpp" "CMakeFiles/chucho.dir/syslog_constants.cpp.o" "gcc" "CMakeFiles/chucho.dir/syslog_constants.cpp.o.d"
+  "/root/repo/syslog_message_builder.cpp" "CMakeFiles/chucho.dir/syslog_message_builder.cpp.o" "gcc" "CMakeFiles/chucho.dir/syslog_message_builder.cpp.o.d"
+  "/root/repo/syslog_writer.cpp" "CMakeFiles/chucho.dir/syslog_writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/syslog_writer.cpp.o.d"
+  "/root/repo/syslog_writer_factory.cpp" "CMakeFiles/chucho.dir/syslog_writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/syslog_writer_factory.cpp.o.d"
+  "/root/repo/syslog_writer_memento.cpp" "CMakeFiles/chucho.dir/syslog_writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/syslog_writer_memento.cpp.o.d"
+  "/root/repo/text_util.cpp" "CMakeFiles/chucho.dir/text_util.cpp.o" "gcc" "CMakeFiles/chucho.dir/text_util.cpp.o.d"
+  "/root/repo/thread_settings.cpp" "CMakeFiles/chucho.dir/thread_settings.cpp.o" "gcc" "CMakeFiles/chucho.dir/thread_settings.cpp.o.d"
+  "/root/repo/thread_util.cpp" "CMakeFiles/chucho.dir/thread_util.cpp.o" "gcc" "CMakeFiles/chucho.dir/thread_util.cpp.o.d"
+  "/root/repo/time_file_roller.cpp" "CMakeFiles/chucho.dir/time_file_roller.cpp.o" "gcc" "CMakeFiles/chucho.dir/time_file_roller.cpp.o.d"
+  "/root/repo/time_file_roller_factory.cpp" "CMakeFiles/chucho.dir/time_file_roller_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/time_file_roller_factory.cpp.o.d"
+  "/root/repo/time_file_roller_memento.cpp" "CMakeFiles/chucho.dir/time_file_roller_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/time_file_roller_memento.cpp.o.d"
+  "/root/repo/time_util.cpp" "CMakeFiles/chucho.dir/time_util.cpp.o" "gcc" "CMakeFiles/chucho.dir/time_util.cpp.o.d"
+  "/root/repo/uring.cpp" "CMakeFiles/chucho.dir/uring.cpp.o" "gcc" "CMakeFiles/chucho.dir/uring.cpp.o.d"
+  "/root/repo/utf8.cpp" "CMakeFiles/chucho.dir/utf8.cpp.o" "gcc" "CMakeFiles/chucho.dir/utf8.cpp.o.d"
+  "/root/repo/writer.cpp" "CMakeFiles/chucho.dir/writer.cpp.o" "gcc" "CMakeFiles/chucho.dir/writer.cpp.o.d"
+  "/root/repo/writer_factory.cpp" "CMakeFiles/chucho.dir/writer_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/writer_factory.cpp.o.d"
+  "/root/repo/writer_memento.cpp" "CMakeFiles/chucho.dir/writer_memento.cpp.o" "gcc" "CMakeFiles/chucho.dir/writer_memento.cpp.o.d"
+  "/root/repo/yaml_configurator.cpp" "CMakeFiles/chucho.dir/yaml_configurator.cpp.o" "gcc" "CMakeFiles/chucho.dir/yaml_configurator.cpp.o.d"
+  "/root/repo/yaml_formatter.cpp" "CMakeFiles/chucho.dir/yaml_formatter.cpp.o" "gcc" "CMakeFiles/chucho.dir/yaml_formatter.cpp.o.d"
+  "/root/repo/yaml_formatter_factory.cpp" "CMakeFiles/chucho.dir/yaml_formatter_factory.cpp.o" "gcc" "CMakeFiles/chucho.dir/yaml_formatter_factory.cpp.o.d"
+  "/root/repo/yaml_parser.cpp" "CMakeFiles/chucho.dir/yaml_parser.cpp.o" "gcc" "CMakeFiles/chucho.dir/yaml_parser.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
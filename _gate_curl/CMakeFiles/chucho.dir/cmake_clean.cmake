@@ -0,0 +1,379 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chucho.dir/async_writer.cpp.o"
+  "CMakeFiles/chucho.dir/async_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/async_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/async_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/async_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/async_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/binary_file_reader.cpp.o"
+  "CMakeFiles/chucho.dir/binary_file_reader.cpp.o.d"
+  "CMakeFiles/chucho.dir/binary_file_writer.cpp.o"
+  "CMakeFiles/chucho.dir/binary_file_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/binary_file_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/binary_file_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/binary_file_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/binary_file_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/c_configuration.cpp.o"
+  "CMakeFiles/chucho.dir/c_configuration.cpp.o.d"
+  "CMakeFiles/chucho.dir/c_finalize.cpp.o"
+  "CMakeFiles/chucho.dir/c_finalize.cpp.o.d"
+  "CMakeFiles/chucho.dir/c_log.cpp.o"
+  "CMakeFiles/chucho.dir/c_log.cpp.o.d"
+  "CMakeFiles/chucho.dir/c_logger.cpp.o"
+  "CMakeFiles/chucho.dir/c_logger.cpp.o.d"
+  "CMakeFiles/chucho.dir/cache_and_release_filter.cpp.o"
+  "CMakeFiles/chucho.dir/cache_and_release_filter.cpp.o.d"
+  "CMakeFiles/chucho.dir/cache_and_release_filter_factory.cpp.o"
+  "CMakeFiles/chucho.dir/cache_and_release_filter_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/cache_and_release_filter_memento.cpp.o"
+  "CMakeFiles/chucho.dir/cache_and_release_filter_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/calendar.cpp.o"
+  "CMakeFiles/chucho.dir/calendar.cpp.o.d"
+  "CMakeFiles/chucho.dir/callsite.cpp.o"
+  "CMakeFiles/chucho.dir/callsite.cpp.o.d"
+  "CMakeFiles/chucho.dir/cerr_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/cerr_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/config_file_configurator.cpp.o"
+  "CMakeFiles/chucho.dir/config_file_configurator.cpp.o.d"
+  "CMakeFiles/chucho.dir/config_watcher.cpp.o"
+  "CMakeFiles/chucho.dir/config_watcher.cpp.o.d"
+  "CMakeFiles/chucho.dir/configurable.cpp.o"
+  "CMakeFiles/chucho.dir/configurable.cpp.o.d"
+  "CMakeFiles/chucho.dir/configurable_factory.cpp.o"
+  "CMakeFiles/chucho.dir/configurable_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/configuration.cpp.o"
+  "CMakeFiles/chucho.dir/configuration.cpp.o.d"
+  "CMakeFiles/chucho.dir/configurator.cpp.o"
+  "CMakeFiles/chucho.dir/configurator.cpp.o.d"
+  "CMakeFiles/chucho.dir/cout_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/cout_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/curl.cpp.o"
+  "CMakeFiles/chucho.dir/curl.cpp.o.d"
+  "CMakeFiles/chucho.dir/demangle.cpp.o"
+  "CMakeFiles/chucho.dir/demangle.cpp.o.d"
+  "CMakeFiles/chucho.dir/diagnostic_context.cpp.o"
+  "CMakeFiles/chucho.dir/diagnostic_context.cpp.o.d"
+  "CMakeFiles/chucho.dir/duplicate_message_filter.cpp.o"
+  "CMakeFiles/chucho.dir/duplicate_message_filter.cpp.o.d"
+  "CMakeFiles/chucho.dir/duplicate_message_filter_factory.cpp.o"
+  "CMakeFiles/chucho.dir/duplicate_message_filter_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/duplicate_message_filter_memento.cpp.o"
+  "CMakeFiles/chucho.dir/duplicate_message_filter_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/email_writer.cpp.o"
+  "CMakeFiles/chucho.dir/email_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/email_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/email_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/email_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/email_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/embedded/cJSON/cJSON.c.o"
+  "CMakeFiles/chucho.dir/embedded/cJSON/cJSON.c.o.d"
+  "CMakeFiles/chucho.dir/embedded/fnv/hash_64a.c.o"
+  "CMakeFiles/chucho.dir/embedded/fnv/hash_64a.c.o.d"
+  "CMakeFiles/chucho.dir/embedded/libyaml/api.c.o"
+  "CMakeFiles/chucho.dir/embedded/libyaml/api.c.o.d"
+  "CMakeFiles/chucho.dir/embedded/libyaml/dumper.c.o"
+  "CMakeFiles/chucho.dir/embedded/libyaml/dumper.c.o.d"
+  "CMakeFiles/chucho.dir/embedded/libyaml/emitter.c.o"
+  "CMakeFiles/chucho.dir/embedded/libyaml/emitter.c.o.d"
+  "CMakeFiles/chucho.dir/embedded/libyaml/loader.c.o"
+  "CMakeFiles/chucho.dir/embedded/libyaml/loader.c.o.d"
+  "CMakeFiles/chucho.dir/embedded/libyaml/parser.c.o"
+  "CMakeFiles/chucho.dir/embedded/libyaml/parser.c.o.d"
+  "CMakeFiles/chucho.dir/embedded/libyaml/reader.c.o"
+  "CMakeFiles/chucho.dir/embedded/libyaml/reader.c.o.d"
+  "CMakeFiles/chucho.dir/embedded/libyaml/scanner.c.o"
+  "CMakeFiles/chucho.dir/embedded/libyaml/scanner.c.o.d"
+  "CMakeFiles/chucho.dir/embedded/libyaml/writer.c.o"
+  "CMakeFiles/chucho.dir/embedded/libyaml/writer.c.o.d"
+  "CMakeFiles/chucho.dir/event.cpp.o"
+  "CMakeFiles/chucho.dir/event.cpp.o.d"
+  "CMakeFiles/chucho.dir/event_cache.cpp.o"
+  "CMakeFiles/chucho.dir/event_cache.cpp.o.d"
+  "CMakeFiles/chucho.dir/event_cache_provider.cpp.o"
+  "CMakeFiles/chucho.dir/event_cache_provider.cpp.o.d"
+  "CMakeFiles/chucho.dir/exception.cpp.o"
+  "CMakeFiles/chucho.dir/exception.cpp.o.d"
+  "CMakeFiles/chucho.dir/expression_filter.cpp.o"
+  "CMakeFiles/chucho.dir/expression_filter.cpp.o.d"
+  "CMakeFiles/chucho.dir/expression_filter_factory.cpp.o"
+  "CMakeFiles/chucho.dir/expression_filter_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/expression_filter_memento.cpp.o"
+  "CMakeFiles/chucho.dir/expression_filter_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_compressor.cpp.o"
+  "CMakeFiles/chucho.dir/file_compressor.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_compressor_factory.cpp.o"
+  "CMakeFiles/chucho.dir/file_compressor_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_compressor_memento.cpp.o"
+  "CMakeFiles/chucho.dir/file_compressor_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_descriptor_writer.cpp.o"
+  "CMakeFiles/chucho.dir/file_descriptor_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_exception.cpp.o"
+  "CMakeFiles/chucho.dir/file_exception.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_roller.cpp.o"
+  "CMakeFiles/chucho.dir/file_roller.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_roller_memento.cpp.o"
+  "CMakeFiles/chucho.dir/file_roller_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_writer.cpp.o"
+  "CMakeFiles/chucho.dir/file_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/file_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/file_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/file_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/filter_memento.cpp.o"
+  "CMakeFiles/chucho.dir/filter_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/finalize.cpp.o"
+  "CMakeFiles/chucho.dir/finalize.cpp.o.d"
+  "CMakeFiles/chucho.dir/format_memo.cpp.o"
+  "CMakeFiles/chucho.dir/format_memo.cpp.o.d"
+  "CMakeFiles/chucho.dir/formatted_message_serializer.cpp.o"
+  "CMakeFiles/chucho.dir/formatted_message_serializer.cpp.o.d"
+  "CMakeFiles/chucho.dir/formatted_message_serializer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/formatted_message_serializer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/garbage_cleaner.cpp.o"
+  "CMakeFiles/chucho.dir/garbage_cleaner.cpp.o.d"
+  "CMakeFiles/chucho.dir/host.cpp.o"
+  "CMakeFiles/chucho.dir/host.cpp.o.d"
+  "CMakeFiles/chucho.dir/http_bulk_sender.cpp.o"
+  "CMakeFiles/chucho.dir/http_bulk_sender.cpp.o.d"
+  "CMakeFiles/chucho.dir/interval_file_roll_trigger.cpp.o"
+  "CMakeFiles/chucho.dir/interval_file_roll_trigger.cpp.o.d"
+  "CMakeFiles/chucho.dir/interval_file_roll_trigger_factory.cpp.o"
+  "CMakeFiles/chucho.dir/interval_file_roll_trigger_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/interval_file_roll_trigger_memento.cpp.o"
+  "CMakeFiles/chucho.dir/interval_file_roll_trigger_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/io_uring_file_writer.cpp.o"
+  "CMakeFiles/chucho.dir/io_uring_file_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/io_uring_file_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/io_uring_file_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/io_uring_file_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/io_uring_file_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/json_configurator.cpp.o"
+  "CMakeFiles/chucho.dir/json_configurator.cpp.o.d"
+  "CMakeFiles/chucho.dir/json_formatter.cpp.o"
+  "CMakeFiles/chucho.dir/json_formatter.cpp.o.d"
+  "CMakeFiles/chucho.dir/json_formatter_factory.cpp.o"
+  "CMakeFiles/chucho.dir/json_formatter_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/level.cpp.o"
+  "CMakeFiles/chucho.dir/level.cpp.o.d"
+  "CMakeFiles/chucho.dir/level_filter.cpp.o"
+  "CMakeFiles/chucho.dir/level_filter.cpp.o.d"
+  "CMakeFiles/chucho.dir/level_filter_factory.cpp.o"
+  "CMakeFiles/chucho.dir/level_filter_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/level_filter_memento.cpp.o"
+  "CMakeFiles/chucho.dir/level_filter_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/level_threshold_email_trigger.cpp.o"
+  "CMakeFiles/chucho.dir/level_threshold_email_trigger.cpp.o.d"
+  "CMakeFiles/chucho.dir/level_threshold_email_trigger_factory.cpp.o"
+  "CMakeFiles/chucho.dir/level_threshold_email_trigger_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/level_threshold_email_trigger_memento.cpp.o"
+  "CMakeFiles/chucho.dir/level_threshold_email_trigger_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/level_threshold_filter.cpp.o"
+  "CMakeFiles/chucho.dir/level_threshold_filter.cpp.o.d"
+  "CMakeFiles/chucho.dir/level_threshold_filter_factory.cpp.o"
+  "CMakeFiles/chucho.dir/level_threshold_filter_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/level_threshold_filter_memento.cpp.o"
+  "CMakeFiles/chucho.dir/level_threshold_filter_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/log_stream.cpp.o"
+  "CMakeFiles/chucho.dir/log_stream.cpp.o.d"
+  "CMakeFiles/chucho.dir/log_streambuf.cpp.o"
+  "CMakeFiles/chucho.dir/log_streambuf.cpp.o.d"
+  "CMakeFiles/chucho.dir/logger.cpp.o"
+  "CMakeFiles/chucho.dir/logger.cpp.o.d"
+  "CMakeFiles/chucho.dir/logger_factory.cpp.o"
+  "CMakeFiles/chucho.dir/logger_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/logger_memento.cpp.o"
+  "CMakeFiles/chucho.dir/logger_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/loggly_writer.cpp.o"
+  "CMakeFiles/chucho.dir/loggly_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/loggly_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/loggly_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/loggly_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/loggly_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/marker.cpp.o"
+  "CMakeFiles/chucho.dir/marker.cpp.o.d"
+  "CMakeFiles/chucho.dir/memento.cpp.o"
+  "CMakeFiles/chucho.dir/memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/memento_key_set.cpp.o"
+  "CMakeFiles/chucho.dir/memento_key_set.cpp.o.d"
+  "CMakeFiles/chucho.dir/message_queue_writer.cpp.o"
+  "CMakeFiles/chucho.dir/message_queue_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/message_queue_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/message_queue_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/nameable_memento.cpp.o"
+  "CMakeFiles/chucho.dir/nameable_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/named_pipe_writer.cpp.o"
+  "CMakeFiles/chucho.dir/named_pipe_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/named_pipe_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/named_pipe_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/named_pipe_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/named_pipe_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/noop_compressor.cpp.o"
+  "CMakeFiles/chucho.dir/noop_compressor.cpp.o.d"
+  "CMakeFiles/chucho.dir/noop_compressor_factory.cpp.o"
+  "CMakeFiles/chucho.dir/noop_compressor_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/numbered_file_roller.cpp.o"
+  "CMakeFiles/chucho.dir/numbered_file_roller.cpp.o.d"
+  "CMakeFiles/chucho.dir/numbered_file_roller_factory.cpp.o"
+  "CMakeFiles/chucho.dir/numbered_file_roller_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/numbered_file_roller_memento.cpp.o"
+  "CMakeFiles/chucho.dir/numbered_file_roller_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/on_start_file_roll_trigger.cpp.o"
+  "CMakeFiles/chucho.dir/on_start_file_roll_trigger.cpp.o.d"
+  "CMakeFiles/chucho.dir/on_start_file_roll_trigger_factory.cpp.o"
+  "CMakeFiles/chucho.dir/on_start_file_roll_trigger_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/optional_features.cpp.o"
+  "CMakeFiles/chucho.dir/optional_features.cpp.o.d"
+  "CMakeFiles/chucho.dir/overload_governor.cpp.o"
+  "CMakeFiles/chucho.dir/overload_governor.cpp.o.d"
+  "CMakeFiles/chucho.dir/parallel_compressor.cpp.o"
+  "CMakeFiles/chucho.dir/parallel_compressor.cpp.o.d"
+  "CMakeFiles/chucho.dir/pattern_formatter.cpp.o"
+  "CMakeFiles/chucho.dir/pattern_formatter.cpp.o.d"
+  "CMakeFiles/chucho.dir/pattern_formatter_factory.cpp.o"
+  "CMakeFiles/chucho.dir/pattern_formatter_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/pattern_formatter_memento.cpp.o"
+  "CMakeFiles/chucho.dir/pattern_formatter_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/pipe_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/pipe_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/pipe_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/pipe_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/calendar_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/calendar_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/cerr_writer_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/cerr_writer_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/cout_writer_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/cout_writer_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/diagnostic_context_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/diagnostic_context_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/environment_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/environment_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/file_descriptor_writer_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/file_descriptor_writer_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/file_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/file_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/file_writer_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/file_writer_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/host_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/host_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/line_ending_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/line_ending_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/named_pipe_writer_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/named_pipe_writer_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/pipe_writer_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/pipe_writer_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/process_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/process_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/shm_ring_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/shm_ring_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/syslog_writer_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/syslog_writer_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/text_util_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/text_util_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/platform/posix/thread_util_posix.cpp.o"
+  "CMakeFiles/chucho.dir/platform/posix/thread_util_posix.cpp.o.d"
+  "CMakeFiles/chucho.dir/properties.cpp.o"
+  "CMakeFiles/chucho.dir/properties.cpp.o.d"
+  "CMakeFiles/chucho.dir/regex.cpp.o"
+  "CMakeFiles/chucho.dir/regex.cpp.o.d"
+  "CMakeFiles/chucho.dir/regex_exception.cpp.o"
+  "CMakeFiles/chucho.dir/regex_exception.cpp.o.d"
+  "CMakeFiles/chucho.dir/regex_filter.cpp.o"
+  "CMakeFiles/chucho.dir/regex_filter.cpp.o.d"
+  "CMakeFiles/chucho.dir/regex_filter_factory.cpp.o"
+  "CMakeFiles/chucho.dir/regex_filter_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/regex_filter_memento.cpp.o"
+  "CMakeFiles/chucho.dir/regex_filter_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/rolling_file_writer.cpp.o"
+  "CMakeFiles/chucho.dir/rolling_file_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/rolling_file_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/rolling_file_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/rolling_file_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/rolling_file_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/security_policy.cpp.o"
+  "CMakeFiles/chucho.dir/security_policy.cpp.o.d"
+  "CMakeFiles/chucho.dir/serialization_formatter.cpp.o"
+  "CMakeFiles/chucho.dir/serialization_formatter.cpp.o.d"
+  "CMakeFiles/chucho.dir/serialization_formatter_memento.cpp.o"
+  "CMakeFiles/chucho.dir/serialization_formatter_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/shm_ring.cpp.o"
+  "CMakeFiles/chucho.dir/shm_ring.cpp.o.d"
+  "CMakeFiles/chucho.dir/shm_ring_reader.cpp.o"
+  "CMakeFiles/chucho.dir/shm_ring_reader.cpp.o.d"
+  "CMakeFiles/chucho.dir/shm_ring_writer.cpp.o"
+  "CMakeFiles/chucho.dir/shm_ring_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/shm_ring_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/shm_ring_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/shm_ring_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/shm_ring_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/size_file_roll_trigger.cpp.o"
+  "CMakeFiles/chucho.dir/size_file_roll_trigger.cpp.o.d"
+  "CMakeFiles/chucho.dir/size_file_roll_trigger_factory.cpp.o"
+  "CMakeFiles/chucho.dir/size_file_roll_trigger_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/size_file_roll_trigger_memento.cpp.o"
+  "CMakeFiles/chucho.dir/size_file_roll_trigger_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/sliding_numbered_file_roller.cpp.o"
+  "CMakeFiles/chucho.dir/sliding_numbered_file_roller.cpp.o.d"
+  "CMakeFiles/chucho.dir/sliding_numbered_file_roller_factory.cpp.o"
+  "CMakeFiles/chucho.dir/sliding_numbered_file_roller_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/sliding_numbered_file_roller_memento.cpp.o"
+  "CMakeFiles/chucho.dir/sliding_numbered_file_roller_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/staged_configurator.cpp.o"
+  "CMakeFiles/chucho.dir/staged_configurator.cpp.o.d"
+  "CMakeFiles/chucho.dir/status.cpp.o"
+  "CMakeFiles/chucho.dir/status.cpp.o.d"
+  "CMakeFiles/chucho.dir/status_manager.cpp.o"
+  "CMakeFiles/chucho.dir/status_manager.cpp.o.d"
+  "CMakeFiles/chucho.dir/status_observer.cpp.o"
+  "CMakeFiles/chucho.dir/status_observer.cpp.o.d"
+  "CMakeFiles/chucho.dir/status_reporter.cpp.o"
+  "CMakeFiles/chucho.dir/status_reporter.cpp.o.d"
+  "CMakeFiles/chucho.dir/syslog_constants.cpp.o"
+  "CMakeFiles/chucho.dir/syslog_constants.cpp.o.d"
+  "CMakeFiles/chucho.dir/syslog_message_builder.cpp.o"
+  "CMakeFiles/chucho.dir/syslog_message_builder.cpp.o.d"
+  "CMakeFiles/chucho.dir/syslog_writer.cpp.o"
+  "CMakeFiles/chucho.dir/syslog_writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/syslog_writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/syslog_writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/syslog_writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/syslog_writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/text_util.cpp.o"
+  "CMakeFiles/chucho.dir/text_util.cpp.o.d"
+  "CMakeFiles/chucho.dir/thread_settings.cpp.o"
+  "CMakeFiles/chucho.dir/thread_settings.cpp.o.d"
+  "CMakeFiles/chucho.dir/thread_util.cpp.o"
+  "CMakeFiles/chucho.dir/thread_util.cpp.o.d"
+  "CMakeFiles/chucho.dir/time_file_roller.cpp.o"
+  "CMakeFiles/chucho.dir/time_file_roller.cpp.o.d"
+  "CMakeFiles/chucho.dir/time_file_roller_factory.cpp.o"
+  "CMakeFiles/chucho.dir/time_file_roller_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/time_file_roller_memento.cpp.o"
+  "CMakeFiles/chucho.dir/time_file_roller_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/time_util.cpp.o"
+  "CMakeFiles/chucho.dir/time_util.cpp.o.d"
+  "CMakeFiles/chucho.dir/uring.cpp.o"
+  "CMakeFiles/chucho.dir/uring.cpp.o.d"
+  "CMakeFiles/chucho.dir/utf8.cpp.o"
+  "CMakeFiles/chucho.dir/utf8.cpp.o.d"
+  "CMakeFiles/chucho.dir/writer.cpp.o"
+  "CMakeFiles/chucho.dir/writer.cpp.o.d"
+  "CMakeFiles/chucho.dir/writer_factory.cpp.o"
+  "CMakeFiles/chucho.dir/writer_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/writer_memento.cpp.o"
+  "CMakeFiles/chucho.dir/writer_memento.cpp.o.d"
+  "CMakeFiles/chucho.dir/yaml_configurator.cpp.o"
+  "CMakeFiles/chucho.dir/yaml_configurator.cpp.o.d"
+  "CMakeFiles/chucho.dir/yaml_formatter.cpp.o"
+  "CMakeFiles/chucho.dir/yaml_formatter.cpp.o.d"
+  "CMakeFiles/chucho.dir/yaml_formatter_factory.cpp.o"
+  "CMakeFiles/chucho.dir/yaml_formatter_factory.cpp.o.d"
+  "CMakeFiles/chucho.dir/yaml_parser.cpp.o"
+  "CMakeFiles/chucho.dir/yaml_parser.cpp.o.d"
+  "libchucho.a"
+  "libchucho.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/chucho.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
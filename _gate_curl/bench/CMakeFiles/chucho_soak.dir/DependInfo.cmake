@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/histogram.cpp" "bench/CMakeFiles/chucho_soak.dir/histogram.cpp.o" "gcc" "bench/CMakeFiles/chucho_soak.dir/histogram.cpp.o.d"
+  "/root/repo/bench/soak.cpp" "bench/CMakeFiles/chucho_soak.dir/soak.cpp.o" "gcc" "bench/CMakeFiles/chucho_soak.dir/soak.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_curl/CMakeFiles/chucho.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
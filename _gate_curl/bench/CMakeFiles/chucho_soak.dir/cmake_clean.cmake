@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chucho_soak.dir/histogram.cpp.o"
+  "CMakeFiles/chucho_soak.dir/histogram.cpp.o.d"
+  "CMakeFiles/chucho_soak.dir/soak.cpp.o"
+  "CMakeFiles/chucho_soak.dir/soak.cpp.o.d"
+  "chucho_soak"
+  "chucho_soak.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chucho_soak.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_VERSION_HPP_)
+#define CHUCHO_VERSION_HPP_
+
+#if defined(major)
+#undef major
+#endif
+
+#if defined(minor)
+#undef minor
+#endif
+
+/**
+ * @file 
+ * Chucho's version functions
+ * @ingroup miscellaneous
+ */
+
+namespace chucho
+{
+
+/**
+ * The Chucho version namespace
+ */
+namespace version
+{
+
+/**
+ * The major version of Chucho in <chucho/version.hpp>.
+ * @ingroup miscellaneous
+ * @return the major version
+ */
+constexpr int major() { return 2; }
+/**
+ * The minor version of Chucho in <chucho/version.hpp>.
+ * @ingroup miscellaneous
+ * @return the minor version
+ */
+constexpr int minor() { return 8; }
+/**
+ * A textual representation of Chucho's version, like "1.3" in 
+ * <chucho/version.hpp>. 
+ * @ingroup miscellaneous
+ * @return a textual representation of Chucho's version
+ */
+constexpr const char* text() { return "2.8"; }
+
+}
+
+}
+
+#endif
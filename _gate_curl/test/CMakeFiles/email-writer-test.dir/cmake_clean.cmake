@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/email-writer-test.dir/email_writer_test.cpp.o"
+  "CMakeFiles/email-writer-test.dir/email_writer_test.cpp.o.d"
+  "CMakeFiles/email-writer-test.dir/harness.cpp.o"
+  "CMakeFiles/email-writer-test.dir/harness.cpp.o.d"
+  "email-writer-test"
+  "email-writer-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/email-writer-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/syslog-writer-test.dir/harness.cpp.o"
+  "CMakeFiles/syslog-writer-test.dir/harness.cpp.o.d"
+  "CMakeFiles/syslog-writer-test.dir/syslog_writer_test.cpp.o"
+  "CMakeFiles/syslog-writer-test.dir/syslog_writer_test.cpp.o.d"
+  "syslog-writer-test"
+  "syslog-writer-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/syslog-writer-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
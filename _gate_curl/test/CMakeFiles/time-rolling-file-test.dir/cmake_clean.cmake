@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/time-rolling-file-test.dir/harness.cpp.o"
+  "CMakeFiles/time-rolling-file-test.dir/harness.cpp.o.d"
+  "CMakeFiles/time-rolling-file-test.dir/time_rolling_file_test.cpp.o"
+  "CMakeFiles/time-rolling-file-test.dir/time_rolling_file_test.cpp.o.d"
+  "time-rolling-file-test"
+  "time-rolling-file-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/time-rolling-file-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
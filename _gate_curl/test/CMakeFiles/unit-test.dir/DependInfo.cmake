@@ -0,0 +1,74 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/async_writer_test.cpp" "test/CMakeFiles/unit-test.dir/async_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/async_writer_test.cpp.o.d"
+  "/root/repo/test/binary_file_writer_test.cpp" "test/CMakeFiles/unit-test.dir/binary_file_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/binary_file_writer_test.cpp.o.d"
+  "/root/repo/test/c_test.cpp" "test/CMakeFiles/unit-test.dir/c_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/c_test.cpp.o.d"
+  "/root/repo/test/cache_and_release_filter_test.cpp" "test/CMakeFiles/unit-test.dir/cache_and_release_filter_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/cache_and_release_filter_test.cpp.o.d"
+  "/root/repo/test/calendar_test.cpp" "test/CMakeFiles/unit-test.dir/calendar_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/calendar_test.cpp.o.d"
+  "/root/repo/test/callsite_test.cpp" "test/CMakeFiles/unit-test.dir/callsite_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/callsite_test.cpp.o.d"
+  "/root/repo/test/chucho_config_file_configurator_test.cpp" "test/CMakeFiles/unit-test.dir/chucho_config_file_configurator_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/chucho_config_file_configurator_test.cpp.o.d"
+  "/root/repo/test/compiled_level_test.cpp" "test/CMakeFiles/unit-test.dir/compiled_level_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/compiled_level_test.cpp.o.d"
+  "/root/repo/test/configuration_test.cpp" "test/CMakeFiles/unit-test.dir/configuration_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/configuration_test.cpp.o.d"
+  "/root/repo/test/configurator_test.cpp" "test/CMakeFiles/unit-test.dir/configurator_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/configurator_test.cpp.o.d"
+  "/root/repo/test/diagnostic_context_test.cpp" "test/CMakeFiles/unit-test.dir/diagnostic_context_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/diagnostic_context_test.cpp.o.d"
+  "/root/repo/test/duplicate_message_filter_test.cpp" "test/CMakeFiles/unit-test.dir/duplicate_message_filter_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/duplicate_message_filter_test.cpp.o.d"
+  "/root/repo/test/event_cache_test.cpp" "test/CMakeFiles/unit-test.dir/event_cache_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/event_cache_test.cpp.o.d"
+  "/root/repo/test/expression_filter_test.cpp" "test/CMakeFiles/unit-test.dir/expression_filter_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/expression_filter_test.cpp.o.d"
+  "/root/repo/test/file_descriptor_writer_test.cpp" "test/CMakeFiles/unit-test.dir/file_descriptor_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/file_descriptor_writer_test.cpp.o.d"
+  "/root/repo/test/file_test.cpp" "test/CMakeFiles/unit-test.dir/file_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/file_test.cpp.o.d"
+  "/root/repo/test/file_writer_test.cpp" "test/CMakeFiles/unit-test.dir/file_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/file_writer_test.cpp.o.d"
+  "/root/repo/test/formatted_message_serializer_test.cpp" "test/CMakeFiles/unit-test.dir/formatted_message_serializer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/formatted_message_serializer_test.cpp.o.d"
+  "/root/repo/test/harness.cpp" "test/CMakeFiles/unit-test.dir/harness.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/harness.cpp.o.d"
+  "/root/repo/test/interval_file_roll_trigger_test.cpp" "test/CMakeFiles/unit-test.dir/interval_file_roll_trigger_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/interval_file_roll_trigger_test.cpp.o.d"
+  "/root/repo/test/io_uring_file_writer_test.cpp" "test/CMakeFiles/unit-test.dir/io_uring_file_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/io_uring_file_writer_test.cpp.o.d"
+  "/root/repo/test/json_configurator_test.cpp" "test/CMakeFiles/unit-test.dir/json_configurator_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/json_configurator_test.cpp.o.d"
+  "/root/repo/test/json_formatter_test.cpp" "test/CMakeFiles/unit-test.dir/json_formatter_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/json_formatter_test.cpp.o.d"
+  "/root/repo/test/level_filter_test.cpp" "test/CMakeFiles/unit-test.dir/level_filter_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/level_filter_test.cpp.o.d"
+  "/root/repo/test/level_test.cpp" "test/CMakeFiles/unit-test.dir/level_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/level_test.cpp.o.d"
+  "/root/repo/test/level_threshold_filter_test.cpp" "test/CMakeFiles/unit-test.dir/level_threshold_filter_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/level_threshold_filter_test.cpp.o.d"
+  "/root/repo/test/log4cplus_config_file_configurator_test.cpp" "test/CMakeFiles/unit-test.dir/log4cplus_config_file_configurator_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/log4cplus_config_file_configurator_test.cpp.o.d"
+  "/root/repo/test/log_macro_test.cpp" "test/CMakeFiles/unit-test.dir/log_macro_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/log_macro_test.cpp.o.d"
+  "/root/repo/test/log_stream_test.cpp" "test/CMakeFiles/unit-test.dir/log_stream_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/log_stream_test.cpp.o.d"
+  "/root/repo/test/loggable_test.cpp" "test/CMakeFiles/unit-test.dir/loggable_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/loggable_test.cpp.o.d"
+  "/root/repo/test/logger_test.cpp" "test/CMakeFiles/unit-test.dir/logger_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/logger_test.cpp.o.d"
+  "/root/repo/test/loggly_writer_test.cpp" "test/CMakeFiles/unit-test.dir/loggly_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/loggly_writer_test.cpp.o.d"
+  "/root/repo/test/marker_test.cpp" "test/CMakeFiles/unit-test.dir/marker_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/marker_test.cpp.o.d"
+  "/root/repo/test/multithread_test.cpp" "test/CMakeFiles/unit-test.dir/multithread_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/multithread_test.cpp.o.d"
+  "/root/repo/test/named_pipe_writer_test.cpp" "test/CMakeFiles/unit-test.dir/named_pipe_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/named_pipe_writer_test.cpp.o.d"
+  "/root/repo/test/noop_compressor_test.cpp" "test/CMakeFiles/unit-test.dir/noop_compressor_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/noop_compressor_test.cpp.o.d"
+  "/root/repo/test/on_start_file_roll_trigger_test.cpp" "test/CMakeFiles/unit-test.dir/on_start_file_roll_trigger_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/on_start_file_roll_trigger_test.cpp.o.d"
+  "/root/repo/test/optional_features_test.cpp" "test/CMakeFiles/unit-test.dir/optional_features_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/optional_features_test.cpp.o.d"
+  "/root/repo/test/optional_test.cpp" "test/CMakeFiles/unit-test.dir/optional_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/optional_test.cpp.o.d"
+  "/root/repo/test/overload_governor_test.cpp" "test/CMakeFiles/unit-test.dir/overload_governor_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/overload_governor_test.cpp.o.d"
+  "/root/repo/test/pattern_formatter_test.cpp" "test/CMakeFiles/unit-test.dir/pattern_formatter_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/pattern_formatter_test.cpp.o.d"
+  "/root/repo/test/pipe_writer_test.cpp" "test/CMakeFiles/unit-test.dir/pipe_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/pipe_writer_test.cpp.o.d"
+  "/root/repo/test/properties_test.cpp" "test/CMakeFiles/unit-test.dir/properties_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/properties_test.cpp.o.d"
+  "/root/repo/test/regex_filter_test.cpp" "test/CMakeFiles/unit-test.dir/regex_filter_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/regex_filter_test.cpp.o.d"
+  "/root/repo/test/regex_test.cpp" "test/CMakeFiles/unit-test.dir/regex_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/regex_test.cpp.o.d"
+  "/root/repo/test/rolling_file_writer_test.cpp" "test/CMakeFiles/unit-test.dir/rolling_file_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/rolling_file_writer_test.cpp.o.d"
+  "/root/repo/test/security_policy_test.cpp" "test/CMakeFiles/unit-test.dir/security_policy_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/security_policy_test.cpp.o.d"
+  "/root/repo/test/shm_ring_writer_test.cpp" "test/CMakeFiles/unit-test.dir/shm_ring_writer_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/shm_ring_writer_test.cpp.o.d"
+  "/root/repo/test/size_file_roll_trigger_test.cpp" "test/CMakeFiles/unit-test.dir/size_file_roll_trigger_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/size_file_roll_trigger_test.cpp.o.d"
+  "/root/repo/test/streamable_test.cpp" "test/CMakeFiles/unit-test.dir/streamable_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/streamable_test.cpp.o.d"
+  "/root/repo/test/text_util_test.cpp" "test/CMakeFiles/unit-test.dir/text_util_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/text_util_test.cpp.o.d"
+  "/root/repo/test/thread_settings_test.cpp" "test/CMakeFiles/unit-test.dir/thread_settings_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/thread_settings_test.cpp.o.d"
+  "/root/repo/test/utf8_test.cpp" "test/CMakeFiles/unit-test.dir/utf8_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/utf8_test.cpp.o.d"
+  "/root/repo/test/yaml_configurator_test.cpp" "test/CMakeFiles/unit-test.dir/yaml_configurator_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/yaml_configurator_test.cpp.o.d"
+  "/root/repo/test/yaml_formatter_test.cpp" "test/CMakeFiles/unit-test.dir/yaml_formatter_test.cpp.o" "gcc" "test/CMakeFiles/unit-test.dir/yaml_formatter_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_curl/CMakeFiles/chucho.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,119 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test.dir/async_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/async_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/binary_file_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/binary_file_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/c_test.cpp.o"
+  "CMakeFiles/unit-test.dir/c_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/cache_and_release_filter_test.cpp.o"
+  "CMakeFiles/unit-test.dir/cache_and_release_filter_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/calendar_test.cpp.o"
+  "CMakeFiles/unit-test.dir/calendar_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/callsite_test.cpp.o"
+  "CMakeFiles/unit-test.dir/callsite_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/chucho_config_file_configurator_test.cpp.o"
+  "CMakeFiles/unit-test.dir/chucho_config_file_configurator_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/compiled_level_test.cpp.o"
+  "CMakeFiles/unit-test.dir/compiled_level_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/configuration_test.cpp.o"
+  "CMakeFiles/unit-test.dir/configuration_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/configurator_test.cpp.o"
+  "CMakeFiles/unit-test.dir/configurator_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/diagnostic_context_test.cpp.o"
+  "CMakeFiles/unit-test.dir/diagnostic_context_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/duplicate_message_filter_test.cpp.o"
+  "CMakeFiles/unit-test.dir/duplicate_message_filter_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/event_cache_test.cpp.o"
+  "CMakeFiles/unit-test.dir/event_cache_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/expression_filter_test.cpp.o"
+  "CMakeFiles/unit-test.dir/expression_filter_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/file_descriptor_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/file_descriptor_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/file_test.cpp.o"
+  "CMakeFiles/unit-test.dir/file_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/file_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/file_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/formatted_message_serializer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/formatted_message_serializer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/harness.cpp.o"
+  "CMakeFiles/unit-test.dir/harness.cpp.o.d"
+  "CMakeFiles/unit-test.dir/interval_file_roll_trigger_test.cpp.o"
+  "CMakeFiles/unit-test.dir/interval_file_roll_trigger_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/io_uring_file_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/io_uring_file_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/json_configurator_test.cpp.o"
+  "CMakeFiles/unit-test.dir/json_configurator_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/json_formatter_test.cpp.o"
+  "CMakeFiles/unit-test.dir/json_formatter_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/level_filter_test.cpp.o"
+  "CMakeFiles/unit-test.dir/level_filter_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/level_test.cpp.o"
+  "CMakeFiles/unit-test.dir/level_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/level_threshold_filter_test.cpp.o"
+  "CMakeFiles/unit-test.dir/level_threshold_filter_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/log4cplus_config_file_configurator_test.cpp.o"
+  "CMakeFiles/unit-test.dir/log4cplus_config_file_configurator_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/log_macro_test.cpp.o"
+  "CMakeFiles/unit-test.dir/log_macro_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/log_stream_test.cpp.o"
+  "CMakeFiles/unit-test.dir/log_stream_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/loggable_test.cpp.o"
+  "CMakeFiles/unit-test.dir/loggable_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/logger_test.cpp.o"
+  "CMakeFiles/unit-test.dir/logger_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/loggly_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/loggly_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/marker_test.cpp.o"
+  "CMakeFiles/unit-test.dir/marker_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/multithread_test.cpp.o"
+  "CMakeFiles/unit-test.dir/multithread_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/named_pipe_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/named_pipe_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/noop_compressor_test.cpp.o"
+  "CMakeFiles/unit-test.dir/noop_compressor_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/on_start_file_roll_trigger_test.cpp.o"
+  "CMakeFiles/unit-test.dir/on_start_file_roll_trigger_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/optional_features_test.cpp.o"
+  "CMakeFiles/unit-test.dir/optional_features_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/optional_test.cpp.o"
+  "CMakeFiles/unit-test.dir/optional_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/overload_governor_test.cpp.o"
+  "CMakeFiles/unit-test.dir/overload_governor_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/pattern_formatter_test.cpp.o"
+  "CMakeFiles/unit-test.dir/pattern_formatter_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/pipe_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/pipe_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/properties_test.cpp.o"
+  "CMakeFiles/unit-test.dir/properties_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/regex_filter_test.cpp.o"
+  "CMakeFiles/unit-test.dir/regex_filter_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/regex_test.cpp.o"
+  "CMakeFiles/unit-test.dir/regex_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/rolling_file_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/rolling_file_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/security_policy_test.cpp.o"
+  "CMakeFiles/unit-test.dir/security_policy_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/shm_ring_writer_test.cpp.o"
+  "CMakeFiles/unit-test.dir/shm_ring_writer_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/size_file_roll_trigger_test.cpp.o"
+  "CMakeFiles/unit-test.dir/size_file_roll_trigger_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/streamable_test.cpp.o"
+  "CMakeFiles/unit-test.dir/streamable_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/text_util_test.cpp.o"
+  "CMakeFiles/unit-test.dir/text_util_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/thread_settings_test.cpp.o"
+  "CMakeFiles/unit-test.dir/thread_settings_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/utf8_test.cpp.o"
+  "CMakeFiles/unit-test.dir/utf8_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/yaml_configurator_test.cpp.o"
+  "CMakeFiles/unit-test.dir/yaml_configurator_test.cpp.o.d"
+  "CMakeFiles/unit-test.dir/yaml_formatter_test.cpp.o"
+  "CMakeFiles/unit-test.dir/yaml_formatter_test.cpp.o.d"
+  "unit-test"
+  "unit-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chucho-decode.dir/chucho_decode.cpp.o"
+  "CMakeFiles/chucho-decode.dir/chucho_decode.cpp.o.d"
+  "chucho-decode"
+  "chucho-decode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chucho-decode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chucho-shm-tail.dir/chucho_shm_tail.cpp.o"
+  "CMakeFiles/chucho-shm-tail.dir/chucho_shm_tail.cpp.o.d"
+  "chucho-shm-tail"
+  "chucho-shm-tail.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chucho-shm-tail.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
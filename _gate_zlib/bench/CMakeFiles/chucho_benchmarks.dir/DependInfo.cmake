@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/async_writer_benchmark.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/async_writer_benchmark.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/async_writer_benchmark.cpp.o.d"
+  "/root/repo/bench/benchmark_util.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/benchmark_util.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/benchmark_util.cpp.o.d"
+  "/root/repo/bench/compressor_benchmark.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/compressor_benchmark.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/compressor_benchmark.cpp.o.d"
+  "/root/repo/bench/event_cache_benchmark.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/event_cache_benchmark.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/event_cache_benchmark.cpp.o.d"
+  "/root/repo/bench/file_writer_benchmark.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/file_writer_benchmark.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/file_writer_benchmark.cpp.o.d"
+  "/root/repo/bench/formatter_benchmark.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/formatter_benchmark.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/formatter_benchmark.cpp.o.d"
+  "/root/repo/bench/log_benchmark.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/log_benchmark.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/log_benchmark.cpp.o.d"
+  "/root/repo/bench/main.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/main.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/main.cpp.o.d"
+  "/root/repo/bench/regex_benchmark.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/regex_benchmark.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/regex_benchmark.cpp.o.d"
+  "/root/repo/bench/serializer_benchmark.cpp" "bench/CMakeFiles/chucho_benchmarks.dir/serializer_benchmark.cpp.o" "gcc" "bench/CMakeFiles/chucho_benchmarks.dir/serializer_benchmark.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_zlib/CMakeFiles/chucho.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chucho_benchmarks.dir/async_writer_benchmark.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/async_writer_benchmark.cpp.o.d"
+  "CMakeFiles/chucho_benchmarks.dir/benchmark_util.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/benchmark_util.cpp.o.d"
+  "CMakeFiles/chucho_benchmarks.dir/compressor_benchmark.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/compressor_benchmark.cpp.o.d"
+  "CMakeFiles/chucho_benchmarks.dir/event_cache_benchmark.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/event_cache_benchmark.cpp.o.d"
+  "CMakeFiles/chucho_benchmarks.dir/file_writer_benchmark.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/file_writer_benchmark.cpp.o.d"
+  "CMakeFiles/chucho_benchmarks.dir/formatter_benchmark.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/formatter_benchmark.cpp.o.d"
+  "CMakeFiles/chucho_benchmarks.dir/log_benchmark.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/log_benchmark.cpp.o.d"
+  "CMakeFiles/chucho_benchmarks.dir/main.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/main.cpp.o.d"
+  "CMakeFiles/chucho_benchmarks.dir/regex_benchmark.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/regex_benchmark.cpp.o.d"
+  "CMakeFiles/chucho_benchmarks.dir/serializer_benchmark.cpp.o"
+  "CMakeFiles/chucho_benchmarks.dir/serializer_benchmark.cpp.o.d"
+  "chucho_benchmarks"
+  "chucho_benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chucho_benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,465 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_LOG_H_)
+#define CHUCHO_LOG_H_
+
+#if !defined(CHUCHO_BUILD) && defined(__cplusplus)
+#error "When using C++, you want the header log.hpp"
+#endif
+
+#include <chucho/compiled_level.h>
+#include <chucho/logger.h>
+
+/**
+ * @file 
+ * Logging macros functions that use the Chucho C API. These 
+ * macros handle the machinery of filtering messages by level 
+ * and adding markers.
+ *
+ * @note If your compiler supports the @c _Generic keyword, then you may
+ * use these macros with either a @ref chucho_logger_t* or a
+ * const char* for the lgr parameter. If your compiler does not
+ * support @c _Generic, then you may only use const char* for the
+ * lgr parameter.
+ *
+ * @note Statements below @ref CHUCHO_MIN_COMPILED_LEVEL are removed
+ * at compile time. See compiled_level.h for details.
+ *  
+ * @ingroup c_loggers 
+ */
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#if !defined(CHUCHO_DONT_DOCUMENT)
+
+#if !defined(CHUCHO_FUNCTION_NAME) && (defined(__GNUC__) || defined(__clang__) || defined(__SUNPRO_C))
+#define CHUCHO_FUNCTION_NAME __PRETTY_FUNCTION__
+#else
+#define CHUCHO_FUNCTION_NAME __FUNCTION__
+#endif
+
+/* This is defined at Chucho compile time. */
+#define CHUCHO_HAVE_C_GENERIC
+
+#if defined(CHUCHO_HAVE_C_GENERIC)
+#define CHUCHO_C_INTERNAL(lvl, lgr, fl, ln, fnc, ...) \
+    _Generic((lgr), chucho_logger_t*: chucho_log_logger, default: chucho_log) \
+    ((lvl), (lgr), (fl), (ln), (fnc), __VA_ARGS__)
+#define CHUCHO_C_INTERNAL_M(lvl, lgr, fl, ln, fnc, mrk, ...) \
+    _Generic((lgr), chucho_logger_t*: chucho_log_mark_logger, default: chucho_log_mark) \
+    ((lvl), (lgr), (fl), (ln), (fnc), (mrk), __VA_ARGS__)
+#else
+#define CHUCHO_C_INTERNAL(lvl, lgr, fl, ln, fnc, ...) \
+    chucho_log((lvl), (lgr), (fl), (ln), (fnc), __VA_ARGS__)
+#define CHUCHO_C_INTERNAL_M(lvl, lgr, fl, ln, fnc, mrk, ...) \
+    chucho_log_mark((lvl), (lgr), (fl), (ln), (fnc), (mrk), __VA_ARGS__)
+#endif
+
+/* A statement that is compiled out still has its call type-checked,
+ * but the call is in a branch that the compiler discards. */
+#define CHUCHO_C_KEEP(...) __VA_ARGS__
+#define CHUCHO_C_DISCARD(...) (0 ? (__VA_ARGS__) : (void)0)
+
+#define CHUCHO_C_EVERY_N_INTERNAL(n, ...) \
+    do \
+    { \
+        static size_t __chucho_every_n_counter = 0; \
+        if (++__chucho_every_n_counter > (n)) \
+            __chucho_every_n_counter -= (n); \
+        if (__chucho_every_n_counter == 1) \
+            __VA_ARGS__ ; \
+    } while (false)
+
+#endif
+
+/**
+ * Log an event. 
+ *  
+ * @note This function is used by the C logging macros. You 
+ *       probably don't need to call it yourself.
+ * 
+ * @param[in] lvl the level
+ * @param[in] lgr the logger
+ * @param[in] file the file name
+ * @param[in] line the line number
+ * @param[in] func the function name
+ * @param[in] format the printf-style format
+ * @param[in] ... any printf-style format parameters
+ */
+CHUCHO_EXPORT void chucho_log(chucho_level_t lvl,
+                              const char* const lgr,
+                              const char* const file,
+                              int line,
+                              const char* const func,
+                              const char* const format, ...);
+
+/**
+ * Log an event with a marker.
+ *  
+ * @note This function is used by the C logging macros. You 
+ *       probably don't need to call it yourself.
+ * 
+ * @param[in] lvl the level
+ * @param[in] lgr the logger
+ * @param[in] file the file name
+ * @param[in] line the line number
+ * @param[in] func the function name
+ * @param[in] mark the marker
+ * @param[in] format the printf-style format
+ * @param[in] ... any printf-style format parameters
+ */
+CHUCHO_EXPORT void chucho_log_mark(chucho_level_t lvl,
+                                   const char* const lgr,
+                                   const char* const file,
+                                   int line,
+                                   const char* const func,
+                                   const char* const mark,
+                                   const char* const format, ...);
+
+/**
+ * Log an event with a logger object.
+ *
+ * @note This function is used by the C logging macros. You
+ *       probably don't need to call it yourself.
+ *
+ * @param[in] lvl the level
+ * @param[in] lgr the logger
+ * @param[in] file the file name
+ * @param[in] line the line number
+ * @param[in] func the function name
+ * @param[in] format the printf-style format
+ * @param[in] ... any printf-style format parameters
+ */
+CHUCHO_EXPORT void chucho_log_logger(chucho_level_t lvl,
+                                     chucho_logger_t* lgr,
+                                     const char* const file,
+                                     int line,
+                                     const char* const func,
+                                     const char* const format, ...);
+
+/**
+ * Log an event with a marker using a logger object.
+ *
+ * @note This function is used by the C logging macros. You
+ *       probably don't need to call it yourself.
+ *
+ * @param[in] lvl the level
+ * @param[in] lgr the logger
+ * @param[in] file the file name
+ * @param[in] line the line number
+ * @param[in] func the function name
+ * @param[in] mark the marker
+ * @param[in] format the printf-style format
+ * @param[in] ... any printf-style format parameters
+ */
+CHUCHO_EXPORT void chucho_log_mark_logger(chucho_level_t lvl,
+                                          chucho_logger_t* lgr,
+                                          const char* const file,
+                                          int line,
+                                          const char* const func,
+                                          const char* const mark,
+                                          const char* const format, ...);
+
+/**
+ * @def CHUCHO_C_TRACE(lgr, ...) 
+ * Log a trace level message. 
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_TRACE(lgr, ...) CHUCHO_IF_COMPILED_TRACE_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL(CHUCHO_TRACE, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_TRACE_L(lgr, ...)
+ * Log a trace level message.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_TRACE_L(lgr, ...) CHUCHO_IF_COMPILED_TRACE_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_logger(CHUCHO_TRACE, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_TRACE_M(lgr, mrk, ...) 
+ * Log a trace level message with a marker.
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_TRACE_M(lgr, mrk, ...) CHUCHO_IF_COMPILED_TRACE_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL_M(CHUCHO_TRACE, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_TRACE_M_L(lgr, mrk, ...)
+ * Log a trace level message with a marker.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_TRACE_M_L(lgr, mrk, ...) CHUCHO_IF_COMPILED_TRACE_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_mark_logger(CHUCHO_TRACE, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_DEBUG(lgr, ...) 
+ * Log a debug level message. 
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_DEBUG(lgr, ...) CHUCHO_IF_COMPILED_DEBUG_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL(CHUCHO_DEBUG, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_DEBUG_L(lgr, ...)
+ * Log a debug level message.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_DEBUG_L(lgr, ...) CHUCHO_IF_COMPILED_DEBUG_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_logger(CHUCHO_DEBUG, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_DEBUG_M(lgr, mrk, ...) 
+ * Log a debug level message with a marker.
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_DEBUG_M(lgr, mrk, ...) CHUCHO_IF_COMPILED_DEBUG_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL_M(CHUCHO_DEBUG, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_DEBUG_M_L(lgr, mrk, ...)
+ * Log a debug level message with a marker.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_DEBUG_M_L(lgr, mrk, ...) CHUCHO_IF_COMPILED_DEBUG_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_mark_logger(CHUCHO_DEBUG, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_INFO(lgr, ...) 
+ * Log a info level message. 
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_INFO(lgr, ...) CHUCHO_IF_COMPILED_INFO_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL(CHUCHO_INFO, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_INFO_L(lgr, ...)
+ * Log a info level message.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_INFO_L(lgr, ...) CHUCHO_IF_COMPILED_INFO_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_logger(CHUCHO_INFO, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_INFO_M(lgr, mrk, ...) 
+ * Log a info level message with a marker.
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_INFO_M(lgr, mrk, ...) CHUCHO_IF_COMPILED_INFO_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL_M(CHUCHO_INFO, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_INFO_M_L(lgr, mrk, ...)
+ * Log a info level message with a marker.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_INFO_M_L(lgr, mrk, ...) CHUCHO_IF_COMPILED_INFO_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_mark_logger(CHUCHO_INFO, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_WARN(lgr, ...) 
+ * Log a warn level message. 
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_WARN(lgr, ...) CHUCHO_IF_COMPILED_WARN_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL(CHUCHO_WARN, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_WARN_L(lgr, ...)
+ * Log a warn level message.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_WARN_L(lgr, ...) CHUCHO_IF_COMPILED_WARN_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_logger(CHUCHO_WARN, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_WARN_M(lgr, mrk, ...) 
+ * Log a warn level message with a marker.
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_WARN_M(lgr, mrk, ...) CHUCHO_IF_COMPILED_WARN_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL_M(CHUCHO_WARN, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_WARN_M_L(lgr, mrk, ...)
+ * Log a warn level message with a marker.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_WARN_M_L(lgr, mrk, ...) CHUCHO_IF_COMPILED_WARN_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_mark_logger(CHUCHO_WARN, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_ERROR(lgr, ...) 
+ * Log a error level message. 
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_ERROR(lgr, ...) CHUCHO_IF_COMPILED_ERROR_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL(CHUCHO_ERROR, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_ERROR_L(lgr, ...)
+ * Log a error level message.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_ERROR_L(lgr, ...) CHUCHO_IF_COMPILED_ERROR_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_logger(CHUCHO_ERROR, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_ERROR_M(lgr, mrk, ...) 
+ * Log a error level message with a marker.
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_ERROR_M(lgr, mrk, ...) CHUCHO_IF_COMPILED_ERROR_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL_M(CHUCHO_ERROR, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_ERROR_M_L(lgr, mrk, ...)
+ * Log a error level message with a marker.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_ERROR_M_L(lgr, mrk, ...) CHUCHO_IF_COMPILED_ERROR_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_mark_logger(CHUCHO_ERROR, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_FATAL(lgr, ...) 
+ * Log a fatal level message. 
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_FATAL(lgr, ...) CHUCHO_IF_COMPILED_FATAL_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL(CHUCHO_FATAL, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_FATAL_L(lgr, ...)
+ * Log a fatal level message.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_FATAL_L(lgr, ...) CHUCHO_IF_COMPILED_FATAL_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_logger(CHUCHO_FATAL, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_FATAL_M(lgr, mrk, ...) 
+ * Log a fatal level message with a marker.
+ *  
+ * @param lgr the logger, which can either be a char* or a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_FATAL_M(lgr, mrk, ...) CHUCHO_IF_COMPILED_FATAL_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(CHUCHO_C_INTERNAL_M(CHUCHO_FATAL, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_FATAL_M_L(lgr, mrk, ...)
+ * Log a fatal level message with a marker.
+ *
+ * @param lgr the logger, which must be a chucho_logger_t*
+ * @param mrk the marker, which must be of type char*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_FATAL_M_L(lgr, mrk, ...) CHUCHO_IF_COMPILED_FATAL_(CHUCHO_C_KEEP, CHUCHO_C_DISCARD)(chucho_log_mark_logger(CHUCHO_FATAL, (lgr), __FILE__, __LINE__, CHUCHO_FUNCTION_NAME, (mrk), __VA_ARGS__))
+/**
+ * @def CHUCHO_C_EVERY_N(lvl, n, lg, ...)
+ * Log an event every N times. The level must be one of TRACE, DEBUG,
+ * INFO, WARN, ERROR or FATAL. This will behave exactly as the corresponding
+ * macro, like @ref CHUCHO_C_INFO, does with the level replaced.
+ *
+ * @param lvl the level, one of TRACE, DEBUG, INFO, WARN ERROR or FATAL
+ * @param n the count after which the event should be logged
+ * @param lg the logger, which can either be a char* or a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_EVERY_N(lvl, n, lg, ...) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_C_EVERY_N_INTERNAL((n), CHUCHO_C_ ## lvl(lg, __VA_ARGS__)), CHUCHO_C_ ## lvl(lg, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_EVERY_N_L(lvl, n, lg, ...)
+ * Log an event every N times. The level must be one of TRACE, DEBUG,
+ * INFO, WARN, ERROR or FATAL. This will behave exactly as the corresponding
+ * macro, like @ref CHUCHO_C_INFO, does with the level replaced.
+ *
+ * @param lvl the level, one of TRACE, DEBUG, INFO, WARN ERROR or FATAL
+ * @param n the count after which the event should be logged
+ * @param lg the logger, which must be a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        format text first
+ */
+#define CHUCHO_C_EVERY_N_L(lvl, n, lg, ...) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_C_EVERY_N_INTERNAL((n), CHUCHO_C_ ## lvl ## _L(lg, __VA_ARGS__)), CHUCHO_C_ ## lvl ## _L(lg, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_EVERY_N_M(lvl, n, lg, ...)
+ * Log an event every N times. The level must be one of TRACE, DEBUG,
+ * INFO, WARN, ERROR or FATAL. This will behave exactly as the corresponding
+ * macro, like @ref CHUCHO_C_INFO, does with the level replaced.
+ *
+ * @param lvl the level, one of TRACE, DEBUG, INFO, WARN ERROR or FATAL
+ * @param n the count after which the event should be logged
+ * @param lg the logger, which can either be a char* or a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        marker text first, then the format text, then the format parameters if any
+ */
+#define CHUCHO_C_EVERY_N_M(lvl, n, lg, ...) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_C_EVERY_N_INTERNAL((n), CHUCHO_C_ ## lvl ## _M(lg, __VA_ARGS__)), CHUCHO_C_ ## lvl ## _M(lg, __VA_ARGS__))
+/**
+ * @def CHUCHO_C_EVERY_N_M_L(lvl, n, lg, ...)
+ * Log an event every N times. The level must be one of TRACE, DEBUG,
+ * INFO, WARN, ERROR or FATAL. This will behave exactly as the corresponding
+ * macro, like @ref CHUCHO_C_INFO, does with the level replaced.
+ *
+ * @param lvl the level, one of TRACE, DEBUG, INFO, WARN ERROR or FATAL
+ * @param n the count after which the event should be logged
+ * @param lg the logger, which must be a chucho_logger_t*
+ * @param ... printf-style parameters that must include the
+ *        marker text first, then the format text, then the format parameters if any
+ */
+#define CHUCHO_C_EVERY_N_M_L(lvl, n, lg, ...) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_C_EVERY_N_INTERNAL((n), CHUCHO_C_ ## lvl ## _M_L(lg, __VA_ARGS__)), CHUCHO_C_ ## lvl ## _M_L(lg, __VA_ARGS__))
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
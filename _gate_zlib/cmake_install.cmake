@@ -0,0 +1,174 @@
+# Install script for directory: /root/repo
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/pkgconfig" TYPE FILE FILES "/root/repo/_gate_zlib/libchucho.pc")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_gate_zlib/libchucho.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/chucho" TYPE FILE FILES
+    "/root/repo/include/chucho/async_writer.hpp"
+    "/root/repo/include/chucho/binary_file_reader.hpp"
+    "/root/repo/include/chucho/binary_file_writer.hpp"
+    "/root/repo/include/chucho/cache_and_release_filter.hpp"
+    "/root/repo/include/chucho/callsite.hpp"
+    "/root/repo/include/chucho/cerr_writer.hpp"
+    "/root/repo/include/chucho/cloud_writer.hpp"
+    "/root/repo/include/chucho/compiled_level.h"
+    "/root/repo/include/chucho/compressor.hpp"
+    "/root/repo/include/chucho/configurable.hpp"
+    "/root/repo/include/chucho/configurable_factory.hpp"
+    "/root/repo/include/chucho/configuration.hpp"
+    "/root/repo/include/chucho/configuration.h"
+    "/root/repo/include/chucho/configurator.hpp"
+    "/root/repo/include/chucho/cout_writer.hpp"
+    "/root/repo/include/chucho/diagnostic_context.hpp"
+    "/root/repo/include/chucho/duplicate_message_filter.hpp"
+    "/root/repo/include/chucho/evaluator_filter.hpp"
+    "/root/repo/include/chucho/event.hpp"
+    "/root/repo/include/chucho/event_cache_provider.hpp"
+    "/root/repo/include/chucho/event_cache_stats.hpp"
+    "/root/repo/include/chucho/exception.hpp"
+    "/root/repo/_gate_zlib/chucho/export.h"
+    "/root/repo/include/chucho/expression_filter.hpp"
+    "/root/repo/include/chucho/file_compressor.hpp"
+    "/root/repo/include/chucho/file_compressor_factory.hpp"
+    "/root/repo/include/chucho/file_compressor_memento.hpp"
+    "/root/repo/include/chucho/file_descriptor_writer.hpp"
+    "/root/repo/include/chucho/file_roller.hpp"
+    "/root/repo/include/chucho/file_roller_memento.hpp"
+    "/root/repo/include/chucho/file_roll_trigger.hpp"
+    "/root/repo/include/chucho/file_writer.hpp"
+    "/root/repo/include/chucho/filter.hpp"
+    "/root/repo/include/chucho/filter_memento.hpp"
+    "/root/repo/include/chucho/finalize.hpp"
+    "/root/repo/include/chucho/finalize.h"
+    "/root/repo/include/chucho/formatted_message_serializer.hpp"
+    "/root/repo/include/chucho/formatter.hpp"
+    "/root/repo/include/chucho/function_name.hpp"
+    "/root/repo/include/chucho/interval_file_roll_trigger.hpp"
+    "/root/repo/include/chucho/json_formatter.hpp"
+    "/root/repo/include/chucho/level.hpp"
+    "/root/repo/include/chucho/level_filter.hpp"
+    "/root/repo/include/chucho/level_threshold_filter.hpp"
+    "/root/repo/include/chucho/log_stream.hpp"
+    "/root/repo/include/chucho/log_streambuf.hpp"
+    "/root/repo/include/chucho/log.hpp"
+    "/root/repo/_gate_zlib/chucho/log.h"
+    "/root/repo/include/chucho/loggable.hpp"
+    "/root/repo/include/chucho/logger.hpp"
+    "/root/repo/include/chucho/logger.h"
+    "/root/repo/include/chucho/marker.hpp"
+    "/root/repo/include/chucho/memento.hpp"
+    "/root/repo/include/chucho/message_queue_writer.hpp"
+    "/root/repo/include/chucho/nameable_memento.hpp"
+    "/root/repo/include/chucho/named_pipe_writer.hpp"
+    "/root/repo/include/chucho/non_copyable.hpp"
+    "/root/repo/include/chucho/noop_compressor.hpp"
+    "/root/repo/include/chucho/numbered_file_roller.hpp"
+    "/root/repo/include/chucho/on_start_file_roll_trigger.hpp"
+    "/root/repo/include/chucho/optional.hpp"
+    "/root/repo/include/chucho/overload_governor.hpp"
+    "/root/repo/include/chucho/optional_features.hpp"
+    "/root/repo/include/chucho/pattern_formatter.hpp"
+    "/root/repo/include/chucho/pipe_writer.hpp"
+    "/root/repo/include/chucho/regex_filter.hpp"
+    "/root/repo/include/chucho/rolling_file_writer.hpp"
+    "/root/repo/include/chucho/ruby_evaluator_filter.hpp"
+    "/root/repo/include/chucho/security_policy.hpp"
+    "/root/repo/include/chucho/serializer.hpp"
+    "/root/repo/include/chucho/serialization_formatter.hpp"
+    "/root/repo/include/chucho/size_file_roll_trigger.hpp"
+    "/root/repo/include/chucho/sliding_numbered_file_roller.hpp"
+    "/root/repo/include/chucho/status.hpp"
+    "/root/repo/include/chucho/status_manager.hpp"
+    "/root/repo/include/chucho/status_observer.hpp"
+    "/root/repo/include/chucho/status_reporter.hpp"
+    "/root/repo/include/chucho/stream_compressor.hpp"
+    "/root/repo/include/chucho/streamable.hpp"
+    "/root/repo/include/chucho/syslog_constants.hpp"
+    "/root/repo/include/chucho/syslog_writer.hpp"
+    "/root/repo/include/chucho/thread_settings.hpp"
+    "/root/repo/include/chucho/time_file_roller.hpp"
+    "/root/repo/_gate_zlib/chucho/version.hpp"
+    "/root/repo/include/chucho/writeable_filter.hpp"
+    "/root/repo/include/chucho/writer.hpp"
+    "/root/repo/include/chucho/writer_factory.hpp"
+    "/root/repo/include/chucho/writer_memento.hpp"
+    "/root/repo/include/chucho/yaml_formatter.hpp"
+    "/root/repo/include/chucho/gzip_file_compressor.hpp"
+    "/root/repo/include/chucho/gzip_stream_compressor.hpp"
+    "/root/repo/include/chucho/zlib_compressor.hpp"
+    "/root/repo/include/chucho/bzip2_compressor.hpp"
+    "/root/repo/include/chucho/bzip2_file_compressor.hpp"
+    "/root/repo/include/chucho/lzma_compressor.hpp"
+    "/root/repo/include/chucho/lzma_file_compressor.hpp"
+    "/root/repo/include/chucho/shm_ring_reader.hpp"
+    "/root/repo/include/chucho/shm_ring_writer.hpp"
+    "/root/repo/include/chucho/io_uring_file_writer.hpp"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_gate_zlib/tools/cmake_install.cmake")
+  include("/root/repo/_gate_zlib/test/cmake_install.cmake")
+  include("/root/repo/_gate_zlib/bench/cmake_install.cmake")
+
+endif()
+
+if(CMAKE_INSTALL_COMPONENT)
+  set(CMAKE_INSTALL_MANIFEST "install_manifest_${CMAKE_INSTALL_COMPONENT}.txt")
+else()
+  set(CMAKE_INSTALL_MANIFEST "install_manifest.txt")
+endif()
+
+string(REPLACE ";" "\n" CMAKE_INSTALL_MANIFEST_CONTENT
+       "${CMAKE_INSTALL_MANIFEST_FILES}")
+file(WRITE "/root/repo/_gate_zlib/${CMAKE_INSTALL_MANIFEST}"
+     "${CMAKE_INSTALL_MANIFEST_CONTENT}")
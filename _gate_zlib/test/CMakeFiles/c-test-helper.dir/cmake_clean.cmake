@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c-test-helper.dir/c_test_helper.c.o"
+  "CMakeFiles/c-test-helper.dir/c_test_helper.c.o.d"
+  "c-test-helper"
+  "c-test-helper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/c-test-helper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/configuration-off.dir/configuration_off.cpp.o"
+  "CMakeFiles/configuration-off.dir/configuration_off.cpp.o.d"
+  "configuration-off"
+  "configuration-off.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/configuration-off.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/named-pipe-writer-test-helper.dir/named_pipe_writer_test_helper.cpp.o"
+  "CMakeFiles/named-pipe-writer-test-helper.dir/named_pipe_writer_test_helper.cpp.o.d"
+  "named-pipe-writer-test-helper"
+  "named-pipe-writer-test-helper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/named-pipe-writer-test-helper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/harness.cpp" "test/CMakeFiles/syslog-writer-test.dir/harness.cpp.o" "gcc" "test/CMakeFiles/syslog-writer-test.dir/harness.cpp.o.d"
+  "/root/repo/test/syslog_writer_test.cpp" "test/CMakeFiles/syslog-writer-test.dir/syslog_writer_test.cpp.o" "gcc" "test/CMakeFiles/syslog-writer-test.dir/syslog_writer_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_zlib/CMakeFiles/chucho.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -16,6 +16,12 @@
 
 #include <chucho/async_writer.hpp>
 #include <chucho/event_cache.hpp>
+#include <chucho/function_name.hpp>
+#include <chucho/logger.hpp>
+#include <chucho/diagnostic_context.hpp>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
 
 namespace
 {
@@ -55,50 +61,205 @@ async_writer::async_writer(const std::string& name,
                            std::size_t chunk_size,
                            std::size_t max_chunks,
                            bool flush_on_destruct)
+    : async_writer(name,
+                   std::move(wrt),
+                   chunk_size,
+                   max_chunks,
+                   std::unique_ptr<overload_governor>(),
+                   flush_on_destruct)
+{
+}
+
+async_writer::async_writer(const std::string& name,
+                           std::unique_ptr<writer>&& wrt,
+                           std::size_t chunk_size,
+                           std::size_t max_chunks,
+                           std::unique_ptr<overload_governor>&& gov,
+                           bool flush_on_destruct)
+    : async_writer(name,
+                   std::move(wrt),
+                   1,
+                   std::string(),
+                   chunk_size,
+                   max_chunks,
+                   std::move(gov),
+                   flush_on_destruct)
+{
+}
+
+async_writer::async_writer(const std::string& name,
+                           std::unique_ptr<writer>&& wrt,
+                           std::size_t shards,
+                           const std::string& shard_key,
+                           std::size_t chunk_size,
+                           std::size_t max_chunks,
+                           std::unique_ptr<overload_governor>&& gov,
+                           bool flush_on_destruct)
     : writer(name, std::move(std::make_unique<noop_formatter>())),
       event_cache_provider(chunk_size, max_chunks * chunk_size),
-      writer_(std::move(wrt)),
+      governor_(std::move(gov)),
       stop_(false),
+      shard_key_(shard_key),
       flush_on_destruct_(flush_on_destruct)
 {
-    if (max_chunks < 2)
-        throw std::invalid_argument("max_chunks must be 2 or greater");
-    set_status_origin("async_writer");
-    if (writer_)
-        worker_ = std::make_unique<std::thread>(std::bind(&async_writer::thread_main, this));
+    writers_.push_back(std::move(wrt));
+    start(shards, chunk_size, max_chunks);
+}
+
+async_writer::async_writer(const std::string& name,
+                           std::vector<std::unique_ptr<writer>>&& wrts,
+                           const std::string& shard_key,
+                           std::size_t chunk_size,
+                           std::size_t max_chunks,
+                           std::unique_ptr<overload_governor>&& gov,
+                           bool flush_on_destruct)
+    : writer(name, std::move(std::make_unique<noop_formatter>())),
+      event_cache_provider(chunk_size, max_chunks * chunk_size),
+      writers_(std::move(wrts)),
+      governor_(std::move(gov)),
+      stop_(false),
+      shard_key_(shard_key),
+      flush_on_destruct_(flush_on_destruct)
+{
+    if (writers_.empty())
+        throw std::invalid_argument("At least one writer must be given");
+    if (std::any_of(writers_.begin(), writers_.end(), [] (const std::unique_ptr<writer>& w) { return !w; }))
+        throw std::invalid_argument("The writers cannot be nullptr");
+    start(writers_.size(), chunk_size, max_chunks);
 }
 
 async_writer::~async_writer()
 {
-    if (worker_)
+    stop_ = true;
+    for (auto& shd : shards_)
     {
-        stop_ = true;
-        worker_->join();
+        if (shd.worker)
+            shd.worker->join();
+    }
+    // Make sure that the governor stops shedding before the summary
+    // is written, since the writer is going away.
+    if (governor_)
+    {
+        governor_->update(0.0);
+        if (writers_.front())
+            write_shed_summary();
+    }
+}
+
+double async_writer::get_fullness() const
+{
+    // The fullest shard is the one that is falling behind
+    double result = 0.0;
+    for (const auto& shd : shards_)
+        result = std::max(result, shd.cache->get_fullness());
+    return result;
+}
+
+event_cache_stats async_writer::get_shard_cache_stats(std::size_t shard)
+{
+    return shards_.at(shard).cache->get_stats();
+}
+
+writer& async_writer::get_writer(std::size_t shard) const
+{
+    return *shards_.at(shard).target;
+}
+
+std::size_t async_writer::select_shard(const event& evt) const
+{
+    if (shards_.size() == 1)
+        return 0;
+    if (!shard_key_.empty())
+    {
+        auto val = diagnostic_context::find(shard_key_);
+        if (val != nullptr)
+            return std::hash<std::string>()(*val) % shards_.size();
+    }
+    auto lgr = evt.get_logger();
+    return lgr ? std::hash<std::string>()(lgr->get_name()) % shards_.size() : 0;
+}
+
+void async_writer::start(std::size_t shards, std::size_t chunk_size, std::size_t max_chunks)
+{
+    if (max_chunks < 2)
+        throw std::invalid_argument("max_chunks must be 2 or greater");
+    if (shards == 0)
+        throw std::invalid_argument("shards must be 1 or greater");
+    set_status_origin("async_writer");
+    shards_.resize(shards);
+    for (std::size_t i = 0; i < shards; i++)
+    {
+        if (i == 0)
+        {
+            shards_[i].cache = cache_.get();
+        }
+        else
+        {
+            shards_[i].own_cache = std::make_unique<event_cache>(chunk_size, max_chunks * chunk_size);
+            shards_[i].cache = shards_[i].own_cache.get();
+        }
+        shards_[i].target = writers_.size() == 1 ? writers_.front().get() : writers_[i].get();
+    }
+    if (writers_.front())
+    {
+        for (std::size_t i = 0; i < shards; i++)
+            shards_[i].worker = std::make_unique<std::thread>(std::bind(&async_writer::thread_main, this, i));
     }
 }
 
-void async_writer::thread_main()
+void async_writer::thread_main(std::size_t idx)
 {
+    auto& shd = shards_[idx];
+    thread_state state;
     while (true)
     {
-        auto evt = cache_->pop(250ms);
+        configure_thread("async", state);
+        auto evt = shd.cache->pop(250ms);
+        if (governor_)
+        {
+            governor_->update(get_fullness());
+            // Only one thread writes the summary, so that it has
+            // a predictable home when shards have their own writers
+            if (idx == 0)
+                write_shed_summary();
+        }
         if (evt)
         {
             if (stop_ && !flush_on_destruct_)
                 break;
-            writer_->write(*evt);
+            shd.target->write(*evt);
         }
         else if (stop_)
         {
             break;
         }
     }
-    report_info("The writer thread is exiting");
+    if (shards_.size() == 1)
+        report_info("The writer thread is exiting");
+    else
+        report_info("The writer thread for shard " + std::to_string(idx) + " is exiting");
 }
 
 void async_writer::write_impl(const event& evt)
 {
-    cache_->push(evt);
+    auto& shd = shards_[select_shard(evt)];
+    shd.cache->push(evt);
+    if (governor_)
+        governor_->update(get_fullness());
+}
+
+void async_writer::write_shed_summary()
+{
+    auto summary = governor_->take_summary();
+    if (summary)
+    {
+        writers_.front()->write(event(logger::get("chucho.async_writer"),
+                                      level::WARN_(),
+                                      get_name() + ": " + *summary,
+                                      __FILE__,
+                                      __LINE__,
+                                      CHUCHO_FUNCTION_NAME));
+    }
 }
 
 }
@@ -44,7 +44,30 @@ std::unique_ptr<configurable> async_writer_factory::create_configurable(std::uni
         *awm->get_max_chunks() : async_writer::DEFAULT_MAX_CHUNKS;
     bool flsh = awm->get_flush_on_destruct() ?
         *awm->get_flush_on_destruct() : true;
-    auto aw = std::make_unique<async_writer>(awm->get_name(), std::move(wrt), chunk_sz, max_ch, flsh);
+    std::unique_ptr<overload_governor> gov;
+    if (awm->get_shed_watermarks())
+    {
+        try
+        {
+            gov = std::make_unique<overload_governor>(overload_governor::parse_watermarks(*awm->get_shed_watermarks()),
+                                                      awm->get_shed_hysteresis() ? *awm->get_shed_hysteresis() : overload_governor::DEFAULT_HYSTERESIS);
+        }
+        catch (std::invalid_argument& e)
+        {
+            throw exception(std::string("async_writer_factory: ") + e.what());
+        }
+    }
+    else if (awm->get_shed_hysteresis())
+    {
+        report_warning("The shed_hysteresis is ignored when shed_watermarks is not set");
+    }
+    std::size_t shards = awm->get_shards() ? *awm->get_shards() : 1;
+    std::string key = awm->get_shard_key() ? *awm->get_shard_key() : std::string();
+    if (shards == 1 && !key.empty())
+        report_warning("The shard_key is ignored when there is only one shard");
+    auto aw = std::make_unique<async_writer>(awm->get_name(), std::move(wrt), shards, key, chunk_sz, max_ch, std::move(gov), flsh);
+    if (!awm->get_thread_settings().is_empty())
+        aw->set_thread_settings(awm->get_thread_settings());
     report_info("Created a " + demangle::get_demangled_name(typeid(*aw)));
     return std::move(aw);
 }
@@ -55,4 +78,9 @@ std::unique_ptr<memento> async_writer_factory::create_memento(configurator& cfg)
     return std::move(mnto);
 }
 
+bool async_writer_factory::creates_writer() const
+{
+    return true;
+}
+
 }
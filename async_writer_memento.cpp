@@ -31,10 +31,32 @@ async_writer_memento::async_writer_memento(configurator& cfg)
     cfg.get_security_policy().set_text("async_writer::chunk_size(text)", 9);
     cfg.get_security_policy().set_text("async_writer::max_chunks(text)", 7);
     cfg.get_security_policy().set_text("async_writer::flush_on_destruct", 5);
+    cfg.get_security_policy().set_text("async_writer::shed_watermarks", 200);
+    cfg.get_security_policy().set_integer("async_writer::shed_hysteresis", 0, 99);
+    cfg.get_security_policy().set_text("async_writer::shed_hysteresis(text)", 2);
+    cfg.get_security_policy().set_integer("async_writer::shards", 1, 1024);
+    cfg.get_security_policy().set_text("async_writer::shards(text)", 4);
+    cfg.get_security_policy().set_text("async_writer::shard_key", 256);
+    cfg.get_security_policy().set_text("thread_settings::affinity", 256);
+    cfg.get_security_policy().set_text("thread_settings::name", 64);
+    cfg.get_security_policy().set_integer("thread_settings::nice", -20, 19);
+    cfg.get_security_policy().set_text("thread_settings::nice(text)", 3);
+    cfg.get_security_policy().set_integer("thread_settings::numa_node", 0, 1023);
+    cfg.get_security_policy().set_text("thread_settings::numa_node(text)", 4);
+    cfg.get_security_policy().set_text("thread_settings::scheduling", 6);
     set_handler("chunk_size", [this] (const std::string& s) { chunk_size_ = static_cast<std::size_t>(validate("async_writer::chunk_size",
          text_util::parse_byte_size(validate("async_writer::chunk_size(text)", s)))); });
     set_handler("max_chunks", [this] (const std::string& cap) { max_chunks_ = validate("async_writer::max_chunks", std::stoul(validate("async_writer::max_chunks(text)", cap))); });
     set_handler("flush_on_destruct", [this] (const std::string& val) { flush_on_destruct_ = boolean_value(validate("async_writer::flush_on_destruct", val)); });
+    set_handler("shed_watermarks", [this] (const std::string& val) { shed_watermarks_ = validate("async_writer::shed_watermarks", val); });
+    set_handler("shed_hysteresis", [this] (const std::string& val) { shed_hysteresis_ = validate("async_writer::shed_hysteresis", std::stoul(validate("async_writer::shed_hysteresis(text)", val))) / 100.0; });
+    set_handler("shards", [this] (const std::string& val) { shards_ = validate("async_writer::shards", std::stoul(validate("async_writer::shards(text)", val))); });
+    set_handler("shard_key", [this] (const std::string& val) { shard_key_ = validate("async_writer::shard_key", val); });
+    set_handler("thread_affinity", [this] (const std::string& val) { thread_settings_.set_affinity(thread_settings::parse_cpu_list(validate("thread_settings::affinity", val))); });
+    set_handler("thread_name", [this] (const std::string& val) { thread_settings_.set_name(validate("thread_settings::name", val)); });
+    set_handler("thread_nice", [this] (const std::string& val) { thread_settings_.set_nice(validate("thread_settings::nice", std::stoi(validate("thread_settings::nice(text)", val)))); });
+    set_handler("thread_numa_node", [this] (const std::string& val) { thread_settings_.set_numa_node(validate("thread_settings::numa_node", std::stoul(validate("thread_settings::numa_node(text)", val)))); });
+    set_handler("thread_scheduling", [this] (const std::string& val) { thread_settings_.set_scheduling(thread_settings::parse_scheduling(validate("thread_settings::scheduling", val))); });
     set_handler("name", [this] (const std::string& name) { name_ = validate("nameable::name", name); });
 }
 
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "benchmark_util.hpp"
+#include <chucho/async_writer.hpp>
+#include <chucho/pattern_formatter.hpp>
+#include <thread>
+
+namespace
+{
+
+const std::size_t BATCH = 64;
+
+chucho::benchmark::null_writer* sink;
+std::atomic<std::size_t> submitted;
+
+std::unique_ptr<chucho::async_writer> make_async_writer(const benchmark::State&)
+{
+    auto nw = std::make_unique<chucho::benchmark::null_writer>(std::make_unique<chucho::pattern_formatter>("%d{%H:%M:%S.%q} %p %c: %m%n"));
+    sink = nw.get();
+    submitted = 0;
+    return std::make_unique<chucho::async_writer>("async", std::move(nw));
+}
+
+using async_writer = chucho::benchmark::shared<chucho::async_writer, make_async_writer>;
+
+// Each iteration writes a batch and waits for the background thread
+// to format all events submitted so far, so that the time covers the
+// trip through the cache and not just the push.
+void end_to_end(benchmark::State& state)
+{
+    auto evt = chucho::benchmark::get_event();
+    auto& async = async_writer::get();
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < BATCH; i++)
+            async.write(evt);
+        auto target = submitted.fetch_add(BATCH) + BATCH;
+        while (sink->get_written() < target)
+            std::this_thread::yield();
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+}
+
+}
+
+BENCHMARK(end_to_end)->Apply(chucho::benchmark::threads)->Setup(async_writer::set_up)->Teardown(async_writer::tear_down);
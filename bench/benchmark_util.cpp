@@ -0,0 +1,58 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "benchmark_util.hpp"
+#include <chucho/formatter.hpp>
+#include <algorithm>
+#include <thread>
+
+namespace chucho
+{
+
+namespace benchmark
+{
+
+null_writer::null_writer(std::unique_ptr<formatter>&& fmt)
+    : writer("null", std::move(fmt)),
+      written_(0)
+{
+}
+
+void null_writer::write_impl(const event& evt)
+{
+    ::benchmark::DoNotOptimize(formatter_->format(evt));
+    written_.fetch_add(1, std::memory_order_release);
+}
+
+event get_event()
+{
+    return event(logger::get("chucho.benchmark"),
+                 level::INFO_(),
+                 "The session with peer 10.0.0.17 was established after 3 attempts in 42 ms",
+                 __FILE__,
+                 __LINE__,
+                 __FUNCTION__);
+}
+
+void threads(::benchmark::internal::Benchmark* bmk)
+{
+    int cores = std::max(1U, std::thread::hardware_concurrency());
+    bmk->ThreadRange(1, cores)->UseRealTime();
+}
+
+}
+
+}
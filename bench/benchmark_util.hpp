@@ -0,0 +1,100 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_BENCHMARK_UTIL_HPP_)
+#define CHUCHO_BENCHMARK_UTIL_HPP_
+
+#include <benchmark/benchmark.h>
+#include <chucho/writer.hpp>
+#include <chucho/logger.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace chucho
+{
+
+namespace benchmark
+{
+
+// Formats every event and throws the result away, so that what is
+// measured is everything up to the point of output.
+class null_writer : public writer
+{
+public:
+    null_writer(std::unique_ptr<formatter>&& fmt);
+
+    std::size_t get_written() const;
+
+protected:
+    virtual void write_impl(const event& evt) override;
+
+private:
+    std::atomic<std::size_t> written_;
+};
+
+// The object that all threads of a benchmark share. Fixtures are set
+// up once per thread, so instead pass set_up and tear_down to the
+// benchmark's Setup() and Teardown(), which run once around all of
+// them. Each maker gets its own object.
+template <typename T, std::unique_ptr<T> (*MAKE)(const ::benchmark::State&)>
+class shared
+{
+public:
+    static T& get();
+    static void set_up(const ::benchmark::State& state);
+    static void tear_down(const ::benchmark::State&);
+
+private:
+    static std::unique_ptr<T> object_;
+};
+
+// A representative event with a message of about 80 bytes
+event get_event();
+// Run a benchmark at 1, 2, 4, ... threads up to the number of cores
+void threads(::benchmark::internal::Benchmark* bmk);
+
+template <typename T, std::unique_ptr<T> (*MAKE)(const ::benchmark::State&)>
+std::unique_ptr<T> shared<T, MAKE>::object_;
+
+template <typename T, std::unique_ptr<T> (*MAKE)(const ::benchmark::State&)>
+inline T& shared<T, MAKE>::get()
+{
+    return *object_;
+}
+
+template <typename T, std::unique_ptr<T> (*MAKE)(const ::benchmark::State&)>
+inline void shared<T, MAKE>::set_up(const ::benchmark::State& state)
+{
+    object_ = MAKE(state);
+}
+
+template <typename T, std::unique_ptr<T> (*MAKE)(const ::benchmark::State&)>
+inline void shared<T, MAKE>::tear_down(const ::benchmark::State&)
+{
+    object_.reset();
+}
+
+inline std::size_t null_writer::get_written() const
+{
+    return written_.load(std::memory_order_acquire);
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "benchmark_util.hpp"
+#include <chucho/pattern_formatter.hpp>
+#include <chucho/noop_compressor.hpp>
+#if defined(CHUCHO_HAVE_ZLIB)
+#include <chucho/zlib_compressor.hpp>
+#endif
+#if defined(CHUCHO_HAVE_BZIP2)
+#include <chucho/bzip2_compressor.hpp>
+#endif
+#if defined(CHUCHO_HAVE_LZMA)
+#include <chucho/lzma_compressor.hpp>
+#endif
+#if defined(CHUCHO_HAVE_LZ4)
+#include <chucho/lz4_compressor.hpp>
+#endif
+
+namespace
+{
+
+// Formatted log lines compress very differently from random bytes,
+// so the input is a run of formatted events.
+std::vector<std::uint8_t> get_input(std::size_t size)
+{
+    chucho::pattern_formatter fmt("%d{%Y-%m-%d %H:%M:%S.%q} %-5p [%t] %c: %m%n");
+    auto evt = chucho::benchmark::get_event();
+    std::vector<std::uint8_t> result;
+    while (result.size() < size)
+    {
+        auto line = fmt.format(evt);
+        result.insert(result.end(), line.begin(), line.end());
+    }
+    result.resize(size);
+    return result;
+}
+
+template <typename compressor_type>
+void compress(benchmark::State& state)
+{
+    compressor_type cmp;
+    auto in = get_input(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cmp.compress(in));
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK_TEMPLATE(compress, chucho::noop_compressor)->Range(1 << 10, 1 << 16)->Apply(chucho::benchmark::threads);
+#if defined(CHUCHO_HAVE_ZLIB)
+BENCHMARK_TEMPLATE(compress, chucho::zlib_compressor)->Range(1 << 10, 1 << 16)->Apply(chucho::benchmark::threads);
+#endif
+#if defined(CHUCHO_HAVE_BZIP2)
+BENCHMARK_TEMPLATE(compress, chucho::bzip2_compressor)->Range(1 << 10, 1 << 16)->Apply(chucho::benchmark::threads);
+#endif
+#if defined(CHUCHO_HAVE_LZMA)
+BENCHMARK_TEMPLATE(compress, chucho::lzma_compressor)->Range(1 << 10, 1 << 16)->Apply(chucho::benchmark::threads);
+#endif
+#if defined(CHUCHO_HAVE_LZ4)
+BENCHMARK_TEMPLATE(compress, chucho::lz4_compressor)->Range(1 << 10, 1 << 16)->Apply(chucho::benchmark::threads);
+#endif
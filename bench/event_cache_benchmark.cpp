@@ -0,0 +1,45 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "benchmark_util.hpp"
+#include <chucho/event_cache.hpp>
+
+namespace
+{
+
+std::unique_ptr<chucho::event_cache> make_event_cache(const benchmark::State&)
+{
+    // Big enough that nothing is ever written to disk
+    return std::make_unique<chucho::event_cache>(1024 * 1024, 8 * 1024 * 1024);
+}
+
+using event_cache = chucho::benchmark::shared<chucho::event_cache, make_event_cache>;
+
+void push_pop(benchmark::State& state)
+{
+    auto evt = chucho::benchmark::get_event();
+    auto& cache = event_cache::get();
+    for (auto _ : state)
+    {
+        cache.push(evt);
+        benchmark::DoNotOptimize(cache.pop(std::chrono::milliseconds(1)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(push_pop)->Apply(chucho::benchmark::threads)->Setup(event_cache::set_up)->Teardown(event_cache::tear_down);
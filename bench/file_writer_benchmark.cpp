@@ -0,0 +1,88 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "benchmark_util.hpp"
+#include <chucho/file_writer.hpp>
+#include <chucho/binary_file_writer.hpp>
+#include <chucho/pattern_formatter.hpp>
+#if defined(CHUCHO_HAVE_IO_URING)
+#include <chucho/io_uring_file_writer.hpp>
+#endif
+#include <cstdio>
+
+namespace
+{
+
+const char* const FILE_NAME = "chucho_benchmarks.log";
+const char* const PATTERN = "%d{%Y-%m-%d %H:%M:%S.%q} %-5p [%t] %c: %m%n";
+
+std::unique_ptr<chucho::writer> wrt;
+
+void tear_down(const benchmark::State&)
+{
+    wrt.reset();
+    std::remove(FILE_NAME);
+}
+
+void binary_file_writer_set_up(const benchmark::State& state)
+{
+    wrt = std::make_unique<chucho::binary_file_writer>("binary",
+                                                       FILE_NAME,
+                                                       chucho::file_writer::on_start::TRUNCATE,
+                                                       state.range(0) != 0);
+}
+
+void file_writer_set_up(const benchmark::State& state)
+{
+    wrt = std::make_unique<chucho::file_writer>("file",
+                                                std::make_unique<chucho::pattern_formatter>(PATTERN),
+                                                FILE_NAME,
+                                                chucho::file_writer::on_start::TRUNCATE,
+                                                state.range(0) != 0);
+}
+
+#if defined(CHUCHO_HAVE_IO_URING)
+
+void io_uring_file_writer_set_up(const benchmark::State& state)
+{
+    wrt = std::make_unique<chucho::io_uring_file_writer>("io_uring",
+                                                         std::make_unique<chucho::pattern_formatter>(PATTERN),
+                                                         FILE_NAME,
+                                                         chucho::file_writer::on_start::TRUNCATE,
+                                                         state.range(0) != 0);
+}
+
+#endif
+
+// The argument is whether the writer flushes after each event
+void write(benchmark::State& state)
+{
+    auto evt = chucho::benchmark::get_event();
+    for (auto _ : state)
+        wrt->write(evt);
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(write)->Name("binary_file_writer")->ArgName("flush")->Arg(0)->Arg(1)->Apply(chucho::benchmark::threads)
+    ->Setup(binary_file_writer_set_up)->Teardown(tear_down);
+BENCHMARK(write)->Name("file_writer")->ArgName("flush")->Arg(0)->Arg(1)->Apply(chucho::benchmark::threads)
+    ->Setup(file_writer_set_up)->Teardown(tear_down);
+#if defined(CHUCHO_HAVE_IO_URING)
+BENCHMARK(write)->Name("io_uring_file_writer")->ArgName("flush")->Arg(0)->Arg(1)->Apply(chucho::benchmark::threads)
+    ->Setup(io_uring_file_writer_set_up)->Teardown(tear_down);
+#endif
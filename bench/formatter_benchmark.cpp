@@ -0,0 +1,65 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "benchmark_util.hpp"
+#include <chucho/pattern_formatter.hpp>
+#include <chucho/json_formatter.hpp>
+#include <chucho/yaml_formatter.hpp>
+
+namespace
+{
+
+const char* const PATTERNS[] =
+{
+    "%m%n",
+    "%p %c - %m%n",
+    "%d{%Y-%m-%d %H:%M:%S.%q} %-5p [%t] %c: %m%n",
+    "%d{%Y-%m-%dT%H:%M:%S} %p %c %b:%L %F - %m%n"
+};
+
+void format(benchmark::State& state, chucho::formatter& fmt)
+{
+    auto evt = chucho::benchmark::get_event();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(fmt.format(evt));
+    state.SetItemsProcessed(state.iterations());
+}
+
+void json_formatter(benchmark::State& state, chucho::serialization_formatter::style styl)
+{
+    chucho::json_formatter fmt(styl);
+    format(state, fmt);
+}
+
+void pattern_formatter(benchmark::State& state)
+{
+    chucho::pattern_formatter fmt(PATTERNS[state.range(0)]);
+    format(state, fmt);
+    state.SetLabel(PATTERNS[state.range(0)]);
+}
+
+void yaml_formatter(benchmark::State& state)
+{
+    chucho::yaml_formatter fmt;
+    format(state, fmt);
+}
+
+}
+
+BENCHMARK_CAPTURE(json_formatter, compact, chucho::serialization_formatter::style::COMPACT)->Apply(chucho::benchmark::threads);
+BENCHMARK_CAPTURE(json_formatter, pretty, chucho::serialization_formatter::style::PRETTY)->Apply(chucho::benchmark::threads);
+BENCHMARK(pattern_formatter)->DenseRange(0, 3)->Apply(chucho::benchmark::threads);
+BENCHMARK(yaml_formatter)->Apply(chucho::benchmark::threads);
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "histogram.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+
+unsigned most_significant_bit(std::uint64_t val)
+{
+    unsigned result = 0;
+    while (val >>= 1)
+        result++;
+    return result;
+}
+
+}
+
+namespace chucho
+{
+
+namespace benchmark
+{
+
+histogram::histogram()
+    : counts_(index_of(std::numeric_limits<std::uint64_t>::max()) + 1),
+      count_(0),
+      min_(std::numeric_limits<std::uint64_t>::max()),
+      max_(0),
+      total_(0.0)
+{
+}
+
+std::uint64_t histogram::get_percentile(double pct) const
+{
+    if (count_ == 0)
+        return 0;
+    auto target = static_cast<std::uint64_t>(std::ceil(pct / 100.0 * count_));
+    target = std::max(target, static_cast<std::uint64_t>(1));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < counts_.size(); i++)
+    {
+        seen += counts_[i];
+        if (seen >= target)
+            return std::min(highest_equivalent(i), max_);
+    }
+    return max_;
+}
+
+std::uint64_t histogram::highest_equivalent(std::size_t idx)
+{
+    if (idx < SUB_BUCKETS)
+        return idx;
+    auto off = idx - SUB_BUCKETS;
+    unsigned shift = off / HALF + 1;
+    std::uint64_t sub = off % HALF + HALF;
+    return ((sub + 1) << shift) - 1;
+}
+
+std::size_t histogram::index_of(std::uint64_t val)
+{
+    if (val < SUB_BUCKETS)
+        return val;
+    unsigned shift = most_significant_bit(val) - (SUB_BUCKET_BITS - 1);
+    return SUB_BUCKETS + (shift - 1) * HALF + ((val >> shift) - HALF);
+}
+
+void histogram::merge(const histogram& other)
+{
+    for (std::size_t i = 0; i < counts_.size(); i++)
+        counts_[i] += other.counts_[i];
+    count_ += other.count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    total_ += other.total_;
+}
+
+void histogram::record(std::uint64_t val)
+{
+    counts_[index_of(val)]++;
+    count_++;
+    min_ = std::min(min_, val);
+    max_ = std::max(max_, val);
+    total_ += val;
+}
+
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_BENCHMARK_HISTOGRAM_HPP_)
+#define CHUCHO_BENCHMARK_HISTOGRAM_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace chucho
+{
+
+namespace benchmark
+{
+
+// A log-linear histogram in the style of HdrHistogram. Values below
+// 128 are counted exactly, and larger ones in buckets that are 1/64 of
+// their power of two wide, so any recorded value is reported within
+// 1.6% across the whole 64-bit range in a fixed 30 KB.
+class histogram
+{
+public:
+    histogram();
+
+    std::uint64_t get_count() const;
+    std::uint64_t get_max() const;
+    double get_mean() const;
+    std::uint64_t get_min() const;
+    // The highest value equivalent to the one at the given percentile
+    std::uint64_t get_percentile(double pct) const;
+    void merge(const histogram& other);
+    void record(std::uint64_t val);
+
+private:
+    static constexpr unsigned SUB_BUCKET_BITS = 7;
+    static constexpr std::uint64_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr std::uint64_t HALF = SUB_BUCKETS / 2;
+
+    static std::size_t index_of(std::uint64_t val);
+    static std::uint64_t highest_equivalent(std::size_t idx);
+
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t count_;
+    std::uint64_t min_;
+    std::uint64_t max_;
+    double total_;
+};
+
+inline std::uint64_t histogram::get_count() const
+{
+    return count_;
+}
+
+inline std::uint64_t histogram::get_max() const
+{
+    return max_;
+}
+
+inline double histogram::get_mean() const
+{
+    return count_ == 0 ? 0.0 : total_ / count_;
+}
+
+inline std::uint64_t histogram::get_min() const
+{
+    return count_ == 0 ? 0 : min_;
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "benchmark_util.hpp"
+#include <chucho/log.hpp>
+#include <chucho/pattern_formatter.hpp>
+
+namespace
+{
+
+// A logger that writes to a null_writer for as long as this exists
+struct null_logger
+{
+    null_logger();
+    ~null_logger();
+
+    std::shared_ptr<chucho::logger> lgr;
+};
+
+null_logger::null_logger()
+    : lgr(chucho::logger::get("chucho.benchmark.log"))
+{
+    lgr->set_writes_to_ancestors(false);
+    lgr->set_level(chucho::level::INFO_());
+    lgr->add_writer(std::make_unique<chucho::benchmark::null_writer>(std::make_unique<chucho::pattern_formatter>("%m%n")));
+}
+
+null_logger::~null_logger()
+{
+    lgr->clear_writers();
+}
+
+std::unique_ptr<null_logger> make_null_logger(const benchmark::State&)
+{
+    return std::make_unique<null_logger>();
+}
+
+using shared_logger = chucho::benchmark::shared<null_logger, make_null_logger>;
+
+void disabled(benchmark::State& state)
+{
+    int attempts = 3;
+    auto& lgr = shared_logger::get().lgr;
+    for (auto _ : state)
+        CHUCHO_DEBUG(lgr, "The session was established after " << attempts << " attempts");
+    state.SetItemsProcessed(state.iterations());
+}
+
+void disabled_str(benchmark::State& state)
+{
+    auto& lgr = shared_logger::get().lgr;
+    for (auto _ : state)
+        CHUCHO_DEBUG_STR(lgr, "The session was established");
+    state.SetItemsProcessed(state.iterations());
+}
+
+void enabled(benchmark::State& state)
+{
+    int attempts = 3;
+    auto& lgr = shared_logger::get().lgr;
+    for (auto _ : state)
+        CHUCHO_INFO(lgr, "The session was established after " << attempts << " attempts");
+    state.SetItemsProcessed(state.iterations());
+}
+
+void enabled_str(benchmark::State& state)
+{
+    auto& lgr = shared_logger::get().lgr;
+    for (auto _ : state)
+        CHUCHO_INFO_STR(lgr, "The session was established");
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(disabled)->Apply(chucho::benchmark::threads)->Setup(shared_logger::set_up)->Teardown(shared_logger::tear_down);
+BENCHMARK(disabled_str)->Apply(chucho::benchmark::threads)->Setup(shared_logger::set_up)->Teardown(shared_logger::tear_down);
+BENCHMARK(enabled)->Apply(chucho::benchmark::threads)->Setup(shared_logger::set_up)->Teardown(shared_logger::tear_down);
+BENCHMARK(enabled_str)->Apply(chucho::benchmark::threads)->Setup(shared_logger::set_up)->Teardown(shared_logger::tear_down);
@@ -0,0 +1,33 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chucho/version.hpp>
+#include <chucho/finalize.hpp>
+
+int main(int argc, char* argv[])
+{
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    // Recorded in the context of the JSON output, so that runs from
+    // different releases can be told apart
+    ::benchmark::AddCustomContext("chucho_version", chucho::version::text());
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    chucho::finalize();
+    return 0;
+}
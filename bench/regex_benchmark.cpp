@@ -0,0 +1,72 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chucho/regex.hpp>
+#include <regex>
+
+namespace
+{
+
+const std::string HIT("2026-10-19 12:01:44.123 INFO  [worker-7] chucho.net.session: heartbeat 4711 from peer 10.0.0.17");
+const std::string MISS("2026-10-19 12:01:44.123 INFO  [worker-7] chucho.net.session: connection established with peer");
+
+// A literal, a pattern for the automaton and one that needs the engine
+const char* const PATTERNS[] =
+{
+    "heartbeat",
+    "heartbeat [0-9]+ from",
+    "(heartbeat|keepalive) [0-9]+"
+};
+
+void chucho_search(benchmark::State& state, const std::string& text)
+{
+    chucho::regex::expression re(PATTERNS[state.range(0)]);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(chucho::regex::search(text, re));
+    state.SetLabel(PATTERNS[state.range(0)]);
+}
+
+void std_search(benchmark::State& state, const std::string& text)
+{
+    std::regex re(PATTERNS[state.range(0)], std::regex::extended);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::regex_search(text, re));
+    state.SetLabel(PATTERNS[state.range(0)]);
+}
+
+void chucho_replace(benchmark::State& state)
+{
+    chucho::regex::expression re("\\.");
+    for (auto _ : state)
+        benchmark::DoNotOptimize(chucho::regex::replace("chucho.net.session", re, "::"));
+}
+
+void std_replace(benchmark::State& state)
+{
+    std::regex re("\\.", std::regex::extended);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::regex_replace("chucho.net.session", re, "::"));
+}
+
+}
+
+BENCHMARK_CAPTURE(chucho_search, hit, HIT)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(chucho_search, miss, MISS)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(std_search, hit, HIT)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(std_search, miss, MISS)->DenseRange(0, 2);
+BENCHMARK(chucho_replace);
+BENCHMARK(std_replace);
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "benchmark_util.hpp"
+#include <chucho/pattern_formatter.hpp>
+#include <chucho/formatted_message_serializer.hpp>
+#if defined(CHUCHO_HAVE_PROTOBUF)
+#include <chucho/protobuf_serializer.hpp>
+#endif
+#if defined(CHUCHO_HAVE_CAPN_PROTO)
+#include <chucho/capn_proto_serializer.hpp>
+#endif
+#if defined(CHUCHO_HAVE_FLATBUFFERS)
+#include <chucho/flatbuffers_serializer.hpp>
+#endif
+
+namespace
+{
+
+// Each iteration serializes a batch of events, as the message queue
+// writers do when coalescing, and finishes the blob
+template <typename serializer_type>
+void serialize(benchmark::State& state)
+{
+    serializer_type ser;
+    chucho::pattern_formatter fmt("%m");
+    auto evt = chucho::benchmark::get_event();
+    std::size_t bytes = 0;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < state.range(0); i++)
+            ser.serialize(evt, fmt);
+        bytes += ser.finish_blob().size();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(bytes);
+}
+
+}
+
+BENCHMARK_TEMPLATE(serialize, chucho::formatted_message_serializer)->RangeMultiplier(16)->Range(1, 256)->Apply(chucho::benchmark::threads);
+#if defined(CHUCHO_HAVE_PROTOBUF)
+BENCHMARK_TEMPLATE(serialize, chucho::protobuf_serializer)->RangeMultiplier(16)->Range(1, 256)->Apply(chucho::benchmark::threads);
+#endif
+#if defined(CHUCHO_HAVE_CAPN_PROTO)
+BENCHMARK_TEMPLATE(serialize, chucho::capn_proto_serializer)->RangeMultiplier(16)->Range(1, 256)->Apply(chucho::benchmark::threads);
+#endif
+#if defined(CHUCHO_HAVE_FLATBUFFERS)
+BENCHMARK_TEMPLATE(serialize, chucho::flatbuffers_serializer)->RangeMultiplier(16)->Range(1, 256)->Apply(chucho::benchmark::threads);
+#endif
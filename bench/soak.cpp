@@ -0,0 +1,489 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "histogram.hpp"
+#include <chucho/configuration.hpp>
+#include <chucho/finalize.hpp>
+#include <chucho/log.hpp>
+#include <chucho/status_manager.hpp>
+#include <chucho/status_observer.hpp>
+#include <chucho/file.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// A soak test of the latency of a logging call on the application's
+// threads while the writers behind it roll, spill, reconnect and get
+// reconfigured. Throughput averages hide exactly these events, so every
+// call is timed, the distribution is kept in a histogram and the worst
+// calls are matched with the status messages reported while they were
+// blocked.
+
+namespace
+{
+
+using chucho::benchmark::histogram;
+
+// The statuses printed for each stall
+const std::size_t MAX_CAUSES = 5;
+
+struct options
+{
+    unsigned threads = 4;
+    unsigned seconds = 10;
+    // Calls per second per producer, or 0 for as fast as possible
+    unsigned rate = 0;
+    // Seconds between reconfigurations, or 0 for none
+    unsigned reconfigure = 2;
+    std::size_t stalls = 10;
+    std::string directory = "chucho_soak";
+    std::vector<std::string> scenarios;
+};
+
+struct stall
+{
+    std::uint64_t nanos;
+    std::chrono::system_clock::time_point end;
+    unsigned producer;
+
+    bool operator> (const stall& other) const
+    {
+        return nanos > other.nanos;
+    }
+};
+
+struct producer_result
+{
+    histogram hist;
+    // A min-heap of the slowest calls
+    std::vector<stall> worst;
+};
+
+class status_log : public chucho::status_observer
+{
+public:
+    std::vector<chucho::status> between(chucho::status::time_type from, chucho::status::time_type to);
+    void clear();
+    std::size_t get_count();
+    virtual void status_reported(const chucho::status& st) override;
+
+private:
+    std::mutex guard_;
+    std::vector<chucho::status> statuses_;
+};
+
+// Receives what the syslog writers send. A positive pause after each
+// read makes a slow consumer, which pushes back on a TCP sender the way
+// a struggling broker would.
+class sink
+{
+public:
+    sink(int type, std::chrono::microseconds pause);
+    ~sink();
+
+    std::uint16_t get_port() const;
+
+private:
+    void thread_main();
+
+    int type_;
+    int socket_;
+    std::uint16_t port_;
+    std::chrono::microseconds pause_;
+    std::atomic<bool> stop_;
+    std::thread thread_;
+};
+
+std::vector<chucho::status> status_log::between(chucho::status::time_type from, chucho::status::time_type to)
+{
+    std::vector<chucho::status> result;
+    std::lock_guard<std::mutex> lg(guard_);
+    for (const auto& st : statuses_)
+    {
+        if (st.get_time() >= from && st.get_time() <= to)
+            result.push_back(st);
+    }
+    return result;
+}
+
+void status_log::clear()
+{
+    std::lock_guard<std::mutex> lg(guard_);
+    statuses_.clear();
+}
+
+std::size_t status_log::get_count()
+{
+    std::lock_guard<std::mutex> lg(guard_);
+    return statuses_.size();
+}
+
+void status_log::status_reported(const chucho::status& st)
+{
+    std::lock_guard<std::mutex> lg(guard_);
+    statuses_.push_back(st);
+}
+
+sink::sink(int type, std::chrono::microseconds pause)
+    : type_(type),
+      pause_(pause),
+      stop_(false)
+{
+    socket_ = ::socket(AF_INET, type, 0);
+    if (socket_ < 0)
+        throw std::runtime_error(std::string("Could not create a socket: ") + std::strerror(errno));
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    if (::bind(socket_, reinterpret_cast<sockaddr*>(&addr), len) != 0 ||
+        ::getsockname(socket_, reinterpret_cast<sockaddr*>(&addr), &len) != 0 ||
+        (type == SOCK_STREAM && ::listen(socket_, 4) != 0))
+    {
+        ::close(socket_);
+        throw std::runtime_error(std::string("Could not set up the sink: ") + std::strerror(errno));
+    }
+    port_ = ntohs(addr.sin_port);
+    thread_ = std::thread(&sink::thread_main, this);
+}
+
+sink::~sink()
+{
+    stop_ = true;
+    thread_.join();
+    ::close(socket_);
+}
+
+std::uint16_t sink::get_port() const
+{
+    return port_;
+}
+
+void sink::thread_main()
+{
+    std::vector<pollfd> fds(1);
+    fds[0].fd = socket_;
+    fds[0].events = POLLIN;
+    char buf[4096];
+    while (!stop_)
+    {
+        if (::poll(fds.data(), fds.size(), 100) <= 0)
+            continue;
+        for (std::size_t i = 0; i < fds.size(); i++)
+        {
+            if (fds[i].revents == 0)
+                continue;
+            if (type_ == SOCK_STREAM && i == 0)
+            {
+                int con = ::accept(socket_, nullptr, nullptr);
+                if (con >= 0)
+                    fds.push_back(pollfd { con, POLLIN, 0 });
+            }
+            else if (::recv(fds[i].fd, buf, sizeof(buf), 0) <= 0 && type_ == SOCK_STREAM)
+            {
+                ::close(fds[i].fd);
+                fds[i].fd = -1;
+            }
+            else if (pause_.count() > 0)
+            {
+                std::this_thread::sleep_for(pause_);
+            }
+        }
+        fds.erase(std::remove_if(fds.begin(), fds.end(), [] (const pollfd& p) { return p.fd < 0; }), fds.end());
+    }
+    for (std::size_t i = 1; i < fds.size(); i++)
+        ::close(fds[i].fd);
+}
+
+std::string get_config(const std::string& scenario, const options& opts, std::uint16_t port, bool flip)
+{
+    std::ostringstream stream;
+    stream << "- chucho::logger:\n"
+              "    name: soak\n"
+              "    level: info\n";
+    if (scenario == "rolling")
+    {
+        stream << "    chucho::rolling_file_writer:\n"
+                  "        chucho::pattern_formatter:\n"
+                  "            pattern: '%d{%Y-%m-%d %H:%M:%S.%q} %-5p [%t] %c: %m%n'\n"
+                  "        chucho::numbered_file_roller:\n"
+                  "            max_index: 5\n"
+#if defined(CHUCHO_HAVE_ZLIB)
+                  "            chucho::gzip_file_compressor:\n"
+                  "                min_index: 1\n"
+#elif defined(CHUCHO_HAVE_BZIP2)
+                  "            chucho::bzip2_file_compressor:\n"
+                  "                min_index: 1\n"
+#endif
+                  "        chucho::size_file_roll_trigger:\n"
+                  "            max_size: 4194304\n"
+                  "        file_name: " << opts.directory << "/rolling.log\n";
+    }
+    else if (scenario == "async")
+    {
+        // The syslog writer over TCP to a slow consumer stands in for
+        // a network writer whose broker is falling behind, so the
+        // cache fills, spills to disk and culls.
+        stream << "    chucho::async_writer:\n"
+                  "        chucho::syslog_writer:\n"
+                  "            chucho::pattern_formatter:\n"
+                  "                pattern: '%m'\n"
+                  "            facility: LOCAL0\n"
+                  "            host_name: 127.0.0.1\n"
+                  "            port: " << port << "\n"
+                  "            protocol: tcp\n"
+                  "        chunk_size: 65536\n"
+                  "        max_chunks: 4\n";
+    }
+    else
+    {
+        stream << "    chucho::syslog_writer:\n"
+                  "        chucho::pattern_formatter:\n"
+                  "            pattern: '%m'\n"
+                  "        facility: LOCAL0\n"
+                  "        host_name: 127.0.0.1\n"
+                  "        port: " << port << "\n";
+    }
+    // Only this logger changes on reconfiguration, so the writers
+    // above are kept and only the cost of reconfiguring is seen.
+    stream << "- chucho::logger:\n"
+              "    name: soak.idle\n"
+              "    level: " << (flip ? "warn" : "info") << "\n";
+    return stream.str();
+}
+
+void keep_worst(std::vector<stall>& worst, std::uint64_t nanos, unsigned producer, std::size_t max)
+{
+    if (worst.size() < max || nanos > worst.front().nanos)
+    {
+        worst.push_back(stall { nanos, std::chrono::system_clock::now(), producer });
+        std::push_heap(worst.begin(), worst.end(), std::greater<stall>());
+        if (worst.size() > max)
+        {
+            std::pop_heap(worst.begin(), worst.end(), std::greater<stall>());
+            worst.pop_back();
+        }
+    }
+}
+
+void produce(unsigned id, const options& opts, const std::atomic<bool>& stop, producer_result& res)
+{
+    auto lgr = chucho::logger::get("soak");
+    std::chrono::nanoseconds interval(opts.rate == 0 ? 0 : 1000000000 / opts.rate);
+    auto next = std::chrono::steady_clock::now();
+    std::uint64_t i = 0;
+    while (!stop.load(std::memory_order_relaxed))
+    {
+        std::chrono::steady_clock::time_point start;
+        if (opts.rate == 0)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        else
+        {
+            // Timing from the intended start keeps a stall from hiding
+            // the calls that should have been made during it
+            std::this_thread::sleep_until(next);
+            start = next;
+            next += interval;
+        }
+        CHUCHO_INFO(lgr, "Soak event " << i++ << " from producer " << id);
+        auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        res.hist.record(nanos);
+        keep_worst(res.worst, nanos, id, opts.stalls);
+    }
+}
+
+std::string micros(std::uint64_t nanos)
+{
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(1) << nanos / 1000.0;
+    return stream.str();
+}
+
+void report(const std::string& scenario,
+            const options& opts,
+            std::vector<producer_result>& results,
+            status_log& statuses,
+            std::chrono::system_clock::time_point began,
+            std::chrono::steady_clock::duration took)
+{
+    histogram total;
+    std::vector<stall> worst;
+    for (auto& res : results)
+    {
+        total.merge(res.hist);
+        worst.insert(worst.end(), res.worst.begin(), res.worst.end());
+    }
+    std::sort(worst.begin(), worst.end(), std::greater<stall>());
+    if (worst.size() > opts.stalls)
+        worst.resize(opts.stalls);
+    double secs = std::chrono::duration<double>(took).count();
+    std::cout << "== " << scenario << ": " << opts.threads << " producers for " << std::fixed << std::setprecision(1) << secs << " s\n"
+              << "calls: " << total.get_count() << " (" << static_cast<std::uint64_t>(total.get_count() / secs) << "/s)\n"
+              << "latency (us): min " << micros(total.get_min())
+              << ", mean " << micros(total.get_mean())
+              << ", p50 " << micros(total.get_percentile(50.0))
+              << ", p90 " << micros(total.get_percentile(90.0))
+              << ", p99 " << micros(total.get_percentile(99.0))
+              << ", p99.9 " << micros(total.get_percentile(99.9))
+              << ", p99.99 " << micros(total.get_percentile(99.99))
+              << ", max " << micros(total.get_max()) << '\n'
+              << "statuses reported: " << statuses.get_count() << '\n'
+              << "worst stalls:\n";
+    // Statuses carry the time they were reported, which for a roll or
+    // a spill is when it finished, so allow a little past the call.
+    std::chrono::milliseconds slack(1);
+    for (const auto& st : worst)
+    {
+        auto start = st.end - std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(st.nanos));
+        std::cout << "  " << micros(st.nanos) << " us on producer " << st.producer
+                  << " at +" << std::setprecision(3) << std::chrono::duration<double>(start - began).count() << " s\n";
+        auto causes = statuses.between(start - slack, st.end + slack);
+        if (causes.empty())
+            std::cout << "      no status was reported\n";
+        for (std::size_t i = 0; i < std::min(causes.size(), MAX_CAUSES); i++)
+            std::cout << "      [" << causes[i].get_origin() << "] " << causes[i].get_message() << '\n';
+        if (causes.size() > MAX_CAUSES)
+            std::cout << "      and " << causes.size() - MAX_CAUSES << " more\n";
+    }
+    std::cout << std::endl;
+}
+
+void run(const std::string& scenario, const options& opts, status_log& statuses)
+{
+    std::unique_ptr<sink> snk;
+    if (scenario == "async")
+        snk = std::make_unique<sink>(SOCK_STREAM, std::chrono::microseconds(500));
+    else if (scenario == "syslog")
+        snk = std::make_unique<sink>(SOCK_DGRAM, std::chrono::microseconds(0));
+    std::uint16_t port = snk ? snk->get_port() : 0;
+    if (!chucho::configuration::set(get_config(scenario, opts, port, false)))
+        throw std::runtime_error("The configuration for " + scenario + " could not be set");
+    statuses.clear();
+    std::vector<producer_result> results(opts.threads);
+    std::atomic<bool> stop(false);
+    auto began = std::chrono::system_clock::now();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (unsigned i = 0; i < opts.threads; i++)
+        producers.emplace_back(produce, i, std::cref(opts), std::cref(stop), std::ref(results[i]));
+    auto end = start + std::chrono::seconds(opts.seconds);
+    bool flip = false;
+    while (std::chrono::steady_clock::now() < end)
+    {
+        auto next = opts.reconfigure == 0 ? end : std::min(end, std::chrono::steady_clock::now() + std::chrono::seconds(opts.reconfigure));
+        std::this_thread::sleep_until(next);
+        if (next < end)
+        {
+            flip = !flip;
+            chucho::configuration::set(get_config(scenario, opts, port, flip));
+        }
+    }
+    stop = true;
+    for (auto& p : producers)
+        p.join();
+    auto took = std::chrono::steady_clock::now() - start;
+    report(scenario, opts, results, statuses, began, took);
+    // Release the writers, and with them the connections to the sink
+    chucho::configuration::set("- chucho::logger:\n    name: soak\n");
+}
+
+void usage(const char* prog)
+{
+    std::cerr << "Usage: " << prog << " [options] [rolling] [async] [syslog]\n"
+                 "  --threads N       producer threads (default 4)\n"
+                 "  --seconds N       how long to run each scenario (default 10)\n"
+                 "  --rate N          calls per second per producer, 0 for no limit (default 0)\n"
+                 "  --reconfigure N   seconds between reconfigurations, 0 for none (default 2)\n"
+                 "  --stalls N        how many of the worst calls to explain (default 10)\n"
+                 "  --directory DIR   where the rolling files go (default chucho_soak)\n"
+                 "With no scenarios given, all of them are run." << std::endl;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    options opts;
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg(argv[i]);
+            if (arg == "rolling" || arg == "async" || arg == "syslog")
+            {
+                opts.scenarios.push_back(arg);
+                continue;
+            }
+            if (i + 1 == argc)
+                throw std::invalid_argument(arg);
+            std::string val(argv[++i]);
+            if (arg == "--threads")
+                opts.threads = std::stoul(val);
+            else if (arg == "--seconds")
+                opts.seconds = std::stoul(val);
+            else if (arg == "--rate")
+                opts.rate = std::stoul(val);
+            else if (arg == "--reconfigure")
+                opts.reconfigure = std::stoul(val);
+            else if (arg == "--stalls")
+                opts.stalls = std::stoul(val);
+            else if (arg == "--directory")
+                opts.directory = val;
+            else
+                throw std::invalid_argument(arg);
+        }
+        if (opts.threads == 0 || opts.seconds == 0 || opts.stalls == 0)
+            throw std::invalid_argument("0");
+    }
+    catch (std::exception&)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    if (opts.scenarios.empty())
+        opts.scenarios = { "rolling", "async", "syslog" };
+    chucho::configuration::set_style(chucho::configuration::style::OFF);
+    auto statuses = std::make_shared<status_log>();
+    chucho::status_manager::get().add(statuses);
+    int result = 0;
+    try
+    {
+        chucho::file::create_directories(opts.directory);
+        for (const auto& scn : opts.scenarios)
+            run(scn, opts, *statuses);
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        result = 1;
+    }
+    chucho::status_manager::get().remove(statuses);
+    chucho::finalize();
+    return result;
+}
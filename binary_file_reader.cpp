@@ -0,0 +1,245 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/binary_file_reader.hpp>
+#include <chucho/binary_log_format.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/logger.hpp>
+#include <cstring>
+
+namespace
+{
+
+class decoded_level : public chucho::level
+{
+public:
+    decoded_level(const std::string& name, int value, chucho::syslog::severity sev)
+        : name_(name),
+          value_(value),
+          severity_(sev)
+    {
+    }
+
+    virtual const char* get_name() const override
+    {
+        return name_.c_str();
+    }
+
+    virtual chucho::syslog::severity get_syslog_severity() const override
+    {
+        return severity_;
+    }
+
+    virtual int get_value() const override
+    {
+        return value_;
+    }
+
+private:
+    std::string name_;
+    int value_;
+    chucho::syslog::severity severity_;
+};
+
+}
+
+namespace chucho
+{
+
+binary_file_reader::binary_file_reader(const std::string& file_name)
+    : file_name_(file_name),
+      stream_(file_name, std::ios::in | std::ios::binary),
+      process_id_(0),
+      last_time_(0)
+{
+    if (!stream_.is_open())
+        throw exception("Could not open " + file_name + " for reading");
+    if (!read_header())
+        throw exception("The file " + file_name + " is not a Chucho binary log");
+}
+
+optional<event> binary_file_reader::read()
+{
+    while (true)
+    {
+        // If the record has been cut short, then go back to its
+        // start so that it can be read if the rest appears later.
+        auto start = stream_.tellg();
+        auto truncated = [&] ()
+        {
+            stream_.clear();
+            stream_.seekg(start);
+            return optional<event>();
+        };
+        int tag = stream_.get();
+        if (tag == std::char_traits<char>::eof())
+            return truncated();
+        if (tag == binary_log::HEADER)
+        {
+            stream_.unget();
+            if (!read_header())
+                return truncated();
+        }
+        else if (tag == binary_log::STRING)
+        {
+            std::uint64_t id;
+            std::string text;
+            if (!read_varint(id) || !read_bytes(text))
+                return truncated();
+            if (id != strings_.size() + 1)
+                throw exception("The file " + file_name_ + " is corrupt: string " + std::to_string(id) + " is out of order");
+            strings_.push_back(std::move(text));
+        }
+        else if (tag == binary_log::LEVEL)
+        {
+            std::uint64_t id;
+            std::uint64_t value;
+            std::uint64_t sev;
+            std::string name;
+            if (!read_varint(id) || !read_varint(value) || !read_varint(sev) || !read_bytes(name))
+                return truncated();
+            if (id != levels_.size() + 1)
+                throw exception("The file " + file_name_ + " is corrupt: level " + std::to_string(id) + " is out of order");
+            std::shared_ptr<level> lvl;
+            try
+            {
+                lvl = level::from_text(name);
+            }
+            catch (exception&)
+            {
+                lvl = std::make_shared<decoded_level>(name,
+                                                      static_cast<int>(binary_log::unzigzag(value)),
+                                                      static_cast<syslog::severity>(sev));
+            }
+            levels_.push_back(lvl);
+        }
+        else if (tag == binary_log::EVENT)
+        {
+            std::uint64_t delta;
+            std::uint64_t ids[7];
+            std::string msg;
+            if (!read_varint(delta))
+                return truncated();
+            for (auto& id : ids)
+            {
+                if (!read_varint(id))
+                    return truncated();
+            }
+            if (!read_bytes(msg))
+                return truncated();
+            std::uint64_t level_id = ids[0];
+            if (level_id == 0 || level_id > levels_.size())
+                throw exception("The file " + file_name_ + " is corrupt: level " + std::to_string(level_id) + " is unknown");
+            const std::string* lgr = string_at(ids[1]);
+            const std::string* fn = string_at(ids[2]);
+            const std::string* func = string_at(ids[4]);
+            const std::string* mrk = string_at(ids[5]);
+            const std::string* thr = string_at(ids[6]);
+            if (lgr == nullptr)
+                throw exception("The file " + file_name_ + " is corrupt: an event has no logger");
+            optional<marker> omrk;
+            if (mrk != nullptr)
+                omrk = marker(*mrk);
+            last_time_ += binary_log::unzigzag(delta);
+            event result(logger::get(*lgr),
+                         levels_[level_id - 1],
+                         msg,
+                         nullptr,
+                         static_cast<unsigned>(ids[3]),
+                         nullptr,
+                         omrk);
+            if (fn != nullptr)
+            {
+                result.file_name_store_ = *fn;
+                result.file_name_ = result.file_name_store_->c_str();
+            }
+            if (func != nullptr)
+            {
+                result.function_name_store_ = *func;
+                result.function_name_ = result.function_name_store_->c_str();
+            }
+            if (thr != nullptr)
+                result.thread_id_ = *thr;
+            result.time_ = event::clock_type::time_point();
+            result.time_ += std::chrono::microseconds(last_time_);
+            return result;
+        }
+        else
+        {
+            throw exception("The file " + file_name_ + " is corrupt: unknown record type " + std::to_string(tag));
+        }
+    }
+}
+
+bool binary_file_reader::read_bytes(std::string& out)
+{
+    std::uint64_t len;
+    if (!read_varint(len))
+        return false;
+    out.resize(len);
+    return len == 0 || stream_.read(&out[0], len);
+}
+
+bool binary_file_reader::read_header()
+{
+    char magic[sizeof(binary_log::MAGIC)];
+    if (!stream_.read(magic, sizeof(magic)))
+        return false;
+    if (std::memcmp(magic, binary_log::MAGIC, sizeof(magic)) != 0)
+        throw exception("The file " + file_name_ + " is not a Chucho binary log");
+    int version = stream_.get();
+    if (version == std::char_traits<char>::eof())
+        return false;
+    if (version != binary_log::VERSION)
+        throw exception("The file " + file_name_ + " has unsupported version " + std::to_string(version));
+    std::uint64_t base;
+    std::string host_name;
+    std::uint64_t pid;
+    if (!read_varint(base) || !read_bytes(host_name) || !read_varint(pid))
+        return false;
+    strings_.clear();
+    levels_.clear();
+    last_time_ = static_cast<std::int64_t>(base);
+    host_name_ = host_name;
+    process_id_ = static_cast<int>(pid);
+    return true;
+}
+
+bool binary_file_reader::read_varint(std::uint64_t& val)
+{
+    val = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        int c = stream_.get();
+        if (c == std::char_traits<char>::eof())
+            return false;
+        val |= static_cast<std::uint64_t>(c & 0x7f) << shift;
+        if ((c & 0x80) == 0)
+            return true;
+    }
+    throw exception("The file " + file_name_ + " is corrupt: an integer is too long");
+}
+
+const std::string* binary_file_reader::string_at(std::uint64_t id) const
+{
+    if (id == 0)
+        return nullptr;
+    if (id > strings_.size())
+        throw exception("The file " + file_name_ + " is corrupt: string " + std::to_string(id) + " is unknown");
+    return &strings_[id - 1];
+}
+
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/binary_file_writer.hpp>
+#include <chucho/binary_log_format.hpp>
+#include <chucho/pattern_formatter.hpp>
+#include <chucho/file_exception.hpp>
+#include <chucho/logger.hpp>
+#include <chucho/host.hpp>
+#include <chucho/process.hpp>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+
+std::int64_t micros_since_epoch(const chucho::event::time_type& tm)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(tm.time_since_epoch()).count();
+}
+
+}
+
+namespace chucho
+{
+
+binary_file_writer::binary_file_writer(const std::string& name,
+                                       const std::string& file_name,
+                                       on_start start,
+                                       bool flsh)
+    // The formatter is never used, but a writer must have one
+    : file_writer(name, std::make_unique<pattern_formatter>("%m%n"), start, flsh),
+      effective_trigger_(nullptr),
+      next_string_id_(1),
+      next_level_id_(1),
+      last_time_(0)
+{
+    set_status_origin("binary_file_writer");
+    open(file_name);
+}
+
+binary_file_writer::binary_file_writer(const std::string& name,
+                                       const std::string& file_name,
+                                       std::unique_ptr<file_roller>&& roller,
+                                       std::unique_ptr<file_roll_trigger>&& trigger,
+                                       on_start start,
+                                       bool flsh)
+    : file_writer(name, std::make_unique<pattern_formatter>("%m%n"), start, flsh),
+      roller_(std::move(roller)),
+      trigger_(std::move(trigger)),
+      next_string_id_(1),
+      next_level_id_(1),
+      last_time_(0)
+{
+    set_status_origin("binary_file_writer");
+    if (!roller_)
+        throw std::invalid_argument("The file_roller cannot be a unintialized");
+    if (trigger_)
+    {
+        effective_trigger_ = trigger_.get();
+    }
+    else
+    {
+        effective_trigger_ = dynamic_cast<file_roll_trigger*>(roller_.get());
+        if (!effective_trigger_)
+            throw std::invalid_argument("The binary_file_writer has no file_roll_trigger");
+    }
+    roller_->set_file_writer(*this);
+    std::string fn = file_name.empty() ? roller_->get_active_file_name() : file_name;
+    if (fn.empty())
+        throw std::invalid_argument("The file_roller does not provide an initial file name, so the binary_file_writer must be given one");
+    open(fn);
+}
+
+std::uint64_t binary_file_writer::intern(const char* text)
+{
+    if (text == nullptr)
+        return 0;
+    auto found = addresses_.find(text);
+    if (found != addresses_.end() && found->second.second == text)
+        return found->second.first;
+    if (addresses_.size() >= MAX_ADDRESSES)
+        addresses_.clear();
+    std::string str(text);
+    std::uint64_t id = intern(str);
+    addresses_[text] = std::make_pair(id, std::move(str));
+    return id;
+}
+
+std::uint64_t binary_file_writer::intern(const std::string& text)
+{
+    auto found = strings_.find(text);
+    if (found != strings_.end())
+        return found->second;
+    std::uint64_t id = next_string_id_++;
+    strings_[text] = id;
+    record_ += static_cast<char>(binary_log::STRING);
+    binary_log::put_varint(record_, id);
+    binary_log::put_bytes(record_, text.data(), text.length());
+    return id;
+}
+
+std::uint64_t binary_file_writer::intern(const level& lvl)
+{
+    const char* name = lvl.get_name();
+    auto found = levels_.find(name);
+    if (found != levels_.end())
+        return found->second;
+    std::uint64_t id = next_level_id_++;
+    levels_[name] = id;
+    record_ += static_cast<char>(binary_log::LEVEL);
+    binary_log::put_varint(record_, id);
+    binary_log::put_varint(record_, binary_log::zigzag(lvl.get_value()));
+    binary_log::put_varint(record_, static_cast<std::uint64_t>(lvl.get_syslog_severity()));
+    binary_log::put_bytes(record_, name, std::strlen(name));
+    return id;
+}
+
+std::uint64_t binary_file_writer::intern_thread(const event& evt)
+{
+    if (evt.get_thread_id())
+        return intern(*evt.get_thread_id());
+    auto me = std::this_thread::get_id();
+    auto found = threads_.find(me);
+    if (found != threads_.end())
+        return found->second;
+    std::ostringstream stream;
+    stream << me;
+    std::uint64_t id = intern(stream.str());
+    threads_[me] = id;
+    return id;
+}
+
+void binary_file_writer::opened()
+{
+    reset();
+    last_time_ = micros_since_epoch(event::clock_type::now());
+    record_.clear();
+    record_.append(binary_log::MAGIC, sizeof(binary_log::MAGIC));
+    record_ += static_cast<char>(binary_log::VERSION);
+    binary_log::put_varint(record_, last_time_);
+    const std::string& host_name = host::get_full_name();
+    binary_log::put_bytes(record_, host_name.data(), host_name.length());
+    binary_log::put_varint(record_, process::id());
+    write_bytes(record_.data(), record_.length());
+}
+
+void binary_file_writer::reset()
+{
+    addresses_.clear();
+    strings_.clear();
+    levels_.clear();
+    threads_.clear();
+    next_string_id_ = 1;
+    next_level_id_ = 1;
+}
+
+void binary_file_writer::write_impl(const event& evt)
+{
+    if (effective_trigger_ != nullptr && effective_trigger_->is_triggered(*this, evt))
+    {
+        close();
+        roller_->roll();
+        open(roller_->get_active_file_name());
+        report_info("Rolled over to " + get_file_name());
+    }
+    try
+    {
+        ensure_access();
+        if (is_open())
+        {
+            write_record(evt);
+            sync_written(evt);
+        }
+        else
+            report_error("Cannot write to " + get_file_name() + " because it is not open");
+    }
+    catch (exception& e)
+    {
+#if defined(CHUCHO_HAVE_NESTED_EXCEPTIONS)
+        std::throw_with_nested(file_exception("Could not write to " + get_file_name()));
+#else
+        throw file_exception("Could not write to " + get_file_name() + ": " + e.what());
+#endif
+    }
+}
+
+void binary_file_writer::write_record(const event& evt)
+{
+    record_.clear();
+    std::uint64_t level_id = intern(*evt.get_level());
+    std::uint64_t logger_id = intern(evt.get_logger()->get_name());
+    std::uint64_t file_id = intern(evt.get_file_name());
+    std::uint64_t function_id = intern(evt.get_function_name());
+    std::uint64_t marker_id = evt.get_marker() ? intern(evt.get_marker()->get_name()) : 0;
+    std::uint64_t thread_id = intern_thread(evt);
+    std::int64_t now = micros_since_epoch(evt.get_time());
+    record_ += static_cast<char>(binary_log::EVENT);
+    binary_log::put_varint(record_, binary_log::zigzag(now - last_time_));
+    last_time_ = now;
+    binary_log::put_varint(record_, level_id);
+    binary_log::put_varint(record_, logger_id);
+    binary_log::put_varint(record_, file_id);
+    binary_log::put_varint(record_, evt.get_line_number());
+    binary_log::put_varint(record_, function_id);
+    binary_log::put_varint(record_, marker_id);
+    binary_log::put_varint(record_, thread_id);
+    const std::string& msg = evt.get_message();
+    binary_log::put_bytes(record_, msg.data(), msg.length());
+    write_bytes(record_.data(), record_.length());
+    if (get_flush())
+        flush();
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/binary_file_writer_factory.hpp>
+#include <chucho/binary_file_writer_memento.hpp>
+#include <chucho/binary_file_writer.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/demangle.hpp>
+#include <assert.h>
+
+namespace chucho
+{
+
+binary_file_writer_factory::binary_file_writer_factory()
+{
+    set_status_origin("binary_file_writer_factory");
+}
+
+std::unique_ptr<configurable> binary_file_writer_factory::create_configurable(std::unique_ptr<memento>& mnto)
+{
+    auto bfwm = dynamic_cast<binary_file_writer_memento*>(mnto.get());
+    assert(bfwm != nullptr);
+    if (bfwm->get_name().empty())
+        throw exception("binary_file_writer_factory: The name is not set");
+    file_writer::on_start start = bfwm->get_on_start() ? *bfwm->get_on_start() : file_writer::on_start::APPEND;
+    bool flsh = bfwm->get_flush() ? *bfwm->get_flush() : true;
+    auto rlr = bfwm->get_file_roller();
+    std::unique_ptr<binary_file_writer> wrt;
+    if (rlr)
+    {
+        wrt = std::make_unique<binary_file_writer>(bfwm->get_name(),
+                                                   bfwm->get_file_name(),
+                                                   std::move(rlr),
+                                                   bfwm->get_file_roll_trigger(),
+                                                   start,
+                                                   flsh);
+    }
+    else
+    {
+        if (bfwm->get_file_roll_trigger())
+            throw exception("binary_file_writer_factory: A file_roll_trigger requires a file_roller");
+        if (bfwm->get_file_name().empty())
+            throw exception("binary_file_writer_factory: The file name is not set");
+        wrt = std::make_unique<binary_file_writer>(bfwm->get_name(),
+                                                   bfwm->get_file_name(),
+                                                   start,
+                                                   flsh);
+    }
+    if (bfwm->get_durability())
+    {
+        wrt->set_durability(*bfwm->get_durability(),
+                            bfwm->get_sync_interval() ? *bfwm->get_sync_interval() : std::chrono::milliseconds(0),
+                            bfwm->get_sync_level());
+    }
+    set_filters(*wrt, *bfwm);
+    set_thread_settings(*wrt, *bfwm);
+    report_info("Created a " + demangle::get_demangled_name(typeid(*wrt)));
+    return std::move(wrt);
+}
+
+std::unique_ptr<memento> binary_file_writer_factory::create_memento(configurator& cfg)
+{
+    auto mnto = std::make_unique<binary_file_writer_memento>(cfg);
+    return std::move(mnto);
+}
+
+}
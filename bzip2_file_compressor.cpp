@@ -17,10 +17,36 @@
 #include <chucho/bzip2_file_compressor.hpp>
 #include <chucho/exception.hpp>
 #include <chucho/file.hpp>
+#include <chucho/parallel_compressor.hpp>
 #include <bzlib.h>
 #include <fstream>
 #include <cstdio>
 
+namespace
+{
+
+// The size of one bzip2 block at compression level 9
+constexpr std::size_t BLOCK_SIZE = 900 * 1000;
+
+void compress_block(const std::vector<char>& in, std::vector<char>& out)
+{
+    // bzip2 promises that output is no more than 1% larger plus 600 bytes
+    out.resize(in.size() + in.size() / 100 + 601);
+    unsigned len = out.size();
+    int rc = BZ2_bzBuffToBuffCompress(out.data(),
+                                      &len,
+                                      const_cast<char*>(in.data()),
+                                      in.size(),
+                                      9,
+                                      0,
+                                      0);
+    if (rc != BZ_OK)
+        throw chucho::exception("Could not compress a block with bzip2: " + std::to_string(rc));
+    out.resize(len);
+}
+
+}
+
 namespace chucho
 {
 
@@ -30,6 +56,32 @@ bzip2_file_compressor::bzip2_file_compressor(unsigned min_idx)
 }
 
 void bzip2_file_compressor::compress(const std::string& file_name)
+{
+    if (get_threads() == 1)
+        run_at_nice([this, &file_name] () { compress_stream(file_name); });
+    else
+        compress_blocks(file_name);
+}
+
+void bzip2_file_compressor::compress_blocks(const std::string& file_name)
+{
+    std::ifstream in(file_name.c_str(), std::ios::in | std::ios::binary);
+    if (!in.is_open())
+        throw exception("Could not open " + file_name + " for reading");
+    std::string to_write = file_name + get_extension();
+    std::ofstream out(to_write.c_str(), std::ios::out | std::ios::binary);
+    if (!out.is_open())
+        throw exception("Could not open " + to_write + " for writing");
+    parallel_compressor pc(get_threads(), get_nice(), BLOCK_SIZE, compress_block);
+    pc.compress(in, out);
+    out.close();
+    if (!out)
+        throw exception("Could not write to " + to_write);
+    in.close();
+    file::remove(file_name);
+}
+
+void bzip2_file_compressor::compress_stream(const std::string& file_name)
 {
     std::ifstream in(file_name.c_str(), std::ios::in | std::ios::binary);
     if (!in.is_open())
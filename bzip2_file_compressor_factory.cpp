@@ -42,6 +42,7 @@ std::unique_ptr<configurable> bzip2_file_compressor_factory::create_configurable
         mi = 1;
     }
     auto bfc = std::make_unique<bzip2_file_compressor>(mi);
+    set_threads(*bfc, *fcm);
     report_info("Created a " + demangle::get_demangled_name(typeid(*bfc)));
     return std::move(bfc);
 }
@@ -17,12 +17,17 @@
 #include <chucho/cache_and_release_filter.hpp>
 #include <chucho/event_cache.hpp>
 #include <chucho/logger.hpp>
+#include <algorithm>
+#include <sstream>
 
 namespace chucho
 {
 
 using namespace std::chrono_literals;
 
+constexpr std::size_t cache_and_release_filter::DEFAULT_EVENTS_PER_THREAD;
+constexpr std::size_t cache_and_release_filter::MAX_THREADS;
+
 cache_and_release_filter::cache_and_release_filter(const std::string& name,
                                                    writer& wrt,
                                                    std::shared_ptr<level> cache_threshold,
@@ -32,7 +37,10 @@ cache_and_release_filter::cache_and_release_filter(const std::string& name,
   : writeable_filter(name, wrt),
     event_cache_provider(chunk_size, chunk_size * max_chunks),
     release_threshold_(release_threshold),
-    cache_threshold_(cache_threshold)
+    cache_threshold_(cache_threshold),
+    events_per_thread_(0),
+    max_age_(0),
+    recorded_(0)
 {
 }
 
@@ -44,8 +52,48 @@ cache_and_release_filter::cache_and_release_filter(const std::string& name,
     : writeable_filter(name),
       event_cache_provider(chunk_size, chunk_size * max_chunks),
       release_threshold_(release_threshold),
-      cache_threshold_(cache_threshold)
+      cache_threshold_(cache_threshold),
+      events_per_thread_(0),
+      max_age_(0),
+      recorded_(0)
+{
+}
+
+// The event cache is not used in flight recorder mode, so it
+// is given the smallest footprint it allows.
+cache_and_release_filter::cache_and_release_filter(const std::string& name,
+                                                   writer& wrt,
+                                                   std::shared_ptr<level> cache_threshold,
+                                                   std::shared_ptr<level> release_threshold,
+                                                   std::size_t events_per_thread,
+                                                   const std::chrono::milliseconds& max_age)
+    : writeable_filter(name, wrt),
+      event_cache_provider(1024, 2048),
+      release_threshold_(release_threshold),
+      cache_threshold_(cache_threshold),
+      events_per_thread_(events_per_thread),
+      max_age_(max_age),
+      recorded_(0)
 {
+    if (events_per_thread_ == 0)
+        throw std::invalid_argument("The number of events per thread in the cache_and_release_filter '" + name + "' must be greater than zero");
+}
+
+cache_and_release_filter::cache_and_release_filter(const std::string& name,
+                                                   std::shared_ptr<level> cache_threshold,
+                                                   std::shared_ptr<level> release_threshold,
+                                                   std::size_t events_per_thread,
+                                                   const std::chrono::milliseconds& max_age)
+    : writeable_filter(name),
+      event_cache_provider(1024, 2048),
+      release_threshold_(release_threshold),
+      cache_threshold_(cache_threshold),
+      events_per_thread_(events_per_thread),
+      max_age_(max_age),
+      recorded_(0)
+{
+    if (events_per_thread_ == 0)
+        throw std::invalid_argument("The number of events per thread in the cache_and_release_filter '" + name + "' must be greater than zero");
 }
 
 filter::result cache_and_release_filter::evaluate(const event& evt)
@@ -55,20 +103,107 @@ filter::result cache_and_release_filter::evaluate(const event& evt)
     {
         if (!has_writer())
             throw std::runtime_error("No writer has been set in the cache_filter '" + get_name() + "'");
-        auto e = cache_->pop(1ms);
-        while (e)
+        if (is_flight_recorder())
         {
-            write(*e);
-            e = cache_->pop(1ms);
+            release_recorded(evt);
+        }
+        else
+        {
+            auto e = cache_->pop(1ms);
+            while (e)
+            {
+                write(*e);
+                e = cache_->pop(1ms);
+            }
         }
         rs = result::ACCEPT;
     }
     else if (*evt.get_level() <= *cache_threshold_)
     {
-        cache_->push(evt);
+        if (is_flight_recorder())
+            record(evt);
+        else
+            cache_->push(evt);
         rs = result::DENY;
     }
     return rs;
 }
 
+// The writer's guard is held while filters are evaluated, so
+// the rings need no locking of their own.
+void cache_and_release_filter::record(const event& evt)
+{
+    auto id = std::this_thread::get_id();
+    auto found = rings_.find(id);
+    if (found == rings_.end())
+    {
+        if (rings_.size() >= MAX_THREADS)
+        {
+            // Threads that have ended never log again, so the ring
+            // that has waited longest is the one to give up
+            auto oldest = std::min_element(rings_.begin(),
+                                           rings_.end(),
+                                           [] (const std::pair<const std::thread::id, ring>& one,
+                                               const std::pair<const std::thread::id, ring>& two) { return one.second.last_recorded < two.second.last_recorded; });
+            rings_.erase(oldest);
+        }
+        std::ostringstream stream;
+        stream << id;
+        found = rings_.emplace(id, ring()).first;
+        found->second.thread_id = stream.str();
+        found->second.next = 0;
+    }
+    ring& rng = found->second;
+    rng.last_recorded = ++recorded_;
+    if (rng.events.size() < events_per_thread_)
+    {
+        rng.events.push_back(evt);
+    }
+    else
+    {
+        rng.events[rng.next] = evt;
+        rng.next = (rng.next + 1) % events_per_thread_;
+    }
+}
+
+void cache_and_release_filter::release_recorded(const event& evt)
+{
+    std::vector<std::pair<event*, const std::string*>> merged;
+    for (auto& p : rings_)
+    {
+        ring& rng = p.second;
+        for (std::size_t i = 0; i < rng.events.size(); i++)
+        {
+            event& e = rng.events[(rng.next + i) % rng.events.size()];
+            if (max_age_.count() == 0 || evt.get_time() - e.get_time() <= max_age_)
+                merged.emplace_back(&e, &rng.thread_id);
+        }
+    }
+    // Each ring is already in time order, so a stable sort keeps
+    // the order of events that share a time stamp in one thread.
+    std::stable_sort(merged.begin(),
+                     merged.end(),
+                     [] (const std::pair<event*, const std::string*>& one, const std::pair<event*, const std::string*>& two) { return one.first->get_time() < two.first->get_time(); });
+    for (auto& p : merged)
+    {
+        p.first->thread_id_ = *p.second;
+        write(*p.first);
+    }
+    // Threads that have logged nothing since the last release
+    // give up their rings. The others keep their storage.
+    for (auto itor = rings_.begin(); itor != rings_.end(); )
+    {
+        if (itor->second.events.empty())
+        {
+            itor = rings_.erase(itor);
+        }
+        else
+        {
+            itor->second.events.clear();
+            itor->second.next = 0;
+            ++itor;
+        }
+    }
+}
+
 }
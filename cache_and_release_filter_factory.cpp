@@ -43,11 +43,29 @@ std::unique_ptr<configurable> cache_and_release_filter_factory::create_configura
         throw exception("cache_and_release_filter_factory: The cache threshold must be set");
     if (!cfm->get_release_threshold())
         throw exception("cache_and_release_filter_factory: The release threshold must be set");
-    auto cnf = std::make_unique<cache_and_release_filter>(cfm->get_name(),
-                                                          cfm->get_cache_threshold(),
-                                                          cfm->get_release_threshold(),
-                                                          *cfm->get_chunk_size(),
-                                                          *cfm->get_max_chunks());
+    std::unique_ptr<cache_and_release_filter> cnf;
+    if (cfm->get_flight_recorder())
+    {
+        std::size_t num = cfm->get_events_per_thread() ?
+            *cfm->get_events_per_thread() : cache_and_release_filter::DEFAULT_EVENTS_PER_THREAD;
+        std::chrono::milliseconds age = cfm->get_max_age() ?
+            *cfm->get_max_age() : std::chrono::milliseconds(0);
+        cnf = std::make_unique<cache_and_release_filter>(cfm->get_name(),
+                                                         cfm->get_cache_threshold(),
+                                                         cfm->get_release_threshold(),
+                                                         num,
+                                                         age);
+    }
+    else
+    {
+        if (cfm->get_events_per_thread() || cfm->get_max_age())
+            report_warning("The events per thread and max age of a cache_and_release_filter are only used when it is a flight recorder");
+        cnf = std::make_unique<cache_and_release_filter>(cfm->get_name(),
+                                                         cfm->get_cache_threshold(),
+                                                         cfm->get_release_threshold(),
+                                                         *cfm->get_chunk_size(),
+                                                         *cfm->get_max_chunks());
+    }
     report_info("Created a " + demangle::get_demangled_name(typeid(*cnf)));
     return std::move(cnf);
 }
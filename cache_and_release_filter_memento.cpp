@@ -24,7 +24,8 @@ namespace chucho
 cache_and_release_filter_memento::cache_and_release_filter_memento(configurator &cfg)
     : filter_memento(cfg),
       chunk_size_(cache_and_release_filter::DEFAULT_CHUNK_SIZE),
-      max_chunks_(cache_and_release_filter::DEFAULT_MAX_CHUNKS)
+      max_chunks_(cache_and_release_filter::DEFAULT_MAX_CHUNKS),
+      flight_recorder_(false)
 {
     set_status_origin("cache_and_release_filter_memento");
     set_default_name(typeid(cache_and_release_filter));
@@ -32,11 +33,19 @@ cache_and_release_filter_memento::cache_and_release_filter_memento(configurator
     cfg.get_security_policy().set_integer("cache_and_release_filter::max_chunks", 2, 1000000);
     cfg.get_security_policy().set_text("cache_and_release_filter::chunk_size(text)", 9);
     cfg.get_security_policy().set_text("cache_and_release_filter::max_chunks(text)", 7);
+    cfg.get_security_policy().set_integer("cache_and_release_filter::events_per_thread", 1, 10000000);
+    cfg.get_security_policy().set_integer("cache_and_release_filter::max_age", 0, 60 * 60 * 24);
+    cfg.get_security_policy().set_text("cache_and_release_filter::events_per_thread(text)", 8);
+    cfg.get_security_policy().set_text("cache_and_release_filter::flight_recorder", 5);
+    cfg.get_security_policy().set_text("cache_and_release_filter::max_age(text)", 5);
     set_handler("release_threshold", [this](const std::string &name) { release_threshold_ = level::from_text(validate("cache_and_release_filter::release_threshold", name)); });
     set_handler("cache_threshold", [this](const std::string &name) { cache_threshold_ = level::from_text(validate("cache_and_release_filter::cache_threshold", name)); });
     set_handler("chunk_size", [this] (const std::string& s) { chunk_size_ = static_cast<std::size_t>(validate("cache_and_release_filter::chunk_size",
         text_util::parse_byte_size(validate("cache_and_release_filter::chunk_size(text)", s)))); });
     set_handler("max_chunks", [this] (const std::string& cap) { max_chunks_ = validate("cache_and_release_filter::max_chunks", std::stoul(validate("cache_and_release_filter::max_chunks(text)", cap))); });
+    set_handler("flight_recorder", [this] (const std::string& val) { flight_recorder_ = boolean_value(validate("cache_and_release_filter::flight_recorder", val)); });
+    set_handler("events_per_thread", [this] (const std::string& num) { events_per_thread_ = validate("cache_and_release_filter::events_per_thread", std::stoul(validate("cache_and_release_filter::events_per_thread(text)", num))); });
+    set_handler("max_age", [this] (const std::string& age) { max_age_ = std::chrono::seconds(validate("cache_and_release_filter::max_age", std::stoul(validate("cache_and_release_filter::max_age(text)", age)))); });
 }
 
 }
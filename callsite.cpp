@@ -0,0 +1,272 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/callsite.hpp>
+#include <chucho/garbage_cleaner.hpp>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+namespace
+{
+
+struct rule
+{
+    std::string file_pattern;
+    unsigned first_line;
+    unsigned last_line;
+    std::shared_ptr<chucho::level> lvl;
+};
+
+// Callsites that outlive the registry must not touch it
+std::atomic<bool> registry_finalized(false);
+
+struct static_data
+{
+    static_data();
+    ~static_data();
+
+    std::vector<chucho::callsite*> sites_;
+    std::vector<rule> rules_;
+    std::mutex guard_;
+};
+
+static_data::static_data()
+{
+    chucho::garbage_cleaner::get().add([this] () { delete this; });
+}
+
+static_data::~static_data()
+{
+    registry_finalized.store(true);
+}
+
+static_data& data()
+{
+    static std::once_flag once;
+    // This will be cleaned in finalize()
+    static static_data* sd;
+
+    std::call_once(once, [&] () { sd = new static_data(); });
+    return *sd;
+}
+
+bool glob_matches(const char* pat, const char* text)
+{
+    const char* star = nullptr;
+    const char* resume = nullptr;
+    while (*text != 0)
+    {
+        if (*pat == '*')
+        {
+            star = pat++;
+            resume = text;
+        }
+        else if (*pat == '?' || *pat == *text)
+        {
+            ++pat;
+            ++text;
+        }
+        else if (star != nullptr)
+        {
+            pat = star + 1;
+            text = ++resume;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    while (*pat == '*')
+        ++pat;
+    return *pat == 0;
+}
+
+bool file_matches(const std::string& pattern, const char* file_name)
+{
+    if (file_name == nullptr)
+        return false;
+    if (glob_matches(pattern.c_str(), file_name))
+        return true;
+    for (const char* p = file_name; *p != 0; p++)
+    {
+        if ((*p == '/' || *p == '\\') && glob_matches(pattern.c_str(), p + 1))
+            return true;
+    }
+    return false;
+}
+
+bool rule_matches(const rule& rl, const chucho::callsite& site)
+{
+    return site.get_line_number() >= rl.first_line &&
+           site.get_line_number() <= rl.last_line &&
+           file_matches(rl.file_pattern, site.get_file_name());
+}
+
+rule parse_spec(const std::string& spec)
+{
+    rule result;
+    result.first_line = 0;
+    result.last_line = std::numeric_limits<unsigned>::max();
+    auto colon = spec.rfind(':');
+    // Don't mistake a Windows drive letter for the line separator
+    if (colon != std::string::npos && colon > 1 && spec.find_first_not_of("0123456789-", colon + 1) == std::string::npos)
+    {
+        std::string lines = spec.substr(colon + 1);
+        result.file_pattern = spec.substr(0, colon);
+        try
+        {
+            auto dash = lines.find('-');
+            result.first_line = std::stoul(lines.substr(0, dash));
+            result.last_line = dash == std::string::npos ? result.first_line : std::stoul(lines.substr(dash + 1));
+        }
+        catch (std::exception&)
+        {
+            throw std::invalid_argument("The line range of the callsite specification '" + spec + "' is invalid");
+        }
+        if (result.first_line > result.last_line)
+            throw std::invalid_argument("The line range of the callsite specification '" + spec + "' is backwards");
+    }
+    else
+    {
+        result.file_pattern = spec;
+    }
+    if (result.file_pattern.empty())
+        throw std::invalid_argument("The callsite specification '" + spec + "' has no file name");
+    return result;
+}
+
+}
+
+namespace chucho
+{
+
+class callsite_registry
+{
+public:
+    static std::size_t add_rule(const std::string& spec, std::shared_ptr<level> lvl)
+    {
+        rule rl = parse_spec(spec);
+        rl.lvl = lvl;
+        static_data& sd(data());
+        std::lock_guard<std::mutex> lg(sd.guard_);
+        sd.rules_.push_back(rl);
+        std::size_t count = 0;
+        for (auto site : sd.sites_)
+        {
+            if (rule_matches(rl, *site))
+            {
+                site->set_override(rl.lvl);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    static void reset()
+    {
+        static_data& sd(data());
+        std::lock_guard<std::mutex> lg(sd.guard_);
+        sd.rules_.clear();
+        for (auto site : sd.sites_)
+            site->clear_override();
+    }
+};
+
+callsite::callsite(const char* const file_name,
+                   unsigned line_number,
+                   const char* const function_name)
+    : file_name_(file_name),
+      line_number_(line_number),
+      function_name_(function_name),
+      overridden_(false),
+      threshold_(0)
+{
+    static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.guard_);
+    sd.sites_.push_back(this);
+    // The most recent matching rule wins
+    auto found = std::find_if(sd.rules_.rbegin(),
+                              sd.rules_.rend(),
+                              [this] (const rule& rl) { return rule_matches(rl, *this); });
+    if (found != sd.rules_.rend())
+        set_override(found->lvl);
+}
+
+callsite::~callsite()
+{
+    // Callsites are destroyed when their module is unloaded or
+    // during static destruction, which may be after finalize()
+    if (registry_finalized.load())
+        return;
+    static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.guard_);
+    auto found = std::find(sd.sites_.begin(), sd.sites_.end(), this);
+    if (found != sd.sites_.end())
+        sd.sites_.erase(found);
+}
+
+void callsite::clear_override()
+{
+    overridden_.store(false, std::memory_order_release);
+    override_.reset();
+}
+
+std::shared_ptr<level> callsite::get_override() const
+{
+    std::lock_guard<std::mutex> lg(data().guard_);
+    return override_;
+}
+
+void callsite::set_override(std::shared_ptr<level> lvl)
+{
+    override_ = lvl;
+    threshold_.store(lvl->get_value(), std::memory_order_relaxed);
+    overridden_.store(true, std::memory_order_release);
+}
+
+namespace callsites
+{
+
+std::size_t disable(const std::string& spec)
+{
+    return callsite_registry::add_rule(spec, level::OFF_());
+}
+
+std::size_t enable(const std::string& spec, std::shared_ptr<level> lvl)
+{
+    if (!lvl)
+        throw std::invalid_argument("The callsite level cannot be an uninitialized std::shared_ptr");
+    return callsite_registry::add_rule(spec, lvl);
+}
+
+std::vector<const callsite*> get_registered()
+{
+    static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.guard_);
+    return std::vector<const callsite*>(sd.sites_.begin(), sd.sites_.end());
+}
+
+void reset()
+{
+    callsite_registry::reset();
+}
+
+}
+
+}
@@ -23,11 +23,22 @@
 #include <aws/logs/model/DescribeLogStreamsRequest.h>
 #include <aws/core/utils/Outcome.h>
 #include <fstream>
+#include <functional>
 
 namespace
 {
 
 constexpr const std::size_t MAX_WIRE_SIZE = 1048576;
+constexpr const unsigned MAX_SEND_ATTEMPTS = 8;
+constexpr const std::chrono::milliseconds FIRST_RETRY_DELAY(200);
+constexpr const std::chrono::milliseconds MAX_RETRY_DELAY(10000);
+
+bool is_throttled(const Aws::Client::AWSError<Aws::CloudWatchLogs::CloudWatchLogsErrors>& err)
+{
+    return err.ShouldRetry() ||
+           err.GetExceptionName() == "ThrottlingException" ||
+           err.GetExceptionName() == "ServiceUnavailableException";
+}
 
 std::string find_aws_region()
 {
@@ -80,7 +91,7 @@ cloudwatch_writer::cloudwatch_writer(const std::string& name,
                                      const std::string& log_group,
                                      const std::string& log_stream,
                                      std::size_t batch_size)
-    : cloudwatch_writer(name, std::move(fmt), log_group, log_stream, find_aws_region(), batch_size)
+    : cloudwatch_writer(name, std::move(fmt), log_group, log_stream, find_aws_region(), std::string(), batch_size)
 {
 }
 
@@ -90,92 +101,229 @@ cloudwatch_writer::cloudwatch_writer(const std::string& name,
                                      const std::string& log_stream,
                                      const std::string& region,
                                      std::size_t batch_size)
+    : cloudwatch_writer(name, std::move(fmt), log_group, log_stream, region, std::string(), batch_size)
+{
+}
+
+cloudwatch_writer::cloudwatch_writer(const std::string& name,
+                                     std::unique_ptr<formatter>&& fmt,
+                                     const std::string& log_group,
+                                     const std::string& log_stream,
+                                     const std::string& region,
+                                     const std::string& endpoint,
+                                     std::size_t batch_size)
     : cloud_writer(name, std::move(fmt)),
       log_group_(log_group),
       log_stream_(log_stream),
-      wire_size_(0),
+      filling_(0),
+      sending_(false),
+      stop_(false),
       batch_size_(std::max(1UL, std::min(batch_size, 10000UL))),
-      region_(region)
+      region_(region),
+      endpoint_(endpoint)
 {
     set_status_origin("cloudwatch_writer");
-    Aws::Client::ClientConfiguration conf;
-    conf.region = region;
-    client_ = std::make_unique<Aws::CloudWatchLogs::CloudWatchLogsClient>(conf);
     if (batch_size > 10000)
         report_warning("The batch size of " + std::to_string(batch_size) + " has been lowered to the maximum of 10000");
     if (batch_size == 0)
         report_warning("The batch size of 0 has been changed to 1");
+    batches_[0].events.reserve(batch_size_);
+    batches_[1].events.reserve(batch_size_);
+    worker_ = std::make_unique<std::thread>(std::bind(&cloudwatch_writer::thread_main, this));
+}
+
+cloudwatch_writer::~cloudwatch_writer()
+{
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
+    std::unique_lock<std::mutex> lock(guard_);
+    stop_ = true;
+    lock.unlock();
+    send_condition_.notify_one();
+    worker_->join();
+}
+
+void cloudwatch_writer::connect()
+{
+    Aws::Client::ClientConfiguration conf;
+    conf.region = region_;
+    if (!endpoint_.empty())
+        conf.endpointOverride = endpoint_;
+    client_ = std::make_unique<Aws::CloudWatchLogs::CloudWatchLogsClient>(conf);
+    try
+    {
+        refresh_sequence_token();
+    }
+    catch (...)
+    {
+        client_.reset();
+        throw;
+    }
+}
+
+void cloudwatch_writer::flush()
+{
+    std::unique_lock<std::mutex> lock(guard_);
+    sent_condition_.wait(lock, [this] () { return !sending_; });
+    if (!batches_[filling_].events.empty())
+    {
+        hand_off(lock);
+        sent_condition_.wait(lock, [this] () { return !sending_; });
+    }
+}
+
+std::size_t cloudwatch_writer::get_current_batch_size()
+{
+    std::lock_guard<std::mutex> lock(guard_);
+    return batches_[filling_].events.size();
+}
+
+void cloudwatch_writer::hand_off(std::unique_lock<std::mutex>& lock)
+{
+    sent_condition_.wait(lock, [this] () { return !sending_; });
+    filling_ ^= 1;
+    sending_ = true;
+    send_condition_.notify_one();
+}
+
+void cloudwatch_writer::refresh_sequence_token()
+{
+    next_token_.clear();
     Aws::CloudWatchLogs::Model::DescribeLogStreamsRequest req;
     req.SetLogGroupName(log_group_.c_str());
     req.SetLogStreamNamePrefix(log_stream_.c_str());
     req.SetOrderBy(Aws::CloudWatchLogs::Model::OrderBy::LogStreamName);
     req.SetLimit(50);
-    bool finished = false;
-    while (!finished)
+    while (true)
     {
         auto oc = client_->DescribeLogStreams(req);
-        if (oc.IsSuccess())
-        {
-            if (oc.GetResult().GetLogStreams().empty())
-            {
-                break;
-            }
-            else
-            {
-                for (const auto& s : oc.GetResult().GetLogStreams())
-                {
-                    if (s.GetLogStreamName() == log_stream_)
-                    {
-                        next_token_ = s.GetUploadSequenceToken();
-                        finished = true;
-                        break;
-                    }
-                }
-            }
-        }
-        else
+        if (!oc.IsSuccess())
         {
             const auto &err = oc.GetError();
             if (err.GetExceptionName() != "ResourceNotFoundException")
-                throw exception("AWS error describing log streams: (" + err.GetExceptionName() + ") " + err.GetMessage());
-            break;
+                report_error("AWS error describing log streams: (" + err.GetExceptionName() + ") " + err.GetMessage());
+            return;
+        }
+        if (oc.GetResult().GetLogStreams().empty())
+            return;
+        for (const auto& s : oc.GetResult().GetLogStreams())
+        {
+            if (s.GetLogStreamName() == log_stream_)
+            {
+                next_token_ = s.GetUploadSequenceToken();
+                return;
+            }
         }
         if (oc.GetResult().GetNextToken().empty())
-            break;
+            return;
         req.SetNextToken(oc.GetResult().GetNextToken());
     }
 }
 
-void cloudwatch_writer::flush()
+void cloudwatch_writer::send(batch& bat)
 {
-    if (!events_.empty())
+    if (!client_)
+    {
+        // The connection failed earlier, so try again
+        try
+        {
+            connect();
+        }
+        catch (std::exception& e)
+        {
+            report_error("Error connecting to Cloudwatch, so " + std::to_string(bat.events.size()) +
+                " events have been dropped: " + e.what());
+            return;
+        }
+    }
+    Aws::CloudWatchLogs::Model::PutLogEventsRequest req;
+    req.SetLogGroupName(log_group_.c_str());
+    req.SetLogStreamName(log_stream_.c_str());
+    req.SetLogEvents(std::move(bat.events));
+    std::chrono::milliseconds delay = FIRST_RETRY_DELAY;
+    for (unsigned attempt = 1; ; attempt++)
     {
-        Aws::CloudWatchLogs::Model::PutLogEventsRequest req;
-        req.SetLogGroupName(log_group_.c_str());
-        req.SetLogStreamName(log_stream_.c_str());
         if (!next_token_.empty())
             req.SetSequenceToken(next_token_);
-        guard_.lock();
-        req.SetLogEvents(std::move(events_));
-        guard_.unlock();
-        wire_size_ = 0;
         auto oc = client_->PutLogEvents(req);
         if (oc.IsSuccess())
         {
             next_token_ = oc.GetResult().GetNextSequenceToken();
+            return;
+        }
+        const auto& err = oc.GetError();
+        if (err.GetExceptionName() == "DataAlreadyAcceptedException")
+        {
+            // A previous attempt got through, but its response was lost
+            refresh_sequence_token();
+            return;
+        }
+        if (attempt == MAX_SEND_ATTEMPTS)
+        {
+            report_error("AWS error putting events, so " + std::to_string(req.GetLogEvents().size()) +
+                " events have been dropped: (" + err.GetExceptionName() + ") " + err.GetMessage());
+            return;
+        }
+        if (err.GetExceptionName() == "InvalidSequenceTokenException")
+        {
+            refresh_sequence_token();
+        }
+        else if (is_throttled(err))
+        {
+            std::this_thread::sleep_for(delay);
+            delay = std::min(delay * 2, MAX_RETRY_DELAY);
         }
         else
         {
-            const auto& err = oc.GetError();
-            throw exception("AWS error putting events: (" + err.GetExceptionName() + ") " + err.GetMessage());
+            report_error("AWS error putting events, so " + std::to_string(req.GetLogEvents().size()) +
+                " events have been dropped: (" + err.GetExceptionName() + ") " + err.GetMessage());
+            return;
         }
     }
 }
 
-std::size_t cloudwatch_writer::get_current_batch_size()
+void cloudwatch_writer::thread_main()
 {
-    std::lock_guard<std::mutex> lock(guard_);
-    return events_.size();
+    thread_state state;
+    configure_thread("cloudwatch", state);
+    try
+    {
+        connect();
+    }
+    catch (std::exception& e)
+    {
+        report_error("Error connecting to Cloudwatch: " + std::string(e.what()));
+    }
+    std::unique_lock<std::mutex> lock(guard_);
+    while (true)
+    {
+        send_condition_.wait(lock, [this] () { return sending_ || stop_; });
+        if (!sending_)
+            break;
+        batch& bat(batches_[filling_ ^ 1]);
+        // The other batch belongs to the writing thread, so the lock can be released
+        lock.unlock();
+        configure_thread("cloudwatch", state);
+        try
+        {
+            send(bat);
+        }
+        catch (std::exception& e)
+        {
+            report_error("Error sending events to Cloudwatch: " + std::string(e.what()));
+        }
+        bat.events.clear();
+        bat.events.reserve(batch_size_);
+        bat.wire_size = 0;
+        lock.lock();
+        sending_ = false;
+        sent_condition_.notify_all();
+    }
 }
 
 void cloudwatch_writer::write_impl(const event& evt)
@@ -184,11 +332,15 @@ void cloudwatch_writer::write_impl(const event& evt)
     ile.SetTimestamp(millis_since_epoch(evt));
     ile.SetMessage(formatter_->format(evt));
     auto esz = get_wire_size(ile);
-    if (events_.size() == batch_size_ || wire_size_ + esz > MAX_WIRE_SIZE)
-        flush();
-    std::lock_guard<std::mutex> lock(guard_);
-    events_.push_back(ile);
-    wire_size_ += esz;
+    std::unique_lock<std::mutex> lock(guard_);
+    batch* bat = &batches_[filling_];
+    if (bat->events.size() == batch_size_ || bat->wire_size + esz > MAX_WIRE_SIZE)
+    {
+        hand_off(lock);
+        bat = &batches_[filling_];
+    }
+    bat->events.push_back(std::move(ile));
+    bat->wire_size += esz;
 }
 
 }
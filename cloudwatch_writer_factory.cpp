@@ -38,7 +38,17 @@ std::unique_ptr<configurable> cloudwatch_writer_factory::create_configurable(std
         throw exception("cloudwatch_writer_factory: The writer's log stream is not set");
     std::size_t batch_sz = cwm->get_batch_size() ? *cwm->get_batch_size() : cloudwatch_writer::DEFAULT_BATCH_SIZE;
     std::unique_ptr<cloudwatch_writer> cw;
-    if (cwm->get_region().empty())
+    if (!cwm->get_endpoint().empty())
+    {
+        cw = std::make_unique<cloudwatch_writer>(cwm->get_name(),
+                                                 std::move(fmt),
+                                                 cwm->get_log_group(),
+                                                 cwm->get_log_stream(),
+                                                 cwm->get_region(),
+                                                 cwm->get_endpoint(),
+                                                 batch_sz);
+    }
+    else if (cwm->get_region().empty())
     {
         cw = std::make_unique<cloudwatch_writer>(cwm->get_name(),
                                                  std::move(fmt),
@@ -56,6 +66,7 @@ std::unique_ptr<configurable> cloudwatch_writer_factory::create_configurable(std
                                                  batch_sz);
     }
     set_filters(*cw, *cwm);
+    set_thread_settings(*cw, *cwm);
     report_info("Created a " + demangle::get_demangled_name(typeid(*cw)));
     return std::move(cw);
 }
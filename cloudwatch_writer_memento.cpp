@@ -25,10 +25,12 @@ cloudwatch_writer_memento::cloudwatch_writer_memento(configurator& cfg)
 {
     set_status_origin("file_writer_memento");
     set_default_name(typeid(cloudwatch_writer));
+    cfg.get_security_policy().set_text("cloudwatch_writer::endpoint", 1024);
     cfg.get_security_policy().set_text("cloudwatch_writer::log_group", 512);
     cfg.get_security_policy().set_text("cloudwatch_writer::log_stream", 512);
     cfg.get_security_policy().set_integer("cloudwatch_writer::batch_size", 1, 10000);
     cfg.get_security_policy().set_text("cloudwatch_writer::batch_size(text)", 5);
+    set_handler("endpoint", [this] (const std::string& s) { endpoint_ = validate("cloudwatch_writer::endpoint", s); });
     set_handler("log_group", [this] (const std::string& s) { log_group_ = validate("cloudwatch_writer::log_group", s); });
     set_handler("log_stream", [this] (const std::string& s) { log_stream_ = validate("cloudwatch_writer::log_stream", s); });
     set_handler("region", [this] (const std::string& s) { region_ = validate("cloudwatch_writer::region", s); });
@@ -283,6 +283,34 @@ IF(CHUCHO_POSIX)
     ENDIF()
     CHECK_CXX_SYMBOL_EXISTS(O_LARGEFILE fcntl.h CHUCHO_HAVE_O_LARGEFILE)
 
+    # Data-only syncing for file_writer durability
+    CHECK_CXX_SYMBOL_EXISTS(fdatasync unistd.h CHUCHO_HAVE_FDATASYNC)
+
+    # Watching the configuration file
+    CHECK_CXX_SYMBOL_EXISTS(inotify_init1 sys/inotify.h CHUCHO_HAVE_INOTIFY)
+
+    # Batched datagrams for syslog_writer
+    CHECK_CXX_SYMBOL_EXISTS(sendmmsg sys/socket.h CHUCHO_HAVE_SENDMMSG)
+
+    # Shared memory for shm_ring_writer
+    CHECK_CXX_SYMBOL_EXISTS(shm_open sys/mman.h CHUCHO_HAVE_SHM_OPEN)
+    IF(NOT CHUCHO_HAVE_SHM_OPEN)
+        SET(CMAKE_REQUIRED_LIBRARIES rt)
+        CHECK_CXX_SYMBOL_EXISTS(shm_open sys/mman.h CHUCHO_HAVE_SHM_OPEN_IN_RT)
+        UNSET(CMAKE_REQUIRED_LIBRARIES)
+        IF(CHUCHO_HAVE_SHM_OPEN_IN_RT)
+            SET(CHUCHO_HAVE_SHM_OPEN TRUE CACHE INTERNAL "Whether we have shm_open")
+            SET(CHUCHO_SHM_LIBS rt CACHE INTERNAL "The libraries required for shm_open")
+        ENDIF()
+    ENDIF()
+
+    # io_uring for io_uring_file_writer. No library is needed, since the
+    # ring is driven with the system calls directly.
+    IF(CHUCHO_LINUX)
+        CHECK_CXX_SOURCE_COMPILES("#include <linux/io_uring.h>\n#include <sys/syscall.h>\nint main() { io_uring_sqe sqe; sqe.opcode = IORING_OP_WRITE_FIXED; sqe.fsync_flags = IORING_FSYNC_DATASYNC; sqe.flags = IOSQE_IO_DRAIN; return __NR_io_uring_setup + __NR_io_uring_enter + __NR_io_uring_register + IORING_REGISTER_BUFFERS; }"
+                                  CHUCHO_HAVE_IO_URING)
+    ENDIF()
+
     # Doors
     IF(CHUCHO_SOLARIS)
         CHECK_INCLUDE_FILE_CXX(door.h CHUCHO_HAVE_DOOR_H)
@@ -512,7 +540,7 @@ CHUCHO_FIND_PACKAGE(LZ4 INCLUDE lz4.h LIBS lz4 PKG_CONFIG_NAME liblz4 SYMBOLS
 CHUCHO_FIND_PACKAGE(SOCI INCLUDE soci/soci.h LIBS soci_core)
 CHUCHO_FIND_PACKAGE(ZEROMQ INCLUDE zmq.h LIBS zmq PKG_CONFIG_NAME libzmq SYMBOLS
     zmq_ctx_new zmq_ctx_destroy zmq_socket zmq_close zmq_connect zmq_msg_send
-    zmq_msg_init_size zmq_msg_data zmq_strerror zmq_msg_close zmq_bind)
+    zmq_msg_init_size zmq_msg_init_data zmq_msg_data zmq_strerror zmq_msg_close zmq_bind)
 CHUCHO_FIND_PACKAGE(ACTIVEMQ INCLUDE cms/ConnectionFactory.h LIBS activemq-cpp apr-1)
 CHUCHO_FIND_PACKAGE(RABBITMQ INCLUDE amqp.h LIBS rabbitmq PKG_CONFIG_NAME librabbitmq SYMBOLS
     amqp_new_connection amqp_socket_open amqp_login amqp_get_rpc_reply
@@ -532,8 +560,8 @@ IF(AWSSDK_FOUND)
 ENDIF()
 CHUCHO_FIND_PACKAGE(RDKAFKA INCLUDE librdkafka/rdkafka.h LIBS rdkafka SYMBOLS
     rd_kafka_conf_new rd_kafka_conf_set rd_kafka_new rd_kafka_flush rd_kafka_topic_new
-    rd_kafka_topic_destroy rd_kafka_destroy rd_kafka_poll rd_kafka_produce
-    rd_kafka_last_error rd_kafka_err2str rd_kafka_topic_name rd_kafka_flush
+    rd_kafka_topic_destroy rd_kafka_destroy rd_kafka_poll rd_kafka_produce rd_kafka_produce_batch
+    rd_kafka_last_error rd_kafka_err2str rd_kafka_topic_name rd_kafka_flush rd_kafka_purge rd_kafka_conf_set_dr_msg_cb
     rd_kafka_poll_set_consumer rd_kafka_topic_partition_list_new rd_kafka_topic_partition_list_add
     rd_kafka_subscribe rd_kafka_topic_partition_list_destroy rd_kafka_consumer_poll rd_kafka_message_destroy)
 
@@ -555,3 +583,6 @@ SET_DIRECTORY_PROPERTIES(PROPERTIES EP_PREFIX "${CHUCHO_EXTERNAL_PREFIX}")
 
 # Gtest
 FIND_PACKAGE(GTest)
+
+# Google Benchmark
+FIND_PACKAGE(benchmark QUIET)
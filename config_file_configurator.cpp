@@ -162,8 +162,8 @@ configurable_factory& config_file_configurator::chucho_properties_processor::get
     auto cls = props.get_one(type + '.' + name);
     if (!cls)
         throw exception("No class has been specified for " + type + " named " + name);
-    auto fact = get_factories().find(*cls);
-    if (fact == get_factories().end())
+    auto fact = cfg_.get_factories().find(*cls);
+    if (fact == cfg_.get_factories().end())
         throw exception("No " + type + " named " + *cls + " exists");
     return *fact->second;
 }
@@ -172,8 +172,8 @@ void config_file_configurator::chucho_properties_processor::process(const proper
 {
     auto chuprops = props.get_subset("chucho.");
     auto loggers = props.get("chucho.logger");
-    assert(get_factories().find("chucho::logger") != get_factories().end());
-    auto& lgr_fact = get_factories().find("chucho::logger")->second;
+    assert(cfg_.get_factories().find("chucho::logger") != cfg_.get_factories().end());
+    auto& lgr_fact = cfg_.get_factories().find("chucho::logger")->second;
     while (loggers.first != loggers.second)
     {
         try
@@ -318,8 +318,8 @@ void config_file_configurator::log4cplus_properties_processor::create_logger(con
                                                                              const std::string& desc,
                                                                              const properties& props)
 {
-    assert(get_factories().find("chucho::logger") != get_factories().end());
-    auto& lgr_fact = get_factories().find("chucho::logger")->second;
+    assert(cfg_.get_factories().find("chucho::logger") != cfg_.get_factories().end());
+    auto& lgr_fact = cfg_.get_factories().find("chucho::logger")->second;
     auto mnto = std::move(lgr_fact->create_memento(cfg_));
     mnto->handle("name", name);
     auto tokens = split_logger_descriptor(desc);
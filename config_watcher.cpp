@@ -0,0 +1,117 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <chucho/config_watcher.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/file.hpp>
+#include <chucho/thread_util.hpp>
+#include <sys/inotify.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstring>
+
+namespace chucho
+{
+
+config_watcher::config_watcher(const std::string& file_name, std::function<void()> changed)
+    : file_name_(file_name),
+      base_name_(file::base_name(file_name)),
+      changed_(changed),
+      inotify_(inotify_init1(IN_CLOEXEC))
+{
+    set_status_origin("config_watcher");
+    if (inotify_ == -1)
+        throw exception(std::string("Could not initialize inotify: ") + std::strerror(errno));
+    if (::pipe(stop_pipe_) == -1)
+    {
+        int err = errno;
+        ::close(inotify_);
+        throw exception(std::string("Could not create a pipe: ") + std::strerror(err));
+    }
+    auto dir = file::directory_name(file_name);
+    if (inotify_add_watch(inotify_, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) == -1)
+    {
+        int err = errno;
+        ::close(inotify_);
+        ::close(stop_pipe_[0]);
+        ::close(stop_pipe_[1]);
+        throw exception("Could not watch the directory " + dir + ": " + std::strerror(err));
+    }
+    worker_ = std::make_unique<std::thread>(std::bind(&config_watcher::thread_main, this));
+}
+
+config_watcher::~config_watcher()
+{
+    char stop = 0;
+    while (::write(stop_pipe_[1], &stop, 1) == -1 && errno == EINTR)
+        ;
+    worker_->join();
+    ::close(inotify_);
+    ::close(stop_pipe_[0]);
+    ::close(stop_pipe_[1]);
+}
+
+void config_watcher::thread_main()
+{
+    thread_util::configure(thread_util::get_global_settings(), "chucho-watch");
+    alignas(inotify_event) char buf[4096];
+    pollfd fds[2];
+    fds[0].fd = inotify_;
+    fds[0].events = POLLIN;
+    fds[1].fd = stop_pipe_[0];
+    fds[1].events = POLLIN;
+    bool changed = false;
+    while (true)
+    {
+        int rc = ::poll(fds, 2, changed ? QUIET_MILLIS : -1);
+        if (rc == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            report_error(std::string("Could not wait for changes to ") + file_name_ + ": " + std::strerror(errno));
+            break;
+        }
+        if (fds[1].revents != 0)
+            break;
+        if (rc == 0)
+        {
+            changed = false;
+            report_info("The file " + file_name_ + " has changed");
+            try
+            {
+                changed_();
+            }
+            catch (std::exception& e)
+            {
+                report_error("An error occurred handling a change to " + file_name_ + ": " + exception::nested_whats(e));
+            }
+        }
+        else if ((fds[0].revents & POLLIN) != 0)
+        {
+            auto len = ::read(inotify_, buf, sizeof(buf));
+            char* cur = buf;
+            while (len > 0 && cur < buf + len)
+            {
+                auto evt = reinterpret_cast<inotify_event*>(cur);
+                if (evt->len > 0 && base_name_ == evt->name)
+                    changed = true;
+                cur += sizeof(inotify_event) + evt->len;
+            }
+        }
+    }
+}
+
+}
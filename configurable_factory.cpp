@@ -28,4 +28,9 @@ configurable_factory::~configurable_factory()
 {
 }
 
+bool configurable_factory::creates_writer() const
+{
+    return false;
+}
+
 }
@@ -24,6 +24,11 @@
 #include <chucho/environment.hpp>
 #include <chucho/configurator.hpp>
 #include <chucho/configurable_factory.hpp>
+#include <chucho/staged_configurator.hpp>
+#include <chucho/thread_util.hpp>
+#if defined(CHUCHO_HAVE_INOTIFY)
+#include <chucho/config_watcher.hpp>
+#endif
 
 #include <chucho/yaml_parser.hpp>
 #include <chucho/yaml_configurator.hpp>
@@ -36,6 +41,7 @@
 #include <sstream>
 #include <assert.h>
 #include <cstring>
+#include <mutex>
 
 namespace
 {
@@ -54,6 +60,13 @@ struct static_data
     bool is_configured_;
     std::size_t max_size_;
     chucho::security_policy security_policy_;
+    std::mutex reconfigure_guard_;
+#if defined(CHUCHO_HAVE_INOTIFY)
+    std::unique_ptr<chucho::config_watcher> watcher_;
+    // Guards watcher_. Never held by the watcher's thread, so the
+    // watcher can be destroyed while it is held.
+    std::mutex watch_guard_;
+#endif
 };
 
 static_data::static_data()
@@ -175,7 +188,7 @@ bool configuration::allow_default()
     return data().allow_default_config_;
 }
 
-bool configuration::configure_from_file(const std::string& file_name, reporter& report)
+bool configuration::configure_from_file(const std::string& file_name, reporter& report, bool replace)
 {
     bool result = false;
     format fmt = detect_file_format(file_name);
@@ -207,7 +220,18 @@ bool configuration::configure_from_file(const std::string& file_name, reporter&
     {
         try
         {
-            cfg->configure(in);
+            if (fmt == format::CONFIG_FILE)
+            {
+                if (replace)
+                    reset_loggers();
+                cfg->configure(in);
+            }
+            else
+            {
+                staged_configurator stg(*cfg);
+                cfg->configure(in);
+                stg.publish(replace);
+            }
             data().loaded_file_name_ = file_name;
             result = true;
         }
@@ -224,7 +248,7 @@ bool configuration::configure_from_file(const std::string& file_name, reporter&
     return result;
 }
 
-bool configuration::configure_from_text(const std::string& cfg, reporter& report)
+bool configuration::configure_from_text(const std::string& cfg, reporter& report, bool replace)
 {
     bool result = true;
     static_data& sd(data());
@@ -236,20 +260,26 @@ bool configuration::configure_from_text(const std::string& cfg, reporter& report
         {
             yaml_configurator yam(sd.security_policy_);
             std::istringstream in(cfg);
+            staged_configurator stg(yam);
             yam.configure(in);
+            stg.publish(replace);
             report.info("Using the YAML format configuration"); 
         }
         else if (fmt == format::JSON)
         {
             json_configurator js(sd.security_policy_);
             std::istringstream in(cfg);
+            staged_configurator stg(js);
             js.configure(in);
+            stg.publish(replace);
             report.info("Using the JSON format configuration");
         }
         else if (fmt == format::CONFIG_FILE)
         {
             config_file_configurator cnf(sd.security_policy_);
             std::istringstream in(cfg);
+            if (replace)
+                reset_loggers();
             cnf.configure(in);
             report.info("Using the config file format configuration"); 
         }
@@ -306,6 +336,11 @@ configuration::style configuration::get_style()
     return data().style_;
 }
 
+thread_settings configuration::get_thread_settings()
+{
+    return thread_util::get_global_settings();
+}
+
 configuration::unknown_handler_type configuration::get_unknown_handler()
 {
     return data().unknown_handler_;
@@ -317,11 +352,22 @@ void configuration::initialize_security_policy()
     yaml_configurator cnf(data().security_policy_);
     // The mementos are where each configurable configures
     // its security policy.
-    auto& facts(configurator::get_factories());
+    auto& facts(cnf.get_factories());
     for (const auto& fact : facts)
         fact.second->create_memento(cnf);
 }
 
+bool configuration::is_watching()
+{
+#if defined(CHUCHO_HAVE_INOTIFY)
+    static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.watch_guard_);
+    return static_cast<bool>(sd.watcher_);
+#else
+    return false;
+#endif
+}
+
 void configuration::perform(std::shared_ptr<logger> root_logger)
 {
     static_data& sd(data());
@@ -383,6 +429,7 @@ void configuration::perform(std::shared_ptr<logger> root_logger)
 bool configuration::reconfigure()
 {
     static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.reconfigure_guard_);
     bool result = false;
     if (sd.is_configured_ &&
         sd.style_ == style::AUTOMATIC &&
@@ -399,13 +446,9 @@ bool configuration::reconfigure()
                 report.warning("The file, " + to_try + ", is " + std::to_string(sz) +
                     " bytes large, but the maximum allowed is " + std::to_string(sd.max_size_));
             }
-            else
+            else if (configure_from_file(to_try, report, true))
             {
-                auto loggers = logger::get_existing_loggers();
-                for (auto lgr : loggers)
-                    lgr->reset();
-                if (configure_from_file(to_try, report))
-                    result = true;
+                result = true;
             }
         }
         else
@@ -416,6 +459,13 @@ bool configuration::reconfigure()
     return result;
 }
 
+void configuration::reset_loggers()
+{
+    auto loggers = logger::get_existing_loggers();
+    for (auto lgr : loggers)
+        lgr->reset();
+}
+
 void configuration::set_allow_default(bool allow)
 {
     data().allow_default_config_ = allow;
@@ -432,12 +482,14 @@ bool configuration::set(const std::string& cfg)
     }
     else
     {
-        auto loggers = logger::get_existing_loggers();
-        for (auto lgr : loggers)
-            lgr->reset();
+        std::lock_guard<std::mutex> lg(data().reconfigure_guard_);
         configurator::initialize();
-        if (configure_from_text(cfg, report))
+        if (configure_from_text(cfg, report, true))
+        {
+            // The file may take over from here on a reconfigure
+            data().is_configured_ = true;
             result = true;
+        }
     }
     return result;
 }
@@ -476,9 +528,54 @@ void configuration::set_style(style stl)
     data().style_ = stl;
 }
 
+void configuration::set_thread_settings(const thread_settings& ts)
+{
+    thread_util::set_global_settings(ts);
+}
+
 void configuration::set_unknown_handler(unknown_handler_type hndl)
 {
     data().unknown_handler_ = hndl;
 }
 
+bool configuration::set_watch(bool state)
+{
+    reporter report;
+#if defined(CHUCHO_HAVE_INOTIFY)
+    static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.watch_guard_);
+    sd.watcher_.reset();
+    if (state)
+    {
+        std::unique_lock<std::mutex> rl(sd.reconfigure_guard_);
+        std::string to_watch = sd.loaded_file_name_.empty() ?
+            sd.file_name_ : sd.loaded_file_name_;
+        rl.unlock();
+        if (to_watch.empty())
+        {
+            report.warning("There is no configuration file to watch");
+            return false;
+        }
+        try
+        {
+            sd.watcher_ = std::make_unique<config_watcher>(to_watch, [] () { reconfigure(); });
+            report.info("Watching the file " + to_watch + " for changes");
+        }
+        catch (std::exception& e)
+        {
+            report.error("Unable to watch the file " + to_watch + ": " + exception::nested_whats(e));
+            return false;
+        }
+    }
+    return true;
+#else
+    if (state)
+    {
+        report.warning("Watching the configuration file is not supported on this platform");
+        return false;
+    }
+    return true;
+#endif
+}
+
 }
@@ -21,10 +21,12 @@
 #include <chucho/regex.hpp>
 
 #include <chucho/async_writer_factory.hpp>
+#include <chucho/binary_file_writer_factory.hpp>
 #include <chucho/cache_and_release_filter_factory.hpp>
 #include <chucho/cerr_writer_factory.hpp>
 #include <chucho/cout_writer_factory.hpp>
 #include <chucho/duplicate_message_filter_factory.hpp>
+#include <chucho/expression_filter_factory.hpp>
 #include <chucho/file_writer_factory.hpp>
 #include <chucho/formatted_message_serializer_factory.hpp>
 #include <chucho/interval_file_roll_trigger_factory.hpp>
@@ -38,6 +40,7 @@
 #include <chucho/on_start_file_roll_trigger_factory.hpp>
 #include <chucho/pattern_formatter_factory.hpp>
 #include <chucho/pipe_writer_factory.hpp>
+#include <chucho/regex_filter_factory.hpp>
 #include <chucho/rolling_file_writer_factory.hpp>
 #include <chucho/size_file_roll_trigger_factory.hpp>
 #include <chucho/sliding_numbered_file_roller_factory.hpp>
@@ -62,9 +65,16 @@
 #if defined(CHUCHO_HAVE_ZEROMQ)
 #include <chucho/zeromq_writer_factory.hpp>
 #endif
+#if defined(CHUCHO_HAVE_SHM_OPEN)
+#include <chucho/shm_ring_writer_factory.hpp>
+#endif
+#if defined(CHUCHO_HAVE_IO_URING)
+#include <chucho/io_uring_file_writer_factory.hpp>
+#endif
 #if defined(CHUCHO_HAVE_ZLIB)
 #include <chucho/zlib_compressor_factory.hpp>
 #include <chucho/gzip_file_compressor_factory.hpp>
+#include <chucho/gzip_stream_compressor_factory.hpp>
 #endif
 #if defined(CHUCHO_HAVE_ACTIVEMQ)
 #include <chucho/activemq_writer_factory.hpp>
@@ -113,7 +123,8 @@ namespace chucho
 {
 
 configurator::configurator(security_policy& sec_pol)
-    : security_policy_(sec_pol)
+    : security_policy_(sec_pol),
+      staged_factories_(nullptr)
 {
     set_status_origin("configurator");
 }
@@ -128,6 +139,11 @@ void configurator::add_configurable_factory(const std::string& name,
     get_factories().emplace(name, std::move(fact));
 }
 
+std::map<std::string, std::unique_ptr<configurable_factory>>& configurator::get_current_factories()
+{
+    return staged_factories_ == nullptr ? get_factories() : *staged_factories_;
+}
+
 std::map<std::string, std::unique_ptr<configurable_factory>>& configurator::get_factories()
 {
     static std::once_flag once;
@@ -157,6 +173,8 @@ void configurator::initialize_impl()
                              std::make_unique<cout_writer_factory>());
     add_configurable_factory("chucho::duplicate_message_filter",
                              std::make_unique<duplicate_message_filter_factory>());
+    add_configurable_factory("chucho::expression_filter",
+                             std::make_unique<expression_filter_factory>());
     add_configurable_factory("chucho::file_writer",
                              std::make_unique<file_writer_factory>());
     add_configurable_factory("chucho::level_filter",
@@ -177,6 +195,8 @@ void configurator::initialize_impl()
                              std::make_unique<pattern_formatter_factory>());
     add_configurable_factory("chucho::pipe_writer",
                              std::make_unique<pipe_writer_factory>());
+    add_configurable_factory("chucho::regex_filter",
+                             std::make_unique<regex_filter_factory>());
     add_configurable_factory("chucho::rolling_file_writer",
                              std::make_unique<rolling_file_writer_factory>());
     add_configurable_factory("chucho::size_file_roll_trigger",
@@ -199,6 +219,8 @@ void configurator::initialize_impl()
                              std::make_unique<cache_and_release_filter_factory>());
     add_configurable_factory("chucho::yaml_formatter",
                              std::make_unique<yaml_formatter_factory>());
+    add_configurable_factory("chucho::binary_file_writer",
+                             std::make_unique<binary_file_writer_factory>());
 #if defined(CHUCHO_WINDOWS)
     add_configurable_factory("chucho::windows_event_log_writer",
                              std::make_unique<windows_event_log_writer_factory>());
@@ -223,11 +245,21 @@ void configurator::initialize_impl()
     add_configurable_factory("chucho::zeromq_writer",
                              std::make_unique<zeromq_writer_factory>());
 #endif
+#if defined(CHUCHO_HAVE_SHM_OPEN)
+    add_configurable_factory("chucho::shm_ring_writer",
+                             std::make_unique<shm_ring_writer_factory>());
+#endif
+#if defined(CHUCHO_HAVE_IO_URING)
+    add_configurable_factory("chucho::io_uring_file_writer",
+                             std::make_unique<io_uring_file_writer_factory>());
+#endif
 #if defined(CHUCHO_HAVE_ZLIB)
     add_configurable_factory("chucho::zlib_compressor",
                              std::make_unique<zlib_compressor_factory>());
     add_configurable_factory("chucho::gzip_file_compressor",
                              std::make_unique<gzip_file_compressor_factory>());
+    add_configurable_factory("chucho::gzip_stream_compressor",
+                             std::make_unique<gzip_stream_compressor_factory>());
 #endif
 #if defined(CHUCHO_HAVE_ACTIVEMQ)
     add_configurable_factory("chucho::activemq_writer",
@@ -19,68 +19,315 @@
 #include <chucho/calendar.hpp>
 #include <chucho/logger.hpp>
 #include <chucho/process.hpp>
-#include <thread>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
 
 namespace
 {
 
 constexpr const char* INSERT = "INSERT INTO chucho_event ( formatted_message, timestmp, file_name, line_number, function_name, logger, level_name, marker, thread, host_name, process_id ) VALUES ( :formatted_message, :timestmp, :file_name, :line_number, :function_name, :logger, :level_name, :marker, :thread, :host_name, :process_id )";
 
+// When inserting in the background, the logging thread blocks once
+// this many batches are waiting
+constexpr std::size_t MAX_PENDING_BATCHES = 8;
+
 }
 
 namespace chucho
 {
 
+constexpr std::chrono::milliseconds database_writer::DEFAULT_LINGER;
+
+void database_writer::columns::clear()
+{
+    formatted_message.clear();
+    timestamp.clear();
+    file_name.clear();
+    line_number.clear();
+    function_name.clear();
+    logger_name.clear();
+    level_name.clear();
+    marker.clear();
+    marker_ind.clear();
+    thread.clear();
+    host_name.clear();
+    process_id.clear();
+}
+
+std::size_t database_writer::columns::size() const
+{
+    return formatted_message.size();
+}
+
+void database_writer::columns::swap(columns& other)
+{
+    formatted_message.swap(other.formatted_message);
+    timestamp.swap(other.timestamp);
+    file_name.swap(other.file_name);
+    line_number.swap(other.line_number);
+    function_name.swap(other.function_name);
+    logger_name.swap(other.logger_name);
+    level_name.swap(other.level_name);
+    marker.swap(other.marker);
+    marker_ind.swap(other.marker_ind);
+    thread.swap(other.thread);
+    host_name.swap(other.host_name);
+    process_id.swap(other.process_id);
+}
+
 database_writer::database_writer(const std::string& name,
                                  std::unique_ptr<formatter>&& fmt,
                                  const std::string& connection)
+    : database_writer(name, std::move(fmt), connection, 1)
+{
+}
+
+database_writer::database_writer(const std::string& name,
+                                 std::unique_ptr<formatter>&& fmt,
+                                 const std::string& connection,
+                                 std::size_t batch_size,
+                                 const std::chrono::milliseconds& linger,
+                                 bool background)
     : writer(name, std::move(fmt)),
       sql_(connection),
       stmt_(sql_),
-      marker_ind_(soci::i_null),
+      batch_size_(batch_size),
+      linger_(linger),
       host_name_(host::get_full_name()),
-      process_id_(process::id())
+      process_id_(process::id()),
+      cached_second_(-1),
+      flush_requested_(0),
+      flush_completed_(0),
+      stop_(false)
 {
+    if (batch_size_ == 0)
+        throw std::invalid_argument("The database_writer batch size must be greater than zero");
+    // SOCI reads the sizes of the vectors each time the statement
+    // is executed, so they only have to be bound once.
     stmt_ = (sql_.prepare << INSERT,
-             soci::use(formatted_message_),
-             soci::use(timestamp_),
-             soci::use(file_name_),
-             soci::use(line_number_),
-             soci::use(function_name_),
-             soci::use(logger_name_),
-             soci::use(level_name_),
-             soci::use(marker_, marker_ind_),
-             soci::use(thread_),
-             soci::use(host_name_),
-             soci::use(process_id_));
+             soci::use(bound_.formatted_message),
+             soci::use(bound_.timestamp),
+             soci::use(bound_.file_name),
+             soci::use(bound_.line_number),
+             soci::use(bound_.function_name),
+             soci::use(bound_.logger_name),
+             soci::use(bound_.level_name),
+             soci::use(bound_.marker, bound_.marker_ind),
+             soci::use(bound_.thread),
+             soci::use(bound_.host_name),
+             soci::use(bound_.process_id));
+    if (background)
+        worker_ = std::make_unique<std::thread>(std::bind(&database_writer::thread_main, this));
+    else if (batch_size_ > 1)
+        lingerer_ = std::make_unique<std::thread>(std::bind(&database_writer::linger_main, this));
 }
 
-void database_writer::write_impl(const event& evt)
+database_writer::~database_writer()
 {
-    formatted_message_ = formatter_->format(evt);
-    // slicing on purpose
-    timestamp_ = calendar::get_local(event::clock_type::to_time_t(evt.get_time()));
-    file_name_ = evt.get_file_name();
-    line_number_ = evt.get_line_number();
-    function_name_ = evt.get_function_name();
-    logger_name_ = evt.get_logger()->get_name();
-    level_name_ = evt.get_level()->get_name();
+    if (worker_)
+    {
+        std::unique_lock<std::mutex> ul(pending_guard_);
+        stop_ = true;
+        ul.unlock();
+        pending_condition_.notify_one();
+        space_condition_.notify_all();
+        worker_->join();
+    }
+    else
+    {
+        if (lingerer_)
+        {
+            std::unique_lock<std::mutex> ul(pending_guard_);
+            stop_ = true;
+            ul.unlock();
+            pending_condition_.notify_one();
+            lingerer_->join();
+        }
+        try
+        {
+            std::lock_guard<std::mutex> lg(pending_guard_);
+            insert();
+        }
+        catch (std::exception& e)
+        {
+            report_error(get_name() + ": Error inserting events on destruction: " + e.what());
+        }
+    }
+}
+
+void database_writer::append(columns& cols, const event& evt)
+{
+    cols.formatted_message.push_back(formatter_->format(evt));
+    std::time_t secs = event::clock_type::to_time_t(evt.get_time());
+    if (secs != cached_second_)
+    {
+        // slicing on purpose
+        cached_timestamp_ = calendar::get_local(secs);
+        cached_second_ = secs;
+    }
+    cols.timestamp.push_back(cached_timestamp_);
+    cols.file_name.push_back(evt.get_file_name());
+    cols.line_number.push_back(evt.get_line_number());
+    cols.function_name.push_back(evt.get_function_name());
+    cols.logger_name.push_back(evt.get_logger()->get_name());
+    cols.level_name.push_back(evt.get_level()->get_name());
     if (evt.get_marker())
     {
         std::ostringstream stream;
         stream << *evt.get_marker();
-        marker_ = stream.str();
-        marker_ind_ = soci::i_ok;
+        cols.marker.push_back(stream.str());
+        cols.marker_ind.push_back(soci::i_ok);
+    }
+    else
+    {
+        cols.marker.emplace_back();
+        cols.marker_ind.push_back(soci::i_null);
+    }
+    auto id = std::this_thread::get_id();
+    if (cached_thread_.empty() || id != cached_thread_id_)
+    {
+        std::ostringstream stream;
+        stream << id;
+        cached_thread_ = stream.str();
+        cached_thread_id_ = id;
+    }
+    cols.thread.push_back(cached_thread_);
+    cols.host_name.push_back(host_name_);
+    cols.process_id.push_back(process_id_);
+}
+
+void database_writer::flush()
+{
+    if (worker_)
+    {
+        std::unique_lock<std::mutex> ul(pending_guard_);
+        auto ticket = ++flush_requested_;
+        pending_condition_.notify_one();
+        flushed_condition_.wait(ul, [this, ticket] () { return flush_completed_ >= ticket || stop_; });
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lg(pending_guard_);
+        insert();
+    }
+}
+
+void database_writer::insert()
+{
+    if (bound_.size() == 0)
+        return;
+    // The events are gone whether or not the insert succeeds
+    struct clearer
+    {
+        ~clearer() { cols.clear(); }
+        columns& cols;
+    } clr{bound_};
+
+    if (batch_size_ == 1 && bound_.size() == 1)
+    {
+        stmt_.execute(true);
+    }
+    else
+    {
+        soci::transaction trans(sql_);
+        stmt_.execute(true);
+        trans.commit();
+    }
+}
+
+void database_writer::linger_main()
+{
+    std::unique_lock<std::mutex> ul(pending_guard_);
+    thread_state state;
+    while (!stop_)
+    {
+        configure_thread("db", state);
+        if (bound_.size() == 0)
+        {
+            pending_condition_.wait(ul);
+        }
+        else if (std::chrono::steady_clock::now() - oldest_ >= linger_)
+        {
+            try
+            {
+                insert();
+            }
+            catch (std::exception& e)
+            {
+                report_error(get_name() + ": Error inserting events: " + e.what());
+            }
+        }
+        else
+        {
+            pending_condition_.wait_until(ul, oldest_ + linger_);
+        }
+    }
+}
+
+void database_writer::thread_main()
+{
+    std::unique_lock<std::mutex> ul(pending_guard_);
+    thread_state state;
+    while (true)
+    {
+        configure_thread("db", state);
+        if (pending_.size() == 0)
+        {
+            pending_condition_.wait(ul, [this] () { return pending_.size() > 0 || stop_ || flush_requested_ != flush_completed_; });
+        }
+        else
+        {
+            pending_condition_.wait_until(ul,
+                                          oldest_ + linger_,
+                                          [this] () { return pending_.size() >= batch_size_ || stop_ || flush_requested_ != flush_completed_; });
+        }
+        auto flush_goal = flush_requested_;
+        if (pending_.size() > 0)
+        {
+            bound_.swap(pending_);
+            space_condition_.notify_all();
+            ul.unlock();
+            try
+            {
+                insert();
+            }
+            catch (std::exception& e)
+            {
+                report_error(get_name() + ": Error inserting events: " + e.what());
+            }
+            ul.lock();
+        }
+        flush_completed_ = flush_goal;
+        flushed_condition_.notify_all();
+        if (stop_ && pending_.size() == 0)
+            break;
+    }
+}
+
+void database_writer::write_impl(const event& evt)
+{
+    std::unique_lock<std::mutex> ul(pending_guard_);
+    if (worker_)
+    {
+        space_condition_.wait(ul, [this] () { return pending_.size() < batch_size_ * MAX_PENDING_BATCHES || stop_; });
+        if (pending_.size() == 0)
+            oldest_ = std::chrono::steady_clock::now();
+        append(pending_, evt);
+        if (pending_.size() >= batch_size_)
+            pending_condition_.notify_one();
     }
     else
     {
-        marker_.clear();
-        marker_ind_ = soci::i_null;
+        if (bound_.size() == 0 && lingerer_)
+        {
+            oldest_ = std::chrono::steady_clock::now();
+            pending_condition_.notify_one();
+        }
+        append(bound_, evt);
+        if (bound_.size() >= batch_size_)
+            insert();
     }
-    std::ostringstream stream;
-    stream << std::this_thread::get_id();
-    thread_ = stream.str();
-    stmt_.execute(true);
 }
 
 }
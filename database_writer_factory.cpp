@@ -34,8 +34,22 @@ std::unique_ptr<configurable> database_writer_factory::create_configurable(std::
         throw exception("database_writer_factory: The writer's formatter is not set");
     if (dwm->get_connection().empty())
         throw exception("database_writer_factory: The writer's connection is not set");
-    auto dw = std::make_unique<database_writer>(dwm->get_name(), std::move(fmt), dwm->get_connection());
+    std::unique_ptr<database_writer> dw;
+    if (dwm->get_batch_size() || dwm->get_linger() || dwm->get_background())
+    {
+        dw = std::make_unique<database_writer>(dwm->get_name(),
+                                               std::move(fmt),
+                                               dwm->get_connection(),
+                                               dwm->get_batch_size() ? *dwm->get_batch_size() : 1,
+                                               dwm->get_linger() ? *dwm->get_linger() : database_writer::DEFAULT_LINGER,
+                                               dwm->get_background() ? *dwm->get_background() : false);
+    }
+    else
+    {
+        dw = std::make_unique<database_writer>(dwm->get_name(), std::move(fmt), dwm->get_connection());
+    }
     set_filters(*dw, *dwm);
+    set_thread_settings(*dw, *dwm);
     report_info("Created a " + demangle::get_demangled_name(typeid(*dw)));
     return std::move(dw);
 }
@@ -23,7 +23,15 @@ namespace chucho
 database_writer_memento::database_writer_memento(configurator &cfg)
     : writer_memento(cfg)
 {
+    cfg.get_security_policy().set_integer("database_writer::batch_size", static_cast<std::size_t>(1), static_cast<std::size_t>(100000));
+    cfg.get_security_policy().set_text("database_writer::batch_size(text)", 6);
+    cfg.get_security_policy().set_integer("database_writer::linger", 0, 60 * 60 * 1000);
+    cfg.get_security_policy().set_text("database_writer::linger(text)", 7);
+    cfg.get_security_policy().set_text("database_writer::background", 5);
     set_handler("connection", [this] (const std::string& s) { connection_ = validate("database_writer::connection", s); });
+    set_handler("batch_size", [this] (const std::string& sz) { batch_size_ = validate("database_writer::batch_size", static_cast<std::size_t>(std::stoul(validate("database_writer::batch_size(text)", sz)))); });
+    set_handler("linger", [this] (const std::string& ms) { linger_ = std::chrono::milliseconds(validate("database_writer::linger", std::stoul(validate("database_writer::linger(text)", ms)))); });
+    set_handler("background", [this] (const std::string& val) { background_ = boolean_value(validate("database_writer::background", val)); });
 }
 
 }
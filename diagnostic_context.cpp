@@ -39,6 +39,13 @@ void diagnostic_context::erase(const std::string& key)
     get_map().erase(key);
 }
 
+const std::string* diagnostic_context::find(const std::string& key)
+{
+    auto& mp = get_map();
+    auto found = mp.find(key);
+    return found == mp.end() ? nullptr : &found->second;
+}
+
 std::map<std::string, std::string> diagnostic_context::get()
 {
     return get_map();
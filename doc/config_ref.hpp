@@ -69,6 +69,21 @@
  *
  * @section Writers
  *
+ * Writers that do their work in background threads, which are async_writer, cloudwatch_writer, database_writer,
+ * email_writer, kafka_writer, loggly_writer and the file writers, also accept the following parameters for their
+ * threads. Refer to @ref chucho::thread_settings "thread_settings" for details. Settings for all of Chucho's
+ * threads can be made with @ref chucho::configuration::set_thread_settings "configuration::set_thread_settings".
+ *
+ * <table>
+ * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>thread_affinity</td><td>The CPUs on which the threads may run, like 0-3,8</td><td>Any CPU</td></tr>
+ * <tr><td>thread_name</td><td>The name of the threads</td><td>The role and writer name, like async:my_writer</td></tr>
+ * <tr><td>thread_nice</td><td>The niceness of the threads, from -20 to 19</td><td>Unchanged</td></tr>
+ * <tr><td>thread_numa_node</td><td>The NUMA node from which the threads prefer memory, and on whose CPUs they run if thread_affinity is not set</td><td>None</td></tr>
+ * <tr><td>thread_scheduling</td><td>The scheduling policy: normal, batch or idle</td><td>Unchanged</td></tr>
+ * </table>
+ *
  * @subsection activemq chucho::activemq_writer
  *
  * Refer to @ref chucho::activemq_writer "activemq_writer" for details.
@@ -115,6 +130,10 @@
  * <tr><td>flush_on_destruct</td><td>Whether the event cache should be flushed: true or false</td><td>true</td></tr>
  * <tr><td>max_chunks</td><td>The maximum number of chunks in the event cache</td><td>2</td></tr>
  * <tr><td>name</td><td>The name of the writer</td><td>%chucho::async_writer</td></tr>
+ * <tr><td>shard_key</td><td>The diagnostic context key whose value selects an event's shard. Events without the key, or all events if this is not set, are sharded by logger name.</td><td>Logger name</td></tr>
+ * <tr><td>shards</td><td>The number of queues, each with its own worker thread and event cache of chunk_size * max_chunks, that share the writer. Events with the same shard key stay in order.</td><td>1</td></tr>
+ * <tr><td>shed_hysteresis</td><td>How far below a watermark, in percent of the cache size, the cache must drain before the watermark is released</td><td>10</td></tr>
+ * <tr><td>shed_watermarks</td><td>A comma-separated list of percent:level pairs, like 80:DEBUG,95:INFO. When the cache is as full as a watermark, events at or below its level are shed. Refer to @ref chucho::overload_governor "overload_governor" for details.</td><td>Nothing is shed</td></tr>
  * </table>
  * @subsubsection async_example Example
  * @code{.yaml}
@@ -125,6 +144,46 @@
  *             chucho::pattern_formatter:
  *                 pattern: '%m%n'
  *             file_name: hello.log
+ *         shards: 4
+ *         shard_key: request_id
+ * @endcode
+ *
+ * @subsection binary_file chucho::binary_file_writer
+ *
+ * Refer to @ref chucho::binary_file_writer "binary_file_writer" for details.
+ * The files can be turned into text with the chucho-decode tool.
+ *
+ * @subsubsection binary_file_params Parameters
+ * <table>
+ * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>durability</td><td>When the file is synced to the disk: none, interval, level or group_commit.
+ *   Refer to @ref chucho::file_writer::durability "durability" for details</td><td>none</td></tr>
+ * <tr><td>file_name</td><td>The name of the file. This field is required unless there is a
+ *   @ref rollers "roller" that sets the active file name</td><td>n/a</td></tr>
+ * <tr><td>flush</td><td>Whether to flush the file after every write: true or false</td><td>true</td></tr>
+ * <tr><td>name</td><td>The name of the writer</td><td>%chucho::binary_file_writer</td></tr>
+ * <tr><td>on_start</td><td>Where to start writing: truncate or append</td><td>append</td></tr>
+ * <tr><td>sync_interval</td><td>The number of milliseconds between syncs, which is required if durability
+ *   is interval</td><td>n/a</td></tr>
+ * <tr><td>sync_level</td><td>The level at or above which events are synced, which is required if durability
+ *   is level. If durability is group_commit and there is no sync_level, then all events are synced.</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any object from the @ref rollers "File Rollers" group, in which case
+ *   the files are rolled as with @ref rolling_file "rolling_file_writer"</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any number objects from the @ref Filters group</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any object from the @ref triggers "File Roll Triggers" group. If there is a
+ *   @ref rollers "roller" that is not also a @ref triggers "trigger", then this field is required.</td><td>n/a</td></tr>
+ * </table>
+ * @subsubsection binary_file_example Example
+ * @code{.yaml}
+ * chucho::logger:
+ *     name: example
+ *     chucho::binary_file_writer:
+ *         file_name: my_stuff.clog
+ *         chucho::numbered_file_roller:
+ *             max_index: 10
+ *         chucho::size_file_roll_trigger:
+ *             max_size: 10MB
  * @endcode
  *
  * @subsection cerr chucho::cerr_writer
@@ -164,6 +223,7 @@
  * <tr><td>name</td><td>The name of the writer</td><td>%chucho::cloudwatch_writer</td></tr>
  * <tr><td>region</td><td>The region</td><td>From env or AWS config file</td></tr>
  * <tr><td>batch_size</td><td>The number of events to send at a time</td><td>50</td></tr>
+ * <tr><td>endpoint</td><td>The endpoint, such as a local stand-in for Cloudwatch</td><td>The region's endpoint</td></tr>
  * <tr><td colspan="2">Any number of objects from the @ref Filters group</td><td>n/a</td></tr>
  * </table>
  * @subsubsection cloudwatch_example Example
@@ -211,6 +271,9 @@
  * <tr><td>connection</td><td>The database connection</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any object from the @ref Formatters group</td><td>n/a</td></tr>
  * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>background</td><td>Whether to insert events from a dedicated thread</td><td>false</td></tr>
+ * <tr><td>batch_size</td><td>The maximum number of events to insert in one transaction</td><td>1</td></tr>
+ * <tr><td>linger</td><td>The number of milliseconds an event may wait for its batch to fill</td><td>1000</td></tr>
  * <tr><td>name</td><td>The name of the writer</td><td>%chucho::database_writer</td></tr>
  * <tr><td colspan="2">Any number objects from the @ref Filters group</td><td>n/a</td></tr>
  * </table>
@@ -241,6 +304,8 @@
  * <tr><td colspan="2">Any object from the @ref email_triggers "Email Triggers" group</td><td>n/a</td></tr>
  * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
  * <tr><td>buffer_size</td><td>The maximum number of events to send in a single email</td><td>256</td></tr>
+ * <tr><td>coalesce_window</td><td>The number of milliseconds after a trigger during which further triggers join the same email</td><td>1000</td></tr>
+ * <tr><td>max_backlog</td><td>The maximum number of emails waiting to be sent</td><td>16</td></tr>
  * <tr><td>name</td><td>The name of the writer</td><td>%chucho::email_writer</td></tr>
  * <tr><td>password</td><td>The password</td><td>n/a</td></tr>
  * <tr><td>port</td><td>The port to which to connect</td><td>25</td></tr>
@@ -276,10 +341,18 @@
  * <tr><td>file_name</td><td>The name of the file</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any object from the @ref Formatters group</td><td>n/a</td></tr>
  * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>durability</td><td>When the file is synced to the disk: none, interval, level or group_commit.
+ *   Refer to @ref chucho::file_writer::durability "durability" for details</td><td>none</td></tr>
  * <tr><td>flush</td><td>Whether to flush the file after every write: true or false</td><td>true</td></tr>
  * <tr><td>name</td><td>The name of the writer</td><td>%chucho::file_writer</td></tr>
  * <tr><td>on_start</td><td>Where to start writing: truncate or append</td><td>append</td></tr>
+ * <tr><td>sync_interval</td><td>The number of milliseconds between syncs, which is required if durability
+ *   is interval</td><td>n/a</td></tr>
+ * <tr><td>sync_level</td><td>The level at or above which events are synced, which is required if durability
+ *   is level. If durability is group_commit and there is no sync_level, then all events are synced.</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any number objects from the @ref Filters group</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any object from the @ref stream_compressors "Stream Compressors" group, with which
+ *   the file is written as a compressed stream</td><td>n/a</td></tr>
  * </table>
  * @subsubsection file_example Example
  * @code{.yaml}
@@ -289,6 +362,46 @@
  *         chucho::pattern_formatter:
  *             pattern: '%m%n'
  *         file_name: hello.log
+ *         durability: level
+ *         sync_level: error
+ * @endcode
+ *
+ * @subsection io_uring_file chucho::io_uring_file_writer
+ *
+ * Refer to @ref chucho::io_uring_file_writer "io_uring_file_writer" for details.
+ * This writer is only available on Linux.
+ *
+ * @subsubsection io_uring_file_params Parameters
+ * <table>
+ * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
+ * <tr><td colspan="3"><b>Required Parameters</b></td></tr>
+ * <tr><td colspan="2">Any object from the @ref Formatters group</td><td>n/a</td></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>buffer_count</td><td>The number of buffers, from 1 to 1024</td><td>8</td></tr>
+ * <tr><td>buffer_size</td><td>The size of each buffer in bytes, from 512 to 64MB</td><td>65536</td></tr>
+ * <tr><td>file_name</td><td>The name of the file. This field is required unless there is a
+ *   @ref rollers "roller" that sets the active file name</td><td>n/a</td></tr>
+ * <tr><td>flush</td><td>Whether to submit a write after every event: true or false</td><td>true</td></tr>
+ * <tr><td>name</td><td>The name of the writer</td><td>%chucho::io_uring_file_writer</td></tr>
+ * <tr><td>on_start</td><td>Where to start writing: truncate or append</td><td>append</td></tr>
+ * <tr><td>sync</td><td>The kind of synchronization: data, for fdatasync, or full, for fsync</td><td>data</td></tr>
+ * <tr><td>sync_interval</td><td>How often, in milliseconds, to synchronize the file, with zero meaning never</td><td>0</td></tr>
+ * <tr><td colspan="2">Any object from the @ref rollers "File Rollers" group, in which case
+ *   the files are rolled as with @ref rolling_file "rolling_file_writer"</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any number objects from the @ref Filters group</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any object from the @ref triggers "File Roll Triggers" group. If there is a
+ *   @ref rollers "roller" that is not also a @ref triggers "trigger", then this field is required.</td><td>n/a</td></tr>
+ * </table>
+ * @subsubsection io_uring_file_example Example
+ * @code{.yaml}
+ * chucho::logger:
+ *     name: example
+ *     chucho::io_uring_file_writer:
+ *         chucho::pattern_formatter:
+ *             pattern: '%m%n'
+ *         file_name: hello.log
+ *         flush: false
+ *         sync_interval: 1000
  * @endcode
  *
  * @subsection kafka chucho::kafka_writer
@@ -304,8 +417,14 @@
  * <tr><td colspan="2">Any object from the @ref Formatters group</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any object from the @ref Serializers group</td><td>n/a</td></tr>
  * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>backpressure</td><td>What to do when the producer's queue is full: block, drop or spill</td><td>block</td></tr>
+ * <tr><td>batch_size</td><td>The number of messages to pass to the producer at once</td><td>1</td></tr>
+ * <tr><td>block_timeout</td><td>The number of milliseconds to wait for room when the backpressure is block</td><td>5000</td></tr>
  * <tr><td>coalesce_max</td><td>The number of events to send at once</td><td>25</td></tr>
+ * <tr><td>linger</td><td>The number of milliseconds a partial batch may wait</td><td>100</td></tr>
  * <tr><td>name</td><td>The name of the writer</td><td>%chucho::kafka_writer</td></tr>
+ * <tr><td>partition_key</td><td>The source of each message's key: none, logger, host or diagnostic_context</td><td>none</td></tr>
+ * <tr><td>partition_key_field</td><td>The diagnostic context field used when the partition key is diagnostic_context</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any number objects from the @ref Filters group</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any object from the @ref Compressors group</td><td>n/a</td></tr>
  * </table>
@@ -332,7 +451,15 @@
  * <tr><td>token</td><td>The Loggly authorization token</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any object from the @ref Formatters group</td><td>n/a</td></tr>
  * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>bulk</td><td>Whether to send events in batches from a background thread. Setting any
+ *   of the batch parameters also turns on bulk mode.</td><td>false</td></tr>
+ * <tr><td>linger</td><td>The number of milliseconds an event may wait for its batch to fill</td><td>1000</td></tr>
+ * <tr><td>max_batch_bytes</td><td>The maximum size of a batch in bytes</td><td>1048576</td></tr>
+ * <tr><td>max_batch_events</td><td>The maximum number of events in a batch</td><td>500</td></tr>
+ * <tr><td>max_retry_batches</td><td>The number of batches that may wait to be sent or retried before
+ *   events are left in the cache</td><td>16</td></tr>
  * <tr><td>name</td><td>The name of the writer</td><td>%chucho::loggly_writer</td></tr>
+ * <tr><td>url</td><td>The URL to which to post in bulk mode</td><td>Loggly's bulk endpoint</td></tr>
  * <tr><td colspan="2">Any number objects from the @ref Filters group</td><td>n/a</td></tr>
  * </table>
  * @subsubsection loggly_example Example
@@ -435,14 +562,22 @@
  * <tr><td colspan="2">Any object from the @ref Formatters group</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any object from the @ref rollers "File Rollers" group</td><td>n/a</td></tr>
  * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>durability</td><td>When the file is synced to the disk: none, interval, level or group_commit.
+ *   Refer to @ref chucho::file_writer::durability "durability" for details</td><td>none</td></tr>
  * <tr><td>file_name</td><td>The name of the file. If the @ref rollers "roller" does not set the active
  *   file name, then this field is required</td><td>n/a</td></tr>
  * <tr><td>flush</td><td>Whether to flush the file after every write: true or false</td><td>true</td></tr>
  * <tr><td>name</td><td>The name of the writer</td><td>%chucho::rolling_file_writer</td></tr>
  * <tr><td>on_start</td><td>Where to start writing: truncate or append</td><td>append</td></tr>
+ * <tr><td>sync_interval</td><td>The number of milliseconds between syncs, which is required if durability
+ *   is interval</td><td>n/a</td></tr>
+ * <tr><td>sync_level</td><td>The level at or above which events are synced, which is required if durability
+ *   is level. If durability is group_commit and there is no sync_level, then all events are synced.</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any number objects from the @ref Filters group</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any object from the @ref triggers "File Roll Triggers" group. If the @ref rollers "roller"
  *   is not also a @ref triggers "trigger", then this field is required.</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any object from the @ref stream_compressors "Stream Compressors" group, with which
+ *   the active file is written as a compressed stream. Rolling the file ends the stream.</td><td>n/a</td></tr>
  * </table>
  * @subsubsection rolling_file_example Example
  * @code{.yaml}
@@ -464,6 +599,51 @@
  *           chucho::time_file_roller:
  *               file_name_pattern: '%d{%d}'
  *               max_history: 5
+ * - chucho::logger:
+ *       name: example3
+ *       chucho::rolling_file_writer:
+ *           file_name: my_stuff.log.gz
+ *           chucho::pattern_formatter:
+ *               pattern: '%m%n'
+ *           chucho::numbered_file_roller:
+ *               max_index: 10
+ *           chucho::size_file_roll_trigger:
+ *               max_uncompressed_size: 100MB
+ *           chucho::gzip_stream_compressor
+ * @endcode
+ *
+ * @subsection shm_ring chucho::shm_ring_writer
+ *
+ * Refer to @ref chucho::shm_ring_writer "shm_ring_writer" for details. This writer is only available on POSIX
+ * systems.
+ *
+ * @subsubsection shm_ring_params Parameters
+ * <table>
+ * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
+ * <tr><td colspan="3"><b>Required Parameters</b></td></tr>
+ * <tr><td>ring_name</td><td>The name of the shared memory segment</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any object from the @ref Formatters group</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any object from the @ref Serializers group</td><td>n/a</td></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>coalesce_max</td><td>The number of events to put in one record</td><td>1</td></tr>
+ * <tr><td>name</td><td>The name of the writer</td><td>%chucho::shm_ring_writer</td></tr>
+ * <tr><td>overflow</td><td>What to do when the reader has not caught up: overwrite or drop</td><td>overwrite</td></tr>
+ * <tr><td>slot_count</td><td>The number of slots in the ring, which must be a power of two</td><td>4096</td></tr>
+ * <tr><td>slot_size</td><td>The size of each slot in bytes, which must be a multiple of eight</td><td>256</td></tr>
+ * <tr><td colspan="2">Any number objects from the @ref Filters group</td><td>n/a</td></tr>
+ * <tr><td colspan="2">Any object from the @ref Compressors group</td><td>n/a</td></tr>
+ * </table>
+ * @subsubsection shm_ring_example Example
+ * @code{.yaml}
+ * chucho::logger:
+ *     name: example
+ *     chucho::shm_ring_writer:
+ *         chucho::pattern_formatter:
+ *             pattern: '%m%n'
+ *         chucho::formatted_message_serializer
+ *         ring_name: my_app_log
+ *         slot_count: 8192
+ *         overflow: drop
  * @endcode
  *
  * @subsection syslog chucho::syslog_writer
@@ -478,9 +658,15 @@
  *   news, uucp, cron, authpriv, ftp, local0, local1, local2, local3, local4, local5, local6, or local7.</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any object from the @ref Formatters group</td><td>n/a</td></tr>
  * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>batch_size</td><td>The number of messages to hold before sending them together. Only
+ *   valid with a host.</td><td>1</td></tr>
+ * <tr><td>format</td><td>The message format, either rfc3164 or rfc5424. Only valid with a host.</td><td>rfc3164</td></tr>
  * <tr><td>host</td><td>The host, which can be omitted if writing to local host</td><td>n/a</td></tr>
  * <tr><td>name</td><td>The name of the writer</td><td>%chucho::syslog_writer</td></tr>
- * <tr><td>port</td><td>The port</td><td>n/a</td></tr>
+ * <tr><td>port</td><td>The port</td><td>514 for udp, 601 for tcp</td></tr>
+ * <tr><td>protocol</td><td>The transport protocol, either udp or tcp. Only valid with a host.</td><td>udp</td></tr>
+ * <tr><td>structured_data_id</td><td>The SD-ID under which RFC 5424 structured data describing the
+ *   event's origin is sent. If not set, no structured data is sent. Only valid with a host.</td><td>n/a</td></tr>
  * <tr><td colspan="2">Any number objects from the @ref Filters group</td><td>n/a</td></tr>
  * </table>
  * @subsubsection syslog_example Example
@@ -751,9 +937,12 @@
  * @subsubsection size_params Parameters
  * <table>
  * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
- * <tr><td colspan="3"><b>Required Parameters</b></td></tr>
+ * <tr><td colspan="3"><b>Optional Parameters, of which at least one is required</b></td></tr>
  * <tr><td>max_size</td><td>The maximum size of a log file. This can be expressed with a case-insensitive suffix
  *   of k, m or g (with an optional b) to indicate kilobytes, megabytes or gigabytes.</td><td>n/a</td></tr>
+ * <tr><td>max_uncompressed_size</td><td>The maximum number of bytes written to a log file before they are
+ *   compressed by a @ref stream_compressors "stream compressor". It is expressed like max_size. If the writer
+ *   has no stream compressor, then this limits the file's size.</td><td>n/a</td></tr>
  * </table>
  * @subsubsection size_example Example
  * @code{.yaml}
@@ -787,6 +976,9 @@
  * <tr><td>release_threshold</td><td>The level at which to release the cache: trace, debug, info, warn, error or fatal</td><td>n/a</td></tr>
  * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
  * <tr><td>chunk_size</td><td>The byte size of each chunk in the cache</td><td>1MB</td></tr>
+ * <tr><td>events_per_thread</td><td>The number of recent events kept for each thread when the filter is a flight recorder</td><td>1000</td></tr>
+ * <tr><td>flight_recorder</td><td>Whether to keep recent events in per-thread rings instead of the cache</td><td>false</td></tr>
+ * <tr><td>max_age</td><td>The age in seconds beyond which recorded events are discarded on release, or 0 for no limit</td><td>0</td></tr>
  * <tr><td>max_chunks</td><td>The number of chunks to keep in the cache</td><td>2</td></tr>
  * <tr><td>name</td><td>The name of the filter</td><td>%chucho::cache_and_release_filter</td></tr>
  * </table>
@@ -810,7 +1002,10 @@
  * <table>
  * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
  * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>capacity</td><td>The number of distinct messages to remember in fingerprint mode</td><td>32</td></tr>
+ * <tr><td>fingerprint</td><td>Whether to compare hashes of the raw message and its origin instead of the formatted text of the last message</td><td>false</td></tr>
  * <tr><td>name</td><td>The name of the filter</td><td>%chucho::duplicate_message_filter</td></tr>
+ * <tr><td>window</td><td>The number of seconds during which repeats are suppressed in fingerprint mode</td><td>60</td></tr>
  * </table>
  * @subsubsection duplicate_example Example
  * @code{.yaml}
@@ -819,7 +1014,35 @@
  *     chucho::cout_writer:
  *         chucho::pattern_formatter:
  *             pattern: '%m%n'
- *         chucho::duplicate_message_filter
+ *         chucho::duplicate_message_filter:
+ *             fingerprint: true
+ *             capacity: 64
+ *             window: 30
+ * @endcode
+ *
+ * @subsection expression chucho::expression_filter
+ *
+ * Refer to @ref chucho::expression_filter "expression_filter" for details.
+ *
+ * @subsubsection expression_params Parameters
+ * <table>
+ * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
+ * <tr><td colspan="3"><b>Required Parameters</b></td></tr>
+ * <tr><td>expression</td><td>An expression that will evaluate the log event. Please refer to
+ *   @ref chucho::expression_filter "expression_filter" to see what fields and operators are
+ *   available to the expression.</td><td>n/a</td></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>name</td><td>The name of the filter</td><td>%chucho::expression_filter</td></tr>
+ * </table>
+ * @subsubsection expression_example Example
+ * @code{.yaml}
+ * chucho::logger:
+ *     name: example
+ *     chucho::cout_writer:
+ *         chucho::pattern_formatter:
+ *             pattern: '%m%n'
+ *         chucho::expression_filter:
+ *             expression: 'level >= warn || message contains "disk"'
  * @endcode
  *
  * @subsection level_filter chucho::level_filter
@@ -871,6 +1094,34 @@
  *             level: warn
  * @endcode
  *
+ * @subsection regex_filter chucho::regex_filter
+ *
+ * Refer to @ref chucho::regex_filter "regex_filter" for details.
+ *
+ * @subsubsection regex_filter_params Parameters
+ * <table>
+ * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
+ * <tr><td colspan="3"><b>Required Parameters</b></td></tr>
+ * <tr><td>regex</td><td>The POSIX extended regular expression to search for</td><td>n/a</td></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>field</td><td>The part of the event to search: message or logger</td><td>message</td></tr>
+ * <tr><td>name</td><td>The name of the filter</td><td>%chucho::regex_filter</td></tr>
+ * <tr><td>on_match</td><td>What to do if the regular expression is found: deny, neutral or accept</td><td>neutral</td></tr>
+ * <tr><td>on_mismatch</td><td>What to do if the regular expression is not found: deny, neutral or accept</td><td>deny</td></tr>
+ * </table>
+ * @subsubsection regex_filter_example Example
+ * @code{.yaml}
+ * chucho::logger:
+ *     name: example
+ *     chucho::cout_writer:
+ *         chucho::pattern_formatter:
+ *             pattern: '%m%n'
+ *         chucho::regex_filter:
+ *             regex: 'heartbeat [0-9]+'
+ *             on_match: deny
+ *             on_mismatch: neutral
+ * @endcode
+ *
  * @subsection ruby_evaluator chucho::ruby_evaluator_filter
  *
  * Refer to @ref chucho::ruby_evaluator_filter "ruby_evaluator_filter" for details.
@@ -907,6 +1158,9 @@
  * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
  * <tr><td colspan="3"><b>Required Parameters</b></td></tr>
  * <tr><td>min_index</td><td>The minimum index at which to start compressing rolled files</td><td>n/a</td></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>nice</td><td>The niceness, from -20 to 19, of the threads that compress</td><td>0</td></tr>
+ * <tr><td>threads</td><td>The number of threads with which to compress, where 0 means one per processor</td><td>One per processor, up to 4</td></tr>
  * </table>
  * @subsubsection bzip2f_example Example
  * @code{.yaml}
@@ -933,6 +1187,9 @@
  * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
  * <tr><td colspan="3"><b>Required Parameters</b></td></tr>
  * <tr><td>min_index</td><td>The minimum index at which to start compressing rolled files</td><td>n/a</td></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>nice</td><td>The niceness, from -20 to 19, of the threads that compress</td><td>0</td></tr>
+ * <tr><td>threads</td><td>The number of threads with which to compress, where 0 means one per processor</td><td>One per processor, up to 4</td></tr>
  * </table>
  * @subsubsection gzipf_example Example
  * @code{.yaml}
@@ -959,6 +1216,9 @@
  * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
  * <tr><td colspan="3"><b>Required Parameters</b></td></tr>
  * <tr><td>min_index</td><td>The minimum index at which to start compressing rolled files</td><td>n/a</td></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>nice</td><td>The niceness, from -20 to 19, of the threads that compress</td><td>0</td></tr>
+ * <tr><td>threads</td><td>The number of threads with which to compress, where 0 means one per processor</td><td>One per processor, up to 4</td></tr>
  * </table>
  * @subsubsection lzmaf_example Example
  * @code{.yaml}
@@ -985,6 +1245,8 @@
  * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
  * <tr><td colspan="3"><b>Required Parameters</b></td></tr>
  * <tr><td>min_index</td><td>The minimum index at which to start compressing rolled files</td><td>n/a</td></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>nice</td><td>The niceness, from -20 to 19, of the threads that compress</td><td>0</td></tr>
  * </table>
  * @subsubsection zipf_example Example
  * @code{.yaml}
@@ -1108,6 +1370,32 @@
            chucho::zlib_compressor
  * @endcode
  *
+ * @section stream_compressors Stream Compressors
+ *
+ * @subsection gzip_stream chucho::gzip_stream_compressor
+ *
+ * Refer to @ref chucho::gzip_stream_compressor "gzip_stream_compressor" for details.
+ *
+ * @subsubsection gzip_stream_params Parameters
+ *
+ * <table>
+ * <tr><th>Name</th><th>Description</th><th>Default</th></tr>
+ * <tr><td colspan="3"><b>Optional Parameters</b></td></tr>
+ * <tr><td>compression_level</td><td>The level of compression, which must be in the range [0, 9].</td><td>6</td></tr>
+ * </table>
+ *
+ * @subsubsection gzip_stream_example Example
+ * @code{.yaml}
+ * chucho::logger:
+ *     name: example
+ *     chucho::file_writer:
+ *         file_name: my_stuff.log.gz
+ *         chucho::pattern_formatter:
+ *             pattern: '%m%n'
+ *         chucho::gzip_stream_compressor:
+ *             compression_level: 3
+ * @endcode
+ *
  * @section Serializers
  *
  * @subsection capn chucho::capn_proto_serializer
@@ -15,27 +15,98 @@
  */
 
 #include <chucho/duplicate_message_filter.hpp>
+#include <chucho/logger.hpp>
+#include "fnv.h"
+#include <stdexcept>
+
+namespace
+{
+
+std::uint64_t compute_fingerprint(const chucho::event& evt)
+{
+    Fnv64_t fnv = fnv_64a_buf(const_cast<char*>(evt.get_message().data()),
+                              evt.get_message().length(),
+                              FNV1A_64_INIT);
+    if (evt.get_file_name() != nullptr)
+        fnv = fnv_64a_str(const_cast<char*>(evt.get_file_name()), fnv);
+    unsigned line = evt.get_line_number();
+    fnv = fnv_64a_buf(&line, sizeof(line), fnv);
+    if (evt.get_logger())
+    {
+        const std::string& lname = evt.get_logger()->get_name();
+        fnv = fnv_64a_buf(const_cast<char*>(lname.data()), lname.length(), fnv);
+    }
+    if (evt.get_level())
+        fnv = fnv_64a_str(const_cast<char*>(evt.get_level()->get_name()), fnv);
+    return fnv;
+}
+
+}
 
 namespace chucho
 {
 
+constexpr std::size_t duplicate_message_filter::DEFAULT_CAPACITY;
+constexpr std::chrono::seconds duplicate_message_filter::DEFAULT_WINDOW;
+
+duplicate_message_filter::entry::entry(std::uint64_t fp, const event& evt)
+    : fingerprint(fp),
+      first(evt),
+      last_seen(evt.get_time()),
+      count(1)
+{
+}
+
 duplicate_message_filter::duplicate_message_filter(const std::string& name)
     : writeable_filter(name),
-      count_(0)
+      count_(0),
+      capacity_(0),
+      window_(DEFAULT_WINDOW)
 {
 }
 
 duplicate_message_filter::duplicate_message_filter(const std::string& name, writer& wrt)
     : writeable_filter(name, wrt),
-      count_(0)
+      count_(0),
+      capacity_(0),
+      window_(DEFAULT_WINDOW)
 {
 }
 
+duplicate_message_filter::duplicate_message_filter(const std::string& name,
+                                                   std::size_t capacity,
+                                                   const std::chrono::milliseconds& window)
+    : writeable_filter(name),
+      count_(0),
+      capacity_(capacity),
+      window_(window)
+{
+    if (capacity_ == 0)
+        throw std::invalid_argument("The capacity of the duplicate_message_filter '" + name + "' must be greater than zero");
+    index_.reserve(capacity_);
+}
+
+duplicate_message_filter::duplicate_message_filter(const std::string& name,
+                                                   writer& wrt,
+                                                   std::size_t capacity,
+                                                   const std::chrono::milliseconds& window)
+    : writeable_filter(name, wrt),
+      count_(0),
+      capacity_(capacity),
+      window_(window)
+{
+    if (capacity_ == 0)
+        throw std::invalid_argument("The capacity of the duplicate_message_filter '" + name + "' must be greater than zero");
+    index_.reserve(capacity_);
+}
+
 filter::result duplicate_message_filter::evaluate(const event& evt)
 {
     result res = result::NEUTRAL;
     if (!has_writer())
         throw std::runtime_error("No writer has been set in the duplicate_message_filter '" + get_name() + "'");
+    if (is_fingerprinting())
+        return evaluate_fingerprint(evt);
     auto fmsg = get_writer().get_formatter().format(evt);
     if (count_ > 0 && fmsg == message_)
     {
@@ -61,4 +132,60 @@ filter::result duplicate_message_filter::evaluate(const event& evt)
     return res;
 }
 
+// The entries are kept in order of last use, most recent first,
+// so expired entries are always found at the back of the list.
+filter::result duplicate_message_filter::evaluate_fingerprint(const event& evt)
+{
+    auto now = evt.get_time();
+    while (!entries_.empty() && now - entries_.back().last_seen >= window_)
+    {
+        retire(entries_.back());
+        index_.erase(entries_.back().fingerprint);
+        entries_.pop_back();
+    }
+    auto fp = compute_fingerprint(evt);
+    auto found = index_.find(fp);
+    if (found != index_.end())
+    {
+        auto itor = found->second;
+        entries_.splice(entries_.begin(), entries_, itor);
+        itor->last_seen = now;
+        if (now - itor->first.get_time() < window_)
+        {
+            itor->count++;
+            return result::DENY;
+        }
+        // The message has been repeating for longer than the window,
+        // so report on it and start counting again.
+        retire(*itor);
+        itor->first = evt;
+        itor->count = 1;
+        return result::NEUTRAL;
+    }
+    if (entries_.size() == capacity_)
+    {
+        retire(entries_.back());
+        index_.erase(entries_.back().fingerprint);
+        entries_.pop_back();
+    }
+    entries_.emplace_front(fp, evt);
+    index_[fp] = entries_.begin();
+    return result::NEUTRAL;
+}
+
+void duplicate_message_filter::retire(const entry& ent)
+{
+    if (ent.count > 1)
+    {
+        event levt(ent.first.get_logger(),
+                   ent.first.get_level(),
+                   "The message \"" + ent.first.get_message() + "\" was logged " + std::to_string(ent.count) + " times",
+                   ent.first.get_file_name(),
+                   ent.first.get_line_number(),
+                   ent.first.get_function_name(),
+                   ent.first.get_marker());
+        write(levt);
+    }
+}
+
 }
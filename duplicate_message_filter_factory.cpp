@@ -16,7 +16,7 @@
 
 #include <chucho/duplicate_message_filter_factory.hpp>
 #include <chucho/duplicate_message_filter.hpp>
-#include <chucho/filter_memento.hpp>
+#include <chucho/duplicate_message_filter_memento.hpp>
 #include <chucho/demangle.hpp>
 #include <chucho/exception.hpp>
 #include <assert.h>
@@ -31,19 +31,30 @@ duplicate_message_filter_factory::duplicate_message_filter_factory()
 
 std::unique_ptr<configurable> duplicate_message_filter_factory::create_configurable(std::unique_ptr<memento>& mnto)
 {
-    auto m = dynamic_cast<filter_memento*>(mnto.get());
+    auto m = dynamic_cast<duplicate_message_filter_memento*>(mnto.get());
     assert(m != nullptr);
     if (m->get_name().empty())
         throw exception("duplicate_message_filter_factory: The filter's name is not set");
-    auto cnf = std::make_unique<duplicate_message_filter>(m->get_name());
+    std::unique_ptr<duplicate_message_filter> cnf;
+    if (m->get_fingerprint())
+    {
+        std::size_t cap = m->get_capacity() ? *m->get_capacity() : duplicate_message_filter::DEFAULT_CAPACITY;
+        std::chrono::milliseconds win = m->get_window() ? *m->get_window() : duplicate_message_filter::DEFAULT_WINDOW;
+        cnf = std::make_unique<duplicate_message_filter>(m->get_name(), cap, win);
+    }
+    else
+    {
+        if (m->get_capacity() || m->get_window())
+            report_warning("The capacity and window of a duplicate_message_filter are only used in fingerprint mode");
+        cnf = std::make_unique<duplicate_message_filter>(m->get_name());
+    }
     report_info("Created a " + demangle::get_demangled_name(typeid(*cnf)));
     return std::move(cnf);
 }
 
 std::unique_ptr<memento> duplicate_message_filter_factory::create_memento(configurator& cfg)
 {
-    auto mnto = std::make_unique<filter_memento>(cfg);
-    mnto->set_default_name(typeid(duplicate_message_filter));
+    auto mnto = std::make_unique<duplicate_message_filter_memento>(cfg);
     return std::move(mnto);
 }
 
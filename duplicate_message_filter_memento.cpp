@@ -0,0 +1,39 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/duplicate_message_filter_memento.hpp>
+#include <chucho/duplicate_message_filter.hpp>
+
+namespace chucho
+{
+
+duplicate_message_filter_memento::duplicate_message_filter_memento(configurator& cfg)
+    : filter_memento(cfg),
+      fingerprint_(false)
+{
+    set_status_origin("duplicate_message_filter_memento");
+    set_default_name(typeid(duplicate_message_filter));
+    cfg.get_security_policy().set_integer("duplicate_message_filter::capacity", 1U, 100000U);
+    cfg.get_security_policy().set_integer("duplicate_message_filter::window", 1U, 60U * 60U * 24U);
+    cfg.get_security_policy().set_text("duplicate_message_filter::capacity(text)", 6);
+    cfg.get_security_policy().set_text("duplicate_message_filter::fingerprint", 5);
+    cfg.get_security_policy().set_text("duplicate_message_filter::window(text)", 5);
+    set_handler("capacity", [this] (const std::string& cap) { capacity_ = validate("duplicate_message_filter::capacity", std::stoul(validate("duplicate_message_filter::capacity(text)", cap))); });
+    set_handler("fingerprint", [this] (const std::string& val) { fingerprint_ = boolean_value(validate("duplicate_message_filter::fingerprint", val)); });
+    set_handler("window", [this] (const std::string& win) { window_ = std::chrono::seconds(validate("duplicate_message_filter::window", std::stoul(validate("duplicate_message_filter::window(text)", win)))); });
+}
+
+}
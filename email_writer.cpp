@@ -20,9 +20,11 @@
 #include <chucho/curl.hpp>
 #include "fnv.h"
 #include <sstream>
-#include <iomanip>
 #include <atomic>
 #include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <functional>
 
 namespace
 {
@@ -44,11 +46,7 @@ std::size_t curl_read_cb(char* buf, std::size_t sz, std::size_t nitems, void* da
     return to_copy;
 }
 
-inline std::ostream& smtpl(std::ostream& stream)
-{
-    stream << "\r\n";
-    return stream;
-}
+const char* const SMTPL = "\r\n";
 
 }
 
@@ -57,6 +55,8 @@ namespace chucho
 
 const std::uint16_t email_writer::DEFAULT_PORT(25);
 const std::size_t email_writer::DEFAULT_BUFFER_CAPACITY(256);
+const std::chrono::milliseconds email_writer::DEFAULT_COALESCE_WINDOW(1000);
+const std::size_t email_writer::DEFAULT_MAX_BACKLOG(16);
 
 email_writer::email_writer(const std::string& name,
                            std::unique_ptr<formatter>&& fmt,
@@ -77,7 +77,13 @@ email_writer::email_writer(const std::string& name,
       host_(host),
       port_(port),
       subject_(subject),
-      connection_type_(connect)
+      connection_type_(connect),
+      coalesce_window_(DEFAULT_COALESCE_WINDOW),
+      max_backlog_(DEFAULT_MAX_BACKLOG),
+      dropped_(0),
+      sending_(false),
+      flushing_(0),
+      stop_(false)
 {
     init();
 }
@@ -105,17 +111,30 @@ email_writer::email_writer(const std::string& name,
       subject_(subject),
       user_(user),
       password_(password),
-      connection_type_(connect)
+      connection_type_(connect),
+      coalesce_window_(DEFAULT_COALESCE_WINDOW),
+      max_backlog_(DEFAULT_MAX_BACKLOG),
+      dropped_(0),
+      sending_(false),
+      flushing_(0),
+      stop_(false)
 {
     init();
 }
 
 email_writer::~email_writer()
 {
-    // Don't delete this destructor.
+    if (sender_)
+    {
+        std::unique_lock<std::mutex> lock(backlog_guard_);
+        stop_ = true;
+        lock.unlock();
+        backlog_condition_.notify_one();
+        sender_->join();
+    }
 }
 
-std::string email_writer::format_date() const
+void email_writer::append_date(std::string& msg) const
 {
     static const char* ENG_DAY[] =
     {
@@ -128,51 +147,56 @@ std::string email_writer::format_date() const
     };
 
     calendar::pieces p = calendar::get_local(std::time(nullptr));
-    std::ostringstream stream;
-    stream << std::setfill('0') << ENG_DAY[p.tm_wday] << ", " << p.tm_mday << ' ' <<
-        ENG_MON[p.tm_mon] << ' ' << (p.tm_year + 1900) << ' ' << std::setw(2) << p.tm_hour <<
-        ':' << std::setw(2) << p.tm_min << ':' << std::setw(2) << p.tm_sec << ' ';
     long tz = calendar::get_time_zone_offset_in_minutes();
+    char sign = '+';
     if (tz < 0)
     {
-        stream << '-';
+        sign = '-';
         tz = -tz;
     }
-    else
-    {
-        stream << '+';
-    }
-    stream << std::setw(2) << (tz / 60) << std::setw(2) << (tz % 60);
-    return stream.str();
+    char buf[64];
+    int len = std::snprintf(buf, sizeof(buf), "%s, %d %s %d %02d:%02d:%02d %c%02ld%02ld",
+                            ENG_DAY[p.tm_wday], p.tm_mday, ENG_MON[p.tm_mon], p.tm_year + 1900,
+                            p.tm_hour, p.tm_min, p.tm_sec, sign, tz / 60, tz % 60);
+    msg.append(buf, len);
 }
 
-std::string email_writer::format_message(const event& evt)
+void email_writer::flush()
 {
-    std::ostringstream stream;
-    stream << "Date: " << format_date() << smtpl;
-    stream << "To: ";
-    for (unsigned i = 0; i < to_.size(); i++)
-    {
-        stream << '<' << to_[i] << '>';
-        if (i != to_.size() - 1)
-            stream << ',';
-    }
-    stream << smtpl;
-    stream << "From: <" << from_ << '>' << smtpl;
-    pattern_formatter sub_fmt(subject_);
-    stream << "Subject: " << sub_fmt.format(evt) << smtpl;
-    stream << smtpl; // Empty line required to separate header from body
-    while (!evts_.empty())
+    std::unique_lock<std::mutex> lock(backlog_guard_);
+    ++flushing_;
+    backlog_condition_.notify_one();
+    sent_condition_.wait(lock, [this] () { return backlog_.empty() && !sending_; });
+    --flushing_;
+}
+
+std::string email_writer::format_message(const letter& let)
+{
+    // Room for the Message-ID header, which is prepended last
+    static constexpr std::size_t MESSAGE_ID_SIZE = 48;
+
+    std::string msg(MESSAGE_ID_SIZE, ' ');
+    msg += "Date: ";
+    append_date(msg);
+    msg += SMTPL;
+    msg += address_header_;
+    msg += "Subject: ";
+    msg += subject_formatter_->format(let.events.back());
+    msg += SMTPL;
+    msg += SMTPL; // Empty line required to separate header from body
+    for (const auto& evt : let.events)
     {
-        stream << formatter_->format(evts_.front()) << smtpl;
-        evts_.pop();
+        msg += formatter_->format(evt);
+        msg += SMTPL;
     }
-    std::string msg = stream.str();
-    Fnv64_t fnv = fnv_64a_str(const_cast<char*>(msg.c_str()), FNV1A_64_INIT);
-    stream.str("");
-    stream << "Message-ID: " << std::setfill('0') << std::hex << std::setw(16) <<
-        fnv << '-' << std::setw(16) << std::time(nullptr) << smtpl;
-    msg.insert(0, stream.str());
+    Fnv64_t fnv = fnv_64a_buf(const_cast<char*>(msg.data() + MESSAGE_ID_SIZE),
+                              msg.length() - MESSAGE_ID_SIZE,
+                              FNV1A_64_INIT);
+    char buf[MESSAGE_ID_SIZE + 1];
+    int len = std::snprintf(buf, sizeof(buf), "Message-ID: %016" PRIx64 "-%016llx\r\n",
+                            static_cast<std::uint64_t>(fnv),
+                            static_cast<unsigned long long>(std::time(nullptr)));
+    msg.replace(0, MESSAGE_ID_SIZE, buf, len);
     return msg;
 }
 
@@ -236,6 +260,40 @@ void email_writer::init()
         curl_.reset();
         throw;
     }
+    subject_formatter_ = std::make_unique<pattern_formatter>(subject_);
+    address_header_ = "To: ";
+    for (unsigned i = 0; i < to_.size(); i++)
+    {
+        address_header_ += '<' + to_[i] + '>';
+        if (i != to_.size() - 1)
+            address_header_ += ',';
+    }
+    address_header_ += SMTPL;
+    address_header_ += "From: <" + from_ + '>' + SMTPL;
+    sender_ = std::make_unique<std::thread>(std::bind(&email_writer::thread_main, this));
+}
+
+void email_writer::send(const letter& let)
+{
+    read_data rd;
+    rd.message = format_message(let);
+    rd.pos = 0;
+    curl_->set_option(CURLOPT_READDATA, &rd, "read user data");
+    CURLcode rc = curl_easy_perform(curl_->get());
+    if (rc != CURLE_OK)
+        throw exception(std::string("Could not send email: ") + curl_easy_strerror(rc));
+}
+
+void email_writer::set_coalesce_window(const std::chrono::milliseconds& window)
+{
+    std::lock_guard<std::mutex> lock(backlog_guard_);
+    coalesce_window_ = window;
+}
+
+void email_writer::set_max_backlog(std::size_t max)
+{
+    std::lock_guard<std::mutex> lock(backlog_guard_);
+    max_backlog_ = std::max(max, static_cast<std::size_t>(1));
 }
 
 void email_writer::set_verbose(bool state)
@@ -243,18 +301,90 @@ void email_writer::set_verbose(bool state)
     curl_->set_verbose(state);
 }
 
+void email_writer::thread_main()
+{
+    std::unique_lock<std::mutex> lock(backlog_guard_);
+    thread_state state;
+    while (true)
+    {
+        configure_thread("email", state);
+        if (backlog_.empty())
+        {
+            if (stop_)
+                break;
+            backlog_condition_.wait(lock);
+            continue;
+        }
+        if (!stop_ && flushing_ == 0 && std::chrono::steady_clock::now() < backlog_.front().deadline)
+        {
+            backlog_condition_.wait_until(lock, backlog_.front().deadline);
+            continue;
+        }
+        letter let(std::move(backlog_.front()));
+        backlog_.pop_front();
+        sending_ = true;
+        lock.unlock();
+        try
+        {
+            send(let);
+        }
+        catch (std::exception& e)
+        {
+            report_error(e.what());
+        }
+        lock.lock();
+        sending_ = false;
+        sent_condition_.notify_all();
+    }
+}
+
 void email_writer::write_impl(const event& evt)
 {
     evts_.push(evt);
     if (trigger_->is_triggered(evt))
     {
-        read_data rd;
-        rd.message = format_message(evt);
-        rd.pos = 0;
-        curl_->set_option(CURLOPT_READDATA, &rd, "read user data");
-        CURLcode rc = curl_easy_perform(curl_->get());
-        if (rc != CURLE_OK)
-            throw exception(std::string("Could not send email: ") + curl_easy_strerror(rc));
+        auto& q = evts_.queue();
+        std::vector<event> events;
+        events.reserve(q.size());
+        while (!q.empty())
+        {
+            events.push_back(std::move(q.front()));
+            q.pop();
+        }
+        std::size_t dropped = 0;
+        std::size_t dropped_now = 0;
+        auto now = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(backlog_guard_);
+        if (!backlog_.empty() && now < backlog_.back().deadline)
+        {
+            auto& pending = backlog_.back().events;
+            pending.insert(pending.end(),
+                           std::make_move_iterator(events.begin()),
+                           std::make_move_iterator(events.end()));
+        }
+        else
+        {
+            backlog_.push_back(letter());
+            backlog_.back().events = std::move(events);
+            backlog_.back().deadline = now + coalesce_window_;
+            while (backlog_.size() > max_backlog_)
+            {
+                dropped_now += backlog_.front().events.size();
+                dropped_ += backlog_.front().events.size();
+                backlog_.pop_front();
+                dropped++;
+            }
+        }
+        std::size_t dropped_events = dropped_;
+        lock.unlock();
+        backlog_condition_.notify_one();
+        if (dropped > 0)
+        {
+            report_warning("The email backlog is full, so " + std::to_string(dropped) +
+                (dropped == 1 ? " waiting email" : " waiting emails") + " with " + std::to_string(dropped_now) +
+                " events " + (dropped == 1 ? "has" : "have") + " been discarded (" + std::to_string(dropped_events) +
+                " events have been discarded in total)");
+        }
     }
 }
 
@@ -84,8 +84,13 @@ std::unique_ptr<configurable> email_writer_factory::create_configurable(std::uni
 
     }
     set_filters(*wrt, *ewm);
+    set_thread_settings(*wrt, *ewm);
     if (ewm->get_verbose())
         wrt->set_verbose(*ewm->get_verbose());
+    if (ewm->get_coalesce_window())
+        wrt->set_coalesce_window(*ewm->get_coalesce_window());
+    if (ewm->get_max_backlog())
+        wrt->set_max_backlog(*ewm->get_max_backlog());
     report_info("Created a " + demangle::get_demangled_name(typeid(*wrt)));
     return std::move(wrt);
 }
@@ -39,6 +39,10 @@ email_writer_memento::email_writer_memento(configurator& cfg)
     cfg.get_security_policy().set_text("email_writer::to(text)", 320 * 100 + 100);
     cfg.get_security_policy().set_text("email_writer::to(address)", 320);
     cfg.get_security_policy().set_text("email_writer::verbose", 5);
+    cfg.get_security_policy().set_integer("email_writer::coalesce_window", 0U, 60U * 60U * 1000U);
+    cfg.get_security_policy().set_text("email_writer::coalesce_window(text)", 7);
+    cfg.get_security_policy().set_integer("email_writer::max_backlog", 1U, 10000U);
+    cfg.get_security_policy().set_text("email_writer::max_backlog(text)", 5);
     set_handler("from", [this] (const std::string& from) { from_ = validate("email_writer::from", from); });
     set_handler("to", std::bind(&email_writer_memento::set_to, this, std::placeholders::_1));
     set_handler("host", [this] (const std::string& host) { host_ = validate("email_writer::host", host); });
@@ -48,6 +52,8 @@ email_writer_memento::email_writer_memento(configurator& cfg)
     set_handler("password", [this] (const std::string& pass) { password_ = validate("email_writer::password", pass); });
     set_handler("connection_type", std::bind(&email_writer_memento::set_connection_type, this, std::placeholders::_1));
     set_handler("buffer_size", [this] (const std::string& bs) { buffer_size_ = validate("email_writer::buffer_size", std::stoul(validate("email_writer::buffer_size(text)", bs))); });
+    set_handler("coalesce_window", [this] (const std::string& ms) { coalesce_window_ = std::chrono::milliseconds(validate("email_writer::coalesce_window", std::stoul(validate("email_writer::coalesce_window(text)", ms)))); });
+    set_handler("max_backlog", [this] (const std::string& mb) { max_backlog_ = validate("email_writer::max_backlog", std::stoul(validate("email_writer::max_backlog(text)", mb))); });
     set_handler("verbose", [this] (const std::string& val) { verbose_ = boolean_value(validate("email_writer::verbose", val)); });
 }
 
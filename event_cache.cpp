@@ -54,7 +54,8 @@ event_cache::event_cache(std::size_t chunk_size, std::size_t max_size)
       mem_chunk_occupied_(0),
       stats_(chunk_size, max_size),
       total_bytes_written_(0),
-      last_fullness_threshold_(0.0)
+      last_fullness_threshold_(0.0),
+      fullness_(0.0)
 {
     if (stats_.chunk_size_ >= stats_.max_size_)
         throw std::invalid_argument("max_size must be greater than chunk_size");
@@ -90,6 +91,7 @@ void event_cache::cull()
         ++stats_.files_destroyed_;
     }
     stats_.current_size_ -= culled;
+    fullness_.store(static_cast<double>(stats_.current_size_) / static_cast<double>(stats_.max_size_), std::memory_order_relaxed);
     std::ostringstream stream;
     stream << "The cache is full. Removed " << culled << " oldest bytes.";
     if (!oldest.empty())
@@ -133,7 +135,7 @@ event_cache_stats event_cache::get_stats()
     return stats_;
 }
 
-optional<event> event_cache::pop(std::chrono::milliseconds to_wait)
+optional<event> event_cache::pop(std::chrono::milliseconds to_wait, std::string* tag)
 {
     optional<event> result;
     std::unique_lock<std::mutex> lock(guard_);
@@ -159,8 +161,9 @@ optional<event> event_cache::pop(std::chrono::milliseconds to_wait)
             report_info("Loaded and removed file " + oldest);
         }
         std::size_t sz;
-        result = unserialize(sz);
+        result = unserialize(sz, tag);
         stats_.current_size_ -= sz;
+        fullness_.store(static_cast<double>(stats_.current_size_) / static_cast<double>(stats_.max_size_), std::memory_order_relaxed);
         read_pos_ += sz;
         mem_chunk_occupied_ -= sz;
         ++stats_.events_read_;
@@ -169,10 +172,10 @@ optional<event> event_cache::pop(std::chrono::milliseconds to_wait)
     return result;
 }
 
-void event_cache::push(const event& evt)
+void event_cache::push(const event& evt, const std::string& tag)
 {
     std::lock_guard<std::mutex> lock(guard_);
-    auto sz = serialize(evt);
+    auto sz = serialize(evt, tag);
     if (write_pos_ != nullptr && (write_pos_ - mem_chunk_.get()) + sz <= stats_.chunk_size_)
     {
         std::memcpy(write_pos_, &ser_buf_[0], sz);
@@ -197,6 +200,7 @@ void event_cache::push(const event& evt)
         write_file_->flush();
     }
     stats_.current_size_ += sz;
+    fullness_.store(static_cast<double>(stats_.current_size_) / static_cast<double>(stats_.max_size_), std::memory_order_relaxed);
     ++stats_.events_written_;
     if (stats_.current_size_ > stats_.largest_size_)
         stats_.largest_size_ = stats_.current_size_;
@@ -245,11 +249,11 @@ void event_cache::report_progress(event_cache_stats::progress_direction dir)
     }
 }
 
-std::size_t event_cache::serialize(const event& evt)
+std::size_t event_cache::serialize(const event& evt, const std::string& tag)
 {
     std::string mrk_text;
     std::string thr_text;
-    auto sz = serialized_size(evt, mrk_text, thr_text);
+    auto sz = serialized_size(evt, tag, mrk_text, thr_text);
     if (ser_buf_.size() < sz)
         ser_buf_.resize(sz);
     std::size_t pos = 0;
@@ -293,10 +297,15 @@ std::size_t event_cache::serialize(const event& evt)
     set_ser_buf<std::uint16_t>(pos, static_cast<std::uint16_t>(len));
     pos += 2;
     std::memcpy(&ser_buf_[pos], thr_text.data(), len);
+    pos += len;
+    len = tag.length();
+    set_ser_buf<std::uint16_t>(pos, static_cast<std::uint16_t>(len));
+    pos += 2;
+    std::memcpy(&ser_buf_[pos], tag.data(), len);
     return sz;
 }
 
-std::size_t event_cache::serialized_size(const event& evt, std::string& mrk_text, std::string& thr_text)
+std::size_t event_cache::serialized_size(const event& evt, const std::string& tag, std::string& mrk_text, std::string& thr_text)
 {
     std::size_t sz = 4 +
                      2 + evt.get_logger()->get_name().length() +
@@ -319,6 +328,7 @@ std::size_t event_cache::serialized_size(const event& evt, std::string& mrk_text
     stream << std::this_thread::get_id();
     thr_text = stream.str();
     sz += thr_text.length();
+    sz += 2 + tag.length();
     return sz;
 }
 
@@ -355,7 +365,7 @@ void event_cache::stop()
     }
 }
 
-event event_cache::unserialize(std::size_t& sz)
+event event_cache::unserialize(std::size_t& sz, std::string* tag)
 {
     sz = get_mem_buf<std::uint32_t>(0);
     std::size_t pos = 4;
@@ -390,6 +400,13 @@ event event_cache::unserialize(std::size_t& sz)
     len = get_mem_buf<std::uint16_t>(pos);
     pos += 2;
     auto thr = get_mem_buf_str(pos, len);
+    pos += len;
+    if (tag != nullptr)
+    {
+        len = get_mem_buf<std::uint16_t>(pos);
+        pos += 2;
+        *tag = get_mem_buf_str(pos, len);
+    }
     optional<marker> omrk;
     if (!mrk.empty())
         omrk = mrk;
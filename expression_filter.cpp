@@ -0,0 +1,490 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/expression_filter.hpp>
+#include <chucho/logger.hpp>
+#include <chucho/diagnostic_context.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/regex.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace
+{
+
+typedef std::function<bool(const chucho::event&)> predicate;
+
+struct text
+{
+    const char* data;
+    std::size_t size;
+    // This is set when the text is held in a string, so that a
+    // regular expression can be searched without a copy
+    const std::string* str;
+};
+
+// Returns false if the field is not present in the event
+typedef std::function<bool(const chucho::event&, text&)> text_getter;
+
+enum class comparison
+{
+    EQUAL,
+    NOT_EQUAL,
+    LESS,
+    LESS_EQUAL,
+    GREATER,
+    GREATER_EQUAL
+};
+
+enum class token_type
+{
+    END,
+    IDENTIFIER,
+    NUMBER,
+    OPERATOR,
+    STRING
+};
+
+struct token
+{
+    token_type type;
+    std::string value;
+    std::size_t pos;
+};
+
+bool compare(int lhs, int rhs, comparison cmp)
+{
+    switch (cmp)
+    {
+    case comparison::EQUAL:
+        return lhs == rhs;
+    case comparison::NOT_EQUAL:
+        return lhs != rhs;
+    case comparison::LESS:
+        return lhs < rhs;
+    case comparison::LESS_EQUAL:
+        return lhs <= rhs;
+    case comparison::GREATER:
+        return lhs > rhs;
+    case comparison::GREATER_EQUAL:
+    default:
+        return lhs >= rhs;
+    }
+}
+
+void set_text(text& t, const std::string& str)
+{
+    t.data = str.data();
+    t.size = str.length();
+    t.str = &str;
+}
+
+bool set_text(text& t, const char* const str)
+{
+    if (str == nullptr)
+        return false;
+    t.data = str;
+    t.size = std::strlen(str);
+    t.str = nullptr;
+    return true;
+}
+
+class parser
+{
+public:
+    parser(const std::string& expr);
+
+    predicate parse();
+
+private:
+    bool accept(const char* const op);
+    [[noreturn]] void fail(const std::string& msg, const token& tok);
+    token next();
+    predicate parse_and();
+    comparison parse_comparison();
+    predicate parse_level();
+    predicate parse_line_number();
+    predicate parse_not();
+    predicate parse_or();
+    predicate parse_primary();
+    predicate parse_text(text_getter get, const std::string& field);
+    const token& peek();
+
+    const std::string& expr_;
+    std::size_t pos_;
+    token peeked_;
+    bool have_peeked_;
+};
+
+parser::parser(const std::string& expr)
+    : expr_(expr),
+      pos_(0),
+      have_peeked_(false)
+{
+}
+
+bool parser::accept(const char* const op)
+{
+    auto& tok = peek();
+    if ((tok.type == token_type::OPERATOR || tok.type == token_type::IDENTIFIER) && tok.value == op)
+    {
+        have_peeked_ = false;
+        return true;
+    }
+    return false;
+}
+
+void parser::fail(const std::string& msg, const token& tok)
+{
+    throw chucho::exception("expression_filter: " + msg + " at position " + std::to_string(tok.pos + 1) +
+        " of the expression: " + expr_);
+}
+
+token parser::next()
+{
+    if (have_peeked_)
+    {
+        have_peeked_ = false;
+        return peeked_;
+    }
+    while (pos_ < expr_.length() && std::isspace(static_cast<unsigned char>(expr_[pos_])))
+        pos_++;
+    token result{token_type::END, std::string(), pos_};
+    if (pos_ == expr_.length())
+        return result;
+    char c = expr_[pos_];
+    if (std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+    {
+        result.type = token_type::IDENTIFIER;
+        while (pos_ < expr_.length() &&
+               (std::isalnum(static_cast<unsigned char>(expr_[pos_])) || expr_[pos_] == '_'))
+        {
+            result.value += expr_[pos_++];
+        }
+    }
+    else if (std::isdigit(static_cast<unsigned char>(c)))
+    {
+        result.type = token_type::NUMBER;
+        while (pos_ < expr_.length() && std::isdigit(static_cast<unsigned char>(expr_[pos_])))
+            result.value += expr_[pos_++];
+    }
+    else if (c == '"' || c == '\'')
+    {
+        result.type = token_type::STRING;
+        pos_++;
+        while (true)
+        {
+            if (pos_ == expr_.length())
+                fail("Unterminated string", result);
+            if (expr_[pos_] == c)
+                break;
+            if (expr_[pos_] == '\\' && pos_ + 1 < expr_.length())
+                pos_++;
+            result.value += expr_[pos_++];
+        }
+        pos_++;
+    }
+    else
+    {
+        static const char* const ops[] = { "&&", "||", "==", "!=", "<=", ">=", "<", ">", "!", "(", ")" };
+        for (auto op : ops)
+        {
+            if (expr_.compare(pos_, std::strlen(op), op) == 0)
+            {
+                result.type = token_type::OPERATOR;
+                result.value = op;
+                pos_ += result.value.length();
+                return result;
+            }
+        }
+        fail(std::string("Unexpected character '") + c + "'", result);
+    }
+    return result;
+}
+
+predicate parser::parse()
+{
+    auto result = parse_or();
+    auto tok = next();
+    if (tok.type != token_type::END)
+        fail("Unexpected text '" + tok.value + "'", tok);
+    return result;
+}
+
+predicate parser::parse_and()
+{
+    auto result = parse_not();
+    while (accept("&&") || accept("and"))
+    {
+        auto rhs = parse_not();
+        result = [result, rhs] (const chucho::event& evt) { return result(evt) && rhs(evt); };
+    }
+    return result;
+}
+
+comparison parser::parse_comparison()
+{
+    auto tok = next();
+    if (tok.type == token_type::OPERATOR)
+    {
+        if (tok.value == "==")
+            return comparison::EQUAL;
+        if (tok.value == "!=")
+            return comparison::NOT_EQUAL;
+        if (tok.value == "<")
+            return comparison::LESS;
+        if (tok.value == "<=")
+            return comparison::LESS_EQUAL;
+        if (tok.value == ">")
+            return comparison::GREATER;
+        if (tok.value == ">=")
+            return comparison::GREATER_EQUAL;
+    }
+    fail("Expected a comparison", tok);
+}
+
+predicate parser::parse_level()
+{
+    auto cmp = parse_comparison();
+    auto tok = next();
+    if (tok.type != token_type::IDENTIFIER && tok.type != token_type::STRING)
+        fail("Expected a level name", tok);
+    std::shared_ptr<chucho::level> lvl;
+    try
+    {
+        lvl = chucho::level::from_text(tok.value);
+    }
+    catch (std::exception&)
+    {
+    }
+    if (!lvl)
+        fail("Unknown level '" + tok.value + "'", tok);
+    int val = lvl->get_value();
+    return [val, cmp] (const chucho::event& evt) { return compare(evt.get_level()->get_value(), val, cmp); };
+}
+
+predicate parser::parse_line_number()
+{
+    auto cmp = parse_comparison();
+    auto tok = next();
+    if (tok.type != token_type::NUMBER)
+        fail("Expected a number", tok);
+    int val;
+    try
+    {
+        val = std::stoi(tok.value);
+    }
+    catch (std::out_of_range&)
+    {
+        fail("The number is too large", tok);
+    }
+    return [val, cmp] (const chucho::event& evt) { return compare(static_cast<int>(evt.get_line_number()), val, cmp); };
+}
+
+predicate parser::parse_not()
+{
+    if (accept("!") || accept("not"))
+    {
+        auto operand = parse_not();
+        return [operand] (const chucho::event& evt) { return !operand(evt); };
+    }
+    return parse_primary();
+}
+
+predicate parser::parse_or()
+{
+    auto result = parse_and();
+    while (accept("||") || accept("or"))
+    {
+        auto rhs = parse_and();
+        result = [result, rhs] (const chucho::event& evt) { return result(evt) || rhs(evt); };
+    }
+    return result;
+}
+
+predicate parser::parse_primary()
+{
+    auto tok = next();
+    if (tok.type == token_type::OPERATOR && tok.value == "(")
+    {
+        auto result = parse_or();
+        if (!accept(")"))
+            fail("Expected ')'", peek());
+        return result;
+    }
+    if (tok.type != token_type::IDENTIFIER)
+        fail("Expected a field", tok);
+    if (tok.value == "true")
+        return [] (const chucho::event&) { return true; };
+    if (tok.value == "false")
+        return [] (const chucho::event&) { return false; };
+    if (tok.value == "level")
+        return parse_level();
+    if (tok.value == "line_number")
+        return parse_line_number();
+    if (tok.value == "logger")
+    {
+        return parse_text([] (const chucho::event& evt, text& t)
+                          {
+                              auto lgr = evt.get_logger();
+                              if (!lgr)
+                                  return false;
+                              // The event holds the logger, so its name outlives this
+                              set_text(t, lgr->get_name());
+                              return true;
+                          },
+                          tok.value);
+    }
+    if (tok.value == "message")
+        return parse_text([] (const chucho::event& evt, text& t) { set_text(t, evt.get_message()); return true; }, tok.value);
+    if (tok.value == "file_name")
+        return parse_text([] (const chucho::event& evt, text& t) { return set_text(t, evt.get_file_name()); }, tok.value);
+    if (tok.value == "function")
+        return parse_text([] (const chucho::event& evt, text& t) { return set_text(t, evt.get_function_name()); }, tok.value);
+    if (tok.value == "marker")
+    {
+        return parse_text([] (const chucho::event& evt, text& t)
+                          {
+                              auto& mark = evt.get_marker();
+                              if (!mark)
+                                  return false;
+                              set_text(t, mark->get_name());
+                              return true;
+                          },
+                          tok.value);
+    }
+    if (tok.value == "context")
+    {
+        if (!accept("("))
+            fail("Expected '('", peek());
+        auto key = next();
+        if (key.type != token_type::STRING && key.type != token_type::IDENTIFIER)
+            fail("Expected a diagnostic context key", key);
+        if (!accept(")"))
+            fail("Expected ')'", peek());
+        auto k = key.value;
+        return parse_text([k] (const chucho::event&, text& t)
+                          {
+                              auto val = chucho::diagnostic_context::find(k);
+                              if (val == nullptr)
+                                  return false;
+                              set_text(t, *val);
+                              return true;
+                          },
+                          "context(\"" + k + "\")");
+    }
+    fail("Unknown field '" + tok.value + "'", tok);
+}
+
+predicate parser::parse_text(text_getter get, const std::string& field)
+{
+    auto& op = peek();
+    bool negate = false;
+    if (op.type == token_type::OPERATOR && (op.value == "==" || op.value == "!="))
+        negate = op.value == "!=";
+    else if (op.type != token_type::IDENTIFIER ||
+             (op.value != "contains" && op.value != "starts_with" && op.value != "ends_with" && op.value != "matches"))
+        return [get] (const chucho::event& evt) { text t; return get(evt, t); };
+    auto op_name = next().value;
+    auto tok = next();
+    if (tok.type != token_type::STRING)
+        fail("Expected a quoted string to compare with " + field, tok);
+    auto val = tok.value;
+    if (op_name == "==" || op_name == "!=")
+    {
+        return [get, val, negate] (const chucho::event& evt)
+        {
+            text t;
+            bool eq = get(evt, t) && t.size == val.length() && std::memcmp(t.data, val.data(), t.size) == 0;
+            return eq != negate;
+        };
+    }
+    if (op_name == "contains")
+    {
+        return [get, val] (const chucho::event& evt)
+        {
+            text t;
+            return get(evt, t) && std::search(t.data, t.data + t.size, val.begin(), val.end()) != t.data + t.size;
+        };
+    }
+    if (op_name == "starts_with")
+    {
+        return [get, val] (const chucho::event& evt)
+        {
+            text t;
+            return get(evt, t) && t.size >= val.length() && std::memcmp(t.data, val.data(), val.length()) == 0;
+        };
+    }
+    if (op_name == "ends_with")
+    {
+        return [get, val] (const chucho::event& evt)
+        {
+            text t;
+            return get(evt, t) &&
+                t.size >= val.length() &&
+                std::memcmp(t.data + t.size - val.length(), val.data(), val.length()) == 0;
+        };
+    }
+    std::shared_ptr<chucho::regex::expression> re;
+    try
+    {
+        re = std::make_shared<chucho::regex::expression>(val);
+    }
+    catch (std::exception& e)
+    {
+        fail("Invalid regular expression '" + val + "' (" + e.what() + ")", tok);
+    }
+    return [get, re] (const chucho::event& evt)
+    {
+        text t;
+        if (!get(evt, t))
+            return false;
+        return t.str == nullptr ?
+            chucho::regex::search(std::string(t.data, t.size), *re) : chucho::regex::search(*t.str, *re);
+    };
+}
+
+const token& parser::peek()
+{
+    if (!have_peeked_)
+    {
+        peeked_ = next();
+        have_peeked_ = true;
+    }
+    return peeked_;
+}
+
+}
+
+namespace chucho
+{
+
+expression_filter::expression_filter(const std::string& name,
+                                     const std::string& expression)
+    : evaluator_filter(name),
+      expression_(expression)
+{
+    set_status_origin("expression_filter");
+    compiled_ = parser(expression_).parse();
+}
+
+filter::result expression_filter::evaluate(const event& evt)
+{
+    return compiled_(evt) ? result::NEUTRAL : result::DENY;
+}
+
+}
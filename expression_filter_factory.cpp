@@ -0,0 +1,51 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/expression_filter_factory.hpp>
+#include <chucho/expression_filter_memento.hpp>
+#include <chucho/expression_filter.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/demangle.hpp>
+#include <assert.h>
+
+namespace chucho
+{
+
+expression_filter_factory::expression_filter_factory()
+{
+    set_status_origin("expression_filter_factory");
+}
+
+std::unique_ptr<configurable> expression_filter_factory::create_configurable(std::unique_ptr<memento>& mnto)
+{
+    auto efm = dynamic_cast<expression_filter_memento*>(mnto.get());
+    assert(efm != nullptr);
+    if (efm->get_name().empty())
+        throw exception("expression_filter_factory: The name must be set");
+    if (efm->get_expression().empty())
+        throw exception("expression_filter_factory: The expression must be set");
+    auto cnf = std::make_unique<expression_filter>(efm->get_name(), efm->get_expression());
+    report_info("Created a " + demangle::get_demangled_name(typeid(*cnf)));
+    return std::move(cnf);
+}
+
+std::unique_ptr<memento> expression_filter_factory::create_memento(configurator& cfg)
+{
+    auto mnto = std::make_unique<expression_filter_memento>(cfg);
+    return std::move(mnto);
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/file_compressor.hpp>
+#include <chucho/thread_util.hpp>
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+namespace chucho
+{
+
+constexpr unsigned file_compressor::DEFAULT_MAX_THREADS;
+
+unsigned file_compressor::default_threads()
+{
+    return std::min(std::max(std::thread::hardware_concurrency(), 1U), DEFAULT_MAX_THREADS);
+}
+
+void file_compressor::run_at_nice(const std::function<void()>& fn) const
+{
+    if (nice_ == 0)
+    {
+        fn();
+    }
+    else
+    {
+        std::exception_ptr err;
+        auto ts = thread_util::get_applied_settings();
+        std::thread thr([this, &fn, &err, &ts] ()
+        {
+            thread_util::configure(ts, "chucho-compress");
+            thread_util::adjust_nice(nice_);
+            try
+            {
+                fn();
+            }
+            catch (...)
+            {
+                err = std::current_exception();
+            }
+        });
+        thr.join();
+        if (err)
+            std::rethrow_exception(err);
+    }
+}
+
+}
@@ -31,4 +31,12 @@ std::unique_ptr<memento> file_compressor_factory::create_memento(configurator& c
     return std::move(mnto);
 }
 
+void file_compressor_factory::set_threads(file_compressor& cmp, const file_compressor_memento& mnto)
+{
+    if (mnto.get_threads())
+        cmp.set_threads(*mnto.get_threads());
+    if (mnto.get_nice())
+        cmp.set_nice(*mnto.get_nice());
+}
+
 }
@@ -25,7 +25,13 @@ file_compressor_memento::file_compressor_memento(configurator& cfg)
     set_status_origin("file_compressor_memento");
     cfg.get_security_policy().set_integer("file_compressor::min_index", 1, 1000);
     cfg.get_security_policy().set_text("file_compressor::min_index(text)", 4);
+    cfg.get_security_policy().set_integer("file_compressor::nice", -20, 19);
+    cfg.get_security_policy().set_text("file_compressor::nice(text)", 3);
+    cfg.get_security_policy().set_integer("file_compressor::threads", 0, 1024);
+    cfg.get_security_policy().set_text("file_compressor::threads(text)", 4);
     set_handler("min_index", [this] (const std::string& idx) { min_index_ = validate("file_compressor::min_index", std::stoul(validate("file_compressor::min_index(text)", idx))); });
+    set_handler("nice", [this] (const std::string& val) { nice_ = validate("file_compressor::nice", std::stoi(validate("file_compressor::nice(text)", val))); });
+    set_handler("threads", [this] (const std::string& val) { threads_ = validate("file_compressor::threads", std::stoul(validate("file_compressor::threads(text)", val))); });
 }
 
 }
@@ -25,19 +25,24 @@ file_descriptor_writer::~file_descriptor_writer()
     close();
 }
 
-void file_descriptor_writer::write_impl(const event& evt)
+void file_descriptor_writer::write_bytes(const char* data, std::size_t len)
 {
-    std::string msg = formatter_->format(evt);
-    std::size_t left = msg.length();
-    while (left > 0)
+    while (len > 0)
     {
-        std::size_t to_copy = std::min(left, buf_.size() - num_);
-        msg.copy(buf_.data() + num_, to_copy, msg.length() - left);
-        left -= to_copy;
+        std::size_t to_copy = std::min(len, buf_.size() - num_);
+        std::copy(data, data + to_copy, buf_.data() + num_);
+        data += to_copy;
+        len -= to_copy;
         num_ += to_copy;
         if (num_ == buf_.size())
             flush();
     }
+}
+
+void file_descriptor_writer::write_impl(const event& evt)
+{
+    std::string msg = formatter_->format(evt);
+    write_bytes(msg.data(), msg.length());
     if (flush_ && num_ > 0)
         flush();
 }
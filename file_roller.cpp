@@ -16,18 +16,72 @@
 
 #include <chucho/file_roller.hpp>
 #include <chucho/file_writer.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/thread_util.hpp>
 
 namespace chucho
 {
 
 file_roller::file_roller(std::unique_ptr<file_compressor>&& cmp)
     : file_writer_(nullptr),
-      compressor_(std::move(cmp))
+      compressor_(std::move(cmp)),
+      compressing_(false),
+      stop_(false)
 {
 }
 
 file_roller::~file_roller()
 {
+    if (compress_thread_)
+    {
+        // Whatever has been handed off is still compressed
+        std::unique_lock<std::mutex> ul(compress_guard_);
+        stop_ = true;
+        ul.unlock();
+        compress_condition_.notify_all();
+        compress_thread_->join();
+    }
+}
+
+void file_roller::compress(const std::string& file_name)
+{
+    std::lock_guard<std::mutex> lg(compress_guard_);
+    to_compress_.push_back(file_name);
+    if (!compress_thread_)
+        compress_thread_ = std::make_unique<std::thread>(&file_roller::compress_main, this);
+    compress_condition_.notify_all();
+}
+
+void file_roller::compress_main()
+{
+    // The thread belongs to the writer, whose settings it takes
+    writer::thread_state state;
+    if (file_writer_ == nullptr)
+        thread_util::configure(thread_util::get_global_settings(), "chucho-compress");
+    std::unique_lock<std::mutex> ul(compress_guard_);
+    while (true)
+    {
+        compress_condition_.wait(ul, [this] () { return !to_compress_.empty() || stop_; });
+        if (to_compress_.empty())
+            break;
+        if (file_writer_ != nullptr)
+            file_writer_->configure_thread("compress", state);
+        std::string file_name = std::move(to_compress_.front());
+        to_compress_.pop_front();
+        compressing_ = true;
+        ul.unlock();
+        try
+        {
+            compressor_->compress(file_name);
+        }
+        catch (std::exception& e)
+        {
+            report_error("Could not compress " + file_name + ": " + exception::nested_whats(e));
+        }
+        ul.lock();
+        compressing_ = false;
+        compress_condition_.notify_all();
+    }
 }
 
 void file_roller::set_file_writer(file_writer& file_writer)
@@ -37,4 +91,10 @@ void file_roller::set_file_writer(file_writer& file_writer)
     file_writer_ = &file_writer;
 }
 
+void file_roller::wait_for_compression()
+{
+    std::unique_lock<std::mutex> ul(compress_guard_);
+    compress_condition_.wait(ul, [this] () { return to_compress_.empty() && !compressing_; });
+}
+
 }
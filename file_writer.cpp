@@ -17,10 +17,19 @@
 #include <chucho/file_writer.hpp>
 #include <chucho/file_exception.hpp>
 #include <chucho/file.hpp>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
 
 namespace
 {
 
+#if defined(_WIN32)
+const HANDLE NO_SYNC_HANDLE = INVALID_HANDLE_VALUE;
+#else
+const int NO_SYNC_HANDLE = -1;
+#endif
+
 inline int to_int(chucho::file::writeability val)
 {
     return static_cast<int>(val);
@@ -31,6 +40,9 @@ inline int to_int(chucho::file::writeability val)
 namespace chucho
 {
 
+constexpr std::size_t file_writer::DEFAULT_COMPRESSED_SYNC_BYTES;
+constexpr std::chrono::milliseconds file_writer::DEFAULT_COMPRESSED_SYNC_INTERVAL;
+
 file_writer::file_writer(const std::string& name,
                          std::unique_ptr<formatter>&& fmt,
                          on_start start,
@@ -40,7 +52,20 @@ file_writer::file_writer(const std::string& name,
       next_access_check_(std::chrono::steady_clock::now()),
       is_open_(false),
       has_been_opened_(false),
-      allow_creation_(true)
+      allow_creation_(true),
+      durability_(durability::NONE),
+      sync_interval_(0),
+      sync_handle_(NO_SYNC_HANDLE),
+      written_(0),
+      requested_(0),
+      synced_(0),
+      stop_(false),
+      uncompressed_size_(0),
+      compressed_sync_bytes_(DEFAULT_COMPRESSED_SYNC_BYTES),
+      compressed_sync_interval_(DEFAULT_COMPRESSED_SYNC_INTERVAL),
+      unsynced_size_(0),
+      last_compressed_sync_(std::chrono::steady_clock::now()),
+      writing_compressed_(false)
 {
     set_status_origin("file_writer");
 }
@@ -56,12 +81,64 @@ file_writer::file_writer(const std::string& name,
       next_access_check_(std::chrono::steady_clock::now()),
       is_open_(false),
       has_been_opened_(false),
-      allow_creation_(true)
+      allow_creation_(true),
+      durability_(durability::NONE),
+      sync_interval_(0),
+      sync_handle_(NO_SYNC_HANDLE),
+      written_(0),
+      requested_(0),
+      synced_(0),
+      stop_(false),
+      uncompressed_size_(0),
+      compressed_sync_bytes_(DEFAULT_COMPRESSED_SYNC_BYTES),
+      compressed_sync_interval_(DEFAULT_COMPRESSED_SYNC_INTERVAL),
+      unsynced_size_(0),
+      last_compressed_sync_(std::chrono::steady_clock::now()),
+      writing_compressed_(false)
 {
     set_status_origin("file_writer");
     open(file_name);
 }
 
+file_writer::~file_writer()
+{
+    // The stream has to be ended while the compressor is still here
+    if (stream_compressor_)
+        close();
+    if (durability_ != durability::NONE)
+    {
+        stop_sync_thread();
+        close();
+        std::unique_lock<std::mutex> ul(sync_guard_);
+        bool unsynced = written_ > synced_;
+        ul.unlock();
+        if (unsynced)
+            sync(written_);
+        std::lock_guard<std::mutex> hl(handle_guard_);
+        close_sync_handle();
+    }
+}
+
+void file_writer::close()
+{
+    if (stream_compressor_)
+    {
+        try
+        {
+            stream_compressor_->finish(compressed_);
+            unsynced_size_ = 0;
+            if (get_file_descriptor() != -1)
+                write_compressed();
+        }
+        catch (std::exception& e)
+        {
+            report_error(std::string("An error occurred while ending the compressed stream: ") + e.what());
+        }
+        compressed_.clear();
+    }
+    file_descriptor_writer::close();
+}
+
 void file_writer::ensure_access()
 {
     if (std::chrono::steady_clock::now() >= next_access_check_) 
@@ -120,6 +197,18 @@ void file_writer::ensure_access()
     }
 }
 
+void file_writer::flush()
+{
+    if (stream_compressor_ && !writing_compressed_ && get_file_descriptor() != -1)
+    {
+        stream_compressor_->sync(compressed_);
+        unsynced_size_ = 0;
+        last_compressed_sync_ = std::chrono::steady_clock::now();
+        write_compressed();
+    }
+    file_descriptor_writer::flush();
+}
+
 void file_writer::open(const std::string& file_name)
 {
     if (file_name_ != file_name)
@@ -131,12 +220,29 @@ void file_writer::open(const std::string& file_name)
     {
         if (allow_creation_)
             file::create_directories(file::directory_name(file_name));
+        // A compressed stream can't continue in another file
+        if (stream_compressor_)
+            close();
+        uncompressed_size_ = 0;
         open_impl(file_name);
+        if (durability_ != durability::NONE)
+        {
+            // Whatever went to the previous file is synced before
+            // its handle is let go
+            std::unique_lock<std::mutex> ul(sync_guard_);
+            bool unsynced = written_ > synced_;
+            ul.unlock();
+            if (unsynced)
+                sync(written_);
+            std::lock_guard<std::mutex> hl(handle_guard_);
+            duplicate_sync_handle();
+        }
         if (is_open_)
         {
             next_access_check_ = std::chrono::steady_clock::now() + std::chrono::seconds(3);
             writeability_ = to_int(file::writeability::WRITEABLE);
             has_been_opened_ = true;
+            opened();
         }
     }
     catch (std::exception& e)
@@ -145,13 +251,184 @@ void file_writer::open(const std::string& file_name)
     }
 }
 
+void file_writer::opened()
+{
+}
+
+bool file_writer::is_sync_level(const event& evt) const
+{
+    return !sync_level_ || *evt.get_level() >= *sync_level_;
+}
+
+file_writer::sync_latency file_writer::get_sync_latency()
+{
+    std::lock_guard<std::mutex> lg(sync_guard_);
+    return latency_;
+}
+
+void file_writer::set_compressed_sync(std::size_t bytes, std::chrono::milliseconds intvl)
+{
+    compressed_sync_bytes_ = bytes;
+    compressed_sync_interval_ = intvl;
+}
+
+void file_writer::set_durability(durability dur,
+                                 std::chrono::milliseconds intvl,
+                                 std::shared_ptr<level> lvl)
+{
+    if (dur == durability::INTERVAL && intvl.count() <= 0)
+        throw std::invalid_argument("The sync interval must be positive");
+    if (dur == durability::LEVEL && !lvl)
+        throw std::invalid_argument("The sync level must be set");
+    stop_sync_thread();
+    durability_ = dur;
+    sync_interval_ = intvl;
+    sync_level_ = lvl;
+    {
+        std::lock_guard<std::mutex> hl(handle_guard_);
+        if (durability_ == durability::NONE)
+            close_sync_handle();
+        else
+            duplicate_sync_handle();
+    }
+    if (durability_ == durability::INTERVAL || durability_ == durability::GROUP_COMMIT)
+    {
+        stop_ = false;
+        sync_thread_ = std::make_unique<std::thread>(std::bind(&file_writer::thread_main, this));
+    }
+}
+
+void file_writer::set_stream_compressor(std::unique_ptr<stream_compressor>&& cmp)
+{
+    if (stream_compressor_ && get_file_descriptor() != -1)
+    {
+        stream_compressor_->finish(compressed_);
+        write_compressed();
+    }
+    stream_compressor_ = std::move(cmp);
+}
+
+void file_writer::stop_sync_thread()
+{
+    if (sync_thread_)
+    {
+        std::unique_lock<std::mutex> ul(sync_guard_);
+        stop_ = true;
+        ul.unlock();
+        sync_condition_.notify_one();
+        synced_condition_.notify_all();
+        sync_thread_->join();
+        sync_thread_.reset();
+    }
+}
+
+void file_writer::sync(std::size_t target)
+{
+    auto start = std::chrono::steady_clock::now();
+    try
+    {
+        std::lock_guard<std::mutex> hl(handle_guard_);
+        sync_handle();
+    }
+    catch (std::exception& e)
+    {
+        report_error(std::string("Could not sync the file: ") + e.what());
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    std::lock_guard<std::mutex> lg(sync_guard_);
+    synced_ = std::max(synced_, target);
+    latency_.count++;
+    latency_.last = elapsed;
+    latency_.max = std::max(latency_.max, elapsed);
+    latency_.total += elapsed;
+    synced_condition_.notify_all();
+}
+
+void file_writer::sync_written(const event& evt)
+{
+    if (durability_ != durability::NONE)
+    {
+        bool at_level = durability_ != durability::INTERVAL && is_sync_level(evt);
+        // The event can't be synced while it's still in our buffer
+        // or the compressor
+        if (at_level && (!get_flush() || unsynced_size_ > 0))
+            flush();
+        std::unique_lock<std::mutex> ul(sync_guard_);
+        std::size_t target = ++written_;
+        ul.unlock();
+        if (at_level && durability_ == durability::LEVEL)
+            sync(target);
+    }
+}
+
+void file_writer::thread_main()
+{
+    std::unique_lock<std::mutex> ul(sync_guard_);
+    thread_state state;
+    while (!stop_)
+    {
+        configure_thread("sync", state);
+        if (durability_ == durability::INTERVAL)
+            sync_condition_.wait_for(ul, sync_interval_, [this] () { return stop_; });
+        else
+            sync_condition_.wait(ul, [this] () { return stop_ || requested_ > synced_; });
+        if (!stop_ && written_ > synced_)
+        {
+            // Everything written so far rides along with this sync
+            std::size_t target = written_;
+            ul.unlock();
+            sync(target);
+            ul.lock();
+        }
+    }
+}
+
+void file_writer::write_compressed()
+{
+    struct sentry
+    {
+        sentry(file_writer& fw) : fw_(fw) { fw_.writing_compressed_ = true; }
+        ~sentry() { fw_.writing_compressed_ = false; fw_.compressed_.clear(); }
+        file_writer& fw_;
+    } sent(*this);
+    write_bytes(reinterpret_cast<const char*>(compressed_.data()), compressed_.size());
+}
+
 void file_writer::write_impl(const event& evt)
 {
     try
     {
         ensure_access();
         if (is_open_)
-            file_descriptor_writer::write_impl(evt);
+        {
+            if (stream_compressor_)
+            {
+                std::string msg = formatter_->format(evt);
+                uncompressed_size_ += msg.length();
+                unsynced_size_ += msg.length();
+                stream_compressor_->compress(msg.data(), msg.length(), compressed_);
+                write_compressed();
+                if (get_flush())
+                {
+                    // Each sync costs compression, so it waits for
+                    // enough bytes or time
+                    if (unsynced_size_ >= compressed_sync_bytes_ ||
+                        std::chrono::steady_clock::now() - last_compressed_sync_ >= compressed_sync_interval_)
+                    {
+                        flush();
+                    }
+                    else
+                    {
+                        file_descriptor_writer::flush();
+                    }
+                }
+            }
+            else
+            {
+                file_descriptor_writer::write_impl(evt);
+            }
+            sync_written(evt);
+        }
         else
             report_error("Cannot write to " + file_name_ + " because it is not open");
     }
@@ -165,4 +442,19 @@ void file_writer::write_impl(const event& evt)
     }
 }
 
+void file_writer::written(const event& evt)
+{
+    if (durability_ == durability::GROUP_COMMIT && is_sync_level(evt))
+    {
+        std::unique_lock<std::mutex> ul(sync_guard_);
+        std::size_t target = written_;
+        if (synced_ < target)
+        {
+            requested_ = std::max(requested_, target);
+            sync_condition_.notify_one();
+            synced_condition_.wait(ul, [this, target] () { return synced_ >= target || stop_; });
+        }
+    }
+}
+
 }
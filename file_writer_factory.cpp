@@ -30,7 +30,7 @@ file_writer_factory::file_writer_factory()
 
 std::unique_ptr<configurable> file_writer_factory::create_configurable(std::unique_ptr<memento>& mnto)
 {
-    std::unique_ptr<configurable> cnf;
+    std::unique_ptr<file_writer> cnf;
     auto fwm = dynamic_cast<file_writer_memento*>(mnto.get());
     assert(fwm != nullptr);
     if (fwm->get_name().empty())
@@ -69,7 +69,22 @@ std::unique_ptr<configurable> file_writer_factory::create_configurable(std::uniq
                                             std::move(fmt),
                                             fwm->get_file_name());
     }
+    if (fwm->get_durability())
+    {
+        cnf->set_durability(*fwm->get_durability(),
+                            fwm->get_sync_interval() ? *fwm->get_sync_interval() : std::chrono::milliseconds(0),
+                            fwm->get_sync_level());
+    }
+    auto cmp = fwm->get_stream_compressor();
+    if (cmp)
+        cnf->set_stream_compressor(std::move(cmp));
+    if (fwm->get_compressed_sync_bytes() || fwm->get_compressed_sync_interval())
+    {
+        cnf->set_compressed_sync(fwm->get_compressed_sync_bytes() ? *fwm->get_compressed_sync_bytes() : file_writer::DEFAULT_COMPRESSED_SYNC_BYTES,
+                                 fwm->get_compressed_sync_interval() ? *fwm->get_compressed_sync_interval() : file_writer::DEFAULT_COMPRESSED_SYNC_INTERVAL);
+    }
     set_filters(*cnf, *fwm);
+    set_thread_settings(*cnf, *fwm);
     report_info("Created a " + demangle::get_demangled_name(typeid(*cnf)));
     return std::move(cnf);
 }
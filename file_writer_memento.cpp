@@ -17,6 +17,7 @@
 #include <chucho/file_writer_memento.hpp>
 #include <chucho/exception.hpp>
 #include <chucho/text_util.hpp>
+#include <chucho/move_util.hpp>
 
 namespace chucho
 {
@@ -30,6 +31,14 @@ file_writer_memento::file_writer_memento(configurator& cfg, memento_key_set ks)
     set_default_name(typeid(file_writer));
     cfg.get_security_policy().set_text("file_writer::flush", 5);
     cfg.get_security_policy().set_text("file_writer::on_start", 8);
+    cfg.get_security_policy().set_text("file_writer::durability", 12);
+    cfg.get_security_policy().set_integer("file_writer::sync_interval", 1, 24 * 60 * 60 * 1000);
+    cfg.get_security_policy().set_text("file_writer::sync_interval(text)", 8);
+    cfg.get_security_policy().set_text("file_writer::sync_level", 100);
+    cfg.get_security_policy().set_integer("file_writer::compressed_sync_bytes", static_cast<std::size_t>(0), static_cast<std::size_t>(1024 * 1024 * 1024));
+    cfg.get_security_policy().set_text("file_writer::compressed_sync_bytes(text)", 10);
+    cfg.get_security_policy().set_integer("file_writer::compressed_sync_interval", 0, 24 * 60 * 60 * 1000);
+    cfg.get_security_policy().set_text("file_writer::compressed_sync_interval(text)", 8);
     handler fn_hnd = [this] (const std::string& name) { file_name_ = validate("file_writer::file_name", name); };
     handler flsh_hnd = [this] (const std::string& val) { flush_ = boolean_value(validate("file_writer::flush", val)); };
     if (ks == memento_key_set::CHUCHO)
@@ -37,6 +46,11 @@ file_writer_memento::file_writer_memento(configurator& cfg, memento_key_set ks)
         set_handler("file_name", fn_hnd);
         set_handler("on_start", std::bind(&file_writer_memento::set_on_start, this, std::placeholders::_1));
         set_handler("flush", flsh_hnd);
+        set_handler("durability", std::bind(&file_writer_memento::set_durability, this, std::placeholders::_1));
+        set_handler("sync_interval", [this] (const std::string& ms) { sync_interval_ = std::chrono::milliseconds(validate("file_writer::sync_interval", std::stoul(validate("file_writer::sync_interval(text)", ms)))); });
+        set_handler("sync_level", [this] (const std::string& name) { sync_level_ = level::from_text(validate("file_writer::sync_level", name)); });
+        set_handler("compressed_sync_bytes", [this] (const std::string& num) { compressed_sync_bytes_ = validate("file_writer::compressed_sync_bytes", static_cast<std::size_t>(std::stoull(validate("file_writer::compressed_sync_bytes(text)", num)))); });
+        set_handler("compressed_sync_interval", [this] (const std::string& ms) { compressed_sync_interval_ = std::chrono::milliseconds(validate("file_writer::compressed_sync_interval", std::stoul(validate("file_writer::compressed_sync_interval(text)", ms)))); });
     }
     else if (ks == memento_key_set::LOG4CPLUS)
     {
@@ -47,6 +61,30 @@ file_writer_memento::file_writer_memento(configurator& cfg, memento_key_set ks)
     }
 }
 
+void file_writer_memento::handle(std::unique_ptr<configurable>&& cnf)
+{
+    auto cmp = dynamic_move<stream_compressor>(std::move(cnf));
+    if (cmp)
+        stream_compressor_ = std::move(cmp);
+    else
+        writer_memento::handle(std::move(cnf));
+}
+
+void file_writer_memento::set_durability(const std::string& value)
+{
+    std::string low = text_util::to_lower(validate("file_writer::durability", value));
+    if (low == "none")
+        durability_ = file_writer::durability::NONE;
+    else if (low == "interval")
+        durability_ = file_writer::durability::INTERVAL;
+    else if (low == "level")
+        durability_ = file_writer::durability::LEVEL;
+    else if (low == "group_commit")
+        durability_ = file_writer::durability::GROUP_COMMIT;
+    else
+        throw exception("durability has an invalid value of " + value);
+}
+
 void file_writer_memento::set_on_start(const std::string& value)
 {
     std::string low = text_util::to_lower(validate("file_writer::on_start", value));
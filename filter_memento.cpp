@@ -15,6 +15,8 @@
  */
 
 #include <chucho/filter_memento.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/text_util.hpp>
 
 namespace chucho
 {
@@ -25,4 +27,16 @@ filter_memento::filter_memento(configurator& cfg)
     set_status_origin("filter_memento");
 }
 
+filter::result filter_memento::text_to_result(const std::string& text) const
+{
+    std::string low = text_util::to_lower(text);
+    if (low == "deny")
+        return chucho::filter::result::DENY;
+    if (low == "neutral")
+        return chucho::filter::result::NEUTRAL;
+    if (low == "accept")
+        return chucho::filter::result::ACCEPT;
+    throw chucho::exception("The text " + text + " does not describe a valid filter result (DENY, NEUTRAL, ACCEPT)");
+}
+
 }
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/format_memo.hpp>
+#include <vector>
+
+namespace
+{
+
+struct entry
+{
+    std::string key;
+    std::string text;
+};
+
+struct memo
+{
+    const chucho::event* evt = nullptr;
+    // Entries beyond used are kept so that their storage can be
+    // reused by the next event
+    std::vector<entry> entries;
+    std::size_t used = 0;
+};
+
+thread_local memo current;
+
+}
+
+namespace chucho
+{
+
+format_memo::scope::scope(const event& evt)
+    : outer_(current.evt == nullptr)
+{
+    if (outer_)
+    {
+        current.evt = &evt;
+        current.used = 0;
+    }
+}
+
+format_memo::scope::~scope()
+{
+    if (outer_)
+        current.evt = nullptr;
+}
+
+const std::string* format_memo::find(const event& evt, const std::string& key)
+{
+    if (current.evt == &evt)
+    {
+        for (std::size_t i = 0; i < current.used; i++)
+        {
+            if (current.entries[i].key == key)
+                return &current.entries[i].text;
+        }
+    }
+    return nullptr;
+}
+
+void format_memo::remember(const event& evt, const std::string& key, const std::string& text)
+{
+    if (current.evt == &evt)
+    {
+        if (current.used == current.entries.size())
+            current.entries.emplace_back();
+        auto& ent = current.entries[current.used++];
+        ent.key = key;
+        ent.text = text;
+    }
+}
+
+}
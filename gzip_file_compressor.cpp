@@ -17,11 +17,47 @@
 #include <chucho/gzip_file_compressor.hpp>
 #include <chucho/exception.hpp>
 #include <chucho/file.hpp>
+#include <chucho/parallel_compressor.hpp>
 #include <zlib.h>
 #include <fstream>
 #include <cstdio>
 #include <cstring>
 
+namespace
+{
+
+// Large enough that the dictionary being reset for each member
+// costs little
+constexpr std::size_t BLOCK_SIZE = 1024 * 1024;
+
+void compress_block(const std::vector<char>& in, std::vector<char>& out)
+{
+    z_stream z;
+    std::memset(&z, 0, sizeof(z));
+    z.zalloc = Z_NULL;
+    z.zfree = Z_NULL;
+    z.opaque = Z_NULL;
+    // Each block is a complete gzip member
+    if (deflateInit2(&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        throw chucho::exception("Could not initialize gzip compression");
+    struct sentry
+    {
+        sentry(z_stream* zp) : zp_(zp) { }
+        ~sentry() { deflateEnd(zp_); }
+        z_stream* zp_;
+    } sent(&z);
+    out.resize(deflateBound(&z, in.size()));
+    z.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+    z.avail_in = in.size();
+    z.next_out = reinterpret_cast<Bytef*>(out.data());
+    z.avail_out = out.size();
+    if (deflate(&z, Z_FINISH) != Z_STREAM_END)
+        throw chucho::exception("Could not complete gzip compression of a block");
+    out.resize(z.total_out);
+}
+
+}
+
 namespace chucho
 {
 
@@ -31,6 +67,32 @@ gzip_file_compressor::gzip_file_compressor(unsigned min_idx)
 }
 
 void gzip_file_compressor::compress(const std::string& file_name)
+{
+    if (get_threads() == 1)
+        run_at_nice([this, &file_name] () { compress_stream(file_name); });
+    else
+        compress_blocks(file_name);
+}
+
+void gzip_file_compressor::compress_blocks(const std::string& file_name)
+{
+    std::ifstream in(file_name.c_str(), std::ios::in | std::ios::binary);
+    if (!in.is_open())
+        throw exception("Could not open " + file_name + " for reading");
+    std::string to_write = file_name + get_extension();
+    std::ofstream out(to_write.c_str(), std::ios::out | std::ios::binary);
+    if (!out.is_open())
+        throw exception("Could not open " + to_write + " for writing");
+    parallel_compressor pc(get_threads(), get_nice(), BLOCK_SIZE, compress_block);
+    pc.compress(in, out);
+    out.close();
+    if (!out)
+        throw exception("Could not write to " + to_write);
+    in.close();
+    file::remove(file_name);
+}
+
+void gzip_file_compressor::compress_stream(const std::string& file_name)
 {
     std::ifstream in(file_name.c_str(), std::ios::in | std::ios::binary);
     if (!in.is_open())
@@ -42,6 +42,7 @@ std::unique_ptr<configurable> gzip_file_compressor_factory::create_configurable(
         mi = 1;
     }
     auto gfc = std::make_unique<gzip_file_compressor>(mi);
+    set_threads(*gfc, *fcm);
     report_info("Created a " + demangle::get_demangled_name(typeid(*gfc)));
     return std::move(gfc);
 }
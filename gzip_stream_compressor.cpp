@@ -0,0 +1,116 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/gzip_stream_compressor.hpp>
+#include <chucho/exception.hpp>
+#include <stdexcept>
+#include <sstream>
+#include <cstdio>
+#include <array>
+#include <cstring>
+
+namespace chucho
+{
+
+gzip_stream_compressor::gzip_stream_compressor(int compression_level)
+    : compression_level_(compression_level),
+      in_member_(false),
+      unsynced_(false)
+{
+    set_status_origin("gzip_stream_compressor");
+    if (compression_level != Z_DEFAULT_COMPRESSION && (compression_level < 0 || compression_level > 9))
+        throw std::invalid_argument("Compresssion level must be an integer from 0 to 9");
+    std::memset(&z_, 0, sizeof(z_));
+    z_.zalloc = Z_NULL;
+    z_.zfree = Z_NULL;
+    z_.opaque = Z_NULL;
+    // Adding 16 to the window bits asks for a gzip header and trailer
+    int rc = deflateInit2(&z_, compression_level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+    if (rc != Z_OK)
+    {
+        if (rc == Z_MEM_ERROR)
+        {
+            throw std::runtime_error("Out of memory");
+        }
+        else if (rc == Z_VERSION_ERROR)
+        {
+            std::ostringstream stream;
+            stream << "The version of zlib with which Chucho was built was " << ZLIB_VERSION << ", but the runtime version is the incompatible " << zlibVersion();
+            throw exception(stream.str());
+        }
+    }
+}
+
+gzip_stream_compressor::~gzip_stream_compressor()
+{
+    deflateEnd(&z_);
+}
+
+void gzip_stream_compressor::compress(const char* data, std::size_t len, std::vector<std::uint8_t>& out)
+{
+    if (len > 0)
+    {
+        z_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+        z_.avail_in = len;
+        deflate_to(Z_NO_FLUSH, out);
+        in_member_ = true;
+        unsynced_ = true;
+    }
+}
+
+void gzip_stream_compressor::deflate_to(int flush, std::vector<std::uint8_t>& out)
+{
+    std::array<std::uint8_t, BUFSIZ> buf;
+    int rc;
+    do
+    {
+        z_.next_out = buf.data();
+        z_.avail_out = buf.size();
+        rc = deflate(&z_, flush);
+        if (rc == Z_STREAM_ERROR)
+        {
+            std::string err_msg("Unknown error");
+            if (z_.msg != nullptr)
+                err_msg = z_.msg;
+            throw exception("Unable to compress data: " + err_msg);
+        }
+        out.insert(out.end(), buf.begin(), buf.begin() + (buf.size() - z_.avail_out));
+    } while (z_.avail_out == 0 || (flush == Z_FINISH && rc != Z_STREAM_END));
+    z_.next_in = Z_NULL;
+    z_.avail_in = 0;
+}
+
+void gzip_stream_compressor::finish(std::vector<std::uint8_t>& out)
+{
+    if (in_member_)
+    {
+        deflate_to(Z_FINISH, out);
+        deflateReset(&z_);
+        in_member_ = false;
+        unsynced_ = false;
+    }
+}
+
+void gzip_stream_compressor::sync(std::vector<std::uint8_t>& out)
+{
+    if (unsynced_)
+    {
+        deflate_to(Z_SYNC_FLUSH, out);
+        unsynced_ = false;
+    }
+}
+
+}
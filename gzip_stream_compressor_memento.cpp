@@ -0,0 +1,31 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/gzip_stream_compressor_memento.hpp>
+
+namespace chucho
+{
+
+gzip_stream_compressor_memento::gzip_stream_compressor_memento(configurator& cfg)
+    : memento(cfg)
+{
+    set_status_origin("gzip_stream_compressor_memento");
+    cfg.get_security_policy().set_integer("gzip_stream_compressor::compression_level", 0, 9);
+    cfg.get_security_policy().set_text("gzip_stream_compressor::compression_level(text)", 1);
+    set_handler("compression_level", [this] (const std::string& lvl) { compression_level_ = validate("gzip_stream_compressor::compression_level", std::stoi(validate("gzip_stream_compressor::compression_level(text)", lvl))); });
+}
+
+}
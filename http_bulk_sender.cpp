@@ -0,0 +1,312 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/http_bulk_sender.hpp>
+#include <chucho/event_cache_provider.hpp>
+#include <algorithm>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+// The number of batches that may be sent at the same time
+constexpr std::size_t MAX_IN_FLIGHT = 2;
+// During an outage the cache moves events to disk, up to this many chunks
+constexpr std::size_t MAX_CACHE_CHUNKS = 32;
+constexpr std::chrono::milliseconds IDLE_WAIT = 100ms;
+constexpr std::chrono::milliseconds FIRST_RETRY_DELAY = 500ms;
+constexpr std::chrono::milliseconds MAX_RETRY_DELAY = 30s;
+// How long the destructor keeps trying to send what is left
+constexpr std::chrono::milliseconds DRAIN_TIME = 5s;
+constexpr std::chrono::milliseconds FLUSH_TIMEOUT = 10s;
+constexpr long TRANSFER_TIMEOUT_SECONDS = 30;
+
+std::size_t written_cb(char* data, std::size_t sz, std::size_t num, void* user)
+{
+    auto str = reinterpret_cast<std::string*>(user);
+    auto total = sz * num;
+    str->append(data, total);
+    return total;
+}
+
+}
+
+namespace chucho
+{
+
+http_bulk_sender::http_bulk_sender(const std::string& origin,
+                                   const std::string& url,
+                                   std::vector<std::string>&& headers,
+                                   formatter& fmt,
+                                   const cloud_writer::bulk_settings& settings,
+                                   response_checker chk,
+                                   thread_configurer cfg)
+    : url_(url),
+      headers_(std::move(headers)),
+      formatter_(fmt),
+      settings_(settings),
+      checker_(chk),
+      configurer_(cfg),
+      cache_(event_cache_provider::DEFAULT_CHUNK_SIZE, event_cache_provider::DEFAULT_CHUNK_SIZE * MAX_CACHE_CHUNKS),
+      multi_(nullptr),
+      transfers_(MAX_IN_FLIGHT),
+      busy_(0),
+      verbose_(false),
+      stop_(false),
+      flush_requested_(0),
+      flush_completed_(0)
+{
+    set_status_origin(origin);
+    if (settings_.max_events == 0 || settings_.max_bytes == 0 || settings_.max_retry_batches == 0)
+        throw std::invalid_argument("The bulk batch limits must be greater than zero");
+    // Don't wait for the server to agree to take large bodies
+    headers_.push_back("Expect:");
+    // The transfers_ vector is never resized, so pointers to its
+    // response strings remain valid.
+    for (auto& t : transfers_)
+    {
+        t.handle = std::make_unique<curl>();
+        t.handle->set_option(CURLOPT_URL, url_.c_str(), "url");
+        t.handle->set_option(CURLOPT_HTTPHEADER, t.handle->create_slist(std::vector<std::string>(headers_)), "HTTP header");
+        t.handle->set_option(CURLOPT_WRITEFUNCTION, written_cb, "write function");
+        t.handle->set_option(CURLOPT_WRITEDATA, &t.response, "write data");
+        t.handle->set_option(CURLOPT_TCP_KEEPALIVE, 1L, "TCP keep-alive");
+        t.handle->set_option(CURLOPT_NOSIGNAL, 1L, "no signals");
+        t.handle->set_option(CURLOPT_TIMEOUT, TRANSFER_TIMEOUT_SECONDS, "timeout");
+    }
+    multi_ = curl_multi_init();
+    if (multi_ == nullptr)
+        throw exception("Could not initialize a libcurl multi handle");
+    worker_ = std::make_unique<std::thread>(std::bind(&http_bulk_sender::thread_main, this));
+}
+
+http_bulk_sender::~http_bulk_sender()
+{
+    stop_ = true;
+    worker_->join();
+    curl_multi_cleanup(multi_);
+}
+
+void http_bulk_sender::complete_transfers()
+{
+    CURLMsg* msg;
+    int left;
+    while ((msg = curl_multi_info_read(multi_, &left)) != nullptr)
+    {
+        if (msg->msg != CURLMSG_DONE)
+            continue;
+        // msg does not survive curl_multi_remove_handle
+        CURL* easy = msg->easy_handle;
+        CURLcode rc = msg->data.result;
+        curl_multi_remove_handle(multi_, easy);
+        auto found = std::find_if(transfers_.begin(),
+                                  transfers_.end(),
+                                  [easy] (const transfer& t) { return t.handle->get() == easy; });
+        if (found == transfers_.end())
+            continue;
+        transfer& t(*found);
+        t.busy = false;
+        --busy_;
+        long status = 0;
+        curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &status);
+        std::string problem;
+        bool retry = false;
+        if (rc != CURLE_OK)
+        {
+            problem = curl_easy_strerror(rc);
+            retry = true;
+        }
+        else if (status >= 200 && status < 300)
+        {
+            try
+            {
+                if (checker_)
+                    checker_(t.response);
+            }
+            catch (std::exception& e)
+            {
+                problem = e.what();
+            }
+        }
+        else
+        {
+            problem = "HTTP status " + std::to_string(status);
+            retry = status == 408 || status == 429 || status >= 500;
+        }
+        if (!problem.empty())
+        {
+            if (retry)
+            {
+                ++t.bat.attempts;
+                auto delay = std::min(MAX_RETRY_DELAY, FIRST_RETRY_DELAY * (1 << std::min(t.bat.attempts - 1, 10U)));
+                report_warning("Could not send " + std::to_string(t.bat.events) + " events to " + url_ + " (" + problem +
+                               "). Attempt " + std::to_string(t.bat.attempts) + " will be retried in " +
+                               std::to_string(delay.count()) + " milliseconds.");
+                t.bat.not_before = std::chrono::steady_clock::now() + delay;
+                ready_.push_front(std::move(t.bat));
+            }
+            else
+            {
+                report_error("Discarded " + std::to_string(t.bat.events) + " events rejected by " + url_ + ": " + problem);
+            }
+        }
+        t.bat = batch();
+    }
+}
+
+void http_bulk_sender::flush()
+{
+    std::unique_lock<std::mutex> ul(flush_guard_);
+    auto ticket = ++flush_requested_;
+    if (!flushed_.wait_for(ul, FLUSH_TIMEOUT, [this, ticket] () { return flush_completed_ >= ticket; }))
+        report_warning("Timed out waiting for events to be sent to " + url_);
+}
+
+void http_bulk_sender::seal()
+{
+    ready_.push_back(std::move(filling_));
+    filling_ = batch();
+}
+
+void http_bulk_sender::set_verbose(bool state)
+{
+    verbose_ = state;
+}
+
+void http_bulk_sender::start_transfers()
+{
+    for (auto& t : transfers_)
+    {
+        if (t.busy)
+            continue;
+        auto now = std::chrono::steady_clock::now();
+        auto found = std::find_if(ready_.begin(),
+                                  ready_.end(),
+                                  [now] (const batch& b) { return b.not_before <= now; });
+        if (found == ready_.end())
+            break;
+        t.bat = std::move(*found);
+        ready_.erase(found);
+        t.response.clear();
+        t.handle->set_verbose(verbose_);
+        t.handle->set_option(CURLOPT_POSTFIELDS, t.bat.body.data(), "post fields");
+        t.handle->set_option(CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(t.bat.body.length()), "post field size");
+        curl_multi_add_handle(multi_, t.handle->get());
+        t.busy = true;
+        ++busy_;
+    }
+}
+
+void http_bulk_sender::thread_main()
+{
+    bool stopping = false;
+    std::chrono::steady_clock::time_point deadline;
+    while (true)
+    {
+        if (configurer_)
+            configurer_();
+        auto goal = flush_requested_.load();
+        if (!stopping && stop_)
+        {
+            stopping = true;
+            deadline = std::chrono::steady_clock::now() + DRAIN_TIME;
+        }
+        bool drained = false;
+        while (ready_.size() + busy_ < settings_.max_retry_batches)
+        {
+            // Only block waiting for events when there is nothing else to do
+            std::chrono::milliseconds wait(0);
+            if (busy_ == 0 && ready_.empty() && !stopping && goal == flush_completed_)
+            {
+                if (filling_.events == 0)
+                {
+                    wait = IDLE_WAIT;
+                }
+                else
+                {
+                    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(filling_started_ + settings_.linger - std::chrono::steady_clock::now());
+                    wait = std::max(0ms, std::min(left, IDLE_WAIT));
+                }
+            }
+            auto evt = cache_.pop(wait);
+            if (!evt)
+            {
+                drained = true;
+                break;
+            }
+            auto line = formatter_.format(*evt);
+            if (line.empty() || line.back() != '\n')
+                line += '\n';
+            if (filling_.events > 0 && filling_.body.length() + line.length() > settings_.max_bytes)
+                seal();
+            if (filling_.events == 0)
+                filling_started_ = std::chrono::steady_clock::now();
+            filling_.body += line;
+            if (++filling_.events >= settings_.max_events || filling_.body.length() >= settings_.max_bytes)
+                seal();
+        }
+        if (filling_.events > 0 &&
+            (stopping || goal != flush_completed_ || std::chrono::steady_clock::now() - filling_started_ >= settings_.linger))
+        {
+            seal();
+        }
+        start_transfers();
+        if (busy_ > 0)
+        {
+            int running;
+            curl_multi_perform(multi_, &running);
+            curl_multi_wait(multi_, nullptr, 0, 50, nullptr);
+            curl_multi_perform(multi_, &running);
+            complete_transfers();
+        }
+        else if (!ready_.empty())
+        {
+            // Everything is waiting to be retried
+            auto until = std::chrono::steady_clock::now() + IDLE_WAIT;
+            for (const auto& b : ready_)
+                until = std::min(until, b.not_before);
+            std::this_thread::sleep_until(until);
+        }
+        bool idle = drained && filling_.events == 0 && ready_.empty() && busy_ == 0;
+        if (idle && goal != flush_completed_)
+        {
+            std::lock_guard<std::mutex> lg(flush_guard_);
+            flush_completed_ = goal;
+            flushed_.notify_all();
+        }
+        if (stopping && (idle || std::chrono::steady_clock::now() >= deadline))
+            break;
+    }
+    std::size_t lost = filling_.events;
+    for (const auto& b : ready_)
+        lost += b.events;
+    for (auto& t : transfers_)
+    {
+        if (t.busy)
+        {
+            curl_multi_remove_handle(multi_, t.handle->get());
+            lost += t.bat.events;
+        }
+    }
+    if (lost > 0)
+        report_error(std::to_string(lost) + " events could not be sent to " + url_ + " before the writer was destroyed");
+    std::lock_guard<std::mutex> lg(flush_guard_);
+    flush_completed_ = flush_requested_;
+    flushed_.notify_all();
+}
+
+}
@@ -24,8 +24,10 @@
 
 #include <chucho/writer.hpp>
 #include <chucho/event_cache_provider.hpp>
+#include <chucho/overload_governor.hpp>
 #include <thread>
 #include <atomic>
+#include <vector>
 
 namespace chucho
 {
@@ -41,7 +43,25 @@ namespace chucho
  * data is held in memory and others are stored to disk. Please
  * refer to @ref event_cache_provider for details.
  *
- * @sa event_cache_provider
+ * An @ref overload_governor may be attached, so that low-level
+ * events are shed while the cache is congested instead of being
+ * culled from it later.
+ *
+ * With a single worker thread, one slow target bounds everything
+ * written through the writer. The writer can instead be divided
+ * into shards, each of which has its own cache and worker thread.
+ * Events are assigned to shards by hashing a key, which is either
+ * the value of a @ref diagnostic_context entry, like a request id,
+ * or the name of the event's logger. Events with the same key are
+ * always written in order, but events in different shards may be
+ * written in any order. The shards may share one target writer,
+ * whose writes are serialized, or each shard may have a target of
+ * its own. The cache of each shard is as large as the cache of an
+ * unsharded writer, and the cache stats of the writer itself are
+ * those of the first shard. The stats of each shard are returned
+ * by @ref get_shard_cache_stats.
+ *
+ * @sa event_cache_provider, overload_governor
  * @ingroup writers
  */
 class CHUCHO_EXPORT async_writer : public writer, public event_cache_provider
@@ -77,6 +97,74 @@ public:
                  std::size_t chunk_size,
                  std::size_t max_chunks,
                  bool flush_on_destruct = true);
+    /**
+     * Construct an asynchronous writer that sheds events when it
+     * falls behind.
+     *
+     * @param name the name of the writer
+     * @param wrt the underlying slow writer
+     * @param chunk_size the size of each chunk in the cache
+     * @param max_chunks the maximum number of chunks for the cache
+     * @param gov the governor that decides when to shed events
+     * @param flush_on_destruct whether to flush the pending events
+     *                          when the writer is destroyed
+     */
+    async_writer(const std::string& name,
+                 std::unique_ptr<writer>&& wrt,
+                 std::size_t chunk_size,
+                 std::size_t max_chunks,
+                 std::unique_ptr<overload_governor>&& gov,
+                 bool flush_on_destruct = true);
+    /**
+     * Construct an asynchronous writer whose shards share one
+     * target writer.
+     *
+     * @param name the name of the writer
+     * @param wrt the underlying slow writer
+     * @param shards the number of shards, which must be at least one
+     * @param shard_key the diagnostic_context key whose value selects
+     *                  the shard, which if empty or missing from the
+     *                  context means that the logger name is used
+     * @param chunk_size the size of each chunk in each shard's cache
+     * @param max_chunks the maximum number of chunks for each shard's
+     *                   cache
+     * @param gov the governor that decides when to shed events, which
+     *            may be nullptr
+     * @param flush_on_destruct whether to flush the pending events
+     *                          when the writer is destroyed
+     */
+    async_writer(const std::string& name,
+                 std::unique_ptr<writer>&& wrt,
+                 std::size_t shards,
+                 const std::string& shard_key,
+                 std::size_t chunk_size,
+                 std::size_t max_chunks,
+                 std::unique_ptr<overload_governor>&& gov,
+                 bool flush_on_destruct = true);
+    /**
+     * Construct an asynchronous writer with one shard for each
+     * target writer.
+     *
+     * @param name the name of the writer
+     * @param wrts the underlying slow writers, one for each shard
+     * @param shard_key the diagnostic_context key whose value selects
+     *                  the shard, which if empty or missing from the
+     *                  context means that the logger name is used
+     * @param chunk_size the size of each chunk in each shard's cache
+     * @param max_chunks the maximum number of chunks for each shard's
+     *                   cache
+     * @param gov the governor that decides when to shed events, which
+     *            may be nullptr
+     * @param flush_on_destruct whether to flush the pending events
+     *                          when the writer is destroyed
+     */
+    async_writer(const std::string& name,
+                 std::vector<std::unique_ptr<writer>>&& wrts,
+                 const std::string& shard_key,
+                 std::size_t chunk_size,
+                 std::size_t max_chunks,
+                 std::unique_ptr<overload_governor>&& gov,
+                 bool flush_on_destruct = true);
     /**
      * Destruct an asynchronous writer.
      */
@@ -91,21 +179,72 @@ public:
      */
     bool get_flush_on_destruct() const;
     /**
-     * Return the underlying slow writer.
+     * Return the overload governor.
+     *
+     * @return the governor, which may be nullptr
+     */
+    overload_governor* get_overload_governor() const;
+    /**
+     * Return the stats of one shard's cache. The current size
+     * in the stats is the depth of the shard's queue.
+     *
+     * @param shard the index of the shard
+     * @return the stats
+     * @throw std::out_of_range if there is no such shard
+     */
+    event_cache_stats get_shard_cache_stats(std::size_t shard);
+    /**
+     * Return the number of shards.
+     *
+     * @return the number of shards
+     */
+    std::size_t get_shard_count() const;
+    /**
+     * Return the diagnostic_context key that selects the shard.
+     *
+     * @return the key, which is empty if the logger name is used
+     */
+    const std::string& get_shard_key() const;
+    /**
+     * Return the underlying slow writer. If each shard has its
+     * own writer, then this is the first shard's writer.
      * 
      * @return the slow writer
      */
     writer& get_writer() const;
+    /**
+     * Return the underlying slow writer of a shard.
+     *
+     * @param shard the index of the shard
+     * @return the slow writer
+     * @throw std::out_of_range if there is no such shard
+     */
+    writer& get_writer(std::size_t shard) const;
 
 protected:
     virtual void write_impl(const event& evt) override;
 
 private:
-    CHUCHO_NO_EXPORT void thread_main();
+    struct CHUCHO_NO_EXPORT shard
+    {
+        // The first shard uses the provider's cache
+        event_cache* cache;
+        std::unique_ptr<event_cache> own_cache;
+        writer* target;
+        std::unique_ptr<std::thread> worker;
+    };
 
-    std::unique_ptr<writer> writer_;
+    CHUCHO_NO_EXPORT double get_fullness() const;
+    CHUCHO_NO_EXPORT std::size_t select_shard(const event& evt) const;
+    CHUCHO_NO_EXPORT void start(std::size_t shards, std::size_t chunk_size, std::size_t max_chunks);
+    CHUCHO_NO_EXPORT void thread_main(std::size_t idx);
+    CHUCHO_NO_EXPORT void write_shed_summary();
+
+    std::vector<std::unique_ptr<writer>> writers_;
+    std::unique_ptr<overload_governor> governor_;
     std::atomic<bool> stop_;
-    std::unique_ptr<std::thread> worker_;
+    std::vector<shard> shards_;
+    std::string shard_key_;
     bool flush_on_destruct_;
 };
 
@@ -114,9 +253,24 @@ inline bool async_writer::get_flush_on_destruct() const
     return flush_on_destruct_;
 }
 
+inline overload_governor* async_writer::get_overload_governor() const
+{
+    return governor_.get();
+}
+
+inline std::size_t async_writer::get_shard_count() const
+{
+    return shards_.size();
+}
+
+inline const std::string& async_writer::get_shard_key() const
+{
+    return shard_key_;
+}
+
 inline writer& async_writer::get_writer() const
 {
-    return *writer_;
+    return *writers_.front();
 }
 
 }
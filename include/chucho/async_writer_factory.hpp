@@ -33,6 +33,7 @@ public:
 
     virtual std::unique_ptr<configurable> create_configurable(std::unique_ptr<memento>& mnto) override;
     virtual std::unique_ptr<memento> create_memento(configurator& cfg) override;
+    virtual bool creates_writer() const override;
 };
 
 }
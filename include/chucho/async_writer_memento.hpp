@@ -23,6 +23,7 @@
 
 #include <chucho/memento.hpp>
 #include <chucho/optional.hpp>
+#include <chucho/thread_settings.hpp>
 #include <chucho/writer.hpp>
 
 namespace chucho
@@ -37,6 +38,11 @@ public:
     const optional<bool>& get_flush_on_destruct() const;
     const optional<std::size_t>& get_max_chunks() const;
     const std::string& get_name() const;
+    const optional<double>& get_shed_hysteresis() const;
+    const optional<std::string>& get_shed_watermarks() const;
+    const optional<std::string>& get_shard_key() const;
+    const optional<std::size_t>& get_shards() const;
+    const thread_settings& get_thread_settings() const;
     std::unique_ptr<writer>& get_writer();
     virtual void handle(std::unique_ptr<configurable>&& cnf) override;
 
@@ -46,6 +52,11 @@ private:
     std::unique_ptr<writer> writer_;
     optional<bool> flush_on_destruct_;
     std::string name_;
+    optional<std::string> shed_watermarks_;
+    optional<double> shed_hysteresis_;
+    optional<std::size_t> shards_;
+    optional<std::string> shard_key_;
+    thread_settings thread_settings_;
 };
 
 inline const optional<std::size_t>& async_writer_memento::get_chunk_size() const
@@ -68,6 +79,31 @@ inline const std::string& async_writer_memento::get_name() const
     return name_;
 }
 
+inline const optional<double>& async_writer_memento::get_shed_hysteresis() const
+{
+    return shed_hysteresis_;
+}
+
+inline const optional<std::string>& async_writer_memento::get_shed_watermarks() const
+{
+    return shed_watermarks_;
+}
+
+inline const optional<std::string>& async_writer_memento::get_shard_key() const
+{
+    return shard_key_;
+}
+
+inline const optional<std::size_t>& async_writer_memento::get_shards() const
+{
+    return shards_;
+}
+
+inline const thread_settings& async_writer_memento::get_thread_settings() const
+{
+    return thread_settings_;
+}
+
 inline std::unique_ptr<writer>& async_writer_memento::get_writer()
 {
     return writer_;
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_BINARY_FILE_READER_HPP_)
+#define CHUCHO_BINARY_FILE_READER_HPP_
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include <chucho/event.hpp>
+#include <chucho/optional.hpp>
+#include <fstream>
+#include <vector>
+
+namespace chucho
+{
+
+/**
+ * @class binary_file_reader binary_file_reader.hpp chucho/binary_file_reader.hpp
+ * Read the events from a file written by @ref binary_file_writer.
+ * The events can then be formatted with any @ref formatter, which
+ * is what the chucho-decode tool does.
+ *
+ * Loggers are looked up by name in this process. Levels are looked
+ * up by name, too, and if there is no level of that name here, then
+ * one is made from the name, value and syslog severity that were
+ * written. Anything a formatter takes from the process rather than
+ * the event, such as the host name or the diagnostic context, comes
+ * from the process doing the reading. The host name and process id
+ * of the process that wrote the file are available from
+ * @ref get_host_name() and @ref get_process_id().
+ *
+ * @ingroup miscellaneous
+ */
+class CHUCHO_EXPORT binary_file_reader
+{
+public:
+    /**
+     * @name Constructor
+     */
+    //@{
+    /**
+     * Construct a reader.
+     *
+     * @param file_name the file to read
+     * @throw exception if the file cannot be opened or was not
+     *        written by a @ref binary_file_writer
+     */
+    binary_file_reader(const std::string& file_name);
+    //@}
+
+    /**
+     * Return the host name of the process that wrote the
+     * events most recently read.
+     *
+     * @return the host name
+     */
+    const std::string& get_host_name() const;
+    /**
+     * Return the id of the process that wrote the events most
+     * recently read.
+     *
+     * @return the process id
+     */
+    int get_process_id() const;
+    /**
+     * Read the next event. A record that has been cut short at
+     * the end of the file, as happens when the writing process
+     * has not finished writing it, is treated as the end of the
+     * file.
+     *
+     * @return the event or an unset optional at the end of the
+     *         file
+     * @throw exception if the file is corrupt
+     */
+    optional<event> read();
+
+private:
+    CHUCHO_NO_EXPORT bool read_bytes(std::string& out);
+    CHUCHO_NO_EXPORT bool read_header();
+    CHUCHO_NO_EXPORT bool read_varint(std::uint64_t& val);
+    CHUCHO_NO_EXPORT const std::string* string_at(std::uint64_t id) const;
+
+    std::string file_name_;
+    std::ifstream stream_;
+    std::vector<std::string> strings_;
+    std::vector<std::shared_ptr<level>> levels_;
+    std::string host_name_;
+    int process_id_;
+    std::int64_t last_time_;
+};
+
+inline const std::string& binary_file_reader::get_host_name() const
+{
+    return host_name_;
+}
+
+inline int binary_file_reader::get_process_id() const
+{
+    return process_id_;
+}
+
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif
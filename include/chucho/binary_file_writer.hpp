@@ -0,0 +1,162 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_BINARY_FILE_WRITER_HPP_)
+#define CHUCHO_BINARY_FILE_WRITER_HPP_
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include <chucho/file_writer.hpp>
+#include <chucho/file_roller.hpp>
+#include <chucho/file_roll_trigger.hpp>
+#include <map>
+#include <thread>
+#include <unordered_map>
+
+namespace chucho
+{
+
+/**
+ * @class binary_file_writer binary_file_writer.hpp chucho/binary_file_writer.hpp
+ * A @ref writer that writes events to a file in a compact binary
+ * format instead of as text. The file can be turned back into text
+ * with the chucho-decode tool or read with @ref binary_file_reader.
+ *
+ * No formatting is done while logging. Each event is written as a
+ * record of variable-length integers. The names of files, functions,
+ * loggers, levels, markers and threads are each written once and
+ * thereafter referred to by number, and the time of each event is
+ * written as the difference from the time of the event before it.
+ * The message is written as is.
+ *
+ * Every time the writer opens a file, it begins with a header and
+ * forgets what it has already written, so each file can be decoded
+ * on its own. This includes each of the files created by a @ref
+ * file_roller when the writer is given one. The roller and trigger
+ * behave just as they do in @ref rolling_file_writer.
+ *
+ * Since no @ref formatter is used, the constructors do not take one.
+ *
+ * @ingroup writers
+ * @ingroup rolling
+ */
+class CHUCHO_EXPORT binary_file_writer : public file_writer
+{
+public:
+    /**
+     * @name Constructors
+     */
+    //@{
+    /**
+     * Construct a binary_file_writer.
+     *
+     * @param name the name of this writer
+     * @param file_name the name of the file
+     * @param start action to take at the start
+     * @param flsh whether to flush after each event is written
+     */
+    binary_file_writer(const std::string& name,
+                       const std::string& file_name,
+                       on_start start = on_start::APPEND,
+                       bool flsh = true);
+    /**
+     * Construct a binary_file_writer that rolls its files.
+     *
+     * @param name the name of this writer
+     * @param file_name the active file name, which if empty is
+     *        taken from the roller
+     * @param roller the roller
+     * @param trigger the optional trigger
+     * @param start action to take at the start
+     * @param flsh whether to flush after each event is written
+     * @throw std::invalid_argument if the roller is an
+     *        uninitialized std::unique_ptr
+     * @throw std::invalid_argument if the trigger cannot be
+     *        resolved
+     * @throw std::invalid_argument if the file name is empty and
+     *        the roller does not provide one
+     */
+    binary_file_writer(const std::string& name,
+                       const std::string& file_name,
+                       std::unique_ptr<file_roller>&& roller,
+                       std::unique_ptr<file_roll_trigger>&& trigger = std::unique_ptr<file_roll_trigger>(),
+                       on_start start = on_start::APPEND,
+                       bool flsh = true);
+    //@}
+
+    /**
+     * Return the roller.
+     *
+     * @return the roller, which is nullptr if files are not rolled
+     */
+    file_roller* get_file_roller() const;
+    /**
+     * Return the trigger.
+     *
+     * @return the trigger, which is nullptr if files are not rolled
+     */
+    file_roll_trigger* get_file_roll_trigger() const;
+
+protected:
+    virtual void opened() override;
+    virtual void write_impl(const event& evt) override;
+
+private:
+    // The address cache is cleared when it grows past this
+    static constexpr std::size_t MAX_ADDRESSES = 4096;
+
+    CHUCHO_NO_EXPORT std::uint64_t intern(const char* text);
+    CHUCHO_NO_EXPORT std::uint64_t intern(const std::string& text);
+    CHUCHO_NO_EXPORT std::uint64_t intern(const level& lvl);
+    CHUCHO_NO_EXPORT std::uint64_t intern_thread(const event& evt);
+    CHUCHO_NO_EXPORT void reset();
+    CHUCHO_NO_EXPORT void write_record(const event& evt);
+
+    std::unique_ptr<file_roller> roller_;
+    std::unique_ptr<file_roll_trigger> trigger_;
+    file_roll_trigger* effective_trigger_;
+    // Strings that come from the same address are almost always
+    // the same literal, but the text is compared anyway.
+    std::unordered_map<const char*, std::pair<std::uint64_t, std::string>> addresses_;
+    std::map<std::string, std::uint64_t> strings_;
+    std::map<std::string, std::uint64_t> levels_;
+    std::map<std::thread::id, std::uint64_t> threads_;
+    std::uint64_t next_string_id_;
+    std::uint64_t next_level_id_;
+    std::int64_t last_time_;
+    std::string record_;
+};
+
+inline file_roller* binary_file_writer::get_file_roller() const
+{
+    return roller_.get();
+}
+
+inline file_roll_trigger* binary_file_writer::get_file_roll_trigger() const
+{
+    return effective_trigger_;
+}
+
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_BINARY_LOG_FORMAT_HPP_)
+#define CHUCHO_BINARY_LOG_FORMAT_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <cstdint>
+#include <string>
+
+namespace chucho
+{
+
+// The layout of the files written by binary_file_writer. A file is a
+// sequence of segments, each of which starts with a header and can be
+// decoded without anything that came before it. A segment begins every
+// time the writer opens a file.
+//
+// header: MAGIC, VERSION, varint base time, varint host name length,
+//         host name, varint process id
+// STRING: tag, varint id, varint length, bytes
+// LEVEL:  tag, varint id, zigzag value, varint syslog severity,
+//         varint name length, name
+// EVENT:  tag, zigzag time delta, varint level id, varint logger id,
+//         varint file id, varint line, varint function id,
+//         varint marker id, varint thread id, varint message length,
+//         message
+//
+// Times are microseconds since the epoch. The first event's delta is
+// from the base time in the header and each later one is from the
+// event before it. String and level ids start at one in each segment
+// and a marker id of zero means that the event has no marker.
+namespace binary_log
+{
+
+constexpr char MAGIC[] = { '\x89', 'C', 'H', 'U', 'C', 'H', 'O', '\n' };
+constexpr std::uint8_t VERSION = 1;
+
+enum tag : std::uint8_t
+{
+    STRING = 1,
+    LEVEL = 2,
+    EVENT = 3,
+    // The first byte of MAGIC
+    HEADER = 0x89
+};
+
+inline void put_varint(std::string& out, std::uint64_t val)
+{
+    while (val >= 0x80)
+    {
+        out += static_cast<char>(val | 0x80);
+        val >>= 7;
+    }
+    out += static_cast<char>(val);
+}
+
+inline void put_bytes(std::string& out, const char* data, std::size_t len)
+{
+    put_varint(out, len);
+    out.append(data, len);
+}
+
+inline std::uint64_t zigzag(std::int64_t val)
+{
+    return (static_cast<std::uint64_t>(val) << 1) ^ static_cast<std::uint64_t>(val >> 63);
+}
+
+inline std::int64_t unzigzag(std::uint64_t val)
+{
+    return static_cast<std::int64_t>(val >> 1) ^ -static_cast<std::int64_t>(val & 1);
+}
+
+}
+
+}
+
+#endif
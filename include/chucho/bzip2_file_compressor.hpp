@@ -53,6 +53,10 @@ public:
     //@}
 
     virtual void compress(const std::string& file_name) override;
+
+private:
+    CHUCHO_NO_EXPORT void compress_blocks(const std::string& file_name);
+    CHUCHO_NO_EXPORT void compress_stream(const std::string& file_name);
 };
 
 }
@@ -24,6 +24,11 @@
 
 #include <chucho/writeable_filter.hpp>
 #include <chucho/event_cache_provider.hpp>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <vector>
 
 namespace chucho
 {
@@ -40,11 +45,36 @@ namespace chucho
  * messages higher than DEBUG, like those of INFO level, will not be
  * filtered.
  *
+ * The filter can also act as a flight recorder. In this mode the event
+ * cache is not used. Instead, each thread that logs gets its own ring
+ * of the most recent events at or below the cache threshold. The events
+ * are kept as they are, so there is no serialization. When an event at
+ * or above the release threshold arrives, the rings of all threads are
+ * merged in order of event time and written together before the
+ * releasing event. The number of events kept per thread is bounded, and
+ * events older than a maximum age can also be discarded at release time.
+ * The number of rings is bounded by @ref MAX_THREADS, so that programs
+ * that create many short-lived threads do not grow the filter without
+ * limit. When a new thread logs and there are already that many rings,
+ * the ring of the thread that has gone longest without logging is
+ * discarded.
+ *
  * @ingroup filters
  */
 class CHUCHO_EXPORT cache_and_release_filter : public writeable_filter, public event_cache_provider
 {
 public:
+    /**
+     * The default number of events kept for each thread in flight
+     * recorder mode.
+     */
+    static constexpr std::size_t DEFAULT_EVENTS_PER_THREAD = 1000;
+    /**
+     * The most threads for which rings are kept in flight recorder
+     * mode.
+     */
+    static constexpr std::size_t MAX_THREADS = 256;
+
     /**
      * @name Constructors
      * @{
@@ -82,6 +112,45 @@ public:
                              std::shared_ptr<level> release_threshold,
                              std::size_t chunk_size = DEFAULT_CHUNK_SIZE,
                              std::size_t max_chunks = DEFAULT_MAX_CHUNKS);
+    /**
+     * Construct a filter in flight recorder mode.
+     *
+     * @param name the name of the filter
+     * @param wrt the writer
+     * @param cache_threshold the cache threshold
+     * @param release_threshold the release threshold
+     * @param events_per_thread the number of recent events to keep
+     *        for each thread
+     * @param max_age the maximum age of events written on release,
+     *        or zero if events should not be discarded by age
+     * @throw std::invalid_argument if events_per_thread is zero
+     */
+    cache_and_release_filter(const std::string& name,
+                             writer& wrt,
+                             std::shared_ptr<level> cache_threshold,
+                             std::shared_ptr<level> release_threshold,
+                             std::size_t events_per_thread,
+                             const std::chrono::milliseconds& max_age);
+    /**
+     * Construct a filter in flight recorder mode.
+     *
+     * @post This filter will not become usable until the @ref set_writer method
+     * is called.
+     *
+     * @param name the name of the filter
+     * @param cache_threshold the cache threshold
+     * @param release_threshold the release threshold
+     * @param events_per_thread the number of recent events to keep
+     *        for each thread
+     * @param max_age the maximum age of events written on release,
+     *        or zero if events should not be discarded by age
+     * @throw std::invalid_argument if events_per_thread is zero
+     */
+    cache_and_release_filter(const std::string& name,
+                             std::shared_ptr<level> cache_threshold,
+                             std::shared_ptr<level> release_threshold,
+                             std::size_t events_per_thread,
+                             const std::chrono::milliseconds& max_age);
     /**
      * @}
      */
@@ -107,10 +176,46 @@ public:
      * @return the release threshold
      */
     std::shared_ptr<level> get_release_threshold() const;
+    /**
+     * Return the number of events kept for each thread in flight
+     * recorder mode. This is zero if the filter is not a flight
+     * recorder.
+     *
+     * @return the number of events
+     */
+    std::size_t get_events_per_thread() const;
+    /**
+     * Return the maximum age of events written on release in flight
+     * recorder mode. Zero means that there is no maximum.
+     *
+     * @return the maximum age
+     */
+    const std::chrono::milliseconds& get_max_age() const;
+    /**
+     * Return whether this filter is in flight recorder mode.
+     *
+     * @return true if events are kept in per-thread rings
+     */
+    bool is_flight_recorder() const;
 
 private:
+    struct ring
+    {
+        std::string thread_id;
+        std::vector<event> events;
+        std::size_t next;
+        std::uint64_t last_recorded;
+    };
+
+    CHUCHO_NO_EXPORT void record(const event& evt);
+    CHUCHO_NO_EXPORT void release_recorded(const event& evt);
+
     std::shared_ptr<level> release_threshold_;
     std::shared_ptr<level> cache_threshold_;
+    std::size_t events_per_thread_;
+    std::chrono::milliseconds max_age_;
+    std::map<std::thread::id, ring> rings_;
+    std::uint64_t recorded_;
 };
 
 inline std::shared_ptr<level> cache_and_release_filter::get_cache_threshold() const
@@ -118,11 +223,26 @@ inline std::shared_ptr<level> cache_and_release_filter::get_cache_threshold() co
     return cache_threshold_;
 }
 
+inline std::size_t cache_and_release_filter::get_events_per_thread() const
+{
+    return events_per_thread_;
+}
+
+inline const std::chrono::milliseconds& cache_and_release_filter::get_max_age() const
+{
+    return max_age_;
+}
+
 inline std::shared_ptr<level> cache_and_release_filter::get_release_threshold() const
 {
     return release_threshold_;
 }
 
+inline bool cache_and_release_filter::is_flight_recorder() const
+{
+    return events_per_thread_ > 0;
+}
+
 }
 
 #if defined(_MSC_VER)
@@ -23,6 +23,7 @@
 
 #include <chucho/filter_memento.hpp>
 #include <chucho/level.hpp>
+#include <chrono>
 
 namespace chucho
 {
@@ -34,6 +35,9 @@ public:
 
     std::shared_ptr<level> get_cache_threshold() const;
     const optional<std::size_t>& get_chunk_size() const;
+    const optional<std::size_t>& get_events_per_thread() const;
+    bool get_flight_recorder() const;
+    const optional<std::chrono::seconds>& get_max_age() const;
     const optional<std::size_t>& get_max_chunks() const;
     std::shared_ptr<level> get_release_threshold() const;
 
@@ -42,6 +46,9 @@ private:
     std::shared_ptr<level> release_threshold_;
     optional<std::size_t> chunk_size_;
     optional<std::size_t> max_chunks_;
+    bool flight_recorder_;
+    optional<std::size_t> events_per_thread_;
+    optional<std::chrono::seconds> max_age_;
 };
 
 inline std::shared_ptr<level> cache_and_release_filter_memento::get_cache_threshold() const
@@ -54,6 +61,21 @@ inline const optional<std::size_t>& cache_and_release_filter_memento::get_chunk_
     return chunk_size_;
 }
 
+inline const optional<std::size_t>& cache_and_release_filter_memento::get_events_per_thread() const
+{
+    return events_per_thread_;
+}
+
+inline bool cache_and_release_filter_memento::get_flight_recorder() const
+{
+    return flight_recorder_;
+}
+
+inline const optional<std::chrono::seconds>& cache_and_release_filter_memento::get_max_age() const
+{
+    return max_age_;
+}
+
 inline const optional<std::size_t>& cache_and_release_filter_memento::get_max_chunks() const
 {
     return max_chunks_;
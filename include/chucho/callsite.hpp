@@ -0,0 +1,216 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_CALLSITE_HPP_)
+#define CHUCHO_CALLSITE_HPP_
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include <chucho/logger.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace chucho
+{
+
+/**
+ * @class callsite callsite.hpp chucho/callsite.hpp
+ * The static descriptor of one logging statement. Each of the
+ * CHUCHO_* macros in @ref log.hpp creates a function-local static
+ * callsite, which registers itself the first time the statement
+ * is reached. A callsite normally defers to its logger to decide
+ * whether an event is permitted, but its level can be overridden
+ * at run time through the functions in the @ref callsites
+ * namespace. That way an individual statement can be turned on
+ * or off without changing the level of a whole logger.
+ *
+ * When no override is set, the only cost of a callsite is one
+ * check of an atomic flag that is almost always false.
+ *
+ * @ingroup loggers
+ */
+class CHUCHO_EXPORT callsite : non_copyable
+{
+public:
+    /**
+     * Construct and register a callsite.
+     *
+     * @param file_name the file name of the statement
+     * @param line_number the line number of the statement
+     * @param function_name the function name of the statement
+     */
+    callsite(const char* const file_name,
+             unsigned line_number,
+             const char* const function_name);
+    /**
+     * Unregister the callsite.
+     */
+    ~callsite();
+
+    /**
+     * Return the file name.
+     *
+     * @return the file name
+     */
+    const char* get_file_name() const;
+    /**
+     * Return the function name.
+     *
+     * @return the function name
+     */
+    const char* get_function_name() const;
+    /**
+     * Return the line number.
+     *
+     * @return the line number
+     */
+    unsigned get_line_number() const;
+    /**
+     * Return the override level, if one is set. An uninitialized
+     * std::shared_ptr is returned if the callsite defers to its
+     * logger.
+     *
+     * @return the override level
+     */
+    std::shared_ptr<level> get_override() const;
+    /**
+     * Return whether the level of this callsite is overridden.
+     *
+     * @return true if there is an override
+     */
+    bool is_overridden() const;
+    /**
+     * Does this callsite permit a level? If there is an override,
+     * then the level must be greater than or equal to the
+     * override. Otherwise the logger decides.
+     *
+     * @param lgr the logger of the statement
+     * @param lvl the level of the statement
+     * @return true if an event should be written
+     */
+    bool permits(const std::shared_ptr<logger>& lgr, const std::shared_ptr<level>& lvl) const;
+
+private:
+    friend class callsite_registry;
+
+    CHUCHO_NO_EXPORT void clear_override();
+    CHUCHO_NO_EXPORT void set_override(std::shared_ptr<level> lvl);
+
+    const char* file_name_;
+    unsigned line_number_;
+    const char* function_name_;
+    std::atomic<bool> overridden_;
+    std::atomic<int> threshold_;
+    // Guarded by the registry
+    std::shared_ptr<level> override_;
+};
+
+/**
+ * Functions for overriding the levels of individual logging
+ * statements at run time.
+ *
+ * A specification selects statements by file and, optionally, by
+ * line. It has the form <tt>file[:line[-line]]</tt>. The file
+ * part may contain the wildcards @c * and @c ?, and it matches
+ * either the whole file name of a statement or any trailing part
+ * of it that begins after a path separator. For example,
+ * <tt>src/net/&lowast;.cpp:120-180</tt> selects all statements in lines
+ * 120 through 180 of every .cpp file in any directory that ends
+ * with src/net.
+ *
+ * Specifications are remembered, so statements that have not yet
+ * been reached when a specification is given will pick it up the
+ * first time they run. If more than one specification matches a
+ * statement, the most recent one wins.
+ *
+ * @ingroup loggers
+ */
+namespace callsites
+{
+
+/**
+ * Override the level of the matching statements. The statements
+ * will write events at or above the given level, regardless of
+ * the level of their loggers.
+ *
+ * @param spec the specification
+ * @param lvl the override level
+ * @return the number of registered statements that matched
+ * @throw std::invalid_argument if the specification is malformed
+ *        or lvl is an uninitialized std::shared_ptr
+ */
+CHUCHO_EXPORT std::size_t enable(const std::string& spec, std::shared_ptr<level> lvl);
+/**
+ * Turn off the matching statements entirely.
+ *
+ * @param spec the specification
+ * @return the number of registered statements that matched
+ * @throw std::invalid_argument if the specification is malformed
+ */
+CHUCHO_EXPORT std::size_t disable(const std::string& spec);
+/**
+ * Return all statements that have registered so far.
+ *
+ * @return the callsites
+ */
+CHUCHO_EXPORT std::vector<const callsite*> get_registered();
+/**
+ * Remove all overrides, so that every statement defers to its
+ * logger again.
+ */
+CHUCHO_EXPORT void reset();
+
+}
+
+inline const char* callsite::get_file_name() const
+{
+    return file_name_;
+}
+
+inline const char* callsite::get_function_name() const
+{
+    return function_name_;
+}
+
+inline unsigned callsite::get_line_number() const
+{
+    return line_number_;
+}
+
+inline bool callsite::is_overridden() const
+{
+    return overridden_.load(std::memory_order_acquire);
+}
+
+inline bool callsite::permits(const std::shared_ptr<logger>& lgr, const std::shared_ptr<level>& lvl) const
+{
+    if (overridden_.load(std::memory_order_acquire))
+        return lvl->get_value() >= threshold_.load(std::memory_order_relaxed);
+    return lgr->permits(lvl);
+}
+
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif
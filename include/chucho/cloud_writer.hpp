@@ -18,6 +18,7 @@
 #define CHUCHO_CLOUD_WRITER_HPP_
 
 #include <chucho/writer.hpp>
+#include <chrono>
 
 namespace chucho
 {
@@ -26,11 +27,46 @@ namespace chucho
  * @class cloud_writer cloud_writer.hpp chucho/cloud_writer.hpp
  * A writer that writes to the cloud.
  *
+ * Cloud writers that support a bulk mode accept a @ref bulk_settings
+ * object. In bulk mode the logging thread only stores the event in an
+ * @ref event_cache_provider "event cache". A background thread formats
+ * the events and sends them in batches, so a slow service never stalls
+ * the thread that logged. While the service cannot be reached, failed
+ * batches are retried with increasing delay. Once the retry limit is
+ * reached, events stay in the cache, which moves them to disk when
+ * its memory fills.
+ *
  * @ingroup writers
  */
 class cloud_writer : public writer
 {
 public:
+    /**
+     * The batching behavior of a cloud writer in bulk mode. A batch is
+     * sent when it reaches either limit, when its first event has
+     * waited for the linger time, and when the writer is flushed.
+     */
+    struct bulk_settings
+    {
+        /**
+         * The maximum number of events in one batch.
+         */
+        std::size_t max_events = 500;
+        /**
+         * The maximum number of bytes in one batch.
+         */
+        std::size_t max_bytes = 1024 * 1024;
+        /**
+         * The longest an event waits for its batch to fill.
+         */
+        std::chrono::milliseconds linger = std::chrono::milliseconds(1000);
+        /**
+         * The number of batches that may be waiting to be sent or
+         * retried before no more events are taken from the cache.
+         */
+        std::size_t max_retry_batches = 16;
+    };
+
     /**
      * @name Contructor
      * @{
@@ -20,6 +20,8 @@
 #include <chucho/cloud_writer.hpp>
 #include <aws/logs/CloudWatchLogsClient.h>
 #include <aws/logs/model/InputLogEvent.h>
+#include <condition_variable>
+#include <thread>
 
 namespace chucho
 {
@@ -34,6 +36,14 @@ namespace chucho
  * file. If the region cannot be gleaned from either of those sources,
  * then it will be empty.
  *
+ * The writer keeps two batches. Events are added to one while the
+ * other is sent by a background thread, so the thread that logs only
+ * waits if a full batch is ready before the previous one has been
+ * sent. The background thread also connects to Cloudwatch and finds
+ * the stream's sequence token, so construction does not block on the
+ * network. Throttled requests are retried with increasing delay, and
+ * a stale sequence token is refreshed and the request is retried.
+ *
  * @ingroup writers
  */
 class CHUCHO_EXPORT cloudwatch_writer : public cloud_writer
@@ -78,10 +88,37 @@ public:
                       const std::string& log_stream,
                       const std::string& region,
                       std::size_t batch_size = DEFAULT_BATCH_SIZE);
+    /**
+     * Construct a writer that sends to a specific endpoint, such as
+     * a local stand-in for Cloudwatch.
+     *
+     * @param name the name
+     * @param fmt the formatter
+     * @param log_group the name of the log group
+     * @param log_stream  the name of the log stream
+     * @param region the region
+     * @param endpoint the endpoint, which if empty is the region's
+     *        Cloudwatch Logs endpoint
+     * @param batch_size the batch size
+     */
+    cloudwatch_writer(const std::string& name,
+                      std::unique_ptr<formatter>&& fmt,
+                      const std::string& log_group,
+                      const std::string& log_stream,
+                      const std::string& region,
+                      const std::string& endpoint,
+                      std::size_t batch_size = DEFAULT_BATCH_SIZE);
+    /**
+     * Send any remaining events and stop the background thread.
+     */
+    ~cloudwatch_writer();
     /**
      * @}
      */
 
+    /**
+     * Send the current batch and wait for both batches to be sent.
+     */
     virtual void flush() override;
     /**
      * Return the batch size of this writer.
@@ -95,6 +132,12 @@ public:
      * @return the unsent events
      */
     std::size_t get_current_batch_size();
+    /**
+     * Return the endpoint override.
+     *
+     * @return the endpoint, which is empty if not overridden
+     */
+    const std::string& get_endpoint() const;
     /**
      * Return the name of the log group.
      *
@@ -121,18 +164,37 @@ protected:
     virtual void write_impl(const event& evt) override;
 
 private:
+    struct CHUCHO_NO_EXPORT batch
+    {
+        Aws::Vector<Aws::CloudWatchLogs::Model::InputLogEvent> events;
+        std::size_t wire_size = 0;
+    };
+
+    CHUCHO_NO_EXPORT void connect();
     CHUCHO_NO_EXPORT std::size_t get_wire_size(const Aws::CloudWatchLogs::Model::InputLogEvent& e) const;
+    // NOTE: guard_ must be locked on entry
+    CHUCHO_NO_EXPORT void hand_off(std::unique_lock<std::mutex>& lock);
     CHUCHO_NO_EXPORT long long millis_since_epoch(const event& e) const;
+    CHUCHO_NO_EXPORT void refresh_sequence_token();
+    CHUCHO_NO_EXPORT void send(batch& bat);
+    CHUCHO_NO_EXPORT void thread_main();
 
     std::unique_ptr<Aws::CloudWatchLogs::CloudWatchLogsClient> client_;
     std::string log_group_;
     std::string log_stream_;
-    Aws::Vector<Aws::CloudWatchLogs::Model::InputLogEvent> events_;
-    std::size_t wire_size_;
+    // One is filled while the other is being sent
+    batch batches_[2];
+    std::size_t filling_;
+    bool sending_;
+    bool stop_;
     Aws::String next_token_;
     std::size_t batch_size_;
     std::string region_;
+    std::string endpoint_;
     std::mutex guard_;
+    std::condition_variable send_condition_;
+    std::condition_variable sent_condition_;
+    std::unique_ptr<std::thread> worker_;
 };
 
 inline std::size_t cloudwatch_writer::get_batch_size() const
@@ -140,6 +202,11 @@ inline std::size_t cloudwatch_writer::get_batch_size() const
     return batch_size_;
 }
 
+inline const std::string& cloudwatch_writer::get_endpoint() const
+{
+    return endpoint_;
+}
+
 inline const std::string& cloudwatch_writer::get_log_group() const
 {
     return log_group_;
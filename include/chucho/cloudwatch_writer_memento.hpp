@@ -33,12 +33,14 @@ public:
     cloudwatch_writer_memento(configurator& cfg);
 
     const optional<std::size_t>& get_batch_size() const;
+    const std::string& get_endpoint() const;
     const std::string& get_log_group() const;
     const std::string& get_log_stream() const;
     const std::string& get_region() const;
 
 private:
     optional<std::size_t> batch_size_;
+    std::string endpoint_;
     std::string log_group_;
     std::string log_stream_;
     std::string region_;
@@ -49,6 +51,11 @@ inline const optional<std::size_t>& cloudwatch_writer_memento::get_batch_size()
     return batch_size_;
 }
 
+inline const std::string& cloudwatch_writer_memento::get_endpoint() const
+{
+    return endpoint_;
+}
+
 inline const std::string& cloudwatch_writer_memento::get_log_group() const
 {
     return log_group_;
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_COMPILED_LEVEL_H_)
+#define CHUCHO_COMPILED_LEVEL_H_
+
+/**
+ * @file
+ * The compile-time minimum level of the logging macros. Both the
+ * C++ macros in log.hpp and the C macros in log.h consult
+ * @ref CHUCHO_MIN_COMPILED_LEVEL. A statement whose level is below
+ * it expands to nothing that is executed, so it costs nothing at
+ * run time, not even a level check. Its arguments are still
+ * compiled, though, so they continue to be type-checked, and any
+ * side effects they might have do not happen.
+ *
+ * To use it, define @ref CHUCHO_MIN_COMPILED_LEVEL before including
+ * the header containing the macros, usually on the compiler's
+ * command line. For example, the following removes all trace- and
+ * debug-level statements:
+ * @code
+ * -DCHUCHO_MIN_COMPILED_LEVEL=CHUCHO_COMPILED_LEVEL_INFO
+ * @endcode
+ *
+ * @note This only affects the logging macros. Logging directly
+ *       through the logger API is unaffected.
+ *
+ * @ingroup miscellaneous
+ */
+
+/**
+ * @def CHUCHO_COMPILED_LEVEL_TRACE
+ * The compiled level of trace statements.
+ */
+#define CHUCHO_COMPILED_LEVEL_TRACE 0
+/**
+ * @def CHUCHO_COMPILED_LEVEL_DEBUG
+ * The compiled level of debug statements.
+ */
+#define CHUCHO_COMPILED_LEVEL_DEBUG 10000
+/**
+ * @def CHUCHO_COMPILED_LEVEL_INFO
+ * The compiled level of info statements.
+ */
+#define CHUCHO_COMPILED_LEVEL_INFO 20000
+/**
+ * @def CHUCHO_COMPILED_LEVEL_WARN
+ * The compiled level of warn statements.
+ */
+#define CHUCHO_COMPILED_LEVEL_WARN 30000
+/**
+ * @def CHUCHO_COMPILED_LEVEL_ERROR
+ * The compiled level of error statements.
+ */
+#define CHUCHO_COMPILED_LEVEL_ERROR 40000
+/**
+ * @def CHUCHO_COMPILED_LEVEL_FATAL
+ * The compiled level of fatal statements.
+ */
+#define CHUCHO_COMPILED_LEVEL_FATAL 50000
+/**
+ * @def CHUCHO_COMPILED_LEVEL_OFF
+ * A compiled level that removes all statements.
+ */
+#define CHUCHO_COMPILED_LEVEL_OFF 2147483647
+
+/**
+ * @def CHUCHO_MIN_COMPILED_LEVEL
+ * Statements with a level below this are removed at compile time.
+ * The values match those of the corresponding chucho::level, so
+ * either one of the CHUCHO_COMPILED_LEVEL_ macros or a plain
+ * number may be used. The default is @ref
+ * CHUCHO_COMPILED_LEVEL_TRACE, which removes nothing.
+ */
+#if !defined(CHUCHO_MIN_COMPILED_LEVEL)
+#define CHUCHO_MIN_COMPILED_LEVEL CHUCHO_COMPILED_LEVEL_TRACE
+#endif
+
+#if !defined(CHUCHO_DONT_DOCUMENT)
+
+/* Each of these chooses its first argument when the level is
+ * compiled in, and its second when it is not. The odd names
+ * allow them to be built by pasting the level tokens that the
+ * macros already use. */
+#if CHUCHO_MIN_COMPILED_LEVEL <= CHUCHO_COMPILED_LEVEL_TRACE
+#define CHUCHO_IF_COMPILED_TRACE_(on, off) on
+#else
+#define CHUCHO_IF_COMPILED_TRACE_(on, off) off
+#endif
+
+#if CHUCHO_MIN_COMPILED_LEVEL <= CHUCHO_COMPILED_LEVEL_DEBUG
+#define CHUCHO_IF_COMPILED_DEBUG_(on, off) on
+#else
+#define CHUCHO_IF_COMPILED_DEBUG_(on, off) off
+#endif
+
+#if CHUCHO_MIN_COMPILED_LEVEL <= CHUCHO_COMPILED_LEVEL_INFO
+#define CHUCHO_IF_COMPILED_INFO_(on, off) on
+#else
+#define CHUCHO_IF_COMPILED_INFO_(on, off) off
+#endif
+
+#if CHUCHO_MIN_COMPILED_LEVEL <= CHUCHO_COMPILED_LEVEL_WARN
+#define CHUCHO_IF_COMPILED_WARN_(on, off) on
+#else
+#define CHUCHO_IF_COMPILED_WARN_(on, off) off
+#endif
+
+#if CHUCHO_MIN_COMPILED_LEVEL <= CHUCHO_COMPILED_LEVEL_ERROR
+#define CHUCHO_IF_COMPILED_ERROR_(on, off) on
+#else
+#define CHUCHO_IF_COMPILED_ERROR_(on, off) off
+#endif
+
+#if CHUCHO_MIN_COMPILED_LEVEL <= CHUCHO_COMPILED_LEVEL_FATAL
+#define CHUCHO_IF_COMPILED_FATAL_(on, off) on
+#else
+#define CHUCHO_IF_COMPILED_FATAL_(on, off) off
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#if !defined(CHUCHO_CONFIG_WATCHER_HPP_)
+#define CHUCHO_CONFIG_WATCHER_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/status_reporter.hpp>
+#include <functional>
+#include <thread>
+
+namespace chucho
+{
+
+/**
+ * Watch a configuration file with inotify. The file's directory
+ * is watched, so that a file that is replaced, as editors and
+ * deployment tools do, or that does not yet exist, is still
+ * noticed. Changes are coalesced until the file has been quiet
+ * for a moment, and then the callback is invoked from the
+ * watcher's thread.
+ */
+class CHUCHO_PRIV_EXPORT config_watcher : public status_reporter
+{
+public:
+    /**
+     * How long the file must be quiet before the callback is
+     * invoked.
+     */
+    static constexpr int QUIET_MILLIS = 100;
+
+    config_watcher(const std::string& file_name, std::function<void()> changed);
+    ~config_watcher();
+
+    const std::string& get_file_name() const;
+
+private:
+    void thread_main();
+
+    std::string file_name_;
+    std::string base_name_;
+    std::function<void()> changed_;
+    int inotify_;
+    int stop_pipe_[2];
+    std::unique_ptr<std::thread> worker_;
+};
+
+inline const std::string& config_watcher::get_file_name() const
+{
+    return file_name_;
+}
+
+}
+
+#endif
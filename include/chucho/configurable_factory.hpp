@@ -74,6 +74,16 @@ public:
      * @return the memento
      */
     virtual std::unique_ptr<memento> create_memento(configurator& cfg) = 0;
+    /**
+     * Return whether the @ref configurable that this factory
+     * creates is a @ref writer. Writers are created after the
+     * other parts of a @ref logger, so that the logger can keep
+     * the ones that have not changed when it is reconfigured. By
+     * default, this returns false.
+     *
+     * @return true if this factory creates writers
+     */
+    virtual bool creates_writer() const;
 };
 
 }
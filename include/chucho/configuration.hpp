@@ -19,6 +19,7 @@
 
 #include <chucho/security_policy.hpp>
 #include <chucho/status_reporter.hpp>
+#include <chucho/thread_settings.hpp>
 #include <string>
 #include <functional>
 
@@ -67,7 +68,9 @@ class logger;
  * side by side.
  *  
  * @note The methods in the configuration class are not thread 
- *       safe.
+ *       safe, except for @ref reconfigure and @ref set, which
+ *       may be called while the configuration file is being
+ *       watched.
  *  
  * @ingroup configuration 
  */
@@ -171,6 +174,14 @@ public:
      * @sa set_style
      */
     static style get_style();
+    /**
+     * Return the settings that apply to all of the threads that
+     * Chucho creates.
+     *
+     * @return the thread settings
+     * @sa set_thread_settings
+     */
+    static thread_settings get_thread_settings();
     /**
      * Return the unknown element handler. The unknown element 
      * handler is a callback that the application may set to process 
@@ -185,6 +196,14 @@ public:
      * @sa set_unknown_handler
      */
     static unknown_handler_type get_unknown_handler();
+    /**
+     * Return whether the configuration file is being watched for
+     * changes.
+     *
+     * @return true if the file is being watched
+     * @sa set_watch
+     */
+    static bool is_watching();
     /**
      * Reconfigure Chucho by reading the last configuration file 
      * again. The file read may either be the last file that was 
@@ -199,12 +218,21 @@ public:
      * servers, which re-read their configuration files upon 
      * receiving SIGHUP.
      *  
-     * If the reconfiguration fails for any reason, then the
+     * If the file is in YAML or JSON format, then the new
+     * configuration is prepared before any @ref logger is touched.
+     * A @ref writer whose configuration has not changed is kept as
+     * it is, so its open files, threads and connections survive.
+     * Each logger's level and writers are then replaced at once,
+     * so events that are logged during reconfiguration are not
+     * lost. If the file cannot be parsed, then the running
+     * configuration is left alone.
+     *  
+     * If the reconfiguration fails for any other reason, then the
      * resulting configuration may be invalid.
      *  
-     * @pre Chucho must have already undergone its initial 
-     *      configuration, which is initiated by requesting the
-     *      first @ref logger.
+     * @pre Chucho must have already been configured, either by
+     *      its initial configuration, which is initiated by
+     *      requesting the first @ref logger, or by @ref set.
      * @note This configuration does not imply the chain of 
      *       fallbacks that occur in initial configuration. In this
      *       case only the last file read or the file named by
@@ -289,6 +317,17 @@ public:
      * @sa get_style
      */
     static void set_style(style stl);
+    /**
+     * Set the settings that apply to all of the threads that Chucho
+     * creates. Anything that a writer sets for its own threads
+     * overrides these settings, and the name is always ignored.
+     * Threads that are already running pick up the change the next
+     * time they wake up.
+     *
+     * @param ts the thread settings
+     * @sa get_thread_settings, writer::set_thread_settings
+     */
+    static void set_thread_settings(const thread_settings& ts);
     /**
      * Set the unknown element handler. The unknown element 
      * handler is a callback that the application may set to process 
@@ -309,6 +348,23 @@ public:
      * @sa get_unknown_handler
      */
     static void set_unknown_handler(unknown_handler_type hndl);
+    /**
+     * Set whether to watch the configuration file for changes. The
+     * file that is watched is the one that @ref reconfigure would
+     * read. When it changes, @ref reconfigure is called from a
+     * background thread. Watching is only supported where inotify
+     * is available.
+     *
+     * @note This method should be called after Chucho has been
+     *       configured, which happens when the first @ref logger is
+     *       requested.
+     *
+     * @param state whether to watch the file
+     * @return true if the file is being watched as requested, or
+     *         false if watching was requested and is not possible
+     * @sa is_watching
+     */
+    static bool set_watch(bool state);
 
 protected:
     friend class logger;
@@ -324,10 +380,11 @@ private:
         void warning(const std::string& message, std::exception_ptr ex = std::exception_ptr()) const;
     };
 
-    CHUCHO_NO_EXPORT static bool configure_from_file(const std::string& file_name, reporter& report);
-    CHUCHO_NO_EXPORT static bool configure_from_text(const std::string& cfg, reporter& report);
+    CHUCHO_NO_EXPORT static bool configure_from_file(const std::string& file_name, reporter& report, bool replace = false);
+    CHUCHO_NO_EXPORT static bool configure_from_text(const std::string& cfg, reporter& report, bool replace = false);
     CHUCHO_NO_EXPORT static void initialize_security_policy();
     CHUCHO_NO_EXPORT static void perform(std::shared_ptr<logger> root_logger);
+    CHUCHO_NO_EXPORT static void reset_loggers();
 };
 
 inline configuration::reporter::reporter()
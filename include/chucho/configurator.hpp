@@ -99,7 +99,23 @@ protected:
      * and private members of this class. 
      */
     friend class configuration;
+    /**
+     * The staged configurator replaces the factories while a
+     * configuration is being staged.
+     */
+    friend class staged_configurator;
 
+    /**
+     * Return the factories that this configurator uses. Subclasses
+     * will call this method while performing configuration. These
+     * are the ones returned by @ref get_factories(), except while a
+     * configuration is being staged for @ref
+     * configuration::reconfigure(), when they are factories that
+     * record the configuration instead of creating objects.
+     *
+     * @return the factories
+     */
+    std::map<std::string, std::unique_ptr<configurable_factory>>& get_current_factories();
     /**
      * Return all known factories. Subclasses will call this method 
      * while performing configuration. 
@@ -136,6 +152,7 @@ private:
 
     std::map<std::string, std::string> variables_;
     security_policy& security_policy_;
+    std::map<std::string, std::unique_ptr<configurable_factory>>* staged_factories_;
 };
 
 inline void configurator::add_variables(const std::map<std::string, std::string>& vars)
@@ -19,6 +19,9 @@
 
 #include <chucho/writer.hpp>
 #include <soci/soci.h>
+#include <chrono>
+#include <condition_variable>
+#include <thread>
 
 namespace chucho
 {
@@ -51,6 +54,19 @@ namespace chucho
  * Please consult the SOCI documentation for the details of the desired
  * back-end.
  *
+ * By default each event is inserted as it is written, which costs one
+ * round trip to the database per event. When a batch size greater than
+ * one is given, events are collected and inserted together using SOCI's
+ * bulk binding, with each batch in its own transaction. A batch is
+ * inserted when it is full, when its oldest event has waited longer than
+ * the linger time, when the writer is flushed and when the writer is
+ * destroyed. A batch that lingers is inserted by a timer thread, so
+ * events are not held indefinitely when nothing else is written.
+ * Optionally, all inserts can be performed by a dedicated thread, so
+ * that the logging thread only has to format the event. In
+ * that case the logging thread blocks if the database falls so far
+ * behind that eight batches are waiting to be inserted.
+ *
  * @ingroup writers database
  */
 class CHUCHO_EXPORT database_writer : public writer
@@ -86,30 +102,133 @@ public:
     database_writer(const std::string& name,
                     std::unique_ptr<formatter>&& fmt,
                     const std::string& connection);
+    /**
+     * Construct a writer that inserts events in batches.
+     *
+     * @param name the name
+     * @param fmt the formatter
+     * @param connection the connection information
+     * @param batch_size the maximum number of events to insert at once
+     * @param linger the longest time an event may wait for its batch to fill
+     * @param background whether to perform the inserts in a dedicated thread
+     * @throw std::invalid_argument if batch_size is zero
+     */
+    database_writer(const std::string& name,
+                    std::unique_ptr<formatter>&& fmt,
+                    const std::string& connection,
+                    std::size_t batch_size,
+                    const std::chrono::milliseconds& linger = DEFAULT_LINGER,
+                    bool background = false);
+    /**
+     * Destroy the writer. Any events waiting to be inserted are
+     * inserted first.
+     */
+    ~database_writer();
     /**
      * @}
      */
 
+    /**
+     * The default linger time of a batch.
+     */
+    static constexpr std::chrono::milliseconds DEFAULT_LINGER = std::chrono::milliseconds(1000);
+
+    /**
+     * Insert any events that are waiting. If the inserts are performed
+     * in the background, then this method returns after the background
+     * thread has inserted everything that was waiting when it was called.
+     */
+    virtual void flush() override;
+    /**
+     * Return the batch size.
+     *
+     * @return the batch size
+     */
+    std::size_t get_batch_size() const;
+    /**
+     * Return the linger time.
+     *
+     * @return the linger time
+     */
+    const std::chrono::milliseconds& get_linger() const;
+    /**
+     * Return whether the inserts are performed in a dedicated thread.
+     *
+     * @return whether inserts are in the background
+     */
+    bool is_background() const;
+
 protected:
     virtual void write_impl(const event& evt) override;
 
 private:
+    struct CHUCHO_NO_EXPORT columns
+    {
+        void clear();
+        std::size_t size() const;
+        void swap(columns& other);
+
+        std::vector<std::string> formatted_message;
+        std::vector<std::tm> timestamp;
+        std::vector<std::string> file_name;
+        std::vector<int> line_number;
+        std::vector<std::string> function_name;
+        std::vector<std::string> logger_name;
+        std::vector<std::string> level_name;
+        std::vector<std::string> marker;
+        std::vector<soci::indicator> marker_ind;
+        std::vector<std::string> thread;
+        std::vector<std::string> host_name;
+        std::vector<int> process_id;
+    };
+
+    CHUCHO_NO_EXPORT void append(columns& cols, const event& evt);
+    CHUCHO_NO_EXPORT void insert();
+    CHUCHO_NO_EXPORT void linger_main();
+    CHUCHO_NO_EXPORT void thread_main();
+
     soci::session sql_;
     soci::statement stmt_;
-    std::string formatted_message_;
-    std::tm timestamp_;
-    std::string file_name_;
-    int line_number_;
-    std::string function_name_;
-    std::string logger_name_;
-    std::string level_name_;
-    std::string marker_;
-    soci::indicator marker_ind_;
-    std::string thread_;
+    // Bound to stmt_
+    columns bound_;
+    // Filled by the logging thread when inserts are in the background
+    columns pending_;
+    std::size_t batch_size_;
+    std::chrono::milliseconds linger_;
+    std::chrono::steady_clock::time_point oldest_;
     std::string host_name_;
     int process_id_;
+    std::time_t cached_second_;
+    std::tm cached_timestamp_;
+    std::thread::id cached_thread_id_;
+    std::string cached_thread_;
+    std::mutex pending_guard_;
+    std::condition_variable pending_condition_;
+    std::condition_variable space_condition_;
+    std::condition_variable flushed_condition_;
+    std::uint64_t flush_requested_;
+    std::uint64_t flush_completed_;
+    bool stop_;
+    std::unique_ptr<std::thread> worker_;
+    // Inserts lingering batches when not in the background
+    std::unique_ptr<std::thread> lingerer_;
 };
 
+inline std::size_t database_writer::get_batch_size() const
+{
+    return batch_size_;
+}
+
+inline const std::chrono::milliseconds& database_writer::get_linger() const
+{
+    return linger_;
+}
+
+inline bool database_writer::is_background() const
+{
+    return static_cast<bool>(worker_);
+}
+
 }
 
 #endif
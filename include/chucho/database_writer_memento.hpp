@@ -22,6 +22,8 @@
 #endif
 
 #include <chucho/writer_memento.hpp>
+#include <chucho/optional.hpp>
+#include <chrono>
 
 namespace chucho
 {
@@ -31,17 +33,38 @@ class database_writer_memento : public writer_memento
 public:
     database_writer_memento(configurator& cfg);
 
+    const optional<bool>& get_background() const;
+    const optional<std::size_t>& get_batch_size() const;
     const std::string& get_connection() const;
+    const optional<std::chrono::milliseconds>& get_linger() const;
 
 private:
     std::string connection_;
+    optional<std::size_t> batch_size_;
+    optional<std::chrono::milliseconds> linger_;
+    optional<bool> background_;
 };
 
+inline const optional<bool>& database_writer_memento::get_background() const
+{
+    return background_;
+}
+
+inline const optional<std::size_t>& database_writer_memento::get_batch_size() const
+{
+    return batch_size_;
+}
+
 inline const std::string& database_writer_memento::get_connection() const
 {
     return connection_;
 }
 
+inline const optional<std::chrono::milliseconds>& database_writer_memento::get_linger() const
+{
+    return linger_;
+}
+
 }
 
 #endif
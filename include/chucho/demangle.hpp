@@ -23,6 +23,7 @@
 
 #include <chucho/export.h>
 #include <string>
+#include <typeinfo>
 
 namespace chucho
 {
@@ -60,6 +60,15 @@ public:
      * @param key the key to erase
      */
     static void erase(const std::string& key);
+    /**
+     * Find the value of a given key. Unlike @ref at, a key that
+     * does not exist is not added.
+     *
+     * @param key the key
+     * @return a pointer to the key's value, or nullptr if the key
+     *         is not in this context
+     */
+    static const std::string* find(const std::string& key);
     /**
      * Get a copy of all key-value pairs.
      * 
@@ -23,6 +23,10 @@
 #endif
 
 #include <chucho/writeable_filter.hpp>
+#include <chrono>
+#include <list>
+#include <unordered_map>
+#include <cstdint>
 
 namespace chucho
 {
@@ -34,6 +38,19 @@ namespace chucho
  * written. If it does, then the event is denied. Once a new 
  * message is received, then the filter writes that a message
  * was repeated a certain number of times.
+ *
+ * The filter can also run in fingerprint mode. In this mode 
+ * the event is not formatted. Instead, a 64-bit hash of the raw 
+ * message, the file name, the line number, the logger name and 
+ * the level is computed, and the filter remembers the last few 
+ * distinct fingerprints in a small least-recently-used table. 
+ * Any event whose fingerprint is already in the table is 
+ * denied, so duplicates that are interleaved with other 
+ * messages, for example from multiple threads, are also 
+ * suppressed. When an entry ages out of the table, because its 
+ * time window has expired or because room is needed for a new 
+ * fingerprint, a summary of how many times the message was 
+ * logged is written.
  *  
  * @ingroup filters 
  */
@@ -41,7 +58,17 @@ class CHUCHO_EXPORT duplicate_message_filter : public writeable_filter
 {
 public:
     /**
-     * @name Constructor
+     * The default number of distinct fingerprints remembered in 
+     * fingerprint mode. 
+     */
+    static constexpr std::size_t DEFAULT_CAPACITY = 32;
+    /**
+     * The default time window in fingerprint mode.
+     */
+    static constexpr std::chrono::seconds DEFAULT_WINDOW = std::chrono::seconds(60);
+
+    /**
+     * @name Constructors
      */
     //@{
     /**
@@ -58,22 +85,106 @@ public:
      * @param wrt the writer
      */
     duplicate_message_filter(const std::string& name, writer& wrt);
+    /**
+     * Construct a duplicate_message_filter that runs in 
+     * fingerprint mode. This filter will not have a writer set 
+     * yet. 
+     *
+     * @param name the name of the filter
+     * @param capacity the number of distinct fingerprints to 
+     *                 remember
+     * @param window the amount of time during which repeats of a 
+     *               message are suppressed
+     * @throw std::invalid_argument if capacity is zero
+     */
+    duplicate_message_filter(const std::string& name,
+                             std::size_t capacity,
+                             const std::chrono::milliseconds& window);
+    /**
+     * Construct a duplicate_message_filter that runs in 
+     * fingerprint mode. 
+     *
+     * @param name the name of the filter
+     * @param wrt the writer
+     * @param capacity the number of distinct fingerprints to 
+     *                 remember
+     * @param window the amount of time during which repeats of a 
+     *               message are suppressed
+     * @throw std::invalid_argument if capacity is zero
+     */
+    duplicate_message_filter(const std::string& name,
+                             writer& wrt,
+                             std::size_t capacity,
+                             const std::chrono::milliseconds& window);
     //@}
 
     /**
      * Return DENY if the event's message matches the last message 
-     * seen. Otherwise return NEUTRAL. 
+     * seen. Otherwise return NEUTRAL. In fingerprint mode, DENY is 
+     * returned if the event's fingerprint is already known and its 
+     * window has not expired.
      * 
      * @param evt the event to evaluate
      * @return the result
      */
     virtual result evaluate(const event& evt) override;
+    /**
+     * Return the number of distinct fingerprints remembered. This 
+     * is zero if the filter is not in fingerprint mode.
+     *
+     * @return the capacity
+     */
+    std::size_t get_capacity() const;
+    /**
+     * Return the time window used in fingerprint mode.
+     *
+     * @return the window
+     */
+    const std::chrono::milliseconds& get_window() const;
+    /**
+     * Return whether this filter is in fingerprint mode.
+     *
+     * @return true if fingerprints are used
+     */
+    bool is_fingerprinting() const;
 
 private:
+    struct entry
+    {
+        entry(std::uint64_t fp, const event& evt);
+
+        std::uint64_t fingerprint;
+        event first;
+        event::time_type last_seen;
+        std::size_t count;
+    };
+
+    CHUCHO_NO_EXPORT result evaluate_fingerprint(const event& evt);
+    CHUCHO_NO_EXPORT void retire(const entry& ent);
+
     std::string message_;
     std::size_t count_;
+    std::size_t capacity_;
+    std::chrono::milliseconds window_;
+    std::list<entry> entries_;
+    std::unordered_map<std::uint64_t, std::list<entry>::iterator> index_;
 };
 
+inline std::size_t duplicate_message_filter::get_capacity() const
+{
+    return capacity_;
+}
+
+inline const std::chrono::milliseconds& duplicate_message_filter::get_window() const
+{
+    return window_;
+}
+
+inline bool duplicate_message_filter::is_fingerprinting() const
+{
+    return capacity_ > 0;
+}
+
 }
 
 #if defined(_MSC_VER)
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_DUPLICATE_MESSAGE_FILTER_MEMENTO_HPP_)
+#define CHUCHO_DUPLICATE_MESSAGE_FILTER_MEMENTO_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/filter_memento.hpp>
+#include <chucho/optional.hpp>
+#include <chrono>
+
+namespace chucho
+{
+
+class duplicate_message_filter_memento : public filter_memento
+{
+public:
+    duplicate_message_filter_memento(configurator& cfg);
+
+    const optional<std::size_t>& get_capacity() const;
+    bool get_fingerprint() const;
+    const optional<std::chrono::seconds>& get_window() const;
+
+private:
+    bool fingerprint_;
+    optional<std::size_t> capacity_;
+    optional<std::chrono::seconds> window_;
+};
+
+inline const optional<std::size_t>& duplicate_message_filter_memento::get_capacity() const
+{
+    return capacity_;
+}
+
+inline bool duplicate_message_filter_memento::get_fingerprint() const
+{
+    return fingerprint_;
+}
+
+inline const optional<std::chrono::seconds>& duplicate_message_filter_memento::get_window() const
+{
+    return window_;
+}
+
+}
+
+#endif
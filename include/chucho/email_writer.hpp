@@ -20,12 +20,17 @@
 #include <chucho/writer.hpp>
 #include <chucho/email_trigger.hpp>
 #include <chucho/optional.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <queue>
+#include <thread>
 
 namespace chucho
 {
 
 class curl;
+class pattern_formatter;
 
 /**
  * @class email_writer email_writer.hpp chucho/email_writer.hpp
@@ -45,6 +50,14 @@ class curl;
  * supported. Support for SSL can be detected before an
  * @ref email_writer is created with the static method
  * @ref get_ssl_supported.
+ *
+ * Email is sent by a background thread, so the event that
+ * triggers an email does not wait for the SMTP conversation.
+ * Triggers that arrive within the coalescing window of the
+ * first one are gathered into a single email, and at most
+ * @ref get_max_backlog emails wait to be sent. When the backlog
+ * is full the oldest waiting email is discarded and the loss is
+ * reported.
  * 
  * @ingroup writers email
  */
@@ -86,6 +99,15 @@ public:
      * The default buffer capacity, which is 256.
      */
     static const std::size_t DEFAULT_BUFFER_CAPACITY;
+    /**
+     * The default coalescing window, which is one second.
+     */
+    static const std::chrono::milliseconds DEFAULT_COALESCE_WINDOW;
+    /**
+     * The default maximum number of emails waiting to be sent,
+     * which is 16.
+     */
+    static const std::size_t DEFAULT_MAX_BACKLOG;
 
     /**
      * Return whether SSL-based connections are supported.
@@ -161,13 +183,20 @@ public:
                  std::uint16_t port = DEFAULT_PORT,
                  std::size_t buffer_capacity = DEFAULT_BUFFER_CAPACITY);
     /**
-     * Destroy an email writer.
+     * Destroy an email writer. Any emails that are waiting
+     * are sent first.
      */
     virtual ~email_writer();
     /**
      * @}
      */
 
+    /**
+     * Send the waiting emails without waiting for their
+     * coalescing windows to close, and wait for them to be sent.
+     */
+    virtual void flush() override;
+
     /**
      * Return the capacity of the buffer that holds events until
      * the @ref email_trigger is triggered.
@@ -182,6 +211,13 @@ public:
      * @return the size of the buffer
      */
     std::size_t get_buffer_size() const;
+    /**
+     * Return the length of time after a trigger during which
+     * further triggers are gathered into the same email.
+     *
+     * @return the coalescing window
+     */
+    std::chrono::milliseconds get_coalesce_window() const;
     /**
      * Return the connection type for sending email.
      * 
@@ -200,6 +236,13 @@ public:
      * @return the host name
      */
     const std::string& get_host() const;
+    /**
+     * Return the maximum number of emails that may be waiting
+     * to be sent.
+     *
+     * @return the maximum backlog
+     */
+    std::size_t get_max_backlog() const;
     /**
      * Return the password used for user/password
      * authentication, if there is one.
@@ -252,6 +295,21 @@ public:
      * @return true if verbose reporting is on
      */
     bool get_verbose() const;
+    /**
+     * Set the length of time after a trigger during which
+     * further triggers are gathered into the same email. A
+     * window of zero sends each trigger's email on its own.
+     *
+     * @param window the coalescing window
+     */
+    void set_coalesce_window(const std::chrono::milliseconds& window);
+    /**
+     * Set the maximum number of emails that may be waiting to
+     * be sent.
+     *
+     * @param max the maximum backlog, which must be at least one
+     */
+    void set_max_backlog(std::size_t max);
     /**
      * Set whether this email writer reports its activity
      * verbosely. By default, this is true if Chucho
@@ -276,15 +334,25 @@ private:
         void pop();
         void push(const event& evt);
         std::size_t size() const;
+        std::queue<event>& queue();
 
     private:
         std::queue<event> q_;
         std::size_t max_;
     };
 
-    CHUCHO_NO_EXPORT std::string format_date() const;
-    CHUCHO_NO_EXPORT std::string format_message(const event& evt);
+    // The events of one or more triggers that will be sent together
+    struct CHUCHO_NO_EXPORT letter
+    {
+        std::vector<event> events;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    CHUCHO_NO_EXPORT void append_date(std::string& msg) const;
+    CHUCHO_NO_EXPORT std::string format_message(const letter& let);
     CHUCHO_NO_EXPORT void init();
+    CHUCHO_NO_EXPORT void send(const letter& let);
+    CHUCHO_NO_EXPORT void thread_main();
 
     fixed_size_queue evts_;
     std::unique_ptr<curl> curl_;
@@ -297,6 +365,19 @@ private:
     optional<std::string> user_;
     optional<std::string> password_;
     connection_type connection_type_;
+    std::unique_ptr<pattern_formatter> subject_formatter_;
+    std::string address_header_;
+    std::deque<letter> backlog_;
+    std::chrono::milliseconds coalesce_window_;
+    std::size_t max_backlog_;
+    std::size_t dropped_;
+    bool sending_;
+    unsigned flushing_;
+    bool stop_;
+    mutable std::mutex backlog_guard_;
+    std::condition_variable backlog_condition_;
+    std::condition_variable sent_condition_;
+    std::unique_ptr<std::thread> sender_;
 };
 
 inline std::size_t email_writer::get_buffer_capacity() const
@@ -309,6 +390,12 @@ inline std::size_t email_writer::get_buffer_size() const
     return evts_.size();
 }
 
+inline std::chrono::milliseconds email_writer::get_coalesce_window() const
+{
+    std::lock_guard<std::mutex> lock(backlog_guard_);
+    return coalesce_window_;
+}
+
 inline email_writer::connection_type email_writer::get_connection_type() const
 {
     return connection_type_;
@@ -324,6 +411,12 @@ inline const std::string& email_writer::get_host() const
     return host_;
 }
 
+inline std::size_t email_writer::get_max_backlog() const
+{
+    std::lock_guard<std::mutex> lock(backlog_guard_);
+    return max_backlog_;
+}
+
 inline const optional<std::string>& email_writer::get_password() const
 {
     return password_;
@@ -374,6 +467,11 @@ inline void email_writer::fixed_size_queue::pop()
     q_.pop();
 }
 
+inline std::queue<event>& email_writer::fixed_size_queue::queue()
+{
+    return q_;
+}
+
 inline std::size_t email_writer::fixed_size_queue::size() const
 {
     return q_.size();
@@ -33,10 +33,12 @@ public:
     email_writer_memento(configurator& cfg);
 
     const optional<std::size_t>& get_buffer_size() const;
+    const optional<std::chrono::milliseconds>& get_coalesce_window() const;
     const optional<email_writer::connection_type>& get_connection_type() const;
     std::unique_ptr<email_trigger> get_email_trigger();
     const std::string& get_from() const;
     const std::string& get_host() const;
+    const optional<std::size_t>& get_max_backlog() const;
     const std::string& get_password() const;
     const optional<std::uint16_t>& get_port() const;
     const std::string& get_subject() const;
@@ -60,6 +62,8 @@ private:
     optional<email_writer::connection_type> connection_type_;
     optional<std::size_t> buffer_size_;
     optional<bool> verbose_;
+    optional<std::chrono::milliseconds> coalesce_window_;
+    optional<std::size_t> max_backlog_;
 };
 
 inline const optional<std::size_t>& email_writer_memento::get_buffer_size() const
@@ -67,6 +71,11 @@ inline const optional<std::size_t>& email_writer_memento::get_buffer_size() cons
     return buffer_size_;
 }
 
+inline const optional<std::chrono::milliseconds>& email_writer_memento::get_coalesce_window() const
+{
+    return coalesce_window_;
+}
+
 inline const optional<email_writer::connection_type>& email_writer_memento::get_connection_type() const
 {
     return connection_type_;
@@ -87,6 +96,11 @@ inline const std::string& email_writer_memento::get_host() const
     return host_;
 }
 
+inline const optional<std::size_t>& email_writer_memento::get_max_backlog() const
+{
+    return max_backlog_;
+}
+
 inline const std::string& email_writer_memento::get_password() const
 {
     return password_;
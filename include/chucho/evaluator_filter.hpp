@@ -30,7 +30,7 @@ namespace chucho
  * that it can evaluate it with full knowledge. 
  *  
  * @ingroup filters 
- * @sa ruby_evaluator_filter 
+ * @sa expression_filter, ruby_evaluator_filter 
  */
 
 class evaluator_filter : public filter
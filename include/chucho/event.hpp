@@ -174,6 +174,8 @@ public:
 
 private:
     friend class event_cache;
+    friend class cache_and_release_filter;
+    friend class binary_file_reader;
 
     std::shared_ptr<logger> logger_;
     std::shared_ptr<level> level_;
@@ -183,7 +185,8 @@ private:
     unsigned line_number_;
     const char* function_name_;
     optional<marker> marker_;
-    // These below are used by the event_cache.
+    // These below are used by the event_cache, the
+    // cache_and_release_filter and the binary_file_reader.
     optional<std::string> thread_id_;
     optional<std::string> file_name_store_;
     optional<std::string> function_name_store_;
@@ -38,6 +38,7 @@
 #include <vector>
 #include <cstring>
 #include <condition_variable>
+#include <atomic>
 
 namespace chucho
 {
@@ -48,9 +49,11 @@ public:
     event_cache(std::size_t chunk_size, std::size_t max_size);
     virtual ~event_cache();
 
+    double get_fullness() const;
     event_cache_stats get_stats();
-    optional<event> pop(std::chrono::milliseconds to_wait);
-    void push(const event& evt);
+    // The tag is anything the owner needs to keep with the event
+    optional<event> pop(std::chrono::milliseconds to_wait, std::string* tag = nullptr);
+    void push(const event& evt, const std::string& tag = std::string());
     void set_progress_callback(event_cache_stats::progress_callback cb);
 
 private:
@@ -87,10 +90,12 @@ private:
     // <len> | Marker
     // 2 | Length of thread ID
     // <len> | Thread ID
+    // 2 | Length of tag
+    // <len> | Tag
     //
     // NOTE: guard_ must be locked on entry
-    std::size_t serialize(const event& evt);
-    std::size_t serialized_size(const event& evt, std::string& mrk_text, std::string& thr_text);
+    std::size_t serialize(const event& evt, const std::string& tag);
+    std::size_t serialized_size(const event& evt, const std::string& tag, std::string& mrk_text, std::string& thr_text);
     template <typename int_type>
     void set_ser_buf(std::size_t idx, int_type val)
     {
@@ -98,7 +103,7 @@ private:
     }
     void stop();
     // NOTE: guard_ must be locked on entry
-    event unserialize(std::size_t& sz);
+    event unserialize(std::size_t& sz, std::string* tag);
 
     std::string directory_;
     std::mutex guard_;
@@ -114,8 +119,15 @@ private:
     event_cache_stats stats_;
     std::size_t total_bytes_written_;
     double last_fullness_threshold_;
+    // A copy of current_size_ / max_size_ that can be read without the lock
+    std::atomic<double> fullness_;
 };
 
+inline double event_cache::get_fullness() const
+{
+    return fullness_.load(std::memory_order_relaxed);
+}
+
 inline std::string event_cache::get_mem_buf_str(std::size_t idx, std::size_t len)
 {
     return std::string(reinterpret_cast<char*>(read_pos_ + idx), len);
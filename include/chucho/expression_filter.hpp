@@ -0,0 +1,129 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_EXPRESSION_FILTER_HPP_)
+#define CHUCHO_EXPRESSION_FILTER_HPP_
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include <chucho/evaluator_filter.hpp>
+#include <functional>
+
+namespace chucho
+{
+
+/**
+ * @class expression_filter expression_filter.hpp chucho/expression_filter.hpp
+ * Filter by evaluating a simple expression over the fields of the
+ * @ref event. The expression is compiled once, when the filter is
+ * constructed, so evaluating an event neither parses text nor takes
+ * a lock. If the expression is true, then the result is
+ * @ref filter::result "result::NEUTRAL", otherwise it is
+ * @ref filter::result "result::DENY".
+ *
+ * The following fields may be referenced.
+ * <table>
+ *     <tr><th>Field</th><th>Type</th><th>Meaning</th></tr>
+ *     <tr><td>context("key")</td><td>text</td>
+ *         <td>The value of the key in the thread's
+ *         @ref diagnostic_context</td></tr>
+ *     <tr><td>file_name</td><td>text</td>
+ *         <td>The file name</td></tr>
+ *     <tr><td>function</td><td>text</td>
+ *         <td>The name of the function</td></tr>
+ *     <tr><td>level</td><td>level</td>
+ *         <td>The level, which is compared with a level name, like
+ *         warn</td></tr>
+ *     <tr><td>line_number</td><td>number</td>
+ *         <td>The line number</td></tr>
+ *     <tr><td>logger</td><td>text</td>
+ *         <td>The name of the logger</td></tr>
+ *     <tr><td>marker</td><td>text</td>
+ *         <td>The name of the marker</td></tr>
+ *     <tr><td>message</td><td>text</td>
+ *         <td>The unformatted message</td></tr>
+ * </table>
+ *
+ * Levels and numbers may be compared with ==, !=, <, <=, > and >=.
+ * Text may be compared with a quoted string using ==, !=, contains,
+ * starts_with, ends_with and matches, the last of which searches
+ * for a regular expression. A text field standing alone is true if
+ * it is present, which is useful for marker and context("key").
+ * Comparisons may be combined with &&, || and !, or their
+ * equivalents and, or and not, and grouped with parentheses. The
+ * literals true and false are also accepted. For example:
+ * @code
+ * level >= warn && (logger starts_with "net." || context("user") == "will")
+ * @endcode
+ *
+ * The text comparisons know nothing of the logger hierarchy, so
+ * <tt>logger starts_with "net"</tt> matches the logger network as
+ * well as net.http. To select a logger and its descendants, compare
+ * the logger itself with == and its descendants with starts_with,
+ * including the dot:
+ * @code
+ * logger == "net" || logger starts_with "net."
+ * @endcode
+ *
+ * @ingroup filters
+ * @sa ruby_evaluator_filter
+ */
+class CHUCHO_EXPORT expression_filter : public evaluator_filter
+{
+public:
+    /**
+     * @name Constructor
+     * @{
+     */
+    /**
+     * Construct a filter.
+     *
+     * @param name the name of this filter
+     * @param expression the expression
+     * @throw exception if the expression is invalid
+     */
+    expression_filter(const std::string& name,
+                      const std::string& expression);
+    /** @} */
+
+    virtual result evaluate(const event& evt) override;
+    /**
+     * Return the expression.
+     *
+     * @return the expression
+     */
+    const std::string& get_expression() const;
+
+private:
+    std::string expression_;
+    std::function<bool(const event&)> compiled_;
+};
+
+inline const std::string& expression_filter::get_expression() const
+{
+    return expression_;
+}
+
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif
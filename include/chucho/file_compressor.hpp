@@ -18,6 +18,7 @@
 #define CHUCHO_FILE_COMPRESSOR_HPP_
 
 #include <chucho/configurable.hpp>
+#include <functional>
 #include <string>
 
 namespace chucho
@@ -50,11 +51,22 @@ namespace chucho
  * my.log.3.gz 
  * @endcode 
  * 
+ * Large files can be compressed by more than one thread. Refer
+ * to @ref set_threads for how each compressor divides its work.
+ * The compressing threads can also be given a lower priority
+ * with @ref set_nice, so that they take less time away from the
+ * rest of the application.
+ * 
  * @ingroup fcompressors
  */
 class CHUCHO_EXPORT file_compressor : public configurable
 {
 public:
+    /**
+     * The most threads used by default to compress.
+     */
+    static constexpr unsigned DEFAULT_MAX_THREADS = 4;
+
     /**
      * @name Destructor
      */
@@ -81,6 +93,12 @@ public:
      * @return const char* the extension
      */
     const char* get_extension() const;
+    /**
+     * Return the niceness of the compressing threads.
+     *
+     * @return the niceness
+     */
+    int get_nice() const;
     /**
      * Return the minimum index at which to start compressing rolled 
      * files. The index here may have no relation to an index that 
@@ -103,6 +121,44 @@ public:
      * @return unsigned the minimum index
      */
     unsigned get_min_index() const;
+    /**
+     * Return the number of threads with which to compress.
+     *
+     * @return the number of threads, where zero means one per
+     *         hardware thread
+     */
+    unsigned get_threads() const;
+    /**
+     * Set the niceness of the threads that compress, in the sense
+     * of the Unix nice command. Positive values lower their
+     * priority. It is an adjustment to the priority of the
+     * roller's background thread that compresses rolled files,
+     * so the thread that rolls never waits at this niceness. If it
+     * is not zero, then compression happens on a separate thread
+     * even if only one thread is used. Raising the priority with negative values usually
+     * requires privileges, and if the priority cannot be changed,
+     * then the threads compress at normal priority.
+     *
+     * @note On POSIX systems other than Linux, niceness applies to
+     * the whole process, so this has no effect.
+     *
+     * @param nice the niceness
+     */
+    void set_nice(int nice);
+    /**
+     * Set the number of threads with which to compress. Gzip and
+     * bzip2 compressors split the file into blocks that are
+     * compressed independently and written as a concatenation of
+     * gzip members or bzip2 streams, which standard tools
+     * decompress as one file. The lzma compressor uses the
+     * multithreaded encoder of liblzma. The zip compressor always
+     * uses one thread. The default is one thread per hardware
+     * thread, but no more than @ref DEFAULT_MAX_THREADS.
+     *
+     * @param threads the number of threads, where zero means one
+     *        per hardware thread
+     */
+    void set_threads(unsigned threads);
 
 protected:
     /**
@@ -125,14 +181,31 @@ protected:
     file_compressor(unsigned min_idx, const char* extension);
     //@}
 
+    /**
+     * Run a function at this compressor's niceness. If the
+     * niceness is zero, then the function runs on the calling
+     * thread. Otherwise, it runs on a new thread and the calling
+     * thread waits for it. Exceptions thrown by the function are
+     * rethrown to the caller.
+     *
+     * @param fn the function
+     */
+    void run_at_nice(const std::function<void()>& fn) const;
+
 private:
+    static unsigned default_threads();
+
     const char* extension_;
     unsigned min_index_;
+    unsigned threads_;
+    int nice_;
 };
 
 inline file_compressor::file_compressor(unsigned min_idx, const  char* extension)
     : extension_(extension),
-      min_index_(min_idx)
+      min_index_(min_idx),
+      threads_(default_threads()),
+      nice_(0)
 {
 }
 
@@ -146,6 +219,26 @@ inline unsigned file_compressor::get_min_index() const
     return min_index_;
 }
 
+inline int file_compressor::get_nice() const
+{
+    return nice_;
+}
+
+inline unsigned file_compressor::get_threads() const
+{
+    return threads_;
+}
+
+inline void file_compressor::set_nice(int nice)
+{
+    nice_ = nice;
+}
+
+inline void file_compressor::set_threads(unsigned threads)
+{
+    threads_ = threads;
+}
+
 }
 
 #endif
@@ -18,6 +18,8 @@
 #define CHUCHO_FILE_COMPRESSOR_FACTORY_HPP_
 
 #include <chucho/configurable_factory.hpp>
+#include <chucho/file_compressor.hpp>
+#include <chucho/file_compressor_memento.hpp>
 
 namespace chucho
 {
@@ -55,6 +57,16 @@ public:
      * @return a @ref file_compressor_memento
      */
     virtual std::unique_ptr<memento> create_memento(configurator& cfg) override;
+
+protected:
+    /**
+     * Set the number of threads and niceness of a compressor from
+     * the memento, if they were given.
+     *
+     * @param cmp the compressor
+     * @param mnto the memento
+     */
+    void set_threads(file_compressor& cmp, const file_compressor_memento& mnto);
 };
 
 }
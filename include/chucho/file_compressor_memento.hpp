@@ -60,9 +60,25 @@ public:
      * @return the minimum index
      */
     const optional<unsigned>& get_min_index() const;
+    /**
+     * Return the niceness of the compressing threads that has been
+     * discovered during configuration time.
+     *
+     * @return the niceness
+     */
+    const optional<int>& get_nice() const;
+    /**
+     * Return the number of compressing threads that has been
+     * discovered during configuration time.
+     *
+     * @return the number of threads
+     */
+    const optional<unsigned>& get_threads() const;
 
 private:
     optional<unsigned> min_index_;
+    optional<int> nice_;
+    optional<unsigned> threads_;
 };
 
 inline const optional<unsigned>& file_compressor_memento::get_min_index() const
@@ -70,6 +86,16 @@ inline const optional<unsigned>& file_compressor_memento::get_min_index() const
     return min_index_;
 }
 
+inline const optional<int>& file_compressor_memento::get_nice() const
+{
+    return nice_;
+}
+
+inline const optional<unsigned>& file_compressor_memento::get_threads() const
+{
+    return threads_;
+}
+
 }
 
 #if defined(_MSC_VER)
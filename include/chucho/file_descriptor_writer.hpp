@@ -98,7 +98,7 @@ public:
     /**
      * Flush the buffer and close the file descriptor.
      */
-    void close();
+    virtual void close();
     /**
      * Whether this writer flushes the buffer after each event 
      * is written. 
@@ -137,6 +137,14 @@ protected:
      * @return the file descriptor
      */
     int get_file_descriptor() const;
+    #if defined(_WIN32) || defined(CHUCHO_DOXYGEN_SPECIAL)
+    /**
+     * Return the handle to which the writer writes.
+     *
+     * @return the handle
+     */
+    HANDLE get_file_handle() const;
+    #endif
     /**
      * Set whether the writer can allow the file descriptor to be
      * closed when the writer is destroyed.
@@ -169,6 +177,15 @@ protected:
      */
     void set_file_handle(HANDLE hnd);
     #endif
+    /**
+     * Add bytes to the buffer, flushing it whenever it fills.
+     * This does not flush the bytes that remain in the buffer,
+     * regardless of the flush setting.
+     *
+     * @param data the bytes
+     * @param len the number of bytes
+     */
+    void write_bytes(const char* data, std::size_t len);
     virtual void write_impl(const event& evt) override;
 
 private:
@@ -187,6 +204,13 @@ inline int file_descriptor_writer::get_file_descriptor() const
     return fd_;
 }
 
+#if defined(_WIN32)
+inline HANDLE file_descriptor_writer::get_file_handle() const
+{
+    return handle_;
+}
+#endif
+
 inline bool file_descriptor_writer::get_flush() const
 {
     return flush_;
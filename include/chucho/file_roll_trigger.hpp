@@ -20,6 +20,7 @@
 #include <chucho/event.hpp>
 #include <chucho/status_reporter.hpp>
 #include <chucho/configurable.hpp>
+#include <chucho/file_writer.hpp>
 
 namespace chucho
 {
@@ -55,8 +56,25 @@ public:
      * @return true if the file should be rolled now
      */
     virtual bool is_triggered(const std::string& active_file, const event& e) = 0;
+    /**
+     * Return whether now is a good time to roll a log file. This is
+     * the method that the writer calls. Triggers that need more than
+     * the file name can override it. By default, it returns the
+     * result of calling @ref is_triggered with the writer's file
+     * name.
+     *
+     * @param writer the writer that owns this trigger
+     * @param e the log event currently being written
+     * @return true if the file should be rolled now
+     */
+    virtual bool is_triggered(const file_writer& writer, const event& e);
 };
 
+inline bool file_roll_trigger::is_triggered(const file_writer& writer, const event& e)
+{
+    return is_triggered(writer.get_file_name(), e);
+}
+
 }
 
 #endif
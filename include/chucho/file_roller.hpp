@@ -26,7 +26,11 @@
 #include <chucho/configurable.hpp>
 #include <chucho/non_copyable.hpp>
 #include <chucho/file_compressor.hpp>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace chucho
 {
@@ -92,8 +96,27 @@ public:
      *                    roller
      */
     void set_file_writer(file_writer& file_writer);
+    /**
+     * Wait for the files handed off for compression to be
+     * compressed. When a roller compresses a file, it does so on a
+     * background thread, so that the thread that rolls, which is
+     * normally one that is logging, does not wait for it. Each roll
+     * waits for the compression started by the previous one before
+     * it renames or removes any files, and so does destroying the
+     * roller.
+     */
+    void wait_for_compression();
 
 protected:
+    /**
+     * Hand a file to the background thread to be compressed with
+     * the @ref file_compressor. Errors are reported, since there is
+     * nobody to catch them.
+     *
+     * @param file_name the file to compress
+     */
+    void compress(const std::string& file_name);
+
     /**
      * The file writer that owns this roller.
      *  
@@ -109,6 +132,16 @@ protected:
      * one. 
      */
     std::unique_ptr<file_compressor> compressor_;
+
+private:
+    CHUCHO_NO_EXPORT void compress_main();
+
+    std::deque<std::string> to_compress_;
+    bool compressing_;
+    bool stop_;
+    std::mutex compress_guard_;
+    std::condition_variable compress_condition_;
+    std::unique_ptr<std::thread> compress_thread_;
 };
 
 inline file_compressor* file_roller::get_file_compressor() const
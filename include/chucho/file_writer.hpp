@@ -23,8 +23,13 @@
 #endif
 
 #include <chucho/file_descriptor_writer.hpp>
+#include <chucho/level.hpp>
+#include <chucho/stream_compressor.hpp>
 #include <string>
 #include <chrono>
+#include <condition_variable>
+#include <thread>
+#include <vector>
 
 namespace chucho
 {
@@ -33,6 +38,31 @@ namespace chucho
  * @class file_writer file_writer.hpp chucho/file_writer.hpp
  * A @ref writer that writes to a file. 
  *  
+ * By default, written events are handed to the operating system,
+ * which decides when they reach the disk. A durability policy
+ * can be set with @ref set_durability to have the file synced
+ * to the disk periodically, after important events, or after
+ * every event with concurrent writers sharing the syncs. Only
+ * the file's data is synced, using fdatasync where it is
+ * available.
+ *
+ * The file can also be written as a compressed stream by setting
+ * a @ref stream_compressor with @ref set_stream_compressor. Each
+ * event is compressed as it is written, so the file does not have
+ * to be compressed again after it is closed. Syncing the compressor
+ * makes everything compressed so far readable by tools like
+ * <tt>zcat</tt>, but each sync also ends the compressor's current
+ * block, which costs compression. So a writer that flushes after
+ * each event only syncs its compressor once enough bytes have been
+ * written or enough time has passed since the last sync, as set
+ * with @ref set_compressed_sync. Lower thresholds lose less on a
+ * crash, since whatever is still in the compressor is lost, and
+ * higher ones compress better. Thresholds of zero sync after every
+ * event. The time is only checked when an event is written, but
+ * events at the sync level of the @ref durability::LEVEL and @ref
+ * durability::GROUP_COMMIT policies always sync the compressor.
+ * Closing the file ends the compressed stream.
+ *
  * @ingroup writers
  */
 class CHUCHO_EXPORT file_writer : public file_descriptor_writer
@@ -53,6 +83,71 @@ public:
         TRUNCATE
     };
 
+    /**
+     * When written events are synced to the disk.
+     */
+    enum class durability
+    {
+        /**
+         * The writer never syncs. The operating system decides when
+         * events reach the disk.
+         */
+        NONE,
+        /**
+         * A background thread syncs the file periodically if
+         * anything has been written since the last sync. If the
+         * writer does not flush after each event, then only the
+         * events that have left the writer's buffer are synced.
+         */
+        INTERVAL,
+        /**
+         * The file is synced after each event whose level is at
+         * least the sync level, by the thread that wrote it.
+         */
+        LEVEL,
+        /**
+         * Each thread that writes an event whose level is at least
+         * the sync level waits until a background thread has synced
+         * it. Threads that are waiting at the same time share a
+         * single sync. If there is no sync level, then all events
+         * wait.
+         */
+        GROUP_COMMIT
+    };
+
+    /**
+     * How long syncing has taken.
+     */
+    struct sync_latency
+    {
+        /**
+         * The number of syncs.
+         */
+        std::size_t count = 0;
+        /**
+         * The duration of the most recent sync.
+         */
+        std::chrono::microseconds last = std::chrono::microseconds(0);
+        /**
+         * The duration of the longest sync.
+         */
+        std::chrono::microseconds max = std::chrono::microseconds(0);
+        /**
+         * The sum of the durations of all syncs.
+         */
+        std::chrono::microseconds total = std::chrono::microseconds(0);
+    };
+
+    /**
+     * The default number of bytes, before compression, after which
+     * the stream compressor is synced.
+     */
+    static constexpr std::size_t DEFAULT_COMPRESSED_SYNC_BYTES = 64 * 1024;
+    /**
+     * The default time after which the stream compressor is synced.
+     */
+    static constexpr std::chrono::milliseconds DEFAULT_COMPRESSED_SYNC_INTERVAL = std::chrono::milliseconds(1000);
+
     /**
      * @name Constructor
      */
@@ -74,8 +169,37 @@ public:
                 const std::string& file_name,
                 on_start start = on_start::APPEND,
                 bool flsh = true);
+    /**
+     * Destroy the writer, stopping any background syncing after a
+     * final sync.
+     */
+    ~file_writer();
     //@}
 
+    /**
+     * End the compressed stream, if there is one, and close the
+     * file.
+     */
+    virtual void close() override;
+    /**
+     * Return the number of bytes, before compression, after which
+     * the stream compressor is synced.
+     *
+     * @return the byte threshold
+     */
+    std::size_t get_compressed_sync_bytes() const;
+    /**
+     * Return the time after which the stream compressor is synced.
+     *
+     * @return the time threshold
+     */
+    std::chrono::milliseconds get_compressed_sync_interval() const;
+    /**
+     * Return the durability policy.
+     *
+     * @return the durability
+     */
+    durability get_durability() const;
     /**
      * Return the name of this file.
      * 
@@ -100,6 +224,73 @@ public:
      * @return the on_start value
      */
     on_start get_on_start() const;
+    /**
+     * Return the interval of the @ref durability::INTERVAL policy.
+     *
+     * @return the interval
+     */
+    std::chrono::milliseconds get_sync_interval() const;
+    /**
+     * Return how long syncing has taken so far.
+     *
+     * @return the latency
+     */
+    sync_latency get_sync_latency();
+    /**
+     * Return the level at or above which events are synced in the
+     * @ref durability::LEVEL and @ref durability::GROUP_COMMIT
+     * policies.
+     *
+     * @return the level, which may be uninitialized
+     */
+    std::shared_ptr<level> get_sync_level() const;
+    /**
+     * Return the stream compressor.
+     *
+     * @return the compressor, which may be null
+     */
+    stream_compressor* get_stream_compressor() const;
+    /**
+     * Return the number of bytes that have been written to the
+     * current file since it was opened, before they were
+     * compressed.
+     *
+     * @return the uncompressed size
+     */
+    std::uintmax_t get_uncompressed_size() const;
+    /**
+     * Set when a writer that flushes after each event syncs its
+     * stream compressor. The compressor is synced when either
+     * threshold is reached, so a threshold of zero syncs after
+     * every event.
+     *
+     * @param bytes the number of bytes, before compression, written
+     *        since the last sync
+     * @param intvl the time since the last sync
+     */
+    void set_compressed_sync(std::size_t bytes, std::chrono::milliseconds intvl);
+    /**
+     * Set the durability policy. This should be called before any
+     * events are written.
+     *
+     * @param dur the durability
+     * @param intvl the interval, which is required for @ref
+     *        durability::INTERVAL
+     * @param lvl the level, which is required for @ref
+     *        durability::LEVEL
+     * @throw std::invalid_argument if the interval or level is
+     *        missing
+     */
+    void set_durability(durability dur,
+                        std::chrono::milliseconds intvl = std::chrono::milliseconds(0),
+                        std::shared_ptr<level> lvl = std::shared_ptr<level>());
+    /**
+     * Set the compressor with which the file is written. This
+     * should be called before any events are written.
+     *
+     * @param cmp the compressor
+     */
+    void set_stream_compressor(std::unique_ptr<stream_compressor>&& cmp);
 
 protected:
     /**
@@ -132,12 +323,24 @@ protected:
      * open it.
      */
     void ensure_access();
+    /**
+     * Flush the buffer, first syncing the stream compressor if
+     * there is one.
+     */
+    virtual void flush() override;
     /**
      * Return whether the file is open for business.
      * 
      * @return whether we have opened the file
      */
     bool is_open() const;
+    /**
+     * Called each time a file has been opened, including when
+     * a file that was removed is created anew. Writers whose
+     * files begin with a header write it here. By default, it
+     * does nothing.
+     */
+    virtual void opened();
     /**
      * Open a file of a new name.
      * 
@@ -152,10 +355,31 @@ protected:
      * @param allow whether to allow creation or not
      */
     void set_allow_creation(bool allow);
+    /**
+     * Prepare an event that has just been written to be synced,
+     * according to the durability policy. Writers that do not
+     * write through @ref file_writer::write_impl call this after
+     * writing each event.
+     *
+     * @param evt the event
+     */
+    void sync_written(const event& evt);
     virtual void write_impl(const event& evt) override;
+    virtual void written(const event& evt) override;
 
 private:
+    // NOTE: handle_guard_ must be locked on entry
+    CHUCHO_NO_EXPORT void close_sync_handle();
+    // NOTE: handle_guard_ must be locked on entry
+    CHUCHO_NO_EXPORT void duplicate_sync_handle();
+    CHUCHO_NO_EXPORT bool is_sync_level(const event& evt) const;
     void open_impl(const std::string& file_name);
+    CHUCHO_NO_EXPORT void sync(std::size_t target);
+    // NOTE: handle_guard_ must be locked on entry
+    CHUCHO_NO_EXPORT void sync_handle();
+    CHUCHO_NO_EXPORT void stop_sync_thread();
+    CHUCHO_NO_EXPORT void thread_main();
+    CHUCHO_NO_EXPORT void write_compressed();
 
     std::string initial_file_name_;
     std::string file_name_;
@@ -165,8 +389,56 @@ private:
     bool is_open_;
     bool has_been_opened_;
     bool allow_creation_;
+    durability durability_;
+    std::chrono::milliseconds sync_interval_;
+    std::shared_ptr<level> sync_level_;
+    // The file's descriptor is duplicated so that it can be synced
+    // without holding the writer's lock
+    #if defined(_WIN32)
+    HANDLE sync_handle_;
+    #else
+    int sync_handle_;
+    #endif
+    std::mutex handle_guard_;
+    // Events counted as they are written, or requested to be synced,
+    // and the count that has been synced
+    std::size_t written_;
+    std::size_t requested_;
+    std::size_t synced_;
+    sync_latency latency_;
+    bool stop_;
+    std::mutex sync_guard_;
+    std::condition_variable sync_condition_;
+    std::condition_variable synced_condition_;
+    std::unique_ptr<std::thread> sync_thread_;
+    std::unique_ptr<stream_compressor> stream_compressor_;
+    std::vector<std::uint8_t> compressed_;
+    std::uintmax_t uncompressed_size_;
+    std::size_t compressed_sync_bytes_;
+    std::chrono::milliseconds compressed_sync_interval_;
+    // What has been compressed since the compressor was last synced
+    std::size_t unsynced_size_;
+    std::chrono::steady_clock::time_point last_compressed_sync_;
+    // Set while compressed bytes are being written, because a full
+    // buffer is flushed without syncing the compressor
+    bool writing_compressed_;
 };
 
+inline std::size_t file_writer::get_compressed_sync_bytes() const
+{
+    return compressed_sync_bytes_;
+}
+
+inline std::chrono::milliseconds file_writer::get_compressed_sync_interval() const
+{
+    return compressed_sync_interval_;
+}
+
+inline file_writer::durability file_writer::get_durability() const
+{
+    return durability_;
+}
+
 inline const std::string& file_writer::get_file_name() const
 {
     return file_name_;
@@ -182,6 +454,26 @@ inline file_writer::on_start file_writer::get_on_start() const
     return start_;
 }
 
+inline std::chrono::milliseconds file_writer::get_sync_interval() const
+{
+    return sync_interval_;
+}
+
+inline std::shared_ptr<level> file_writer::get_sync_level() const
+{
+    return sync_level_;
+}
+
+inline stream_compressor* file_writer::get_stream_compressor() const
+{
+    return stream_compressor_.get();
+}
+
+inline std::uintmax_t file_writer::get_uncompressed_size() const
+{
+    return uncompressed_size_;
+}
+
 inline bool file_writer::is_open() const
 {
     return is_open_;
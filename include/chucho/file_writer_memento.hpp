@@ -34,18 +34,47 @@ class file_writer_memento : public writer_memento
 public:
     file_writer_memento(configurator& cfg, memento_key_set ks);
 
+    const optional<std::size_t>& get_compressed_sync_bytes() const;
+    const optional<std::chrono::milliseconds>& get_compressed_sync_interval() const;
+    const optional<file_writer::durability>& get_durability() const;
     const std::string& get_file_name() const;
     const optional<bool>& get_flush() const;
     const optional<file_writer::on_start>& get_on_start() const;
+    const optional<std::chrono::milliseconds>& get_sync_interval() const;
+    std::unique_ptr<stream_compressor> get_stream_compressor();
+    std::shared_ptr<level> get_sync_level() const;
+    virtual void handle(std::unique_ptr<configurable>&& cnf) override;
 
 private:
+    void set_durability(const std::string& value);
     void set_on_start(const std::string& value);
 
     std::string file_name_;
     optional<file_writer::on_start> start_;
     optional<bool> flush_;
+    optional<file_writer::durability> durability_;
+    optional<std::chrono::milliseconds> sync_interval_;
+    std::shared_ptr<level> sync_level_;
+    std::unique_ptr<stream_compressor> stream_compressor_;
+    optional<std::size_t> compressed_sync_bytes_;
+    optional<std::chrono::milliseconds> compressed_sync_interval_;
 };
 
+inline const optional<std::size_t>& file_writer_memento::get_compressed_sync_bytes() const
+{
+    return compressed_sync_bytes_;
+}
+
+inline const optional<std::chrono::milliseconds>& file_writer_memento::get_compressed_sync_interval() const
+{
+    return compressed_sync_interval_;
+}
+
+inline const optional<file_writer::durability>& file_writer_memento::get_durability() const
+{
+    return durability_;
+}
+
 inline const std::string& file_writer_memento::get_file_name() const
 {
     return file_name_;
@@ -61,6 +90,21 @@ inline const optional<file_writer::on_start>& file_writer_memento::get_on_start(
     return start_;
 }
 
+inline const optional<std::chrono::milliseconds>& file_writer_memento::get_sync_interval() const
+{
+    return sync_interval_;
+}
+
+inline std::unique_ptr<stream_compressor> file_writer_memento::get_stream_compressor()
+{
+    return std::move(stream_compressor_);
+}
+
+inline std::shared_ptr<level> file_writer_memento::get_sync_level() const
+{
+    return sync_level_;
+}
+
 }
 
 #endif
@@ -18,6 +18,7 @@
 #define CHUCHO_FILTER_MEMENTO_HPP_
 
 #include <chucho/nameable_memento.hpp>
+#include <chucho/filter.hpp>
 
 namespace chucho
 {
@@ -43,6 +44,17 @@ public:
      */
     filter_memento(configurator& cfg);
     //@}
+
+protected:
+    /**
+     * Convert text to a filter result. The text is not case
+     * sensitive.
+     *
+     * @param text the text, which is deny, neutral or accept
+     * @return the result
+     * @throw exception if the text does not describe a result
+     */
+    filter::result text_to_result(const std::string& text) const;
 };
 
 }
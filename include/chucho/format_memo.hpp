@@ -0,0 +1,80 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_FORMAT_MEMO_HPP_)
+#define CHUCHO_FORMAT_MEMO_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/export.h>
+#include <string>
+
+namespace chucho
+{
+
+class event;
+
+/**
+ * Remember the text that formatters produce for the event that
+ * is currently being written by a logger on this thread. Formatters
+ * that would produce identical text, because they have the same
+ * configuration, render the event once and later ones reuse it.
+ */
+class CHUCHO_PRIV_EXPORT format_memo
+{
+public:
+    /**
+     * While a scope is alive, text can be remembered for its event.
+     * Only the outermost scope on a thread does anything, so the
+     * recursion through a logger's ancestors shares one memo.
+     */
+    class CHUCHO_PRIV_EXPORT scope
+    {
+    public:
+        scope(const event& evt);
+        scope(const scope&) = delete;
+        ~scope();
+
+        scope& operator= (const scope&) = delete;
+
+    private:
+        bool outer_;
+    };
+
+    /**
+     * Find text remembered for an event.
+     *
+     * @param evt the event
+     * @param key the canonical configuration of the formatter
+     * @return the text, or nullptr if there is none
+     */
+    static const std::string* find(const event& evt, const std::string& key);
+    /**
+     * Remember text for an event. Nothing is remembered unless the
+     * event belongs to the current scope.
+     *
+     * @param evt the event
+     * @param key the canonical configuration of the formatter
+     * @param text the formatted text
+     */
+    static void remember(const event& evt, const std::string& key, const std::string& text);
+};
+
+}
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_GZIP_STREAM_COMPRESSOR_HPP_)
+#define CHUCHO_GZIP_STREAM_COMPRESSOR_HPP_
+
+#include <chucho/stream_compressor.hpp>
+#include <zlib.h>
+
+namespace chucho
+{
+
+/**
+ * @class gzip_stream_compressor gzip_stream_compressor.hpp chucho/gzip_stream_compressor.hpp
+ * A stream compressor that writes the gzip format using zlib.
+ *
+ * Each call to @ref sync ends the current deflate block on a
+ * byte boundary, so everything written up to that point can be
+ * read with tools like <tt>zcat</tt> while the stream is still
+ * open. Each call to @ref finish writes a complete gzip member.
+ * A file made of several members is still a valid gzip file.
+ *
+ * @ingroup compressors
+ */
+class CHUCHO_EXPORT gzip_stream_compressor : public stream_compressor
+{
+public:
+    /**
+     * @name Constructor and Destructor
+     * @{
+     */
+    /**
+     * Construct a gzip stream compressor with the given compression
+     * level.
+     *
+     * @param compression_level the level, which can be [0, 9]
+     * @throw std::invalid_argument if the compression level is out
+     *        of range
+     */
+    gzip_stream_compressor(int compression_level = Z_DEFAULT_COMPRESSION);
+    /**
+     * Destroy the compressor.
+     */
+    ~gzip_stream_compressor();
+    /**
+     * @}
+     */
+
+    virtual void compress(const char* data, std::size_t len, std::vector<std::uint8_t>& out) override;
+    virtual void finish(std::vector<std::uint8_t>& out) override;
+    /**
+     * Return the compression level.
+     *
+     * @return the level
+     */
+    int get_compression_level() const;
+    virtual void sync(std::vector<std::uint8_t>& out) override;
+
+private:
+    CHUCHO_NO_EXPORT void deflate_to(int flush, std::vector<std::uint8_t>& out);
+
+    z_stream z_;
+    int compression_level_;
+    bool in_member_;
+    bool unsynced_;
+};
+
+inline int gzip_stream_compressor::get_compression_level() const
+{
+    return compression_level_;
+}
+
+}
+
+#endif
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_HTTP_BULK_SENDER_HPP_)
+#define CHUCHO_HTTP_BULK_SENDER_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/cloud_writer.hpp>
+#include <chucho/event_cache.hpp>
+#include <chucho/curl.hpp>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <thread>
+
+namespace chucho
+{
+
+// Takes events from the logging thread through an event_cache and
+// posts them, newline-delimited, in batches from a background thread.
+// The transfers are driven by a curl multi handle, so connections are
+// kept alive between batches and more than one batch can be in flight.
+class CHUCHO_PRIV_EXPORT http_bulk_sender : public status_reporter
+{
+public:
+    // Throws an exception if the body of a successful response
+    // reports a failure
+    typedef std::function<void(const std::string&)> response_checker;
+    // Called by the sending thread whenever it wakes up
+    typedef std::function<void()> thread_configurer;
+
+    http_bulk_sender(const std::string& origin,
+                     const std::string& url,
+                     std::vector<std::string>&& headers,
+                     formatter& fmt,
+                     const cloud_writer::bulk_settings& settings,
+                     response_checker chk,
+                     thread_configurer cfg = thread_configurer());
+    ~http_bulk_sender();
+
+    void flush();
+    event_cache_stats get_cache_stats();
+    const cloud_writer::bulk_settings& get_settings() const;
+    bool get_verbose() const;
+    void push(const event& evt);
+    void set_verbose(bool state);
+
+private:
+    struct batch
+    {
+        std::string body;
+        std::size_t events = 0;
+        unsigned attempts = 0;
+        std::chrono::steady_clock::time_point not_before;
+    };
+
+    struct transfer
+    {
+        std::unique_ptr<curl> handle;
+        batch bat;
+        std::string response;
+        bool busy = false;
+    };
+
+    void complete_transfers();
+    void seal();
+    void start_transfers();
+    void thread_main();
+
+    std::string url_;
+    std::vector<std::string> headers_;
+    formatter& formatter_;
+    cloud_writer::bulk_settings settings_;
+    response_checker checker_;
+    thread_configurer configurer_;
+    event_cache cache_;
+    CURLM* multi_;
+    std::vector<transfer> transfers_;
+    std::size_t busy_;
+    std::deque<batch> ready_;
+    batch filling_;
+    std::chrono::steady_clock::time_point filling_started_;
+    std::atomic<bool> verbose_;
+    std::atomic<bool> stop_;
+    std::atomic<std::uint64_t> flush_requested_;
+    std::uint64_t flush_completed_;
+    std::mutex flush_guard_;
+    std::condition_variable flushed_;
+    std::unique_ptr<std::thread> worker_;
+};
+
+inline event_cache_stats http_bulk_sender::get_cache_stats()
+{
+    return cache_.get_stats();
+}
+
+inline const cloud_writer::bulk_settings& http_bulk_sender::get_settings() const
+{
+    return settings_;
+}
+
+inline bool http_bulk_sender::get_verbose() const
+{
+    return verbose_;
+}
+
+inline void http_bulk_sender::push(const event& evt)
+{
+    cache_.push(evt);
+}
+
+}
+
+#endif
@@ -0,0 +1,335 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_IO_URING_FILE_WRITER_HPP_)
+#define CHUCHO_IO_URING_FILE_WRITER_HPP_
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include <chucho/file_writer.hpp>
+#include <chucho/file_roller.hpp>
+#include <chucho/file_roll_trigger.hpp>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace chucho
+{
+
+class uring;
+
+/**
+ * @class io_uring_file_writer io_uring_file_writer.hpp chucho/io_uring_file_writer.hpp
+ * A @ref writer that writes to a file through a Linux io_uring, so
+ * that the thread that logs does not wait for the disk.
+ *
+ * Formatted events are copied into one of a small set of buffers
+ * that are registered with the ring. When a buffer is full, or after
+ * each event if flushing is enabled, the buffer is submitted to the
+ * ring and writing continues in another one. Buffers are recycled as
+ * the kernel reports that their writes have completed. The thread
+ * that logs only waits if every buffer is still being written, which
+ * happens when the disk cannot keep up. Each write carries its own
+ * position in the file, so the order in which the writes complete
+ * does not matter.
+ *
+ * The file can also be synchronized at an interval. A background
+ * thread wakes at each interval and, if anything has been written
+ * since the last sync, submits the buffer being filled along with an
+ * fdatasync, or an fsync if a full sync is requested, that runs
+ * behind all of the writes that came before it. A writer that goes
+ * quiet therefore still has its last writes synchronized. No thread
+ * that logs waits for the sync.
+ *
+ * If the writer is given a @ref file_roller, then files are rolled
+ * just as they are by @ref rolling_file_writer. Before a file is
+ * rolled, all of its writes are allowed to complete, since the roller
+ * may compress it. Because the file's size on disk lags behind what
+ * has been submitted, a @ref size_file_roll_trigger lets the file
+ * grow a little past its maximum size.
+ *
+ * If the ring cannot be created, as happens when io_uring has been
+ * disabled in the kernel, then a warning is reported and the writer
+ * behaves like a @ref file_writer.
+ *
+ * @ingroup writers
+ * @ingroup rolling
+ */
+class CHUCHO_EXPORT io_uring_file_writer : public file_writer
+{
+public:
+    /**
+     * The kind of synchronization to perform.
+     */
+    enum class sync
+    {
+        /**
+         * Synchronize the data with fdatasync.
+         */
+        DATA,
+        /**
+         * Synchronize the data and all metadata with fsync.
+         */
+        FULL
+    };
+
+    /**
+     * The default number of buffers.
+     */
+    static constexpr std::size_t DEFAULT_BUFFER_COUNT = 8;
+    /**
+     * The default size of each buffer.
+     */
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+    /**
+     * @name Constructors and Destructor
+     */
+    //@{
+    /**
+     * Construct an io_uring_file_writer.
+     *
+     * @param name the name of this writer
+     * @param fmt the formatter
+     * @param file_name the name of the file
+     * @param start action to take at the start
+     * @param flsh whether to submit a write after each event
+     * @param buffer_count the number of buffers
+     * @param buffer_size the size of each buffer
+     * @throw std::invalid_argument if fmt is an uninitialized
+     *        std::unique_ptr
+     * @throw std::invalid_argument if buffer_count or buffer_size
+     *        is zero
+     */
+    io_uring_file_writer(const std::string& name,
+                         std::unique_ptr<formatter>&& fmt,
+                         const std::string& file_name,
+                         on_start start = on_start::APPEND,
+                         bool flsh = true,
+                         std::size_t buffer_count = DEFAULT_BUFFER_COUNT,
+                         std::size_t buffer_size = DEFAULT_BUFFER_SIZE);
+    /**
+     * Construct an io_uring_file_writer that rolls its files.
+     *
+     * @param name the name of this writer
+     * @param fmt the formatter
+     * @param file_name the active file name, which if empty is
+     *        taken from the roller
+     * @param roller the roller
+     * @param trigger the optional trigger
+     * @param start action to take at the start
+     * @param flsh whether to submit a write after each event
+     * @param buffer_count the number of buffers
+     * @param buffer_size the size of each buffer
+     * @throw std::invalid_argument if fmt is an uninitialized
+     *        std::unique_ptr
+     * @throw std::invalid_argument if buffer_count or buffer_size
+     *        is zero
+     * @throw std::invalid_argument if the roller is an
+     *        uninitialized std::unique_ptr
+     * @throw std::invalid_argument if the trigger cannot be
+     *        resolved
+     * @throw std::invalid_argument if the file name is empty and
+     *        the roller does not provide one
+     */
+    io_uring_file_writer(const std::string& name,
+                         std::unique_ptr<formatter>&& fmt,
+                         const std::string& file_name,
+                         std::unique_ptr<file_roller>&& roller,
+                         std::unique_ptr<file_roll_trigger>&& trigger = std::unique_ptr<file_roll_trigger>(),
+                         on_start start = on_start::APPEND,
+                         bool flsh = true,
+                         std::size_t buffer_count = DEFAULT_BUFFER_COUNT,
+                         std::size_t buffer_size = DEFAULT_BUFFER_SIZE);
+    /**
+     * Wait for all writes to complete and close the file.
+     */
+    ~io_uring_file_writer();
+    //@}
+
+    /**
+     * Wait for all writes to complete and close the file.
+     */
+    virtual void close() override;
+    /**
+     * Return the number of buffers.
+     *
+     * @return the buffer count
+     */
+    std::size_t get_buffer_count() const;
+    /**
+     * Return the size of each buffer.
+     *
+     * @return the buffer size
+     */
+    std::size_t get_buffer_size() const;
+    /**
+     * Return the roller.
+     *
+     * @return the roller, which is nullptr if files are not rolled
+     */
+    file_roller* get_file_roller() const;
+    /**
+     * Return the trigger.
+     *
+     * @return the trigger, which is nullptr if files are not rolled
+     */
+    file_roll_trigger* get_file_roll_trigger() const;
+    /**
+     * Return the synchronization interval.
+     *
+     * @return the interval, which is zero if the file is not
+     *         synchronized
+     */
+    std::chrono::milliseconds get_sync_interval() const;
+    /**
+     * Return the kind of synchronization.
+     *
+     * @return the kind of synchronization
+     */
+    sync get_sync_kind() const;
+    /**
+     * Return the number of synchronizations that have completed.
+     *
+     * @return the sync count
+     */
+    std::size_t get_sync_count();
+    /**
+     * Return whether the writer is using an io_uring. If it is not,
+     * then the ring could not be created and the writer is behaving
+     * like a @ref file_writer.
+     *
+     * @return true if an io_uring is in use
+     */
+    bool is_using_ring() const;
+    /**
+     * Synchronize the file at an interval from a background thread.
+     * This is not safe to call while other threads are writing. If
+     * the writer is not using an io_uring, then this has no effect
+     * other than to record the interval.
+     *
+     * @param intvl the interval, which if zero turns off
+     *        synchronization
+     * @param kind the kind of synchronization
+     */
+    void set_sync_interval(std::chrono::milliseconds intvl, sync kind = sync::DATA);
+
+protected:
+    /**
+     * Submit the current buffer and wait for all writes to complete.
+     */
+    virtual void flush() override;
+    virtual void opened() override;
+    virtual void write_impl(const event& evt) override;
+
+private:
+    struct CHUCHO_NO_EXPORT pending
+    {
+        std::size_t length;
+        std::size_t done;
+        std::uint64_t offset;
+        // The file the write belongs to, even if another is opened
+        int fd;
+    };
+
+    CHUCHO_NO_EXPORT std::size_t acquire();
+    CHUCHO_NO_EXPORT void init();
+    CHUCHO_NO_EXPORT void reap();
+    CHUCHO_NO_EXPORT void stop_syncer();
+    CHUCHO_NO_EXPORT void submit_current();
+    CHUCHO_NO_EXPORT void submit_sync();
+    CHUCHO_NO_EXPORT void submit_write(std::size_t idx);
+    CHUCHO_NO_EXPORT void syncer_main();
+    CHUCHO_NO_EXPORT void wait_for_all();
+    CHUCHO_NO_EXPORT void write_formatted(const std::string& text);
+
+    std::unique_ptr<file_roller> roller_;
+    std::unique_ptr<file_roll_trigger> trigger_;
+    file_roll_trigger* effective_trigger_;
+    std::unique_ptr<uring> ring_;
+    bool fixed_;
+    std::size_t buffer_count_;
+    std::size_t buffer_size_;
+    std::unique_ptr<char[]> storage_;
+    std::vector<pending> pending_;
+    std::vector<std::size_t> free_;
+    // The buffer being filled, which is buffer_count_ if there is none
+    std::size_t current_;
+    std::size_t used_;
+    // The file that offset_ belongs to
+    int fd_;
+    std::uint64_t offset_;
+    unsigned in_flight_;
+    std::chrono::milliseconds sync_interval_;
+    sync sync_kind_;
+    // The ring is shared by the thread that logs and the syncer, so
+    // everything that touches it does so with this held
+    std::mutex ring_guard_;
+    std::unique_ptr<std::thread> syncer_;
+    std::condition_variable syncer_condition_;
+    bool stop_syncing_;
+    // Something has been written since the last sync was submitted
+    bool unsynced_;
+    // A sync has been submitted and has not completed
+    bool syncing_;
+    std::size_t syncs_;
+};
+
+inline std::size_t io_uring_file_writer::get_buffer_count() const
+{
+    return buffer_count_;
+}
+
+inline std::size_t io_uring_file_writer::get_buffer_size() const
+{
+    return buffer_size_;
+}
+
+inline file_roller* io_uring_file_writer::get_file_roller() const
+{
+    return roller_.get();
+}
+
+inline file_roll_trigger* io_uring_file_writer::get_file_roll_trigger() const
+{
+    return effective_trigger_;
+}
+
+inline std::chrono::milliseconds io_uring_file_writer::get_sync_interval() const
+{
+    return sync_interval_;
+}
+
+inline io_uring_file_writer::sync io_uring_file_writer::get_sync_kind() const
+{
+    return sync_kind_;
+}
+
+inline bool io_uring_file_writer::is_using_ring() const
+{
+    return static_cast<bool>(ring_);
+}
+
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif
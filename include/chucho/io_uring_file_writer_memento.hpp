@@ -0,0 +1,71 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_IO_URING_FILE_WRITER_MEMENTO_HPP_)
+#define CHUCHO_IO_URING_FILE_WRITER_MEMENTO_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/rolling_file_writer_memento.hpp>
+#include <chucho/io_uring_file_writer.hpp>
+
+namespace chucho
+{
+
+class io_uring_file_writer_memento : public rolling_file_writer_memento
+{
+public:
+    io_uring_file_writer_memento(configurator& cfg);
+
+    const optional<std::size_t>& get_buffer_count() const;
+    const optional<std::size_t>& get_buffer_size() const;
+    const optional<std::chrono::milliseconds>& get_sync_interval() const;
+    const optional<io_uring_file_writer::sync>& get_sync_kind() const;
+
+private:
+    void set_sync_kind(const std::string& value);
+
+    optional<std::size_t> buffer_count_;
+    optional<std::size_t> buffer_size_;
+    optional<std::chrono::milliseconds> sync_interval_;
+    optional<io_uring_file_writer::sync> sync_kind_;
+};
+
+inline const optional<std::size_t>& io_uring_file_writer_memento::get_buffer_count() const
+{
+    return buffer_count_;
+}
+
+inline const optional<std::size_t>& io_uring_file_writer_memento::get_buffer_size() const
+{
+    return buffer_size_;
+}
+
+inline const optional<std::chrono::milliseconds>& io_uring_file_writer_memento::get_sync_interval() const
+{
+    return sync_interval_;
+}
+
+inline const optional<io_uring_file_writer::sync>& io_uring_file_writer_memento::get_sync_kind() const
+{
+    return sync_kind_;
+}
+
+}
+
+#endif
@@ -19,11 +19,15 @@
 
 #include <chucho/message_queue_writer.hpp>
 #include <librdkafka/rdkafka.h>
+#include <chrono>
+#include <mutex>
 #include <thread>
 
 namespace chucho
 {
 
+class event_cache;
+
 /**
  * @class kafka_writer kafka_writer.hpp chucho/kafka_writer.hpp
  * Write to a Kafka server. The configuration must that one created
@@ -31,11 +35,105 @@ namespace chucho
  * instantiation, the configuraiton may be set using a map of
  * @c kafka_configuration keys and values.
  *
+ * Serialized messages are handed to @c librdkafka without being
+ * copied, and they are released when their delivery is reported.
+ * Messages are collected and passed to @c rd_kafka_produce_batch
+ * when @ref delivery_settings::batch_size are ready, when a partial
+ * batch has waited for @ref delivery_settings::linger, or when the
+ * writer is flushed. If a @ref partition_key is chosen, then each
+ * message carries a key derived from its events, so that related
+ * events land on the same partition and stay in order. A message
+ * holds events with only one key, so the pending message is sent
+ * whenever the key changes.
+ *
+ * When the producer's queue is full, the writer follows its
+ * @ref backpressure_policy.
+ *
  * @ingroup writers
  */
 class CHUCHO_EXPORT kafka_writer : public message_queue_writer
 {
 public:
+    /**
+     * What to do when the producer's queue is full.
+     */
+    enum class backpressure_policy
+    {
+        /**
+         * Wait for room in the queue until @ref
+         * delivery_settings::block_timeout passes, and then
+         * discard the messages.
+         */
+        BLOCK,
+        /**
+         * Discard the messages.
+         */
+        DROP,
+        /**
+         * Keep the messages, and hold new events in an event cache,
+         * which overflows to disk, until the queue has room.
+         */
+        SPILL
+    };
+
+    /**
+     * Where the key of each message comes from.
+     */
+    enum class partition_key
+    {
+        /**
+         * Messages have no key and are spread across partitions.
+         */
+        NONE,
+        /**
+         * The name of the event's logger.
+         */
+        LOGGER,
+        /**
+         * The base name of the host.
+         */
+        HOST,
+        /**
+         * A field of the @ref diagnostic_context, which is read
+         * when the event is written to Kafka.
+         */
+        DIAGNOSTIC_CONTEXT
+    };
+
+    /**
+     * How messages are delivered to the producer.
+     */
+    struct delivery_settings
+    {
+        /**
+         * The number of messages passed to @c
+         * rd_kafka_produce_batch at once.
+         */
+        std::size_t batch_size = 1;
+        /**
+         * How long a partial batch may wait.
+         */
+        std::chrono::milliseconds linger = std::chrono::milliseconds(100);
+        /**
+         * The source of each message's key.
+         */
+        partition_key key = partition_key::NONE;
+        /**
+         * The @ref diagnostic_context field used when @ref key is
+         * @ref partition_key::DIAGNOSTIC_CONTEXT.
+         */
+        std::string key_field;
+        /**
+         * What to do when the producer's queue is full.
+         */
+        backpressure_policy backpressure = backpressure_policy::BLOCK;
+        /**
+         * How long to wait for room when @ref backpressure is @ref
+         * backpressure_policy::BLOCK.
+         */
+        std::chrono::milliseconds block_timeout = std::chrono::milliseconds(5000);
+    };
+
     /**
      * @name Constructor and Destructor
      * @{
@@ -56,6 +154,24 @@ public:
                  std::unique_ptr<serializer>&& ser,
                  const std::string& topic,
                  rd_kafka_conf_t* conf);
+    /**
+     * Create a writer.
+     *
+     * @post The writer takes ownership of the @c conf parameter.
+     *
+     * @param name the name
+     * @param fmt the formatter
+     * @param ser the serializer
+     * @param topic the name of the topic to which to write
+     * @param conf the @c librdkafka configuration
+     * @param settings how messages are delivered
+     */
+    kafka_writer(const std::string& name,
+                 std::unique_ptr<formatter>&& fmt,
+                 std::unique_ptr<serializer>&& ser,
+                 const std::string& topic,
+                 rd_kafka_conf_t* conf,
+                 const delivery_settings& settings);
     /**
      * Destroy a writer.
      */
@@ -64,6 +180,11 @@ public:
      * @}
      */
 
+    /**
+     * Send the pending messages and any events held while the
+     * producer's queue was full.
+     */
+    virtual void flush() override;
     /**
      * Return a value from the configuration. These may be keys
      * defined for configurations by the library @c librdkafka.
@@ -72,6 +193,20 @@ public:
      * @return the value
      */
     std::string get_config_value(const std::string& key) const;
+    /**
+     * Return how messages are delivered.
+     *
+     * @return the delivery settings
+     */
+    const delivery_settings& get_delivery_settings() const;
+    /**
+     * Return the number of messages that have been discarded
+     * because the producer's queue was full or because they
+     * could not be delivered.
+     *
+     * @return the number of discarded messages
+     */
+    std::size_t get_discarded() const;
     /**
      * Return the topic to which this writer is writing.
      *
@@ -80,18 +215,52 @@ public:
     std::string get_topic() const;
 
 protected:
+    virtual void flush_blob(std::vector<std::uint8_t>&& blob) override;
     virtual void flush_impl(const std::vector<std::uint8_t>& blob) override;
+    virtual void write_impl(const event& evt) override;
 
 private:
+    struct CHUCHO_NO_EXPORT outgoing
+    {
+        std::unique_ptr<std::vector<std::uint8_t>> payload;
+        std::string key;
+    };
+
+    CHUCHO_NO_EXPORT static void delivered(rd_kafka_t* rk, const rd_kafka_message_t* msg, void* opaque);
+
+    CHUCHO_NO_EXPORT void apply_backpressure();
+    CHUCHO_NO_EXPORT void discard_pending(const std::string& why);
+    CHUCHO_NO_EXPORT void drain_spill();
+    CHUCHO_NO_EXPORT std::string get_key(const event& evt) const;
     CHUCHO_NO_EXPORT void poller_main();
+    // NOTE: pending_guard_ must be locked on entry
+    CHUCHO_NO_EXPORT bool produce_pending();
+    CHUCHO_NO_EXPORT void write_keyed(const event& evt, const std::string& key);
 
     rd_kafka_conf_t* config_;
     rd_kafka_t* producer_;
     rd_kafka_topic_t* topic_;
     std::thread poller_;
     std::atomic_bool should_stop_;
+    delivery_settings settings_;
+    std::string current_key_;
+    std::vector<outgoing> pending_;
+    std::chrono::steady_clock::time_point pending_since_;
+    std::mutex pending_guard_;
+    std::unique_ptr<event_cache> spill_;
+    std::atomic<std::size_t> discarded_;
 };
 
+inline const kafka_writer::delivery_settings& kafka_writer::get_delivery_settings() const
+{
+    return settings_;
+}
+
+inline std::size_t kafka_writer::get_discarded() const
+{
+    return discarded_;
+}
+
 }
 
 #endif
@@ -23,6 +23,8 @@
 
 #include <chucho/message_queue_writer_memento.hpp>
 #include <chucho/kafka_configuration.hpp>
+#include <chucho/kafka_writer.hpp>
+#include <chucho/optional.hpp>
 
 namespace chucho
 {
@@ -34,13 +36,19 @@ public:
     virtual void handle(std::unique_ptr<configurable>&& cnf) override;
 
     const std::string& get_brokers() const;
+    const optional<kafka_writer::delivery_settings>& get_delivery_settings() const;
     std::unique_ptr<kafka_configuration> get_kafka_config();
     const std::string& get_topic() const;
 
 private:
+    kafka_writer::delivery_settings& delivery();
+    void set_backpressure(const std::string& policy);
+    void set_partition_key(const std::string& key);
+
     std::unique_ptr<kafka_configuration> kafka_conf_;
     std::string brokers_;
     std::string topic_;
+    optional<kafka_writer::delivery_settings> delivery_;
 };
 
 inline const std::string& kafka_writer_memento::get_brokers() const
@@ -48,6 +56,11 @@ inline const std::string& kafka_writer_memento::get_brokers() const
     return brokers_;
 }
 
+inline const optional<kafka_writer::delivery_settings>& kafka_writer_memento::get_delivery_settings() const
+{
+    return delivery_;
+}
+
 inline std::unique_ptr<kafka_configuration> kafka_writer_memento::get_kafka_config()
 {
     return std::move(kafka_conf_);
@@ -21,20 +21,30 @@
  * @file
  * Macros for writing messages to logs. These macros handle the 
  * machinery of filtering messages by level and adding markers. 
+ * Each statement also registers a @ref chucho::callsite, so its
+ * level can be overridden individually at run time with the 
+ * functions in @ref chucho::callsites.
+ *
+ * Statements below @ref CHUCHO_MIN_COMPILED_LEVEL are removed at
+ * compile time. See compiled_level.h for details.
  *  
  * @ingroup loggers 
  */
 
-#include <chucho/logger.hpp>
+#include <chucho/callsite.hpp>
+#include <chucho/compiled_level.h>
 #include <chucho/function_name.hpp>
 #include <sstream>
+#include <string>
+#include <utility>
 
 #if !defined(CHUCHO_DONT_DOCUMENT)
 
 #define CHUCHO_LOG(lvl, lg, fl, ln, fnc, msg) \
     do \
     { \
-        if ((lg)->permits(lvl)) \
+        static ::chucho::callsite __chucho_internal_site((fl), (ln), (fnc)); \
+        if (__chucho_internal_site.permits((lg), (lvl))) \
         { \
             std::ostringstream __chucho_internal_stream; \
             __chucho_internal_stream << msg; \
@@ -45,14 +55,16 @@
 #define CHUCHO_LOG_STR(lvl, lg, fl, ln, fnc, msg) \
     do \
     { \
-        if ((lg)->permits(lvl)) \
+        static ::chucho::callsite __chucho_internal_site((fl), (ln), (fnc)); \
+        if (__chucho_internal_site.permits((lg), (lvl))) \
             (lg)->write(::chucho::event((lg), (lvl), (msg), (fl), (ln), (fnc))); \
     } while (false)
 
 #define CHUCHO_LOG_M(mrk, lvl, lg, fl, ln, fnc, msg) \
     do \
     { \
-        if ((lg)->permits(lvl)) \
+        static ::chucho::callsite __chucho_internal_site((fl), (ln), (fnc)); \
+        if (__chucho_internal_site.permits((lg), (lvl))) \
         { \
             std::ostringstream __chucho_internal_stream; \
             __chucho_internal_stream << msg; \
@@ -63,14 +75,62 @@
 #define CHUCHO_LOG_STR_M(mrk, lvl, lg, fl, ln, fnc, msg) \
     do \
     { \
-        if ((lg)->permits(lvl)) \
+        static ::chucho::callsite __chucho_internal_site((fl), (ln), (fnc)); \
+        if (__chucho_internal_site.permits((lg), (lvl))) \
             (lg)->write(::chucho::event((lg), (lvl), (msg), (fl), (ln), (fnc), (mrk))); \
     } while (false)
 
-#define CHUCHO_INTERNAL_LOG(lvl, lg, fl, ln, fnc, msg) CHUCHO_LOG(::chucho::level::lvl(), lg, fl, ln, fnc, msg)
-#define CHUCHO_INTERNAL_LOG_STR(lvl, lg, fl, ln, fnc, msg) CHUCHO_LOG_STR(::chucho::level::lvl(), lg, fl, ln, fnc, msg)
-#define CHUCHO_INTERNAL_LOG_M(mrk, lvl, lg, fl, ln, fnc, msg) CHUCHO_LOG_M(mrk, ::chucho::level::lvl(), lg, fl, ln, fnc, msg)
-#define CHUCHO_INTERNAL_LOG_STR_M(mrk, lvl, lg, fl, ln, fnc, msg) CHUCHO_LOG_STR_M(mrk, ::chucho::level::lvl(), lg, fl, ln, fnc, msg)
+// The level is looked up once per statement and then held by reference,
+// so the check doesn't pay for a call_once and a reference count bump.
+#define CHUCHO_INTERNAL_CACHED_LEVEL(lvl, log_macro) \
+    do \
+    { \
+        static const std::shared_ptr<::chucho::level>& __chucho_internal_level(::chucho::level::lvl()); \
+        log_macro; \
+    } while (false)
+
+// Statements that are compiled out are only type-checked, in an
+// unevaluated context, so nothing is executed.
+#define CHUCHO_INTERNAL_DISCARD(lg, msg) \
+    do \
+    { \
+        static_cast<void>(sizeof((lg)->get_name())); \
+        static_cast<void>(sizeof(std::declval<std::ostream&>() << msg)); \
+    } while (false)
+
+#define CHUCHO_INTERNAL_DISCARD_STR(lg, msg) \
+    do \
+    { \
+        static_cast<void>(sizeof((lg)->get_name())); \
+        static_cast<void>(sizeof(std::string(msg))); \
+    } while (false)
+
+#define CHUCHO_INTERNAL_DISCARD_M(mrk, lg, msg) \
+    do \
+    { \
+        static_cast<void>(sizeof(mrk)); \
+        CHUCHO_INTERNAL_DISCARD(lg, msg); \
+    } while (false)
+
+#define CHUCHO_INTERNAL_DISCARD_STR_M(mrk, lg, msg) \
+    do \
+    { \
+        static_cast<void>(sizeof(mrk)); \
+        CHUCHO_INTERNAL_DISCARD_STR(lg, msg); \
+    } while (false)
+
+#define CHUCHO_INTERNAL_LOG(lvl, lg, fl, ln, fnc, msg) \
+    CHUCHO_IF_COMPILED_ ## lvl(CHUCHO_INTERNAL_CACHED_LEVEL(lvl, CHUCHO_LOG(__chucho_internal_level, lg, fl, ln, fnc, msg)), \
+                               CHUCHO_INTERNAL_DISCARD(lg, msg))
+#define CHUCHO_INTERNAL_LOG_STR(lvl, lg, fl, ln, fnc, msg) \
+    CHUCHO_IF_COMPILED_ ## lvl(CHUCHO_INTERNAL_CACHED_LEVEL(lvl, CHUCHO_LOG_STR(__chucho_internal_level, lg, fl, ln, fnc, msg)), \
+                               CHUCHO_INTERNAL_DISCARD_STR(lg, msg))
+#define CHUCHO_INTERNAL_LOG_M(mrk, lvl, lg, fl, ln, fnc, msg) \
+    CHUCHO_IF_COMPILED_ ## lvl(CHUCHO_INTERNAL_CACHED_LEVEL(lvl, CHUCHO_LOG_M(mrk, __chucho_internal_level, lg, fl, ln, fnc, msg)), \
+                               CHUCHO_INTERNAL_DISCARD_M(mrk, lg, msg))
+#define CHUCHO_INTERNAL_LOG_STR_M(mrk, lvl, lg, fl, ln, fnc, msg) \
+    CHUCHO_IF_COMPILED_ ## lvl(CHUCHO_INTERNAL_CACHED_LEVEL(lvl, CHUCHO_LOG_STR_M(mrk, __chucho_internal_level, lg, fl, ln, fnc, msg)), \
+                               CHUCHO_INTERNAL_DISCARD_STR_M(mrk, lg, msg))
 
 #define CHUCHO_EVERY_N_INTERNAL(n, body) \
     do \
@@ -746,7 +806,7 @@
  *            output to a std::stream, like "I have " << 7 << "
  *            dreams."
  */
-#define CHUCHO_EVERY_N(lvl, n, lg, msg) CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl(lg, msg))
+#define CHUCHO_EVERY_N(lvl, n, lg, msg) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl(lg, msg)), CHUCHO_ ## lvl(lg, msg))
 
 /**
  * @def CHUCHO_EVERY_N_LGBL(lvl, n, msg)
@@ -760,7 +820,7 @@
  *            output to a std::stream, like "I have " << 7 << "
  *            dreams."
  */
-#define CHUCHO_EVERY_N_LGBL(lvl, n, msg) CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _LGBL(msg))
+#define CHUCHO_EVERY_N_LGBL(lvl, n, msg) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _LGBL(msg)), CHUCHO_ ## lvl ## _LGBL(msg))
 
 /**
  * @def CHUCHO_EVERY_N_L(lvl, n, msg)
@@ -779,7 +839,7 @@
  * @param lg the logger
  * @param msg the message to write
  */
-#define CHUCHO_EVERY_N_STR(lvl, n, lg, msg) CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _STR(lg, msg))
+#define CHUCHO_EVERY_N_STR(lvl, n, lg, msg) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _STR(lg, msg)), CHUCHO_ ## lvl ## _STR(lg, msg))
 
 /**
  * @def CHUCHO_EVERY_N_LGBL_STR(lvl, n, msg)
@@ -791,7 +851,7 @@
  * @param n the count after which the event should be logged
  * @param msg the message to write
  */
-#define CHUCHO_EVERY_N_LGBL_STR(lvl, n, msg) CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _LGBL_STR(msg))
+#define CHUCHO_EVERY_N_LGBL_STR(lvl, n, msg) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _LGBL_STR(msg)), CHUCHO_ ## lvl ## _LGBL_STR(msg))
 
 /**
  * @def CHUCHO_EVERY_N_L_STR(lvl, n, msg)
@@ -816,7 +876,7 @@
  *            output to a std::stream, like "I have " << 7 << "
  *            dreams."
  */
-#define CHUCHO_EVERY_N_M(lvl, n, mrk, lg, msg) CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _M(mrk, lg, msg))
+#define CHUCHO_EVERY_N_M(lvl, n, mrk, lg, msg) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _M(mrk, lg, msg)), CHUCHO_ ## lvl ## _M(mrk, lg, msg))
 
 /**
  * @def CHUCHO_EVERY_N_LGBL_M(lvl, n, mrk, msg)
@@ -834,7 +894,7 @@
  *            output to a std::stream, like "I have " << 7 << "
  *            dreams."
  */
-#define CHUCHO_EVERY_N_LGBL_M(lvl, n, mrk, msg) CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _LGBL_M(mrk, msg))
+#define CHUCHO_EVERY_N_LGBL_M(lvl, n, mrk, msg) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _LGBL_M(mrk, msg)), CHUCHO_ ## lvl ## _LGBL_M(mrk, msg))
 
 /**
  * @def CHUCHO_EVERY_N_L_M(lvl, n, mrk, msg)
@@ -857,7 +917,7 @@
  * @param lg the logger
  * @param msg the message to write
  */
-#define CHUCHO_EVERY_N_STR_M(lvl, n, mrk, lg, msg) CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _STR_M(mrk, lg, msg))
+#define CHUCHO_EVERY_N_STR_M(lvl, n, mrk, lg, msg) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _STR_M(mrk, lg, msg)), CHUCHO_ ## lvl ## _STR_M(mrk, lg, msg))
 
 /**
  * @def CHUCHO_EVERY_N_LGBL_STR_M(lvl, n, mrk, msg)
@@ -873,7 +933,7 @@
  *            on the fly
  * @param msg the message to write
  */
-#define CHUCHO_EVERY_N_LGBL_STR_M(lvl, n, mrk, msg) CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _LGBL_STR_M(mrk, msg))
+#define CHUCHO_EVERY_N_LGBL_STR_M(lvl, n, mrk, msg) CHUCHO_IF_COMPILED_ ## lvl ## _(CHUCHO_EVERY_N_INTERNAL((n), CHUCHO_ ## lvl ## _LGBL_STR_M(mrk, msg)), CHUCHO_ ## lvl ## _LGBL_STR_M(mrk, msg))
 
 /**
  * @def CHUCHO_EVERY_N_L_STR_M(lvl, n, mrk, msg)
@@ -23,7 +23,9 @@
 #endif
 
 #include <chucho/writer.hpp>
+#include <cstdint>
 #include <list>
+#include <vector>
 
 namespace chucho
 {
@@ -166,12 +168,15 @@ public:
     /**
      * Does this logger permit a level? If the level is greater than
      * or equal to the effective level of this logger, then the 
-     * level is permitted. 
+     * level is permitted. However, while an @ref overload_governor
+     * is shedding events, levels at or below its watermark are not
+     * permitted if this logger, or any ancestor to which it writes,
+     * has the @ref async_writer that the governor watches.
      * 
      * @param lvl the level to test
      * @return true if the level would be permitted by this logger
      */
-    bool permits(std::shared_ptr<level> lvl);
+    bool permits(const std::shared_ptr<level>& lvl);
     /**
      * Remove a specific writer from this logger.
      * 
@@ -226,18 +231,48 @@ public:
 
 private:
     friend class logger_factory;
+    friend class staged_configurator;
 
     static CHUCHO_NO_EXPORT std::shared_ptr<logger> get_impl(const std::string& name);
     static CHUCHO_NO_EXPORT void initialize();
 
     CHUCHO_NO_EXPORT logger(const std::string& name, std::shared_ptr<level> lvl = std::shared_ptr<level>());
 
+    // The identifiers of the overload governors of the async_writers
+    // that this logger reaches. They are cached until the writers or
+    // writes_to_ancestors of any logger change.
+    CHUCHO_NO_EXPORT std::vector<std::uint64_t> get_governors();
+
+    // The level, writers and writes_to_ancestors that a logger is
+    // to have. Each writer is either a new one or, if the pointer is
+    // set, one that the logger already has.
+    struct CHUCHO_NO_EXPORT replacement
+    {
+        std::shared_ptr<logger> lgr;
+        std::shared_ptr<level> lvl;
+        bool wta;
+        std::vector<std::pair<writer*, std::unique_ptr<writer>>> writers;
+    };
+
+    // Replace several loggers at once. All of their locks are held
+    // while any of them changes. The writers that are no longer
+    // needed are returned, so they can be destroyed after the locks
+    // are released.
+    static CHUCHO_NO_EXPORT std::list<std::shared_ptr<writer>> replace(std::vector<replacement>& reps);
+
+    // @pre guard_ must be locked
+    CHUCHO_NO_EXPORT std::list<std::shared_ptr<writer>> replace(replacement& rep);
+
     std::shared_ptr<logger> parent_;
     std::string name_;
     std::shared_ptr<level> level_;
-    std::list<std::unique_ptr<writer>> writers_;
+    // These are shared only so that a writer outlives its removal
+    // while an event written to it is being finished
+    std::list<std::shared_ptr<writer>> writers_;
     std::mutex guard_;
     bool writes_to_ancestors_;
+    std::vector<std::uint64_t> governors_;
+    std::uint32_t governors_version_;
 };
 
 inline const std::string& logger::get_name() const
@@ -18,11 +18,13 @@
 #define CHUCHO_LOGGLY_WRITER_HPP_
 
 #include <chucho/cloud_writer.hpp>
+#include <chucho/optional.hpp>
 
 namespace chucho
 {
 
 class curl;
+class http_bulk_sender;
 
 /**
  * @class loggly_writer loggly_writer.hpp chucho/loggly_writer.hpp
@@ -48,6 +50,22 @@ public:
     loggly_writer(const std::string& name,
                   std::unique_ptr<formatter>&& fmt,
                   const std::string& token);
+    /**
+     * Construct a Loggly writer in bulk mode. Events are sent in
+     * batches to Loggly's bulk endpoint from a background thread.
+     *
+     * @param name the writer's name
+     * @param fmt the formatter
+     * @param token the Loggly customer token
+     * @param bulk the batching settings
+     * @param url the URL to which to post, which if empty is
+     *        Loggly's bulk endpoint for the token
+     */
+    loggly_writer(const std::string& name,
+                  std::unique_ptr<formatter>&& fmt,
+                  const std::string& token,
+                  const bulk_settings& bulk,
+                  const std::string& url = std::string());
     /**
      * Destruct a Loggly writer.
      */
@@ -56,12 +74,30 @@ public:
      * @}
      */
 
+    /**
+     * Wait for the events written so far to be sent. This only has an
+     * effect in bulk mode.
+     */
+    virtual void flush() override;
+    /**
+     * Return the bulk settings, which are unset if the writer is not
+     * in bulk mode.
+     *
+     * @return the bulk settings
+     */
+    optional<bulk_settings> get_bulk_settings() const;
     /**
      * Return the Loggly customer token.
      *
      * @return the customer token
      */
     const std::string& get_token() const;
+    /**
+     * Return the URL to which events are posted.
+     *
+     * @return the URL
+     */
+    const std::string& get_url() const;
     /**
      * Return whether the curl output is verbose.
      *
@@ -81,6 +117,8 @@ protected:
 private:
     std::unique_ptr<curl> curl_;
     std::string token_;
+    std::string url_;
+    std::unique_ptr<http_bulk_sender> sender_;
 };
 
 inline const std::string& loggly_writer::get_token() const
@@ -88,6 +126,11 @@ inline const std::string& loggly_writer::get_token() const
     return token_;
 }
 
+inline const std::string& loggly_writer::get_url() const
+{
+    return url_;
+}
+
 }
 
 #endif
@@ -23,6 +23,7 @@
 
 #include <chucho/writer_memento.hpp>
 #include <chucho/optional.hpp>
+#include <chucho/cloud_writer.hpp>
 
 namespace chucho
 {
@@ -32,18 +33,33 @@ class loggly_writer_memento : public writer_memento
 public:
     loggly_writer_memento(configurator& cfg);
 
+    const optional<cloud_writer::bulk_settings>& get_bulk_settings() const;
     const std::string& get_token() const;
+    const std::string& get_url() const;
 
 private:
-    std::string token_;
+    cloud_writer::bulk_settings& bulk();
 
+    std::string token_;
+    std::string url_;
+    optional<cloud_writer::bulk_settings> bulk_settings_;
 };
 
+inline const optional<cloud_writer::bulk_settings>& loggly_writer_memento::get_bulk_settings() const
+{
+    return bulk_settings_;
+}
+
 inline const std::string& loggly_writer_memento::get_token() const
 {
     return token_;
 }
 
+inline const std::string& loggly_writer_memento::get_url() const
+{
+    return url_;
+}
+
 }
 
 #endif
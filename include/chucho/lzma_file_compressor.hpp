@@ -48,6 +48,9 @@ public:
     //@}
 
     virtual void compress(const std::string& file_name) override;
+
+private:
+    CHUCHO_NO_EXPORT void compress_impl(const std::string& file_name);
 };
 
 }
@@ -126,6 +126,20 @@ protected:
     /**
      * @}
      */
+    /**
+     * Write the blob to the message queue, taking ownership of
+     * its bytes. Writers whose client libraries can take over a
+     * buffer without copying it override this. By default, it
+     * calls @ref flush_impl.
+     *
+     * @param blob the bytes to write
+     */
+    virtual void flush_blob(std::vector<std::uint8_t>&& blob);
+    /**
+     * Serialize the coalesced events into a blob and pass it to
+     * @ref flush_blob.
+     */
+    void flush_coalesced();
     /**
      * Write the blob to the message queue.
      *
@@ -38,6 +38,9 @@ public:
     std::unique_ptr<serializer> get_serializer();
     virtual void handle(std::unique_ptr<configurable>&& cnf) override;
 
+protected:
+    message_queue_writer_memento(configurator& cfg, std::size_t coalesce_max);
+
 private:
     std::unique_ptr<serializer> serializer_;
     std::unique_ptr<compressor> compressor_;
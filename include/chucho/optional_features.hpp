@@ -71,6 +71,8 @@ enum feature
     CLOUDWATCH_WRITER,          /**< AWS Cloudwatch writer */
     DATABASE_WRITER,            /**< Database writer */
     KAFKA_WRITER,               /**< Kafka writer */
+    SHM_RING_WRITER,            /**< Shared memory ring writer */
+    IO_URING_FILE_WRITER,       /**< Linux io_uring file writer */
     FEATURE_COUNT               /**< Do not use. This is just so I can know how many there are. */
 };
 
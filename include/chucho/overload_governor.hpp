@@ -0,0 +1,220 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_OVERLOAD_GOVERNOR_HPP_)
+#define CHUCHO_OVERLOAD_GOVERNOR_HPP_
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include <chucho/level.hpp>
+#include <chucho/non_copyable.hpp>
+#include <chucho/optional.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace chucho
+{
+
+/**
+ * @class overload_governor overload_governor.hpp chucho/overload_governor.hpp
+ * Shed low-level events when an @ref async_writer falls behind.
+ * The governor watches the fullness of the writer's cache. When
+ * the fullness reaches a watermark, events at or below the
+ * watermark's level are refused by @ref logger::permits(), so
+ * they are never even constructed. When the cache drains to the
+ * hysteresis distance below the watermark, the previous level is
+ * restored.
+ *
+ * For example, the watermarks <tt>80:DEBUG,95:INFO</tt> cause
+ * trace- and debug-level events to be shed when the cache is 80%
+ * full, and info-level ones as well at 95%. With the default
+ * hysteresis of 10%, info-level events are admitted again when
+ * the cache drops below 85%, and debug-level ones below 70%.
+ *
+ * Shedding applies to the loggers that reach the governor's
+ * @ref async_writer, either because they have it or because they
+ * write to an ancestor that has it. Loggers that only reach other
+ * writers are never shed by this governor, and events below the
+ * level of the logger are neither shed nor counted.
+ * When shedding stops, the governor produces a summary of how
+ * many events were shed at each level, which the @ref
+ * async_writer writes to its underlying writer.
+ *
+ * @note The governor is driven by the @ref async_writer that owns
+ *       it. You don't call update() or take_summary() yourself.
+ *
+ * @ingroup writers
+ */
+class CHUCHO_EXPORT overload_governor : non_copyable
+{
+public:
+    /**
+     * A point at which events start to be shed.
+     */
+    struct CHUCHO_EXPORT watermark
+    {
+        /**
+         * The fullness, from 0.0 to 1.0, at which shedding starts.
+         */
+        double fullness;
+        /**
+         * The level at or below which events are shed.
+         */
+        std::shared_ptr<level> shed;
+    };
+
+    /**
+     * The default hysteresis, which is 10%.
+     */
+    static constexpr double DEFAULT_HYSTERESIS = 0.1;
+
+    /**
+     * Parse watermarks from text. The text is a comma-separated
+     * list of <tt>percent:level</tt> pairs, like
+     * <tt>80:DEBUG,95:INFO</tt>.
+     *
+     * @param text the text
+     * @return the watermarks
+     * @throw std::invalid_argument if the text is malformed
+     */
+    static std::vector<watermark> parse_watermarks(const std::string& text);
+    /**
+     * Return whether a level is currently admitted. This is called
+     * by @ref logger::permits() for events that the logger would
+     * otherwise write. Levels that are refused are counted for the
+     * summary.
+     *
+     * @param lvl the level
+     * @return true if the level is admitted
+     */
+    static bool admits(const level& lvl);
+    /**
+     * Return whether a level is currently being shed by any
+     * governor. Unlike admits(), nothing is counted.
+     *
+     * @param lvl the level
+     * @return true if the level is being shed
+     */
+    static bool sheds(const level& lvl);
+
+    /**
+     * @name Constructor and destructor
+     */
+    //@{
+    /**
+     * Construct a governor. The watermarks must be in ascending
+     * order of both fullness and level.
+     *
+     * @param marks the watermarks
+     * @param hysteresis how far below a watermark, as a fraction
+     *                   of the cache size, the fullness must fall
+     *                   before the watermark is released
+     * @throw std::invalid_argument if the watermarks are empty or
+     *        out of order, or if the hysteresis is not between 0.0
+     *        and 1.0
+     */
+    overload_governor(const std::vector<watermark>& marks,
+                      double hysteresis = DEFAULT_HYSTERESIS);
+    /**
+     * Destroy the governor. If it is shedding, it stops.
+     */
+    ~overload_governor();
+    //@}
+
+    /**
+     * Return the hysteresis.
+     *
+     * @return the hysteresis
+     */
+    double get_hysteresis() const;
+    /**
+     * Return the level at or below which events are currently shed
+     * because of this governor.
+     *
+     * @return the level, which is empty if nothing is being shed
+     */
+    std::shared_ptr<level> get_shed_level() const;
+    /**
+     * Return the watermarks.
+     *
+     * @return the watermarks
+     */
+    const std::vector<watermark>& get_watermarks() const;
+    /**
+     * Return the summary of a shedding episode that has ended. The
+     * summary is only returned once.
+     *
+     * @return the summary, which is unset if there is none
+     */
+    optional<std::string> take_summary();
+    /**
+     * Update the governor with the current fullness of the cache.
+     *
+     * @param fullness the fullness, from 0.0 to 1.0
+     */
+    void update(double fullness);
+
+private:
+    friend class logger;
+
+    /**
+     * Return whether a level is being shed by any of some governors.
+     *
+     * @param lvl the level
+     * @param ids the identifiers of the governors
+     * @return true if the level is being shed
+     */
+    static CHUCHO_NO_EXPORT bool sheds(const level& lvl, const std::vector<std::uint64_t>& ids);
+
+    CHUCHO_NO_EXPORT void set_current(int idx);
+
+    std::vector<watermark> marks_;
+    double hysteresis_;
+    // The index of the watermark in effect, or -1
+    std::atomic<int> current_;
+    std::atomic<bool> summary_pending_;
+    std::mutex guard_;
+    std::chrono::steady_clock::time_point started_;
+    std::string summary_;
+    int peak_;
+    // Identifies the governor to the loggers that reach it without
+    // their having to keep a pointer that could dangle
+    std::uint64_t id_;
+};
+
+inline double overload_governor::get_hysteresis() const
+{
+    return hysteresis_;
+}
+
+inline const std::vector<overload_governor::watermark>& overload_governor::get_watermarks() const
+{
+    return marks_;
+}
+
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif
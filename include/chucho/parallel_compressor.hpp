@@ -0,0 +1,55 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_PARALLEL_COMPRESSOR_HPP_)
+#define CHUCHO_PARALLEL_COMPRESSOR_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/export.h>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace chucho
+{
+
+// Split input into blocks that are compressed independently by a
+// bounded number of threads, writing the results in their original
+// order. The compressed blocks must be concatenable, like gzip
+// members or bzip2 streams.
+class CHUCHO_PRIV_EXPORT parallel_compressor
+{
+public:
+    typedef std::function<void(const std::vector<char>& in, std::vector<char>& out)> block_function;
+
+    parallel_compressor(unsigned threads, int nice, std::size_t block_size, block_function fn);
+
+    void compress(std::istream& in, std::ostream& out);
+
+private:
+    unsigned threads_;
+    int nice_;
+    std::size_t block_size_;
+    block_function fn_;
+};
+
+}
+
+#endif
@@ -179,6 +179,11 @@ struct expression;
  *         message. Justification and width modifiers
  *         may not be used with this token.</td></tr>
  * </table>
+ *
+ * While a @ref logger writes an event, including to its ancestors'
+ * writers, the event is formatted only once for each distinct
+ * pattern. Writers whose pattern_formatters share a pattern all
+ * receive the same text.
  *  
  * @ingroup formatters 
  */
@@ -438,6 +443,7 @@ private:
     CHUCHO_NO_EXPORT std::string get_argument(std::string::const_iterator& pos,
                                               std::string::const_iterator end);
 
+    std::string pattern_;
     std::vector<std::unique_ptr<piece>> pieces_;
 };
 
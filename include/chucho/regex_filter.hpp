@@ -0,0 +1,160 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_REGEX_FILTER_HPP_)
+#define CHUCHO_REGEX_FILTER_HPP_
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include <chucho/filter.hpp>
+
+namespace chucho
+{
+
+namespace regex
+{
+
+struct expression;
+
+}
+
+/**
+ * @class regex_filter regex_filter.hpp chucho/regex_filter.hpp
+ * A filter that searches the event's message or logger name for a
+ * regular expression. The regular expression follows the POSIX
+ * extended syntax. Expressions that are plain text, or that have
+ * no groups or alternation, are matched without the general
+ * regular expression engine, and any text that every match must
+ * contain is looked for before the engine is consulted. A matching
+ * and a non-matching @ref result are accepted in the constructor.
+ *
+ * @ingroup filters
+ */
+class CHUCHO_EXPORT regex_filter : public filter
+{
+public:
+    /**
+     * The part of the event that is searched.
+     */
+    enum class field
+    {
+        /**
+         * The name of the logger.
+         */
+        LOGGER,
+        /**
+         * The unformatted message.
+         */
+        MESSAGE
+    };
+
+    /**
+     * @name Constructor and Destructor
+     * @{
+     */
+    /**
+     * Construct a regex_filter.
+     *
+     * @param name the name of this filter
+     * @param regex the regular expression
+     * @param fld the part of the event to search
+     * @param on_match the result if the regular expression is found
+     * @param on_mismatch the result if the regular expression is not
+     *                    found
+     * @throw exception if the regular expression is invalid
+     */
+    regex_filter(const std::string& name,
+                 const std::string& regex,
+                 field fld = field::MESSAGE,
+                 result on_match = result::NEUTRAL,
+                 result on_mismatch = result::DENY);
+    /**
+     * Destroy the filter.
+     */
+    ~regex_filter();
+    /** @} */
+
+    /**
+     * Return the matching result if the regular expression is found
+     * in the event. Otherwise, return the non-matching result.
+     *
+     * @param evt the event to test
+     * @return either the matching or the non-matching result
+     */
+    virtual result evaluate(const event& evt) override;
+    /**
+     * Return the part of the event that is searched.
+     *
+     * @return the field
+     */
+    field get_field() const;
+    /**
+     * Return the result when the regular expression is found.
+     *
+     * @return the matching result
+     */
+    result get_on_match() const;
+    /**
+     * Return the result when the regular expression is not found.
+     *
+     * @return the non-matching result
+     */
+    result get_on_mismatch() const;
+    /**
+     * Return the regular expression.
+     *
+     * @return the regular expression
+     */
+    const std::string& get_regex() const;
+
+private:
+    std::string regex_;
+    std::unique_ptr<regex::expression> re_;
+    field field_;
+    result on_match_;
+    result on_mismatch_;
+};
+
+inline regex_filter::field regex_filter::get_field() const
+{
+    return field_;
+}
+
+inline filter::result regex_filter::get_on_match() const
+{
+    return on_match_;
+}
+
+inline filter::result regex_filter::get_on_mismatch() const
+{
+    return on_mismatch_;
+}
+
+inline const std::string& regex_filter::get_regex() const
+{
+    return regex_;
+}
+
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_REGEX_FILTER_MEMENTO_HPP_)
+#define CHUCHO_REGEX_FILTER_MEMENTO_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/filter_memento.hpp>
+#include <chucho/regex_filter.hpp>
+#include <chucho/optional.hpp>
+
+namespace chucho
+{
+
+class regex_filter_memento : public filter_memento
+{
+public:
+    regex_filter_memento(configurator& cfg);
+
+    const optional<regex_filter::field>& get_field() const;
+    const optional<filter::result>& get_on_match() const;
+    const optional<filter::result>& get_on_mismatch() const;
+    const std::string& get_regex() const;
+
+private:
+    std::string regex_;
+    optional<regex_filter::field> field_;
+    optional<filter::result> on_match_;
+    optional<filter::result> on_mismatch_;
+};
+
+inline const optional<regex_filter::field>& regex_filter_memento::get_field() const
+{
+    return field_;
+}
+
+inline const optional<filter::result>& regex_filter_memento::get_on_match() const
+{
+    return on_match_;
+}
+
+inline const optional<filter::result>& regex_filter_memento::get_on_mismatch() const
+{
+    return on_mismatch_;
+}
+
+inline const std::string& regex_filter_memento::get_regex() const
+{
+    return regex_;
+}
+
+}
+
+#endif
@@ -78,6 +78,12 @@ namespace chucho
  *         <td>[2, 1000000]</td></tr>
  *     <tr><td>async_writer::max_chunks(text)</td>
  *         <td>7</td></tr>
+ *     <tr><td>async_writer::shard_key</td>
+ *         <td>256</td></tr>
+ *     <tr><td>async_writer::shards</td>
+ *         <td>[1, 1024]</td></tr>
+ *     <tr><td>async_writer::shards(text)</td>
+ *         <td>4</td></tr>
  *     <tr><td>cache_and_release_filter::cache_threshold</td>
  *         <td><i>default</i></td></tr>
  *     <tr><td>cache_and_release_filter::chunk_size</td>
@@ -126,16 +132,30 @@ namespace chucho
  *         <td>320</td></tr>
  *     <tr><td>email_writer::verbose</td>
  *         <td>5</td></tr>
+ *     <tr><td>expression_filter::expression</td>
+ *         <td><i>default</i></td></tr>
  *     <tr><td>file_compressor::min_index</td>
  *         <td>[1, 1000]</td></tr>
  *     <tr><td>file_compressor::min_index(text)</td>
  *         <td>4</td></tr>
+ *     <tr><td>file_compressor::nice</td>
+ *         <td>[-20, 19]</td></tr>
+ *     <tr><td>file_compressor::nice(text)</td>
+ *         <td>3</td></tr>
+ *     <tr><td>file_compressor::threads</td>
+ *         <td>[0, 1024]</td></tr>
+ *     <tr><td>file_compressor::threads(text)</td>
+ *         <td>4</td></tr>
  *     <tr><td>file_writer::file_name</td>
  *         <td><i>default</i></td></tr>
  *     <tr><td>%file_writer::flush</td>
  *         <td>5</td></tr>
  *     <tr><td>%file_writer::on_start</td>
  *         <td>8</td></tr>
+ *     <tr><td>gzip_stream_compressor::compression_level</td>
+ *         <td>[0, 9]</td></tr>
+ *     <tr><td>gzip_stream_compressor::compression_level(text)</td>
+ *         <td>1</td></tr>
  *     <tr><td>interval_file_roll_trigger::count</td>
  *         <td>[1, 5000]</td></tr>
  *     <tr><td>interval_file_roll_trigger::period(text)</td>
@@ -194,12 +214,24 @@ namespace chucho
  *         <td><i>default</i></td></tr>
  *     <tr><td>rabbitmq_writer::url</td>
  *         <td><i>default</i></td></tr>
+ *     <tr><td>regex_filter::field</td>
+ *         <td>7</td></tr>
+ *     <tr><td>regex_filter::on_match</td>
+ *         <td>7</td></tr>
+ *     <tr><td>regex_filter::on_mismatch</td>
+ *         <td>7</td></tr>
+ *     <tr><td>regex_filter::regex</td>
+ *         <td><i>default</i></td></tr>
  *     <tr><td>ruby_evaluator_filter::expression</td>
  *         <td><i>default</i></td></tr>
  *     <tr><td>size_file_roll_trigger::max_size</td>
  *         <td>[1, 1G]</td></tr>
  *     <tr><td>size_file_roll_trigger::max_size(text)</td>
  *         <td>50</td></tr>
+ *     <tr><td>size_file_roll_trigger::max_uncompressed_size</td>
+ *         <td>[1, 1T]</td></tr>
+ *     <tr><td>size_file_roll_trigger::max_uncompressed_size(text)</td>
+ *         <td>50</td></tr>
  *     <tr><td>sliding_numbered_file_roller::min_index</td>
  *         <td>[-1000, 1000]</td></tr>
  *     <tr><td>sliding_numbered_file_roller::min_index(text)</td>
@@ -214,6 +246,20 @@ namespace chucho
  *         <td>[1, 65535]</td></tr>
  *     <tr><td>syslog_writer::port(text)</td>
  *         <td>5</td></tr>
+ *     <tr><td>thread_settings::affinity</td>
+ *         <td>256</td></tr>
+ *     <tr><td>thread_settings::name</td>
+ *         <td>64</td></tr>
+ *     <tr><td>thread_settings::nice</td>
+ *         <td>[-20, 19]</td></tr>
+ *     <tr><td>thread_settings::nice(text)</td>
+ *         <td>3</td></tr>
+ *     <tr><td>thread_settings::numa_node</td>
+ *         <td>[0, 1023]</td></tr>
+ *     <tr><td>thread_settings::numa_node(text)</td>
+ *         <td>4</td></tr>
+ *     <tr><td>thread_settings::scheduling</td>
+ *         <td>6</td></tr>
  *     <tr><td>time_file_roller::file_name_pattern</td>
  *         <td><i>default</i></td></tr>
  *     <tr><td>time_file_roller::max_history</td>
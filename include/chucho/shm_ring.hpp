@@ -0,0 +1,216 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_SHM_RING_HPP_)
+#define CHUCHO_SHM_RING_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/export.h>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace chucho
+{
+
+// A ring of fixed-size slots in a POSIX shared memory segment. Any
+// number of threads in any number of processes may write, and one
+// reader drains it. Writers never wait. A record that needs more than
+// one slot occupies consecutive positions. Each slot carries a sequence
+// number: 2p + 1 while a writer fills it for position p and 2p + 2 once
+// it is committed. A multi-slot record commits its continuation slots
+// before its head, so a reader that finds a committed head can read the
+// whole record. The reader copies optimistically and checks the sequence
+// again afterwards, so a record overwritten while being read is reported
+// as lost instead of being returned torn.
+class CHUCHO_PRIV_EXPORT shm_ring
+{
+public:
+    enum class overflow
+    {
+        OVERWRITE,
+        DROP
+    };
+
+    enum class read_result
+    {
+        RECORD,
+        EMPTY,
+        PENDING,
+        LOST
+    };
+
+    static constexpr std::uint32_t MAGIC = 0x63687368; // chsh
+    static constexpr std::uint32_t VERSION = 1;
+
+    // The writer's side, which creates the segment if it does not exist.
+    // If it exists, then its geometry is used and geometry_matched()
+    // returns false if that differs from what was requested.
+    shm_ring(const std::string& name,
+             std::uint32_t slot_count,
+             std::uint32_t slot_size,
+             overflow ovr);
+    // The reader's side, which requires the segment to exist.
+    explicit shm_ring(const std::string& name);
+    shm_ring(const shm_ring&) = delete;
+    ~shm_ring();
+
+    shm_ring& operator= (const shm_ring&) = delete;
+
+    static std::string normalize_name(const std::string& name);
+    static void remove(const std::string& name);
+
+    bool geometry_matched() const;
+    std::uint64_t get_dropped() const;
+    const std::string& get_name() const;
+    overflow get_overflow() const;
+    std::uint64_t get_overwritten() const;
+    std::uint64_t get_read_position() const;
+    std::uint32_t get_slot_count() const;
+    std::uint32_t get_slot_size() const;
+    std::uint64_t get_truncated() const;
+    std::uint64_t get_write_position() const;
+    std::size_t max_record_size() const;
+    // On RECORD the cursor is moved past the record and its bytes are in
+    // rec. On LOST the cursor has been moved past unreadable positions and
+    // lost holds their number. EMPTY means nothing has been written at the
+    // cursor, and PENDING means a writer has claimed the cursor's position
+    // but has not committed it.
+    read_result read(std::uint64_t& cursor, std::vector<std::uint8_t>& rec, std::uint64_t& lost);
+    void set_read_position(std::uint64_t pos);
+    // Returns false if the record was dropped
+    bool write(const std::uint8_t* data, std::size_t len);
+
+private:
+    struct header
+    {
+        std::atomic<std::uint32_t> magic;
+        std::uint32_t version;
+        std::uint32_t slot_count;
+        std::uint32_t slot_size;
+        std::uint32_t policy;
+        alignas(64) std::atomic<std::uint64_t> reserve;
+        alignas(64) std::atomic<std::uint64_t> read_pos;
+        alignas(64) std::atomic<std::uint64_t> dropped;
+        std::atomic<std::uint64_t> overwritten;
+        std::atomic<std::uint64_t> truncated;
+    };
+
+    // A head slot has a non-zero span, which is the number of slots in
+    // its record, and its length is that of the whole record. Other slots
+    // have a span of zero and their length is that of their own bytes.
+    struct slot
+    {
+        std::atomic<std::uint64_t> seq;
+        std::uint32_t length;
+        std::uint32_t span;
+    };
+
+    static std::size_t segment_size(std::uint32_t slot_count, std::uint32_t slot_size);
+
+    std::uint8_t* data_of(slot& s) const;
+    bool lock(std::uint64_t pos);
+    void map(bool create, std::uint32_t slot_count, std::uint32_t slot_size, overflow ovr);
+    std::size_t payload_size() const;
+    slot& slot_at(std::uint64_t pos) const;
+    void unlock(std::uint64_t pos, std::uint32_t length, std::uint32_t span);
+
+    std::string name_;
+    void* base_;
+    std::size_t size_;
+    header* header_;
+    std::uint8_t* slots_;
+    std::uint64_t mask_;
+    bool geometry_matched_;
+};
+
+inline std::uint8_t* shm_ring::data_of(slot& s) const
+{
+    return reinterpret_cast<std::uint8_t*>(&s) + sizeof(slot);
+}
+
+inline bool shm_ring::geometry_matched() const
+{
+    return geometry_matched_;
+}
+
+inline std::uint64_t shm_ring::get_dropped() const
+{
+    return header_->dropped.load(std::memory_order_relaxed);
+}
+
+inline const std::string& shm_ring::get_name() const
+{
+    return name_;
+}
+
+inline shm_ring::overflow shm_ring::get_overflow() const
+{
+    return static_cast<overflow>(header_->policy);
+}
+
+inline std::uint64_t shm_ring::get_overwritten() const
+{
+    return header_->overwritten.load(std::memory_order_relaxed);
+}
+
+inline std::uint64_t shm_ring::get_read_position() const
+{
+    return header_->read_pos.load(std::memory_order_acquire);
+}
+
+inline std::uint32_t shm_ring::get_slot_count() const
+{
+    return header_->slot_count;
+}
+
+inline std::uint32_t shm_ring::get_slot_size() const
+{
+    return header_->slot_size;
+}
+
+inline std::uint64_t shm_ring::get_truncated() const
+{
+    return header_->truncated.load(std::memory_order_relaxed);
+}
+
+inline std::uint64_t shm_ring::get_write_position() const
+{
+    return header_->reserve.load(std::memory_order_acquire);
+}
+
+inline std::size_t shm_ring::payload_size() const
+{
+    return header_->slot_size - sizeof(slot);
+}
+
+inline shm_ring::slot& shm_ring::slot_at(std::uint64_t pos) const
+{
+    return *reinterpret_cast<slot*>(slots_ + (pos & mask_) * header_->slot_size);
+}
+
+inline void shm_ring::set_read_position(std::uint64_t pos)
+{
+    header_->read_pos.store(pos, std::memory_order_release);
+}
+
+}
+
+#endif
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_SHM_RING_READER_HPP_)
+#define CHUCHO_SHM_RING_READER_HPP_
+
+#include <chucho/export.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace chucho
+{
+
+class shm_ring;
+
+/**
+ * @class shm_ring_reader shm_ring_reader.hpp chucho/shm_ring_reader.hpp
+ * Read the records that a @ref shm_ring_writer puts into shared
+ * memory. A ring has one reader, which publishes its position in the
+ * ring, so that writers with the @ref
+ * shm_ring_writer::overflow_policy::DROP "DROP" policy know how much
+ * room there is. A new reader resumes where the last one stopped.
+ *
+ * Each record is the bytes that the writer's @ref serializer and
+ * @ref compressor produced. When the writer used a @ref
+ * formatted_message_serializer without a compressor, a record is
+ * just the formatted text of its events.
+ *
+ * The reader never blocks writers. If it falls behind a ring that
+ * overwrites, then it skips to the oldest intact record and counts
+ * what it missed in @ref get_lost().
+ *
+ * @ingroup writers
+ */
+class CHUCHO_EXPORT shm_ring_reader
+{
+public:
+    /**
+     * How long a slot may be claimed but unwritten before it is
+     * assumed that its writer died, which is one second.
+     */
+    static constexpr std::chrono::milliseconds DEFAULT_STALL_TIMEOUT = std::chrono::seconds(1);
+
+    /**
+     * @name Constructor and Destructor
+     * @{
+     */
+    /**
+     * Attach to a ring.
+     *
+     * @param ring_name the name of the shared memory segment
+     * @param stall_timeout how long to wait for a claimed slot
+     * @throw exception if the segment does not exist or is not a ring
+     */
+    shm_ring_reader(const std::string& ring_name,
+                    std::chrono::milliseconds stall_timeout = DEFAULT_STALL_TIMEOUT);
+    shm_ring_reader(const shm_ring_reader&) = delete;
+    /**
+     * Detach from the ring.
+     */
+    ~shm_ring_reader();
+    /**
+     * @}
+     */
+
+    shm_ring_reader& operator= (const shm_ring_reader&) = delete;
+
+    /**
+     * Remove a shared memory segment. Processes that have it
+     * mapped keep using it.
+     *
+     * @param ring_name the name of the segment
+     */
+    static void remove(const std::string& ring_name);
+
+    /**
+     * Return the number of records that the ring's writers have
+     * dropped.
+     *
+     * @return the number dropped
+     */
+    std::uint64_t get_dropped() const;
+    /**
+     * Return the number of slots that this reader skipped because
+     * they were overwritten before they could be read or their
+     * writer stalled.
+     *
+     * @return the number of lost slots
+     */
+    std::uint64_t get_lost() const;
+    /**
+     * Return the number of records that the ring's writers have
+     * written over unread ones.
+     *
+     * @return the number overwritten
+     */
+    std::uint64_t get_overwritten() const;
+    /**
+     * Return the normalized name of the segment.
+     *
+     * @return the name
+     */
+    const std::string& get_ring_name() const;
+    /**
+     * Return the number of slots in the ring.
+     *
+     * @return the slot count
+     */
+    std::uint32_t get_slot_count() const;
+    /**
+     * Return the size of each slot in the ring.
+     *
+     * @return the slot size
+     */
+    std::uint32_t get_slot_size() const;
+    /**
+     * Return the number of records that were truncated because they
+     * were too large for the ring.
+     *
+     * @return the number truncated
+     */
+    std::uint64_t get_truncated() const;
+    /**
+     * Return the number of slots that have been written but not
+     * read.
+     *
+     * @return the backlog
+     */
+    std::uint64_t get_unread() const;
+    /**
+     * Read the next record, waiting if there is none.
+     *
+     * @param rec the record, which is replaced
+     * @param timeout how long to wait, which may be zero
+     * @return true if a record was read, or false if none arrived
+     *         before the timeout
+     */
+    bool read(std::vector<std::uint8_t>& rec,
+              std::chrono::milliseconds timeout = std::chrono::milliseconds::zero());
+    /**
+     * Skip all unread records, so that the next one read is the
+     * next one written.
+     */
+    void seek_to_end();
+
+private:
+    CHUCHO_NO_EXPORT bool stalled();
+
+    std::unique_ptr<shm_ring> ring_;
+    std::uint64_t cursor_;
+    std::uint64_t lost_;
+    std::chrono::milliseconds stall_timeout_;
+    std::uint64_t stalled_at_;
+    std::chrono::steady_clock::time_point stalled_since_;
+};
+
+inline std::uint64_t shm_ring_reader::get_lost() const
+{
+    return lost_;
+}
+
+}
+
+#endif
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_SHM_RING_WRITER_HPP_)
+#define CHUCHO_SHM_RING_WRITER_HPP_
+
+#include <chucho/message_queue_writer.hpp>
+
+namespace chucho
+{
+
+class shm_ring;
+
+/**
+ * @class shm_ring_writer shm_ring_writer.hpp chucho/shm_ring_writer.hpp
+ * A writer that puts events into a ring buffer in POSIX shared
+ * memory, so that a process on the same host, such as a log shipper,
+ * can take them without this process doing any file or network I/O.
+ * Use @ref shm_ring_reader or the command-line program
+ * @c chucho-shm-tail to read the ring.
+ *
+ * The ring is a power-of-two number of fixed-size slots. A record,
+ * which is the output of the @ref serializer and the optional
+ * @ref compressor, occupies as many consecutive slots as it needs, up
+ * to half of the ring. Longer records are truncated and counted.
+ * Writers in any number of threads and processes claim slots with
+ * atomic operations and never wait for each other or for the reader.
+ * When the reader falls behind, the @ref overflow_policy decides
+ * whether new records overwrite the oldest unread ones or are
+ * dropped. Both cases are counted in the ring itself, so the reader
+ * sees them, too.
+ *
+ * The segment is created if it does not exist. If it does, then its
+ * layout is used, and a warning is reported if that differs from the
+ * one requested. The segment is not removed when the writer is
+ * destroyed, so that a reader may drain it afterwards.
+ *
+ * Each event is written as its own record by default. A coalesce
+ * maximum greater than one groups events into a record as other
+ * @ref message_queue_writer "message queue writers" do.
+ *
+ * @ingroup writers
+ */
+class CHUCHO_EXPORT shm_ring_writer : public message_queue_writer
+{
+public:
+    /**
+     * What to do when the reader has not caught up.
+     */
+    enum class overflow_policy
+    {
+        /**
+         * Replace the oldest unread records.
+         */
+        OVERWRITE,
+        /**
+         * Discard the new record.
+         */
+        DROP
+    };
+
+    /**
+     * The default number of slots, which is 4096.
+     */
+    static constexpr std::uint32_t DEFAULT_SLOT_COUNT = 4096;
+    /**
+     * The default size of a slot in bytes, including its 16-byte
+     * header, which is 256.
+     */
+    static constexpr std::uint32_t DEFAULT_SLOT_SIZE = 256;
+
+    /**
+     * @name Constructor and Destructor
+     * @{
+     */
+    /**
+     * Construct a shared memory ring writer.
+     *
+     * @param name the name of this writer
+     * @param fmt the formatter
+     * @param ser the serializer
+     * @param ring_name the name of the shared memory segment, to
+     *        which a leading slash is added if it is missing
+     * @param slot_count the number of slots, which must be a power of two
+     * @param slot_size the size of each slot, which must be a multiple
+     *        of eight that is at least 64
+     * @param ovr what to do when the reader has not caught up
+     * @param cmp the compressor
+     * @throw exception if the segment cannot be created or opened
+     */
+    shm_ring_writer(const std::string& name,
+                    std::unique_ptr<formatter>&& fmt,
+                    std::unique_ptr<serializer>&& ser,
+                    const std::string& ring_name,
+                    std::uint32_t slot_count = DEFAULT_SLOT_COUNT,
+                    std::uint32_t slot_size = DEFAULT_SLOT_SIZE,
+                    overflow_policy ovr = overflow_policy::OVERWRITE,
+                    std::unique_ptr<compressor>&& cmp = std::move(std::unique_ptr<compressor>()));
+    /**
+     * Destroy the writer.
+     */
+    ~shm_ring_writer();
+    /**
+     * @}
+     */
+
+    /**
+     * Return the number of records that have been dropped from the
+     * ring by all of its writers.
+     *
+     * @return the number dropped
+     */
+    std::uint64_t get_dropped() const;
+    /**
+     * Return the policy of the ring. If the ring already existed,
+     * then this is the policy it was created with.
+     *
+     * @return the overflow policy
+     */
+    overflow_policy get_overflow_policy() const;
+    /**
+     * Return the number of records written by all of the ring's
+     * writers over records that had not been read.
+     *
+     * @return the number overwritten
+     */
+    std::uint64_t get_overwritten() const;
+    /**
+     * Return the normalized name of the shared memory segment.
+     *
+     * @return the name
+     */
+    const std::string& get_ring_name() const;
+    /**
+     * Return the number of slots in the ring.
+     *
+     * @return the slot count
+     */
+    std::uint32_t get_slot_count() const;
+    /**
+     * Return the size of each slot in the ring.
+     *
+     * @return the slot size
+     */
+    std::uint32_t get_slot_size() const;
+    /**
+     * Return the number of records that were too large for the ring
+     * and were truncated.
+     *
+     * @return the number truncated
+     */
+    std::uint64_t get_truncated() const;
+
+protected:
+    virtual void flush_impl(const std::vector<std::uint8_t>& blob) override;
+
+private:
+    std::unique_ptr<shm_ring> ring_;
+};
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_SHM_RING_WRITER_MEMENTO_HPP_)
+#define CHUCHO_SHM_RING_WRITER_MEMENTO_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/message_queue_writer_memento.hpp>
+#include <chucho/shm_ring_writer.hpp>
+#include <chucho/optional.hpp>
+
+namespace chucho
+{
+
+class shm_ring_writer_memento : public message_queue_writer_memento
+{
+public:
+    shm_ring_writer_memento(configurator& cfg);
+
+    const optional<shm_ring_writer::overflow_policy>& get_overflow() const;
+    const std::string& get_ring_name() const;
+    const optional<std::uint32_t>& get_slot_count() const;
+    const optional<std::uint32_t>& get_slot_size() const;
+
+private:
+    void set_overflow(const std::string& ovr);
+
+    std::string ring_name_;
+    optional<std::uint32_t> slot_count_;
+    optional<std::uint32_t> slot_size_;
+    optional<shm_ring_writer::overflow_policy> overflow_;
+};
+
+inline const optional<shm_ring_writer::overflow_policy>& shm_ring_writer_memento::get_overflow() const
+{
+    return overflow_;
+}
+
+inline const std::string& shm_ring_writer_memento::get_ring_name() const
+{
+    return ring_name_;
+}
+
+inline const optional<std::uint32_t>& shm_ring_writer_memento::get_slot_count() const
+{
+    return slot_count_;
+}
+
+inline const optional<std::uint32_t>& shm_ring_writer_memento::get_slot_size() const
+{
+    return slot_size_;
+}
+
+}
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <chucho/file_roll_trigger.hpp>
 #include <cstdint>
+#include <limits>
 
 namespace chucho
 {
@@ -29,13 +30,25 @@ namespace chucho
  * active log file reaches this trigger's maximum size, then it 
  * will signal that now would be a good time to roll the file. 
  *  
+ * If the writer writes its file with a @ref stream_compressor,
+ * then the maximum size is that of the compressed file, and a
+ * separate maximum uncompressed size can limit the number of
+ * bytes that were compressed into the file. The trigger fires
+ * when either limit is reached. Without compression, the file's
+ * size is also its uncompressed size.
+ *  
  * @ingroup rolling 
  */
 class CHUCHO_EXPORT size_file_roll_trigger : public file_roll_trigger
 {
 public:
     /**
-     * @name Constructor
+     * The value of a maximum size that is not limited.
+     */
+    static constexpr std::uintmax_t UNLIMITED = std::numeric_limits<std::uintmax_t>::max();
+
+    /**
+     * @name Constructors
      */
     //@{
     /**
@@ -45,6 +58,18 @@ public:
      *                 rolling
      */
     size_file_roll_trigger(std::uintmax_t max_size);
+    /**
+     * Construct a size_file_roll_trigger that also limits the
+     * uncompressed size.
+     *
+     * @param max_size the maximum size that a file can reach before
+     *                 rolling, which may be @ref UNLIMITED
+     * @param max_uncompressed_size the maximum number of bytes that
+     *                              can be written to a file before
+     *                              they are compressed, which may be
+     *                              @ref UNLIMITED
+     */
+    size_file_roll_trigger(std::uintmax_t max_size, std::uintmax_t max_uncompressed_size);
     //@}
 
     /**
@@ -53,6 +78,12 @@ public:
      * @return this trigger's maximum size
      */
     std::uintmax_t get_max_size() const;
+    /**
+     * Return this trigger's maximum uncompressed size.
+     *
+     * @return the maximum uncompressed size
+     */
+    std::uintmax_t get_max_uncompressed_size() const;
     /**
      * If the size of active_file is greater than this trigger's 
      * maximum size, then this trigger fires. 
@@ -62,9 +93,20 @@ public:
      * @return bool true if the file size has exceeded the limit
      */
     virtual bool is_triggered(const std::string& active_file, const event& e) override;
+    /**
+     * If the writer's file has reached either this trigger's
+     * maximum size or its maximum uncompressed size, then this
+     * trigger fires.
+     *
+     * @param writer the writer
+     * @param e the log event
+     * @return true if either size has reached its limit
+     */
+    virtual bool is_triggered(const file_writer& writer, const event& e) override;
 
 private:
     std::uintmax_t max_size_;
+    std::uintmax_t max_uncompressed_size_;
 };
 
 inline std::uintmax_t size_file_roll_trigger::get_max_size() const
@@ -72,6 +114,11 @@ inline std::uintmax_t size_file_roll_trigger::get_max_size() const
     return max_size_;
 }
 
+inline std::uintmax_t size_file_roll_trigger::get_max_uncompressed_size() const
+{
+    return max_uncompressed_size_;
+}
+
 }
 
 #endif
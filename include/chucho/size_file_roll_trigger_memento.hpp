@@ -34,9 +34,11 @@ public:
     size_file_roll_trigger_memento(configurator& cfg);
 
     const optional<std::uintmax_t>& get_max_size() const;
+    const optional<std::uintmax_t>& get_max_uncompressed_size() const;
 
 private:
     optional<std::uintmax_t> max_size_;
+    optional<std::uintmax_t> max_uncompressed_size_;
 };
 
 inline const optional<std::uintmax_t>& size_file_roll_trigger_memento::get_max_size() const
@@ -44,6 +46,11 @@ inline const optional<std::uintmax_t>& size_file_roll_trigger_memento::get_max_s
     return max_size_;
 }
 
+inline const optional<std::uintmax_t>& size_file_roll_trigger_memento::get_max_uncompressed_size() const
+{
+    return max_uncompressed_size_;
+}
+
 }
 
 #endif
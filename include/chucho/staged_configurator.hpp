@@ -0,0 +1,132 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#if !defined(CHUCHO_STAGED_CONFIGURATOR_HPP_)
+#define CHUCHO_STAGED_CONFIGURATOR_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/configurator.hpp>
+#include <chucho/configurable_factory.hpp>
+#include <chucho/memento.hpp>
+#include <vector>
+
+namespace chucho
+{
+
+class level;
+class logger;
+class writer;
+
+/**
+ * Stage a configuration, so that it can be applied to the
+ * existing loggers without tearing down writers that have not
+ * changed. While the staged configurator exists, its configurator
+ * records what it reads instead of creating anything. Then, @ref
+ * publish compares each logger's recorded writers to the writers
+ * that were created by the previous configuration. A writer whose
+ * configuration is identical is kept, and the others are created.
+ * Finally, once every logger's new level and writers have been
+ * built, they are all swapped in while every affected logger is
+ * locked, so an event is written either with the old configuration
+ * or the new one.
+ */
+class CHUCHO_PRIV_EXPORT staged_configurator : public status_reporter
+{
+public:
+    staged_configurator(configurator& cfg);
+    ~staged_configurator();
+
+    /**
+     * Apply the staged configuration.
+     *
+     * @param replace if true, then loggers are set to exactly what
+     *        was configured, and loggers that do not appear in the
+     *        configuration are reset; otherwise, configured writers
+     *        are added to the writers that the loggers already have
+     */
+    void publish(bool replace);
+
+private:
+    class recorded : public configurable
+    {
+    public:
+        struct item
+        {
+            std::string key;
+            std::string value;
+            std::unique_ptr<recorded> child;
+        };
+
+        recorded(configurable_factory& fact, const std::string& type);
+
+        std::string get_fingerprint() const;
+
+        configurable_factory& factory_;
+        std::string type_;
+        std::vector<item> items_;
+    };
+
+    class recording_memento : public memento
+    {
+    public:
+        recording_memento(configurator& cfg);
+
+        using memento::handle;
+        virtual void handle(std::unique_ptr<configurable>&& cnf) override;
+
+        std::vector<recorded::item> items_;
+
+    protected:
+        virtual void default_handler(const std::string& key, const std::string& value) override;
+    };
+
+    class recording_factory : public configurable_factory
+    {
+    public:
+        recording_factory(staged_configurator& stg,
+                          configurable_factory& fact,
+                          const std::string& type);
+
+        virtual std::unique_ptr<configurable> create_configurable(std::unique_ptr<memento>& mnto) override;
+        virtual std::unique_ptr<memento> create_memento(configurator& cfg) override;
+
+    private:
+        staged_configurator& staged_;
+        configurable_factory& factory_;
+        std::string type_;
+    };
+
+    // One logger's replacement, built before any logger changes
+    struct prepared;
+
+    std::unique_ptr<configurable> create(recorded& rec);
+    void prepare(std::shared_ptr<logger> lgr,
+                 std::shared_ptr<level> lvl,
+                 bool wta,
+                 const std::vector<recorded*>& wrts,
+                 bool replace,
+                 prepared& prep);
+
+    configurator& cfg_;
+    std::map<std::string, std::unique_ptr<configurable_factory>> factories_;
+    std::vector<std::unique_ptr<recorded>> loggers_;
+};
+
+}
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_STREAM_COMPRESSOR_HPP_)
+#define CHUCHO_STREAM_COMPRESSOR_HPP_
+
+#include <chucho/configurable.hpp>
+#include <chucho/status_reporter.hpp>
+#include <chucho/non_copyable.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace chucho
+{
+
+/**
+ * @class stream_compressor stream_compressor.hpp chucho/stream_compressor.hpp
+ * Compressors that can be used by a @ref file_writer to write
+ * its file as a compressed stream. Unlike a @ref compressor,
+ * which compresses each message on its own, a stream compressor
+ * keeps its state from one call to the next, so that a whole
+ * file forms one compressed stream.
+ *
+ * @ingroup compressors
+ */
+class CHUCHO_EXPORT stream_compressor : non_copyable, public configurable, public status_reporter
+{
+public:
+    /**
+     * @name Destructor
+     * @{
+     */
+    /**
+     * Destroy a compressor.
+     */
+    virtual ~stream_compressor() { }
+    /**
+     * @}
+     */
+
+    /**
+     * Compress bytes. The compressor may hold on to some of the
+     * compressed output until @ref sync or @ref finish is called.
+     *
+     * @param data the bytes to compress
+     * @param len the number of bytes
+     * @param out the vector to which compressed bytes are appended
+     */
+    virtual void compress(const char* data, std::size_t len, std::vector<std::uint8_t>& out) = 0;
+    /**
+     * End the stream. The next bytes compressed will begin a new
+     * stream. If nothing has been compressed since the stream
+     * began, then nothing is appended.
+     *
+     * @param out the vector to which compressed bytes are appended
+     */
+    virtual void finish(std::vector<std::uint8_t>& out) = 0;
+    /**
+     * Emit all bytes compressed so far, so that a reader of the
+     * stream can decompress them without waiting for the stream to
+     * end.
+     *
+     * @param out the vector to which compressed bytes are appended
+     */
+    virtual void sync(std::vector<std::uint8_t>& out) = 0;
+};
+
+}
+
+#endif
@@ -36,6 +36,11 @@ namespace syslog
  */
 CHUCHO_EXPORT extern const std::uint16_t DEFAULT_PORT;
 
+/**
+ * The default port for syslog over TCP, which is 601.
+ */
+CHUCHO_EXPORT extern const std::uint16_t DEFAULT_TCP_PORT;
+
 /**
  * All standard syslog facilities. Defined in the file
  * <chucho/syslog_constants.hpp>. 
@@ -79,6 +84,26 @@ enum class severity
     INFORMATIONAL, /**< Information messages */
     DEBUG_ /**< Debug-level messages. This constant has a trailing underscore so that it will not clash with a possible macro named DEBUG. */
 };
+
+/**
+ * The transport protocols for sending to a remote syslog. Defined
+ * in the file <chucho/syslog_constants.hpp>.
+ */
+enum class transport_protocol
+{
+    UDP, /**< One datagram per message */
+    TCP  /**< A persistent connection with octet-counted framing, as in RFC 6587 */
+};
+
+/**
+ * The formats of messages sent to a remote syslog. Defined in the
+ * file <chucho/syslog_constants.hpp>.
+ */
+enum class message_format
+{
+    RFC3164, /**< The traditional BSD format */
+    RFC5424  /**< The IETF format, which can carry structured data */
+};
 //@}
 
 }
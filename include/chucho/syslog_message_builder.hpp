@@ -0,0 +1,70 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_SYSLOG_MESSAGE_BUILDER_HPP_)
+#define CHUCHO_SYSLOG_MESSAGE_BUILDER_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/syslog_constants.hpp>
+#include <chucho/event.hpp>
+#include <array>
+#include <ctime>
+#include <string>
+
+namespace chucho
+{
+
+/**
+ * Builds the text of messages sent to a remote syslog. Everything
+ * that doesn't change from one message to the next is computed
+ * once, and the timestamp is only reformatted when the second
+ * changes.
+ *
+ * @note This class is not thread-safe.
+ */
+class CHUCHO_PRIV_EXPORT syslog_message_builder
+{
+public:
+    syslog_message_builder(syslog::facility fcl,
+                           syslog::message_format mfmt,
+                           const std::string& structured_data_id);
+
+    /**
+     * Append a complete message, without any framing, to text.
+     */
+    void append(std::string& text,
+                syslog::severity sev,
+                const event& evt,
+                const std::string& message);
+
+private:
+    void append_structured_data(std::string& text, const event& evt);
+    void append_time(std::string& text, const event::time_type& when);
+
+    syslog::message_format format_;
+    std::array<std::string, 8> priorities_;
+    std::string host_part_;
+    std::string structured_data_id_;
+    std::time_t cached_second_;
+    std::string cached_time_;
+};
+
+}
+
+#endif
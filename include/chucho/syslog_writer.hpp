@@ -24,6 +24,7 @@
 
 #include <chucho/writer.hpp>
 #include <chucho/optional.hpp>
+#include <functional>
 
 namespace chucho
 {
@@ -37,6 +38,40 @@ class syslog_transport_handle;
  * syslog. Otherwise, if the platform supports it, then the 
  * writer will use the native syslog interface and allow the 
  * system to handle the IPC. 
+ *
+ * A remote syslog may also be reached over TCP, in which case a
+ * persistent connection is kept and messages are framed by octet
+ * counting, as described in RFC 6587. If the connection breaks,
+ * it is reestablished, though no more often than once per second.
+ * Messages that are written while no connection can be made are
+ * lost.
+ *
+ * Remote messages may be sent in the traditional format of RFC
+ * 3164, or in the format of RFC 5424. The latter may carry
+ * structured data describing the origin of each event. When a
+ * structured data ID is given, like <tt>origin@32473</tt>, each
+ * message carries an element with that ID and the parameters
+ * @c logger, @c file, @c line, @c function, @c thread and, if the
+ * event has one, @c marker.
+ *
+ * Messages to a remote syslog may also be batched. Up to
+ * batch_size messages are held and then sent together, with one
+ * @c sendmmsg() call for UDP, where the platform has it, or one
+ * write for TCP. Held messages are also sent by a background
+ * thread once the oldest of them is a second old, when flush()
+ * is called, and when the writer is destroyed. Batching is most
+ * useful behind an @ref async_writer.
+ *
+ * Over TCP, writing never touches the network. Messages are
+ * framed into a buffer of at most a megabyte, and a background
+ * thread connects, reconnects and sends, so a slow or unreachable
+ * collector cannot hold up the application. Messages that do not
+ * fit in the buffer are dropped, and the number dropped is
+ * reported as a warning. The thread waits at most half a second
+ * for a connection to complete and at most a second for a stalled
+ * connection to accept more data, and if the connection is lost,
+ * a new one is attempted at most once a second. Calling flush()
+ * waits for the thread to send what has been written.
  * 
  * @ingroup writers syslog
  */
@@ -86,8 +121,51 @@ public:
                   syslog::facility fcl,
                   const std::string& host,
                   std::uint16_t port = syslog::DEFAULT_PORT);
+    /**
+     * Construct a syslog_writer that writes to a remote syslog.
+     *
+     * @param name the name of this writer
+     * @param fmt the formatter
+     * @param fcl the syslog facility
+     * @param host the syslog host 
+     * @param port the port on which syslogd is listening 
+     * @param proto the transport protocol
+     * @param mfmt the format of the messages
+     * @param batch_size the number of messages to send at once
+     * @param structured_data_id the ID of the structured data
+     *        element, which is only used with @ref
+     *        syslog::message_format::RFC5424, and which omits
+     *        structured data if empty
+     * @throw std::invalid_argument if fmt is an uninitialized 
+     *        std::unique_ptr or batch_size is zero
+     * @throw exception if the syslog host cannot be resolved or
+     *        the socket cannot be created
+     */
+    syslog_writer(const std::string& name,
+                  std::unique_ptr<formatter>&& fmt,
+                  syslog::facility fcl,
+                  const std::string& host,
+                  std::uint16_t port,
+                  syslog::transport_protocol proto,
+                  syslog::message_format mfmt = syslog::message_format::RFC3164,
+                  std::size_t batch_size = 1,
+                  const std::string& structured_data_id = std::string());
+    /**
+     * Destroy the writer, sending any messages that are held.
+     */
+    ~syslog_writer();
     //@}
 
+    /**
+     * Send any messages that are held in a batch.
+     */
+    void flush();
+    /**
+     * Return the number of messages that are sent at once.
+     *
+     * @return the batch size
+     */
+    std::size_t get_batch_size() const;
     /**
      * Return the syslog facility.
      * 
@@ -108,6 +186,24 @@ public:
      * @return the syslog host name
      */
     const optional<std::uint16_t>& get_port() const;
+    /**
+     * Return the message format.
+     *
+     * @return the format
+     */
+    syslog::message_format get_message_format() const;
+    /**
+     * Return the transport protocol.
+     *
+     * @return the protocol
+     */
+    syslog::transport_protocol get_protocol() const;
+    /**
+     * Return the ID of the structured data element.
+     *
+     * @return the ID, which is empty if no structured data is sent
+     */
+    const std::string& get_structured_data_id() const;
 
 protected:
     virtual void write_impl(const event& evt) override;
@@ -116,16 +212,20 @@ private:
     class CHUCHO_NO_EXPORT transport
     {
     public:
-        transport();
-        transport(const std::string& host, std::uint16_t port);
+        transport(syslog::facility fcl);
+        transport(syslog::facility fcl,
+                  const std::string& host,
+                  std::uint16_t port,
+                  syslog::transport_protocol proto,
+                  syslog::message_format mfmt,
+                  std::size_t batch_size,
+                  const std::string& structured_data_id,
+                  std::function<void()> configure_thread);
         ~transport();
 
-        std::string format(syslog::facility fcl,
-                           syslog::severity sev,
-                           const event::time_type& when,
-                           const std::string& message);
-        void send(syslog::facility fcl,
-                  syslog::severity sev,
+        void flush();
+        void send(syslog::severity sev,
+                  const event& evt,
                   const std::string& message);
 
     private:
@@ -141,8 +241,17 @@ private:
     syslog::facility facility_;
     std::string host_name_;
     optional<std::uint16_t> port_;
+    syslog::transport_protocol protocol_;
+    syslog::message_format message_format_;
+    std::size_t batch_size_;
+    std::string structured_data_id_;
 };
 
+inline std::size_t syslog_writer::get_batch_size() const
+{
+    return batch_size_;
+}
+
 inline syslog::facility syslog_writer::get_facility() const
 {
     return facility_;
@@ -158,6 +267,21 @@ inline const optional<std::uint16_t>& syslog_writer::get_port() const
     return port_;
 }
 
+inline syslog::message_format syslog_writer::get_message_format() const
+{
+    return message_format_;
+}
+
+inline syslog::transport_protocol syslog_writer::get_protocol() const
+{
+    return protocol_;
+}
+
+inline const std::string& syslog_writer::get_structured_data_id() const
+{
+    return structured_data_id_;
+}
+
 }
 
 #if defined(_MSC_VER)
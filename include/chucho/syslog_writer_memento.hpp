@@ -33,18 +33,33 @@ class syslog_writer_memento : public writer_memento
 public:
     syslog_writer_memento(configurator& cfg);
 
+    const optional<std::size_t>& get_batch_size() const;
     const optional<syslog::facility>& get_facility() const;
     const std::string& get_host_name() const;
+    const optional<syslog::message_format>& get_message_format() const;
     const optional<std::uint16_t> get_port() const;
+    const optional<syslog::transport_protocol>& get_protocol() const;
+    const std::string& get_structured_data_id() const;
 
 private:
     void set_facility(const std::string& name);
+    void set_message_format(const std::string& name);
+    void set_protocol(const std::string& name);
 
     std::string host_name_;
     optional<syslog::facility> facility_;
     optional<std::uint16_t> port_;
+    optional<syslog::transport_protocol> protocol_;
+    optional<syslog::message_format> message_format_;
+    optional<std::size_t> batch_size_;
+    std::string structured_data_id_;
 };
 
+inline const optional<std::size_t>& syslog_writer_memento::get_batch_size() const
+{
+    return batch_size_;
+}
+
 inline const optional<syslog::facility>& syslog_writer_memento::get_facility() const
 {
     return facility_;
@@ -55,11 +70,26 @@ inline const std::string& syslog_writer_memento::get_host_name() const
     return host_name_;
 }
 
+inline const optional<syslog::message_format>& syslog_writer_memento::get_message_format() const
+{
+    return message_format_;
+}
+
 inline const optional<std::uint16_t> syslog_writer_memento::get_port() const
 {
     return port_;
 }
 
+inline const optional<syslog::transport_protocol>& syslog_writer_memento::get_protocol() const
+{
+    return protocol_;
+}
+
+inline const std::string& syslog_writer_memento::get_structured_data_id() const
+{
+    return structured_data_id_;
+}
+
 }
 
 #endif
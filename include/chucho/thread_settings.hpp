@@ -0,0 +1,233 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_THREAD_SETTINGS_HPP_)
+#define CHUCHO_THREAD_SETTINGS_HPP_
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include <chucho/optional.hpp>
+#include <string>
+#include <vector>
+
+namespace chucho
+{
+
+/**
+ * @class thread_settings thread_settings.hpp chucho/thread_settings.hpp
+ * How chucho's own threads run. Writers like @ref async_writer
+ * and @ref file_writer do their work in background threads, which
+ * would otherwise compete on equal terms with the application's
+ * threads. Settings can be given to a writer with @ref
+ * writer::set_thread_settings, and to all of chucho's threads with
+ * @ref configuration::set_thread_settings. Anything that a writer
+ * does not set is taken from the global settings, and anything
+ * that neither sets leaves the thread as it was created.
+ *
+ * Threads are named after their role and their writer, like
+ * async:my_writer. Linux limits thread names to 15 characters, so
+ * there the writer's name is cut to its last characters, and a
+ * writer named my_rolling_writer has a thread named
+ * async:ng_writer.
+ *
+ * Affinity, scheduling and NUMA nodes are only supported on Linux.
+ * On Windows, niceness maps to thread priorities. Anything that
+ * is not supported is reported as a warning and otherwise ignored.
+ *
+ * @ingroup miscellaneous
+ */
+class CHUCHO_EXPORT thread_settings
+{
+public:
+    /**
+     * The scheduling policy.
+     */
+    enum class scheduling
+    {
+        NORMAL, /**< The default time-sharing policy. */
+        BATCH,  /**< For CPU-bound work that is not interactive (SCHED_BATCH). */
+        IDLE    /**< Only run when nothing else wants to (SCHED_IDLE). */
+    };
+
+    /**
+     * Parse a list of CPUs, like "0-3,8,10-11".
+     *
+     * @param text the text to parse
+     * @return the CPUs in ascending order
+     * @throw std::invalid_argument if the text is not a list of CPUs
+     */
+    static std::vector<unsigned> parse_cpu_list(const std::string& text);
+    /**
+     * Parse a scheduling policy, which is one of "normal", "batch"
+     * or "idle", in any case.
+     *
+     * @param text the text to parse
+     * @return the policy
+     * @throw std::invalid_argument if the text is not a policy
+     */
+    static scheduling parse_scheduling(const std::string& text);
+
+    /**
+     * Return the CPUs on which the threads may run.
+     *
+     * @return the CPUs, which are empty if affinity is not set
+     */
+    const std::vector<unsigned>& get_affinity() const;
+    /**
+     * Return the name of the thread, which replaces the name that
+     * chucho would have given it. Global settings have no name.
+     *
+     * @return the name, which is empty if not set
+     */
+    const std::string& get_name() const;
+    /**
+     * Return the niceness of the threads, in the sense of the Unix
+     * nice command.
+     *
+     * @return the niceness
+     */
+    const optional<int>& get_nice() const;
+    /**
+     * Return the NUMA node that the threads prefer. Memory is
+     * preferably allocated from the node, and, if no affinity is
+     * set, the threads run on the node's CPUs.
+     *
+     * @return the node
+     */
+    const optional<unsigned>& get_numa_node() const;
+    /**
+     * Return the scheduling policy.
+     *
+     * @return the policy
+     */
+    const optional<scheduling>& get_scheduling() const;
+    /**
+     * Return whether nothing is set.
+     *
+     * @return true if nothing is set
+     */
+    bool is_empty() const;
+    /**
+     * Set the CPUs on which the threads may run.
+     *
+     * @param cpus the CPUs, where empty means any CPU
+     */
+    void set_affinity(const std::vector<unsigned>& cpus);
+    /**
+     * Set the name of the thread.
+     *
+     * @param name the name
+     */
+    void set_name(const std::string& name);
+    /**
+     * Set the niceness of the threads. Positive values lower their
+     * priority, and negative values, which usually require special
+     * privileges, raise it.
+     *
+     * @param nice the niceness, from -20 to 19
+     * @throw std::invalid_argument if the niceness is out of range
+     */
+    void set_nice(int nice);
+    /**
+     * Set the NUMA node that the threads prefer.
+     *
+     * @param node the node
+     */
+    void set_numa_node(unsigned node);
+    /**
+     * Set the scheduling policy.
+     *
+     * @param sched the policy
+     */
+    void set_scheduling(scheduling sched);
+    /**
+     * Return these settings with anything that is not set taken
+     * from other settings. The name is never taken from the other
+     * settings.
+     *
+     * @param dflt the other settings
+     * @return the combined settings
+     */
+    thread_settings with_defaults(const thread_settings& dflt) const;
+
+private:
+    std::vector<unsigned> affinity_;
+    std::string name_;
+    optional<int> nice_;
+    optional<unsigned> numa_node_;
+    optional<scheduling> scheduling_;
+};
+
+inline const std::vector<unsigned>& thread_settings::get_affinity() const
+{
+    return affinity_;
+}
+
+inline const std::string& thread_settings::get_name() const
+{
+    return name_;
+}
+
+inline const optional<int>& thread_settings::get_nice() const
+{
+    return nice_;
+}
+
+inline const optional<unsigned>& thread_settings::get_numa_node() const
+{
+    return numa_node_;
+}
+
+inline const optional<thread_settings::scheduling>& thread_settings::get_scheduling() const
+{
+    return scheduling_;
+}
+
+inline bool thread_settings::is_empty() const
+{
+    return affinity_.empty() && name_.empty() && !nice_ && !numa_node_ && !scheduling_;
+}
+
+inline void thread_settings::set_affinity(const std::vector<unsigned>& cpus)
+{
+    affinity_ = cpus;
+}
+
+inline void thread_settings::set_name(const std::string& name)
+{
+    name_ = name;
+}
+
+inline void thread_settings::set_numa_node(unsigned node)
+{
+    numa_node_ = node;
+}
+
+inline void thread_settings::set_scheduling(scheduling sched)
+{
+    scheduling_ = sched;
+}
+
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_THREAD_UTIL_HPP_)
+#define CHUCHO_THREAD_UTIL_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/thread_settings.hpp>
+#include <cstdint>
+
+namespace chucho
+{
+
+namespace thread_util
+{
+
+/**
+ * Adjust the scheduling priority of the calling thread by the
+ * given niceness, where positive values lower the priority. Only
+ * the calling thread is affected, and threads that it creates
+ * afterward inherit the adjustment where the platform supports it.
+ *
+ * @param nice the adjustment
+ * @return whether the priority could be adjusted
+ */
+CHUCHO_PRIV_EXPORT bool adjust_nice(int nice);
+/**
+ * Let the calling thread run on any of the process's CPUs.
+ *
+ * @return whether the affinity could be cleared
+ */
+CHUCHO_PRIV_EXPORT bool clear_affinity();
+/**
+ * Let the calling thread take memory from any NUMA node.
+ *
+ * @return whether the preference could be cleared
+ */
+CHUCHO_PRIV_EXPORT bool clear_numa_node();
+/**
+ * Apply settings to the calling thread. Anything that cannot be
+ * applied is reported as a warning.
+ *
+ * @param ts the settings
+ * @param name the name to give the thread if the settings have none
+ */
+CHUCHO_PRIV_EXPORT void configure(const thread_settings& ts, const std::string& name);
+/**
+ * Apply settings to the calling thread, which has already applied
+ * others. Anything that the previous settings set and the new ones
+ * do not is restored to its default: affinity to all CPUs, no NUMA
+ * node, normal scheduling and a niceness of zero.
+ *
+ * @param ts the settings
+ * @param name the name to give the thread if the settings have none
+ * @param previous the settings that were applied before
+ */
+CHUCHO_PRIV_EXPORT void configure(const thread_settings& ts,
+                                  const std::string& name,
+                                  const thread_settings& previous);
+/**
+ * Return the settings that were last applied to the calling thread
+ * with @ref configure, with the name that the thread was given. A
+ * thread that starts helpers hands these to them, so that the
+ * helpers run the way it does. If nothing has been applied to the
+ * calling thread, then the global settings are returned.
+ *
+ * @return the settings
+ */
+CHUCHO_PRIV_EXPORT thread_settings get_applied_settings();
+/**
+ * Return the settings that apply to all of chucho's threads.
+ *
+ * @return the settings
+ */
+CHUCHO_PRIV_EXPORT thread_settings get_global_settings();
+/**
+ * Return a number that changes each time the global settings
+ * change, so threads can tell when to apply them again.
+ *
+ * @return the version
+ */
+CHUCHO_PRIV_EXPORT std::uint32_t get_global_version();
+/**
+ * Return the CPUs of a NUMA node.
+ *
+ * @param node the node
+ * @return the CPUs, which are empty if they cannot be found
+ */
+CHUCHO_PRIV_EXPORT std::vector<unsigned> get_numa_node_cpus(unsigned node);
+/**
+ * Make a thread name from a role and the name of whatever owns the
+ * thread, like async:my_writer. Where thread names are limited in
+ * length, as they are to 15 characters on Linux, the role is kept
+ * and the owner's name loses characters from its start, since
+ * names often share a prefix and differ at the end.
+ *
+ * @param role the role, which should be short
+ * @param owner the owner's name
+ * @return the name
+ */
+CHUCHO_PRIV_EXPORT std::string make_name(const std::string& role, const std::string& owner);
+/**
+ * Restrict the calling thread to some CPUs.
+ *
+ * @param cpus the CPUs
+ * @return whether the affinity could be set
+ */
+CHUCHO_PRIV_EXPORT bool set_affinity(const std::vector<unsigned>& cpus);
+/**
+ * Set the settings that apply to all of chucho's threads.
+ *
+ * @param ts the settings
+ */
+CHUCHO_PRIV_EXPORT void set_global_settings(const thread_settings& ts);
+/**
+ * Name the calling thread.
+ *
+ * @param name the name, which may be truncated
+ * @return whether the name could be set
+ */
+CHUCHO_PRIV_EXPORT bool set_name(const std::string& name);
+/**
+ * Set the niceness of the calling thread, regardless of what it
+ * was before.
+ *
+ * @param nice the niceness
+ * @return whether the niceness could be set
+ */
+CHUCHO_PRIV_EXPORT bool set_nice(int nice);
+/**
+ * Make the calling thread prefer memory from a NUMA node.
+ *
+ * @param node the node
+ * @return whether the preference could be set
+ */
+CHUCHO_PRIV_EXPORT bool set_numa_node(unsigned node);
+/**
+ * Set the scheduling policy of the calling thread.
+ *
+ * @param sched the policy
+ * @return whether the policy could be set
+ */
+CHUCHO_PRIV_EXPORT bool set_scheduling(thread_settings::scheduling sched);
+
+}
+
+}
+
+#endif
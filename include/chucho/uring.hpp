@@ -0,0 +1,83 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_URING_HPP_)
+#define CHUCHO_URING_HPP_
+
+#if !defined(CHUCHO_BUILD)
+#error "This header is private"
+#endif
+
+#include <chucho/export.h>
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+#include <cstddef>
+#include <vector>
+
+namespace chucho
+{
+
+// A minimal io_uring, driven with the system calls directly. Only
+// one thread may use it at a time.
+class CHUCHO_PRIV_EXPORT uring
+{
+public:
+    // Throws exception if the ring cannot be created
+    uring(unsigned entries);
+    uring(const uring&) = delete;
+    ~uring();
+
+    uring& operator= (const uring&) = delete;
+
+    // Return the next entry to fill, which is cleared, or nullptr if
+    // all entries are waiting to be submitted
+    io_uring_sqe* get_sqe();
+    // Copy the next completion and consume it, or return false if
+    // there is none
+    bool peek(io_uring_cqe& cqe);
+    // Returns false if the kernel refuses, as it may when the buffers
+    // would exceed the locked memory limit
+    bool register_buffers(const std::vector<iovec>& bufs);
+    // Submit whatever has been filled and wait for at least the given
+    // number of completions
+    void submit(unsigned wait_for = 0);
+
+private:
+    CHUCHO_NO_EXPORT void release();
+
+    int fd_;
+    void* sq_ptr_;
+    std::size_t sq_size_;
+    void* cq_ptr_;
+    std::size_t cq_size_;
+    io_uring_sqe* sqes_;
+    std::size_t sqes_size_;
+    unsigned* sq_head_;
+    unsigned* sq_tail_;
+    unsigned* sq_mask_;
+    unsigned* sq_entries_;
+    unsigned* sq_array_;
+    unsigned* cq_head_;
+    unsigned* cq_tail_;
+    unsigned* cq_mask_;
+    io_uring_cqe* cqes_;
+    // Entries filled but not yet submitted
+    unsigned to_submit_;
+};
+
+}
+
+#endif
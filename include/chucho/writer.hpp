@@ -26,6 +26,9 @@
 #include <chucho/formatter.hpp>
 #include <chucho/configurable.hpp>
 #include <chucho/non_copyable.hpp>
+#include <chucho/thread_settings.hpp>
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <mutex>
 #include <vector>
@@ -108,12 +111,27 @@ public:
      * @return the name
      */
     const std::string& get_name() const;
+    /**
+     * Return the settings of the threads that this writer creates.
+     *
+     * @return the settings
+     */
+    thread_settings get_thread_settings();
     /**
      * Remove a named filter.
      *
      * @param name the name of the filter to remove
      */
     void remove_filter(const std::string& name);
+    /**
+     * Set the settings of the threads that this writer creates.
+     * Threads that are already running pick up the new settings
+     * the next time they call @ref configure_thread, and settings
+     * that are no longer given are restored to their defaults.
+     *
+     * @param ts the settings
+     */
+    void set_thread_settings(const thread_settings& ts);
     /**
      * Write an event. This non-virtual method takes care of all the 
      * common housekeeping that writers must undertake when writing 
@@ -128,6 +146,50 @@ public:
     void write(const event& evt);
 
 protected:
+    /**
+     * What a thread has applied from this writer's thread settings.
+     * Each thread that a writer creates keeps one of these, so that
+     * @ref configure_thread can tell what has changed since the
+     * last time that thread called it.
+     */
+    struct thread_state
+    {
+        /**
+         * Create a state for a thread that has applied nothing.
+         */
+        thread_state();
+
+        /**
+         * The version of the writer's settings that was applied,
+         * where zero means nothing has been applied yet.
+         */
+        std::uint32_t version;
+        /**
+         * The version of the global settings that was applied.
+         */
+        std::uint32_t global_version;
+        /**
+         * The settings that were applied.
+         */
+        thread_settings applied;
+    };
+
+    /**
+     * Apply this writer's thread settings, combined with the global
+     * ones from @ref configuration::get_thread_settings, to the
+     * calling thread. Writers that create threads call this when
+     * each thread starts and whenever it wakes up. The settings are
+     * only applied again if they have changed, and anything that
+     * was applied before but is no longer set is restored to its
+     * default.
+     *
+     * @param role the role of the thread, which together with the
+     *        writer's name makes up the thread's name, like
+     *        async:my_writer
+     * @param state what the calling thread has applied, which
+     *        must belong to the calling thread alone
+     */
+    void configure_thread(const std::string& role, thread_state& state);
     /**
      * Write the event. This virtual method is meant to handle the 
      * mechanics of actually writing to the destination. The calling 
@@ -136,6 +198,15 @@ protected:
      * @param evt the event to write
      */
     virtual void write_impl(const event& evt) = 0;
+    /**
+     * Called by @ref write after an event has been written and the
+     * writer's lock has been released, so that a thread can wait
+     * for something without keeping other threads from writing. By
+     * default, it does nothing.
+     *
+     * @param evt the event that was written
+     */
+    virtual void written(const event& evt);
 
     /**
      * The formatter used to turn events into text.
@@ -143,8 +214,23 @@ protected:
     std::unique_ptr<formatter> formatter_;
 
 private:
+    friend class file_roller;
+    friend class logger;
     friend class writeable_filter;
 
+    /**
+     * Write the event if it is permitted, with guard_ locked.
+     *
+     * @param evt the event to write
+     * @return true if the event was written
+     */
+    CHUCHO_NO_EXPORT bool deliver(const event& evt);
+    /**
+     * Call @ref written for an event that @ref deliver wrote.
+     *
+     * @param evt the event that was written
+     */
+    CHUCHO_NO_EXPORT void delivered(const event& evt);
     /**
      * @pre guard_ must be locked
      * @param evt the event to evaluate
@@ -155,6 +241,9 @@ private:
     std::list<std::unique_ptr<filter>> filters_;
     std::mutex guard_;
     std::string name_;
+    thread_settings thread_settings_;
+    std::atomic<std::uint32_t> thread_settings_version_;
+    std::mutex thread_settings_guard_;
 };
 
 inline formatter& writer::get_formatter() const
@@ -34,6 +34,14 @@ namespace chucho
  */
 class CHUCHO_EXPORT writer_factory : public configurable_factory
 {
+public:
+    /**
+     * Return true, since this factory creates writers.
+     *
+     * @return true
+     */
+    virtual bool creates_writer() const override;
+
 protected:
     /**
      * Set a writer's filters. The @ref configurable here must be a 
@@ -44,6 +52,15 @@ protected:
      * @param mnto the @ref memento that has the filters
      */
     void set_filters(configurable& cnf, writer_memento& mnto);
+    /**
+     * Set the settings of the threads that a writer creates. The
+     * @ref configurable here must be a @ref writer. Only writers
+     * that create threads need to call this.
+     *
+     * @param cnf the @ref writer that creates threads
+     * @param mnto the @ref memento that has the thread settings
+     */
+    void set_thread_settings(configurable& cnf, writer_memento& mnto);
 };
 
 }
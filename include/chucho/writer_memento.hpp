@@ -25,6 +25,7 @@
 #include <chucho/nameable_memento.hpp>
 #include <chucho/filter.hpp>
 #include <chucho/formatter.hpp>
+#include <chucho/thread_settings.hpp>
 #include <vector>
 
 namespace chucho
@@ -67,11 +68,19 @@ public:
      * @return the formatter
      */
     std::unique_ptr<formatter>& get_formatter();
+    /**
+     * Return the settings of the writer's threads that have been
+     * discovered during configuration time.
+     *
+     * @return the thread settings
+     */
+    const thread_settings& get_thread_settings() const;
     virtual void handle(std::unique_ptr<configurable>&& cnf) override;
 
 private:
     std::unique_ptr<formatter> fmt_;
     std::vector<std::unique_ptr<filter>> filters_;
+    thread_settings thread_settings_;
 };
 
 inline std::vector<std::unique_ptr<filter>>& writer_memento::get_filters()
@@ -84,6 +93,11 @@ inline std::unique_ptr<formatter>& writer_memento::get_formatter()
     return fmt_;
 }
 
+inline const thread_settings& writer_memento::get_thread_settings() const
+{
+    return thread_settings_;
+}
+
 }
 
 #if defined(_MSC_VER)
@@ -29,6 +29,9 @@ namespace chucho
  * a ZeroMQ socket of type ZMQ_SUB. Additionally, a "topic" can be used
  * by providing a prefix in the writer's constructor. If a prefix is
  * provided, then each event will be published as a two-part message.
+ *
+ * The serialized bytes are handed to ZeroMQ without being copied,
+ * and ZeroMQ releases them once the message has been sent.
  * 
  * @ingroup mq writers
  */
@@ -133,6 +136,7 @@ public:
     const std::vector<std::uint8_t>& get_prefix() const;
 
 protected:
+    virtual void flush_blob(std::vector<std::uint8_t>&& bytes) override;
     virtual void flush_impl(const std::vector<std::uint8_t>& bytes) override;
 
 private:
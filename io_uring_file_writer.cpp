@@ -0,0 +1,427 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/io_uring_file_writer.hpp>
+#include <chucho/uring.hpp>
+#include <chucho/file_exception.hpp>
+#include <chucho/formatter.hpp>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+
+// Marks the completion of a sync, rather than a buffer's write
+constexpr std::uint64_t SYNC_DATA = ~static_cast<std::uint64_t>(0);
+
+}
+
+namespace chucho
+{
+
+io_uring_file_writer::io_uring_file_writer(const std::string& name,
+                                           std::unique_ptr<formatter>&& fmt,
+                                           const std::string& file_name,
+                                           on_start start,
+                                           bool flsh,
+                                           std::size_t buffer_count,
+                                           std::size_t buffer_size)
+    : file_writer(name, std::move(fmt), start, flsh),
+      effective_trigger_(nullptr),
+      fixed_(false),
+      buffer_count_(buffer_count),
+      buffer_size_(buffer_size),
+      sync_interval_(0),
+      sync_kind_(sync::DATA),
+      stop_syncing_(false),
+      unsynced_(false),
+      syncing_(false),
+      syncs_(0)
+{
+    init();
+    open(file_name);
+}
+
+io_uring_file_writer::io_uring_file_writer(const std::string& name,
+                                           std::unique_ptr<formatter>&& fmt,
+                                           const std::string& file_name,
+                                           std::unique_ptr<file_roller>&& roller,
+                                           std::unique_ptr<file_roll_trigger>&& trigger,
+                                           on_start start,
+                                           bool flsh,
+                                           std::size_t buffer_count,
+                                           std::size_t buffer_size)
+    : file_writer(name, std::move(fmt), start, flsh),
+      roller_(std::move(roller)),
+      trigger_(std::move(trigger)),
+      fixed_(false),
+      buffer_count_(buffer_count),
+      buffer_size_(buffer_size),
+      sync_interval_(0),
+      sync_kind_(sync::DATA),
+      stop_syncing_(false),
+      unsynced_(false),
+      syncing_(false),
+      syncs_(0)
+{
+    if (!roller_)
+        throw std::invalid_argument("The file_roller cannot be a unintialized");
+    if (trigger_)
+    {
+        effective_trigger_ = trigger_.get();
+    }
+    else
+    {
+        effective_trigger_ = dynamic_cast<file_roll_trigger*>(roller_.get());
+        if (!effective_trigger_)
+            throw std::invalid_argument("The io_uring_file_writer has no file_roll_trigger");
+    }
+    init();
+    roller_->set_file_writer(*this);
+    std::string fn = file_name.empty() ? roller_->get_active_file_name() : file_name;
+    if (fn.empty())
+        throw std::invalid_argument("The file_roller does not provide an initial file name, so the io_uring_file_writer must be given one");
+    open(fn);
+}
+
+io_uring_file_writer::~io_uring_file_writer()
+{
+    stop_syncer();
+    try
+    {
+        std::lock_guard<std::mutex> lg(ring_guard_);
+        wait_for_all();
+    }
+    catch (std::exception& e)
+    {
+        report_error(std::string("Error waiting for writes to complete: ") + e.what());
+    }
+}
+
+std::size_t io_uring_file_writer::acquire()
+{
+    reap();
+    while (free_.empty())
+    {
+        ring_->submit(1);
+        reap();
+    }
+    std::size_t idx = free_.back();
+    free_.pop_back();
+    return idx;
+}
+
+void io_uring_file_writer::close()
+{
+    // Nothing may be in flight to a descriptor that is closed
+    try
+    {
+        std::lock_guard<std::mutex> lg(ring_guard_);
+        wait_for_all();
+        fd_ = -1;
+    }
+    catch (std::exception& e)
+    {
+        report_error(std::string("Error waiting for writes to complete: ") + e.what());
+    }
+    file_writer::close();
+}
+
+void io_uring_file_writer::flush()
+{
+    if (ring_)
+    {
+        std::lock_guard<std::mutex> lg(ring_guard_);
+        wait_for_all();
+    }
+    else
+    {
+        file_writer::flush();
+    }
+}
+
+void io_uring_file_writer::init()
+{
+    set_status_origin("io_uring_file_writer");
+    if (buffer_count_ == 0)
+        throw std::invalid_argument("The buffer count of an io_uring_file_writer must be greater than zero");
+    if (buffer_size_ == 0)
+        throw std::invalid_argument("The buffer size of an io_uring_file_writer must be greater than zero");
+    try
+    {
+        // Every buffer may be in flight along with a sync
+        ring_ = std::make_unique<uring>(static_cast<unsigned>(buffer_count_ + 1));
+    }
+    catch (exception& e)
+    {
+        report_warning(std::string(e.what()) + ", so writes will be synchronous");
+        return;
+    }
+    storage_.reset(new char[buffer_count_ * buffer_size_]);
+    std::vector<iovec> iovs(buffer_count_);
+    for (std::size_t i = 0; i < buffer_count_; i++)
+    {
+        iovs[i].iov_base = storage_.get() + i * buffer_size_;
+        iovs[i].iov_len = buffer_size_;
+    }
+    fixed_ = ring_->register_buffers(iovs);
+    if (!fixed_)
+        report_info("The buffers could not be registered with the io_uring, so they will be mapped for each write");
+    pending_.resize(buffer_count_);
+    for (std::size_t i = buffer_count_; i > 0; i--)
+        free_.push_back(i - 1);
+    current_ = buffer_count_;
+    used_ = 0;
+    fd_ = -1;
+    offset_ = 0;
+    in_flight_ = 0;
+}
+
+void io_uring_file_writer::opened()
+{
+    if (!ring_)
+        return;
+    std::lock_guard<std::mutex> lg(ring_guard_);
+    // A file that was removed is opened anew without being closed,
+    // so whatever is bound for the previous one has to land there
+    // before the offset moves to the new one.
+    wait_for_all();
+    // Every write says where it goes, so appending has to be turned
+    // off. Otherwise writes that complete out of order would land
+    // out of order.
+    fd_ = get_file_descriptor();
+    int flags = fcntl(fd_, F_GETFL);
+    if (flags != -1 && (flags & O_APPEND) != 0)
+        fcntl(fd_, F_SETFL, flags & ~O_APPEND);
+    off_t end = lseek(fd_, 0, SEEK_END);
+    offset_ = end == -1 ? 0 : static_cast<std::uint64_t>(end);
+}
+
+void io_uring_file_writer::reap()
+{
+    io_uring_cqe cqe;
+    while (ring_->peek(cqe))
+    {
+        --in_flight_;
+        if (cqe.user_data == SYNC_DATA)
+        {
+            syncing_ = false;
+            if (cqe.res < 0)
+                report_error("Unable to synchronize " + get_file_name() + ": " + std::strerror(-cqe.res));
+            else
+                ++syncs_;
+            continue;
+        }
+        std::size_t idx = static_cast<std::size_t>(cqe.user_data);
+        pending& pnd = pending_[idx];
+        if (cqe.res < 0)
+        {
+            report_error("Unable to write to " + get_file_name() + ": " + std::strerror(-cqe.res));
+        }
+        else if (cqe.res == 0)
+        {
+            report_error("Unable to write to " + get_file_name() + ": nothing was written");
+        }
+        else
+        {
+            pnd.done += static_cast<std::size_t>(cqe.res);
+            // A short write is resubmitted with what is left
+            if (pnd.done < pnd.length)
+            {
+                submit_write(idx);
+                ring_->submit();
+                continue;
+            }
+        }
+        free_.push_back(idx);
+    }
+}
+
+std::size_t io_uring_file_writer::get_sync_count()
+{
+    std::lock_guard<std::mutex> lg(ring_guard_);
+    if (ring_)
+        reap();
+    return syncs_;
+}
+
+void io_uring_file_writer::set_sync_interval(std::chrono::milliseconds intvl, sync kind)
+{
+    stop_syncer();
+    sync_interval_ = intvl;
+    sync_kind_ = kind;
+    if (ring_ && sync_interval_.count() > 0)
+    {
+        stop_syncing_ = false;
+        syncer_ = std::make_unique<std::thread>(std::bind(&io_uring_file_writer::syncer_main, this));
+    }
+}
+
+void io_uring_file_writer::stop_syncer()
+{
+    if (syncer_)
+    {
+        {
+            std::lock_guard<std::mutex> lg(ring_guard_);
+            stop_syncing_ = true;
+        }
+        syncer_condition_.notify_one();
+        syncer_->join();
+        syncer_.reset();
+    }
+}
+
+void io_uring_file_writer::submit_current()
+{
+    if (current_ == buffer_count_)
+        return;
+    pending& pnd = pending_[current_];
+    pnd.length = used_;
+    pnd.done = 0;
+    pnd.offset = offset_;
+    pnd.fd = fd_;
+    offset_ += used_;
+    submit_write(current_);
+    current_ = buffer_count_;
+    used_ = 0;
+    ring_->submit();
+}
+
+void io_uring_file_writer::submit_sync()
+{
+    io_uring_sqe* sqe = ring_->get_sqe();
+    sqe->opcode = IORING_OP_FSYNC;
+    sqe->fd = fd_;
+    if (sync_kind_ == sync::DATA)
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+    // Wait for the writes that were submitted before it
+    sqe->flags = IOSQE_IO_DRAIN;
+    sqe->user_data = SYNC_DATA;
+    ++in_flight_;
+    syncing_ = true;
+    ring_->submit();
+}
+
+void io_uring_file_writer::submit_write(std::size_t idx)
+{
+    const pending& pnd = pending_[idx];
+    // There are enough entries for every buffer and a sync
+    io_uring_sqe* sqe = ring_->get_sqe();
+    sqe->opcode = fixed_ ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    sqe->fd = pnd.fd;
+    sqe->addr = reinterpret_cast<std::uint64_t>(storage_.get() + idx * buffer_size_ + pnd.done);
+    sqe->len = static_cast<std::uint32_t>(pnd.length - pnd.done);
+    sqe->off = pnd.offset + pnd.done;
+    if (fixed_)
+        sqe->buf_index = static_cast<std::uint16_t>(idx);
+    sqe->user_data = idx;
+    ++in_flight_;
+}
+
+void io_uring_file_writer::syncer_main()
+{
+    thread_state state;
+    std::unique_lock<std::mutex> ul(ring_guard_);
+    while (!stop_syncing_)
+    {
+        configure_thread("sync", state);
+        syncer_condition_.wait_for(ul, sync_interval_, [this] () { return stop_syncing_; });
+        if (stop_syncing_ || fd_ == -1)
+            continue;
+        reap();
+        // A sync that has not finished yet covers nothing written
+        // after it was submitted, so this waits for the next round
+        if (unsynced_ && !syncing_)
+        {
+            submit_current();
+            submit_sync();
+            unsynced_ = false;
+        }
+    }
+}
+
+void io_uring_file_writer::wait_for_all()
+{
+    if (!ring_)
+        return;
+    submit_current();
+    while (in_flight_ > 0)
+    {
+        ring_->submit(1);
+        reap();
+    }
+}
+
+void io_uring_file_writer::write_formatted(const std::string& text)
+{
+    std::lock_guard<std::mutex> lg(ring_guard_);
+    const char* data = text.data();
+    std::size_t left = text.length();
+    while (left > 0)
+    {
+        if (current_ == buffer_count_)
+            current_ = acquire();
+        std::size_t to_copy = std::min(left, buffer_size_ - used_);
+        std::memcpy(storage_.get() + current_ * buffer_size_ + used_, data, to_copy);
+        data += to_copy;
+        left -= to_copy;
+        used_ += to_copy;
+        if (used_ == buffer_size_)
+            submit_current();
+    }
+    if (get_flush())
+        submit_current();
+    unsynced_ = true;
+}
+
+void io_uring_file_writer::write_impl(const event& evt)
+{
+    if (effective_trigger_ != nullptr && effective_trigger_->is_triggered(*this, evt))
+    {
+        // The roller may compress the file, so it must be complete,
+        // which close() makes sure of
+        close();
+        roller_->roll();
+        open(roller_->get_active_file_name());
+        report_info("Rolled over to " + get_file_name());
+    }
+    if (!ring_)
+    {
+        file_writer::write_impl(evt);
+        return;
+    }
+    try
+    {
+        ensure_access();
+        if (is_open())
+            write_formatted(formatter_->format(evt));
+        else
+            report_error("Cannot write to " + get_file_name() + " because it is not open");
+    }
+    catch (exception& e)
+    {
+#if defined(CHUCHO_HAVE_NESTED_EXCEPTIONS)
+        std::throw_with_nested(file_exception("Could not write to " + get_file_name()));
+#else
+        throw file_exception("Could not write to " + get_file_name() + ": " + e.what());
+#endif
+    }
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/io_uring_file_writer_factory.hpp>
+#include <chucho/io_uring_file_writer_memento.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/demangle.hpp>
+#include <assert.h>
+
+namespace chucho
+{
+
+io_uring_file_writer_factory::io_uring_file_writer_factory()
+{
+    set_status_origin("io_uring_file_writer_factory");
+}
+
+std::unique_ptr<configurable> io_uring_file_writer_factory::create_configurable(std::unique_ptr<memento>& mnto)
+{
+    auto iufwm = dynamic_cast<io_uring_file_writer_memento*>(mnto.get());
+    assert(iufwm != nullptr);
+    if (iufwm->get_name().empty())
+        throw exception("io_uring_file_writer_factory: The name is not set");
+    auto fmt = std::move(iufwm->get_formatter());
+    if (!fmt)
+        throw exception("io_uring_file_writer_factory: The writer's formatter is not set");
+    file_writer::on_start start = iufwm->get_on_start() ? *iufwm->get_on_start() : file_writer::on_start::APPEND;
+    bool flsh = iufwm->get_flush() ? *iufwm->get_flush() : true;
+    std::size_t count = iufwm->get_buffer_count() ? *iufwm->get_buffer_count() : io_uring_file_writer::DEFAULT_BUFFER_COUNT;
+    std::size_t size = iufwm->get_buffer_size() ? *iufwm->get_buffer_size() : io_uring_file_writer::DEFAULT_BUFFER_SIZE;
+    auto rlr = iufwm->get_file_roller();
+    std::unique_ptr<io_uring_file_writer> wrt;
+    if (rlr)
+    {
+        wrt = std::make_unique<io_uring_file_writer>(iufwm->get_name(),
+                                                     std::move(fmt),
+                                                     iufwm->get_file_name(),
+                                                     std::move(rlr),
+                                                     iufwm->get_file_roll_trigger(),
+                                                     start,
+                                                     flsh,
+                                                     count,
+                                                     size);
+    }
+    else
+    {
+        if (iufwm->get_file_roll_trigger())
+            throw exception("io_uring_file_writer_factory: A file_roll_trigger requires a file_roller");
+        if (iufwm->get_file_name().empty())
+            throw exception("io_uring_file_writer_factory: The file name is not set");
+        wrt = std::make_unique<io_uring_file_writer>(iufwm->get_name(),
+                                                     std::move(fmt),
+                                                     iufwm->get_file_name(),
+                                                     start,
+                                                     flsh,
+                                                     count,
+                                                     size);
+    }
+    if (iufwm->get_sync_interval())
+        wrt->set_sync_interval(*iufwm->get_sync_interval(), iufwm->get_sync_kind() ? *iufwm->get_sync_kind() : io_uring_file_writer::sync::DATA);
+    set_filters(*wrt, *iufwm);
+    set_thread_settings(*wrt, *iufwm);
+    report_info("Created a " + demangle::get_demangled_name(typeid(*wrt)));
+    return std::move(wrt);
+}
+
+std::unique_ptr<memento> io_uring_file_writer_factory::create_memento(configurator& cfg)
+{
+    auto mnto = std::make_unique<io_uring_file_writer_memento>(cfg);
+    return std::move(mnto);
+}
+
+}
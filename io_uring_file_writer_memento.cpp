@@ -0,0 +1,53 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/io_uring_file_writer_memento.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/text_util.hpp>
+
+namespace chucho
+{
+
+io_uring_file_writer_memento::io_uring_file_writer_memento(configurator& cfg)
+    : rolling_file_writer_memento(cfg)
+{
+    set_status_origin("io_uring_file_writer_memento");
+    set_default_name(typeid(io_uring_file_writer));
+    cfg.get_security_policy().set_integer("io_uring_file_writer::buffer_count", static_cast<std::size_t>(1), static_cast<std::size_t>(1024));
+    cfg.get_security_policy().set_text("io_uring_file_writer::buffer_count(text)", 4);
+    cfg.get_security_policy().set_integer("io_uring_file_writer::buffer_size", static_cast<std::size_t>(512), static_cast<std::size_t>(64 * 1024 * 1024));
+    cfg.get_security_policy().set_text("io_uring_file_writer::buffer_size(text)", 8);
+    cfg.get_security_policy().set_integer("io_uring_file_writer::sync_interval", 0, 60 * 60 * 1000);
+    cfg.get_security_policy().set_text("io_uring_file_writer::sync_interval(text)", 7);
+    cfg.get_security_policy().set_text("io_uring_file_writer::sync", 4);
+    set_handler("buffer_count", [this] (const std::string& num) { buffer_count_ = validate("io_uring_file_writer::buffer_count", static_cast<std::size_t>(std::stoul(validate("io_uring_file_writer::buffer_count(text)", num)))); });
+    set_handler("buffer_size", [this] (const std::string& num) { buffer_size_ = validate("io_uring_file_writer::buffer_size", static_cast<std::size_t>(std::stoul(validate("io_uring_file_writer::buffer_size(text)", num)))); });
+    set_handler("sync_interval", [this] (const std::string& ms) { sync_interval_ = std::chrono::milliseconds(validate("io_uring_file_writer::sync_interval", std::stoul(validate("io_uring_file_writer::sync_interval(text)", ms)))); });
+    set_handler("sync", std::bind(&io_uring_file_writer_memento::set_sync_kind, this, std::placeholders::_1));
+}
+
+void io_uring_file_writer_memento::set_sync_kind(const std::string& value)
+{
+    std::string low = text_util::to_lower(validate("io_uring_file_writer::sync", value));
+    if (low == "data")
+        sync_kind_ = io_uring_file_writer::sync::DATA;
+    else if (low == "full")
+        sync_kind_ = io_uring_file_writer::sync::FULL;
+    else
+        throw exception("io_uring_file_writer_memento: sync has an invalid value of " + value);
+}
+
+}
@@ -85,7 +85,7 @@ void json_configurator::configure(std::istream& in)
 std::unique_ptr<configurable> json_configurator::create_subobject(const cJSON* json,
                                                                   std::unique_ptr<configurable_factory>& fact)
 {
-    auto& facts = get_factories();
+    auto& facts = get_current_factories();
     auto mnto = std::move(fact->create_memento(*this));
     while (json != nullptr)
     {
@@ -101,8 +101,8 @@ std::unique_ptr<configurable> json_configurator::create_subobject(const cJSON* j
 
 std::unique_ptr<configurable_factory>& json_configurator::get_factory(const char* const str)
 {
-    auto fact = get_factories().find(str);
-    if (fact == get_factories().end())
+    auto fact = get_current_factories().find(str);
+    if (fact == get_current_factories().end())
         throw std::runtime_error(std::string("No type named ") + str + " exists");
     return fact->second;
 }
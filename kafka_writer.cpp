@@ -15,7 +15,13 @@
  */
 
 #include <chucho/kafka_writer.hpp>
+#include <chucho/diagnostic_context.hpp>
+#include <chucho/event_cache.hpp>
+#include <chucho/event_cache_provider.hpp>
 #include <chucho/exception.hpp>
+#include <chucho/host.hpp>
+#include <chucho/logger.hpp>
+#include <cstring>
 
 namespace chucho
 {
@@ -27,14 +33,36 @@ kafka_writer::kafka_writer(const std::string& name,
                            std::unique_ptr<serializer>&& ser,
                            const std::string& topic,
                            rd_kafka_conf_t* conf)
+    : kafka_writer(name, std::move(fmt), std::move(ser), topic, conf, delivery_settings())
+{
+}
+
+kafka_writer::kafka_writer(const std::string& name,
+                           std::unique_ptr<formatter>&& fmt,
+                           std::unique_ptr<serializer>&& ser,
+                           const std::string& topic,
+                           rd_kafka_conf_t* conf,
+                           const delivery_settings& settings)
     : message_queue_writer(name, std::move(fmt), std::move(ser), 1),
       config_(conf),
-      should_stop_(false)
+      should_stop_(false),
+      settings_(settings),
+      discarded_(0)
 {
+    set_status_origin("kafka_writer");
+    if (settings_.batch_size == 0)
+        settings_.batch_size = 1;
+    pending_.reserve(settings_.batch_size);
+    if (settings_.backpressure == backpressure_policy::SPILL)
+        spill_ = std::make_unique<event_cache>(event_cache_provider::DEFAULT_CHUNK_SIZE,
+                                               event_cache_provider::DEFAULT_CHUNK_SIZE * event_cache_provider::DEFAULT_MAX_CHUNKS);
     try
     {
         char err_msg[1024];
         auto local = rd_kafka_conf_dup(config_);
+        // The payloads belong to the writer until their delivery is reported
+        rd_kafka_conf_set_dr_msg_cb(local, delivered);
+        rd_kafka_conf_set_opaque(local, this);
         producer_ = rd_kafka_new(RD_KAFKA_PRODUCER, local, err_msg, sizeof(err_msg));
         if (producer_ == nullptr)
         {
@@ -60,40 +88,147 @@ kafka_writer::~kafka_writer()
 {
     should_stop_ = true;
     poller_.join();
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
     rd_kafka_flush(producer_, 5000);
+    if (spill_)
+    {
+        // The flush may have made room for the events that were held
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+        rd_kafka_flush(producer_, 5000);
+    }
+    {
+        std::lock_guard<std::mutex> lock(pending_guard_);
+        if (!pending_.empty())
+            discard_pending("the writer is closing");
+    }
+    // Whatever is still queued is failed, which releases its payload
+    rd_kafka_purge(producer_, RD_KAFKA_PURGE_F_QUEUE | RD_KAFKA_PURGE_F_INFLIGHT);
+    rd_kafka_poll(producer_, 0);
     rd_kafka_topic_destroy(topic_);
     rd_kafka_destroy(producer_);
     rd_kafka_conf_destroy(config_);
 }
 
-void kafka_writer::flush_impl(const std::vector<std::uint8_t>& blob)
+void kafka_writer::apply_backpressure()
 {
-    while (true)
+    // NOTE: pending_guard_ must not be locked on entry
+    if (settings_.backpressure == backpressure_policy::BLOCK)
     {
-        int rc = rd_kafka_produce(topic_,
-                                  RD_KAFKA_PARTITION_UA,
-                                  RD_KAFKA_MSG_F_COPY,
-                                  const_cast<void*>(reinterpret_cast<const void*>(&blob[0])),
-                                  blob.size(),
-                                  nullptr,
-                                  0,
-                                  nullptr);
-        if (rc == 0)
+        auto deadline = std::chrono::steady_clock::now() + settings_.block_timeout;
+        while (true)
         {
-            break;
+            {
+                std::lock_guard<std::mutex> lock(pending_guard_);
+                if (pending_.empty() || produce_pending())
+                    break;
+                if (std::chrono::steady_clock::now() >= deadline)
+                {
+                    discard_pending("the producer's queue stayed full");
+                    break;
+                }
+            }
+            rd_kafka_poll(producer_, 10);
         }
-        else if (rc == RD_KAFKA_RESP_ERR__QUEUE_FULL)
+    }
+    else if (settings_.backpressure == backpressure_policy::DROP)
+    {
+        std::lock_guard<std::mutex> lock(pending_guard_);
+        if (!pending_.empty() && !produce_pending())
+            discard_pending("the producer's queue is full");
+    }
+}
+
+void kafka_writer::delivered(rd_kafka_t* rk, const rd_kafka_message_t* msg, void* opaque)
+{
+    delete static_cast<std::vector<std::uint8_t>*>(msg->_private);
+    if (msg->err != RD_KAFKA_RESP_ERR_NO_ERROR)
+    {
+        auto wrt = static_cast<kafka_writer*>(opaque);
+        ++wrt->discarded_;
+        wrt->report_error(std::string("Kafka could not deliver a message: ") + rd_kafka_err2str(msg->err));
+    }
+}
+
+void kafka_writer::discard_pending(const std::string& why)
+{
+    discarded_ += pending_.size();
+    report_error(std::to_string(pending_.size()) + " Kafka messages have been discarded because " + why);
+    pending_.clear();
+}
+
+void kafka_writer::drain_spill()
+{
+    while (true)
+    {
         {
-            // Give our poller a chance to flush things
-            std::this_thread::sleep_for(250ms);
+            std::lock_guard<std::mutex> lock(pending_guard_);
+            if (!pending_.empty() && !produce_pending())
+                return;
         }
-        else
+        // The key was taken when the event was written, since the
+        // diagnostic context here belongs to some other thread
+        std::string key;
+        auto evt = spill_->pop(0ms, &key);
+        if (!evt)
+            return;
+        write_keyed(*evt, key);
+    }
+}
+
+void kafka_writer::flush()
+{
+    if (get_number_coalesced() > 0)
+        flush_coalesced();
+    if (spill_)
+    {
+        drain_spill();
+    }
+    else
+    {
         {
-            throw exception(std::string("Kafka error writing to topic '") + rd_kafka_topic_name(topic_) + "': " + rd_kafka_err2str(rd_kafka_last_error()));
+            std::lock_guard<std::mutex> lock(pending_guard_);
+            if (pending_.empty() || produce_pending())
+                return;
         }
+        apply_backpressure();
     }
 }
 
+void kafka_writer::flush_blob(std::vector<std::uint8_t>&& blob)
+{
+    bool full;
+    {
+        std::lock_guard<std::mutex> lock(pending_guard_);
+        if (pending_.empty())
+            pending_since_ = std::chrono::steady_clock::now();
+        pending_.emplace_back();
+        pending_.back().payload = std::make_unique<std::vector<std::uint8_t>>(std::move(blob));
+        pending_.back().key = current_key_;
+        if (pending_.size() < settings_.batch_size)
+            return;
+        full = !produce_pending();
+    }
+    if (full)
+        apply_backpressure();
+}
+
+void kafka_writer::flush_impl(const std::vector<std::uint8_t>& blob)
+{
+    flush_blob(std::vector<std::uint8_t>(blob));
+}
+
 std::string kafka_writer::get_config_value(const std::string& key) const
 {
     char value[1024 * 4];
@@ -103,6 +238,25 @@ std::string kafka_writer::get_config_value(const std::string& key) const
     throw exception("Unable to retrieve Kafka setting for '" + key + '"');
 }
 
+std::string kafka_writer::get_key(const event& evt) const
+{
+    switch (settings_.key)
+    {
+    case partition_key::LOGGER:
+        return evt.get_logger() ? evt.get_logger()->get_name() : std::string();
+    case partition_key::HOST:
+        return host::get_base_name();
+    case partition_key::DIAGNOSTIC_CONTEXT:
+        {
+            // Looking must not add the field to the context
+            auto found = diagnostic_context::find(settings_.key_field);
+            return found == nullptr ? std::string() : *found;
+        }
+    default:
+        return std::string();
+    }
+}
+
 std::string kafka_writer::get_topic() const
 {
     return rd_kafka_topic_name(topic_);
@@ -110,8 +264,96 @@ std::string kafka_writer::get_topic() const
 
 void kafka_writer::poller_main()
 {
+    thread_state state;
     while (!should_stop_)
-        rd_kafka_poll(producer_, 500);
+    {
+        configure_thread("kafka", state);
+        rd_kafka_poll(producer_, 100);
+        std::lock_guard<std::mutex> lock(pending_guard_);
+        if (!pending_.empty() &&
+            std::chrono::steady_clock::now() - pending_since_ >= settings_.linger)
+        {
+            // If the queue is full, then the writing thread applies the policy
+            produce_pending();
+        }
+    }
+}
+
+bool kafka_writer::produce_pending()
+{
+    std::vector<rd_kafka_message_t> msgs(pending_.size());
+    for (std::size_t i = 0; i < pending_.size(); i++)
+    {
+        std::memset(&msgs[i], 0, sizeof(msgs[i]));
+        msgs[i].partition = RD_KAFKA_PARTITION_UA;
+        msgs[i].payload = pending_[i].payload->data();
+        msgs[i].len = pending_[i].payload->size();
+        if (!pending_[i].key.empty())
+        {
+            msgs[i].key = const_cast<char*>(pending_[i].key.data());
+            msgs[i].key_len = pending_[i].key.length();
+        }
+        msgs[i]._private = pending_[i].payload.get();
+    }
+    // With no flags librdkafka neither copies nor frees the payloads,
+    // and the partitioner is run for each message because of its key
+    rd_kafka_produce_batch(topic_, RD_KAFKA_PARTITION_UA, 0, msgs.data(), static_cast<int>(msgs.size()));
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < pending_.size(); i++)
+    {
+        if (msgs[i].err == RD_KAFKA_RESP_ERR_NO_ERROR)
+        {
+            // Released in delivered()
+            pending_[i].payload.release();
+        }
+        else if (msgs[i].err == RD_KAFKA_RESP_ERR__QUEUE_FULL)
+        {
+            if (kept != i)
+                pending_[kept] = std::move(pending_[i]);
+            ++kept;
+        }
+        else
+        {
+            ++discarded_;
+            report_error(std::string("Kafka error writing to topic '") + rd_kafka_topic_name(topic_) + "': " + rd_kafka_err2str(msgs[i].err));
+        }
+    }
+    pending_.erase(pending_.begin() + kept, pending_.end());
+    if (!pending_.empty())
+        pending_since_ = std::chrono::steady_clock::now();
+    return pending_.empty();
+}
+
+void kafka_writer::write_impl(const event& evt)
+{
+    std::string key;
+    if (settings_.key != partition_key::NONE)
+        key = get_key(evt);
+    if (spill_)
+    {
+        drain_spill();
+        std::lock_guard<std::mutex> lock(pending_guard_);
+        if (!pending_.empty())
+        {
+            spill_->push(evt, key);
+            return;
+        }
+    }
+    write_keyed(evt, key);
+}
+
+void kafka_writer::write_keyed(const event& evt, const std::string& key)
+{
+    if (settings_.key != partition_key::NONE)
+    {
+        if (key != current_key_)
+        {
+            if (get_number_coalesced() > 0)
+                flush_coalesced();
+            current_key_ = key;
+        }
+    }
+    message_queue_writer::write_impl(evt);
 }
 
 }
@@ -55,12 +55,21 @@ std::unique_ptr<configurable> kafka_writer_factory::create_configurable(std::uni
     std::size_t len;
     if (rd_kafka_conf_get(raw_conf, "bootstrap.servers", nullptr, &len) != RD_KAFKA_CONF_OK)
         throw exception("kafka_writer_factory: The writer's brokers are not set");
+    kafka_writer::delivery_settings settings;
+    if (kwm->get_delivery_settings())
+    {
+        settings = *kwm->get_delivery_settings();
+        if (settings.key == kafka_writer::partition_key::DIAGNOSTIC_CONTEXT && settings.key_field.empty())
+            throw exception("kafka_writer_factory: The partition_key_field must be set when the partition key is diagnostic_context");
+    }
     auto kw = std::make_unique<kafka_writer>(kwm->get_name(),
                                              std::move(fmt),
                                              std::move(ser),
                                              kwm->get_topic(),
-                                             raw_conf);
+                                             raw_conf,
+                                             settings);
     set_filters(*kw, *kwm);
+    set_thread_settings(*kw, *kwm);
     report_info("Created a " + demangle::get_demangled_name(typeid(*kw)));
     return std::move(kw);
 }
@@ -17,6 +17,7 @@
 #include <chucho/kafka_writer_memento.hpp>
 #include <chucho/kafka_writer.hpp>
 #include <chucho/move_util.hpp>
+#include <chucho/text_util.hpp>
 
 namespace chucho
 {
@@ -28,6 +29,28 @@ kafka_writer_memento::kafka_writer_memento(configurator& cfg)
     set_default_name(typeid(kafka_writer));
     set_handler("brokers", [this] (const std::string& val) { brokers_ = validate("kafka_writer::brokers", val); });
     set_handler("topic", [this] (const std::string& val) { topic_ = validate("kafka_writer::topic", val); });
+    cfg.get_security_policy().set_integer("kafka_writer::batch_size", 1U, 100000U);
+    cfg.get_security_policy().set_text("kafka_writer::batch_size(text)", 6);
+    cfg.get_security_policy().set_integer("kafka_writer::linger", 0U, 60U * 60U * 1000U);
+    cfg.get_security_policy().set_text("kafka_writer::linger(text)", 7);
+    cfg.get_security_policy().set_text("kafka_writer::partition_key", 18);
+    cfg.get_security_policy().set_text("kafka_writer::partition_key_field", 256);
+    cfg.get_security_policy().set_text("kafka_writer::backpressure", 5);
+    cfg.get_security_policy().set_integer("kafka_writer::block_timeout", 0U, 60U * 60U * 1000U);
+    cfg.get_security_policy().set_text("kafka_writer::block_timeout(text)", 7);
+    set_handler("batch_size", [this] (const std::string& val) { delivery().batch_size = validate("kafka_writer::batch_size", std::stoul(validate("kafka_writer::batch_size(text)", val))); });
+    set_handler("linger", [this] (const std::string& ms) { delivery().linger = std::chrono::milliseconds(validate("kafka_writer::linger", std::stoul(validate("kafka_writer::linger(text)", ms)))); });
+    set_handler("partition_key", std::bind(&kafka_writer_memento::set_partition_key, this, std::placeholders::_1));
+    set_handler("partition_key_field", [this] (const std::string& val) { delivery().key_field = validate("kafka_writer::partition_key_field", val); });
+    set_handler("backpressure", std::bind(&kafka_writer_memento::set_backpressure, this, std::placeholders::_1));
+    set_handler("block_timeout", [this] (const std::string& ms) { delivery().block_timeout = std::chrono::milliseconds(validate("kafka_writer::block_timeout", std::stoul(validate("kafka_writer::block_timeout(text)", ms)))); });
+}
+
+kafka_writer::delivery_settings& kafka_writer_memento::delivery()
+{
+    if (!delivery_)
+        delivery_ = kafka_writer::delivery_settings();
+    return *delivery_;
 }
 
 void kafka_writer_memento::handle(std::unique_ptr<configurable>&& cnf)
@@ -39,5 +62,33 @@ void kafka_writer_memento::handle(std::unique_ptr<configurable>&& cnf)
         message_queue_writer_memento::handle(std::move(cnf));
 }
 
+void kafka_writer_memento::set_backpressure(const std::string& policy)
+{
+    auto low = text_util::to_lower(validate("kafka_writer::backpressure", policy));
+    if (low == "block")
+        delivery().backpressure = kafka_writer::backpressure_policy::BLOCK;
+    else if (low == "drop")
+        delivery().backpressure = kafka_writer::backpressure_policy::DROP;
+    else if (low == "spill")
+        delivery().backpressure = kafka_writer::backpressure_policy::SPILL;
+    else
+        throw exception("kafka_writer_memento: The backpressure policy must be block, drop or spill");
+}
+
+void kafka_writer_memento::set_partition_key(const std::string& key)
+{
+    auto low = text_util::to_lower(validate("kafka_writer::partition_key", key));
+    if (low == "none")
+        delivery().key = kafka_writer::partition_key::NONE;
+    else if (low == "logger")
+        delivery().key = kafka_writer::partition_key::LOGGER;
+    else if (low == "host")
+        delivery().key = kafka_writer::partition_key::HOST;
+    else if (low == "diagnostic_context")
+        delivery().key = kafka_writer::partition_key::DIAGNOSTIC_CONTEXT;
+    else
+        throw exception("kafka_writer_memento: The partition key must be none, logger, host or diagnostic_context");
+}
+
 }
 
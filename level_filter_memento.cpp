@@ -16,9 +16,6 @@
 
 #include <chucho/level_filter_memento.hpp>
 #include <chucho/level_filter.hpp>
-#include <chucho/exception.hpp>
-#include <chucho/text_util.hpp>
-#include <algorithm>
 
 namespace chucho
 {
@@ -46,16 +43,4 @@ level_filter_memento::level_filter_memento(configurator& cfg, memento_key_set ks
     }
 }
 
-filter::result level_filter_memento::text_to_result(const std::string& text) const
-{
-    std::string low = text_util::to_lower(text);
-    if (low == "deny")
-        return chucho::filter::result::DENY;
-    if (low == "neutral")
-        return chucho::filter::result::NEUTRAL;
-    if (low == "accept")
-        return chucho::filter::result::ACCEPT;
-    throw chucho::exception("The text " + text + " does not describe a valid filter result (DENY, NEUTRAL, ACCEPT)");
-}
-
 }
@@ -22,6 +22,9 @@
 #include <chucho/time_util.hpp>
 #include <chucho/demangle.hpp>
 #include <chucho/regex.hpp>
+#include <chucho/overload_governor.hpp>
+#include <chucho/async_writer.hpp>
+#include <chucho/format_memo.hpp>
 #include <map>
 #include <stdexcept>
 #include <atomic>
@@ -56,6 +59,11 @@ static_data& data()
     return *sd;
 }
 
+// This changes whenever a logger's writers or writes_to_ancestors
+// change, so that loggers know when their cached governors are stale.
+// Zero is never used, so a new logger always looks.
+std::atomic<std::uint32_t> writers_version(1);
+
 std::vector<std::string> split(const std::string& name)
 {
     std::vector<std::string> result;
@@ -79,7 +87,8 @@ namespace chucho
 logger::logger(const std::string& name, std::shared_ptr<level> lvl)
     : name_(name),
       level_(lvl),
-      writes_to_ancestors_(true)
+      writes_to_ancestors_(true),
+      governors_version_(0)
 {
     set_status_origin("logger");
     auto ancestors = split(name);
@@ -133,6 +142,7 @@ void logger::add_writer(std::unique_ptr<writer>&& wrt)
         throw std::invalid_argument("The writer cannot be an uninitialized std::unique_ptr");
     std::lock_guard<std::mutex> lg(guard_);
     writers_.push_back(std::move(wrt));
+    writers_version++;
 }
 
 std::shared_ptr<logger> logger::get(const std::string& name)
@@ -189,7 +199,7 @@ writer& logger::get_writer(const std::string& name)
     std::lock_guard<std::mutex> lg(guard_);
     auto found = std::find_if(writers_.begin(),
                               writers_.end(),
-                              [&name](const std::unique_ptr<writer>& w) { return w->get_name() == name; });
+                              [&name](const std::shared_ptr<writer>& w) { return w->get_name() == name; });
     if (found == writers_.end())
         throw std::invalid_argument("Writer '" + name + "' was not found");
     return **found;
@@ -217,16 +227,56 @@ void logger::initialize()
         configuration::perform(root);
 }
 
-bool logger::permits(std::shared_ptr<level> lvl)
+bool logger::permits(const std::shared_ptr<level>& lvl)
+{
+    {
+        std::lock_guard<std::mutex> lg(guard_);
+        if (*lvl < *get_effective_level())
+            return false;
+    }
+    // Only events that would otherwise be written are subject to
+    // shedding, and only if they can reach an async_writer whose
+    // governor is shedding them.
+    if (!overload_governor::sheds(*lvl) || !overload_governor::sheds(*lvl, get_governors()))
+        return true;
+    return overload_governor::admits(*lvl);
+}
+
+std::vector<std::uint64_t> logger::get_governors()
 {
+    auto ver = writers_version.load();
+    {
+        std::lock_guard<std::mutex> lg(guard_);
+        if (governors_version_ == ver)
+            return governors_;
+    }
+    std::vector<std::uint64_t> result;
+    logger* cur = this;
+    while (cur != nullptr)
+    {
+        std::lock_guard<std::mutex> lg(cur->guard_);
+        for (const auto& w : cur->writers_)
+        {
+            auto aw = dynamic_cast<async_writer*>(w.get());
+            if (aw != nullptr && aw->get_overload_governor() != nullptr)
+                result.push_back(aw->get_overload_governor()->id_);
+        }
+        if (!cur->writes_to_ancestors_)
+            break;
+        cur = cur->parent_.get();
+    }
+    // If anything changed while looking, then the next call looks again
     std::lock_guard<std::mutex> lg(guard_);
-    return *lvl >= *get_effective_level();
+    governors_ = result;
+    governors_version_ = ver;
+    return result;
 }
 
 void logger::clear_writers()
 {
     std::lock_guard<std::mutex> lg(guard_);
     writers_.clear();
+    writers_version++;
 }
 
 void logger::remove_unused_loggers()
@@ -306,7 +356,54 @@ void logger::remove_unused_loggers()
 void logger::remove_writer(const std::string& wrt)
 {
     std::lock_guard<std::mutex> lg(guard_);
-    writers_.remove_if([&wrt] (const std::unique_ptr<writer>& w) { return w->get_name() == wrt; });
+    writers_.remove_if([&wrt] (const std::shared_ptr<writer>& w) { return w->get_name() == wrt; });
+    writers_version++;
+}
+
+std::list<std::shared_ptr<writer>> logger::replace(std::vector<replacement>& reps)
+{
+    // The loggers are always locked in the same order, so two
+    // replacements cannot deadlock
+    std::vector<logger*> order;
+    for (auto& rep : reps)
+        order.push_back(rep.lgr.get());
+    std::sort(order.begin(), order.end());
+    order.erase(std::unique(order.begin(), order.end()), order.end());
+    std::vector<std::unique_lock<std::mutex>> locks;
+    for (auto lgr : order)
+        locks.emplace_back(lgr->guard_);
+    std::list<std::shared_ptr<writer>> result;
+    for (auto& rep : reps)
+        result.splice(result.end(), rep.lgr->replace(rep));
+    writers_version++;
+    return result;
+}
+
+std::list<std::shared_ptr<writer>> logger::replace(replacement& rep)
+{
+    std::list<std::shared_ptr<writer>> result;
+    for (auto& w : rep.writers)
+    {
+        if (w.first == nullptr)
+        {
+            result.push_back(std::move(w.second));
+        }
+        else
+        {
+            auto found = std::find_if(writers_.begin(),
+                                      writers_.end(),
+                                      [&w] (const std::shared_ptr<writer>& cur) { return cur.get() == w.first; });
+            if (found != writers_.end())
+            {
+                result.push_back(std::move(*found));
+                writers_.erase(found);
+            }
+        }
+    }
+    writers_.swap(result);
+    level_ = rep.lvl;
+    writes_to_ancestors_ = rep.wta;
+    return result;
 }
 
 void logger::reset()
@@ -315,6 +412,7 @@ void logger::reset()
     writers_.clear();
     level_.reset();
     writes_to_ancestors_ = true;
+    writers_version++;
 }
 
 void logger::set_level(std::shared_ptr<level> lvl)
@@ -327,6 +425,7 @@ void logger::set_writes_to_ancestors(bool val)
 {
     std::lock_guard<std::mutex> lg(guard_);
     writes_to_ancestors_ = val;
+    writers_version++;
 }
 
 std::string logger::type_to_logger_name(const std::type_info& info)
@@ -346,10 +445,21 @@ std::string logger::type_to_logger_name(const std::type_info& info)
 
 void logger::write(const event& evt)
 {
+    format_memo::scope ms(evt);
+    // Whatever a writer waits for after writing, such as a group
+    // commit's sync, is waited for without the lock, so that threads
+    // logging here can wait together. The writers are held, since
+    // they may be removed in the meantime.
+    std::vector<std::shared_ptr<writer>> wrote;
     std::unique_lock<std::mutex> ul(guard_);
     for (auto& w : writers_)
-        w->write(evt);
+    {
+        if (w->deliver(evt))
+            wrote.push_back(w);
+    }
     ul.unlock();
+    for (auto& w : wrote)
+        w->delivered(evt);
     if (parent_ && writes_to_ancestors_)
         parent_->write(evt);
 }
@@ -16,6 +16,7 @@
 
 #include <chucho/loggly_writer.hpp>
 #include <chucho/curl.hpp>
+#include <chucho/http_bulk_sender.hpp>
 #include <cJSON.h>
 #include <cstring>
 
@@ -30,6 +31,33 @@ std::size_t written_cb(char* data, std::size_t sz, std::size_t num, void* user)
     return total;
 }
 
+void check_response(const std::string& response)
+{
+    auto json = cJSON_Parse(response.c_str());
+    if (json != nullptr)
+    {
+        try
+        {
+            auto resp = cJSON_GetObjectItemCaseSensitive(json, "response");
+            if (resp == nullptr)
+                throw chucho::exception("Unable to find response key in returned JSON from Loggly");
+            if (!cJSON_IsString(resp))
+                throw chucho::exception("The Loggly JSON response is not a string");
+            if (std::strcmp("ok", resp->valuestring) != 0)
+                throw chucho::exception("Expected Loggly ok response, but got: " + std::string(resp->valuestring));
+        } catch (...)
+        {
+            cJSON_Delete(json);
+            throw;
+        }
+        cJSON_Delete(json);
+    }
+    else
+    {
+        throw chucho::exception("Unable to parse JSON from Loggly");
+    }
+}
+
 }
 
 namespace chucho
@@ -40,31 +68,71 @@ loggly_writer::loggly_writer(const std::string& name,
                              const std::string& token)
     : cloud_writer(name, std::move(fmt)),
       curl_(std::make_unique<curl>()),
-      token_(token)
+      token_(token),
+      url_("http://logs-01.loggly.com/inputs/" + token + "/tag/http")
 {
-    auto url = "http://logs-01.loggly.com/inputs/" + token + "/tag/http";
-    curl_->set_option(CURLOPT_URL, url.c_str(), "url");
+    curl_->set_option(CURLOPT_URL, url_.c_str(), "url");
     curl_->set_option(CURLOPT_HTTPHEADER, curl_->create_slist({"content-type:text/plain"}), "HTTP header");
     curl_->set_option(CURLOPT_WRITEFUNCTION, written_cb, "write funtion");
 }
 
+loggly_writer::loggly_writer(const std::string& name,
+                             std::unique_ptr<formatter>&& fmt,
+                             const std::string& token,
+                             const bulk_settings& bulk,
+                             const std::string& url)
+    : cloud_writer(name, std::move(fmt)),
+      token_(token),
+      url_(url.empty() ? "http://logs-01.loggly.com/bulk/" + token + "/tag/bulk/" : url)
+{
+    sender_ = std::make_unique<http_bulk_sender>("loggly_writer",
+                                                 url_,
+                                                 std::vector<std::string>({"content-type:text/plain"}),
+                                                 *formatter_,
+                                                 bulk,
+                                                 check_response,
+                                                 [this, state = thread_state()] () mutable { configure_thread("loggly", state); });
+}
+
 loggly_writer::~loggly_writer()
 {
     // Don't delete this destructor
 }
 
+void loggly_writer::flush()
+{
+    if (sender_)
+        sender_->flush();
+}
+
+optional<cloud_writer::bulk_settings> loggly_writer::get_bulk_settings() const
+{
+    optional<bulk_settings> result;
+    if (sender_)
+        result = sender_->get_settings();
+    return result;
+}
+
 bool loggly_writer::get_verbose() const
 {
-    return curl_->get_verbose();
+    return sender_ ? sender_->get_verbose() : curl_->get_verbose();
 }
 
 void loggly_writer::set_verbose(bool state)
 {
-    curl_->set_verbose(state);
+    if (sender_)
+        sender_->set_verbose(state);
+    else
+        curl_->set_verbose(state);
 }
 
 void loggly_writer::write_impl(const event& evt)
 {
+    if (sender_)
+    {
+        sender_->push(evt);
+        return;
+    }
     auto msg = formatter_->format(evt);
     curl_->set_option(CURLOPT_POSTFIELDS, msg.c_str(), "post fields");
     curl_->set_option(CURLOPT_POSTFIELDSIZE_LARGE, msg.length(), "post field size");
@@ -73,29 +141,7 @@ void loggly_writer::write_impl(const event& evt)
     CURLcode rc = curl_easy_perform(curl_->get());
     if (rc != CURLE_OK)
         throw exception(std::string("Could not send event to Loggly: ") + curl_easy_strerror(rc));
-    auto json = cJSON_Parse(written.c_str());
-    if (json != nullptr)
-    {
-        try
-        {
-            auto resp = cJSON_GetObjectItemCaseSensitive(json, "response");
-            if (resp == nullptr)
-                throw exception("Unable to find response key in returned JSON from Loggly");
-            if (!cJSON_IsString(resp))
-                throw exception("The Loggly JSON response is not a string");
-            if (std::strcmp("ok", resp->valuestring) != 0)
-                throw exception("Expected Loggly ok response, but got: " + std::string(resp->valuestring));
-        } catch (...)
-        {
-            cJSON_Delete(json);
-            throw;
-        }
-        cJSON_Delete(json);
-    }
-    else
-    {
-        throw exception("Unable to parse JSON from Loggly");
-    }
+    check_response(written);
 }
 
 }
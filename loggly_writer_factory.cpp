@@ -34,8 +34,23 @@ std::unique_ptr<configurable> loggly_writer_factory::create_configurable(std::un
         throw exception("loggly_writer_factory: The writer's formatter is not set");
     if (lwm->get_token().empty())
         throw exception("loggly_writer_factory: The writer's token is not set");
-    auto lw = std::make_unique<loggly_writer>(lwm->get_name(), std::move(fmt), lwm->get_token());
+    std::unique_ptr<loggly_writer> lw;
+    if (lwm->get_bulk_settings())
+    {
+        lw = std::make_unique<loggly_writer>(lwm->get_name(),
+                                             std::move(fmt),
+                                             lwm->get_token(),
+                                             *lwm->get_bulk_settings(),
+                                             lwm->get_url());
+    }
+    else
+    {
+        if (!lwm->get_url().empty())
+            throw exception("loggly_writer_factory: The url can only be set in bulk mode");
+        lw = std::make_unique<loggly_writer>(lwm->get_name(), std::move(fmt), lwm->get_token());
+    }
     set_filters(*lw, *lwm);
+    set_thread_settings(*lw, *lwm);
     report_info("Created a " + demangle::get_demangled_name(typeid(*lw)));
     return std::move(lw);
 }
@@ -24,7 +24,36 @@ loggly_writer_memento::loggly_writer_memento(configurator& cfg)
     : writer_memento(cfg)
 {
     set_default_name(typeid(loggly_writer));
+    cfg.get_security_policy().set_text("loggly_writer::bulk", 5);
+    cfg.get_security_policy().set_integer("loggly_writer::max_batch_events", static_cast<std::size_t>(1), static_cast<std::size_t>(100000));
+    cfg.get_security_policy().set_text("loggly_writer::max_batch_events(text)", 6);
+    cfg.get_security_policy().set_integer("loggly_writer::max_batch_bytes", static_cast<std::size_t>(1024), static_cast<std::size_t>(5 * 1024 * 1024));
+    cfg.get_security_policy().set_text("loggly_writer::max_batch_bytes(text)", 7);
+    cfg.get_security_policy().set_integer("loggly_writer::linger", 0, 60 * 60 * 1000);
+    cfg.get_security_policy().set_text("loggly_writer::linger(text)", 7);
+    cfg.get_security_policy().set_integer("loggly_writer::max_retry_batches", static_cast<std::size_t>(1), static_cast<std::size_t>(10000));
+    cfg.get_security_policy().set_text("loggly_writer::max_retry_batches(text)", 5);
+    cfg.get_security_policy().set_text("loggly_writer::url", 2000);
     set_handler("token", [this] (const std::string& t) { token_ = validate("loggly_writer::token", t); });
+    set_handler("bulk", [this] (const std::string& val)
+    {
+        if (boolean_value(validate("loggly_writer::bulk", val)))
+            bulk();
+        else
+            bulk_settings_ = optional<cloud_writer::bulk_settings>();
+    });
+    set_handler("max_batch_events", [this] (const std::string& num) { bulk().max_events = validate("loggly_writer::max_batch_events", static_cast<std::size_t>(std::stoul(validate("loggly_writer::max_batch_events(text)", num)))); });
+    set_handler("max_batch_bytes", [this] (const std::string& num) { bulk().max_bytes = validate("loggly_writer::max_batch_bytes", static_cast<std::size_t>(std::stoul(validate("loggly_writer::max_batch_bytes(text)", num)))); });
+    set_handler("linger", [this] (const std::string& ms) { bulk().linger = std::chrono::milliseconds(validate("loggly_writer::linger", std::stoul(validate("loggly_writer::linger(text)", ms)))); });
+    set_handler("max_retry_batches", [this] (const std::string& num) { bulk().max_retry_batches = validate("loggly_writer::max_retry_batches", static_cast<std::size_t>(std::stoul(validate("loggly_writer::max_retry_batches(text)", num)))); });
+    set_handler("url", [this] (const std::string& u) { url_ = validate("loggly_writer::url", u); });
+}
+
+cloud_writer::bulk_settings& loggly_writer_memento::bulk()
+{
+    if (!bulk_settings_)
+        bulk_settings_ = cloud_writer::bulk_settings();
+    return *bulk_settings_;
 }
 
 }
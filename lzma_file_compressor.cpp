@@ -17,6 +17,8 @@
 #include <chucho/lzma_file_compressor.hpp>
 #include <chucho/exception.hpp>
 #include <chucho/file.hpp>
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <lzma.h>
 
@@ -29,6 +31,11 @@ lzma_file_compressor::lzma_file_compressor(unsigned min_idx)
 }
 
 void lzma_file_compressor::compress(const std::string& file_name)
+{
+    run_at_nice([this, &file_name] () { compress_impl(file_name); });
+}
+
+void lzma_file_compressor::compress_impl(const std::string& file_name)
 {
     std::ifstream in(file_name.c_str(), std::ios::in | std::ios::binary);
     if (!in.is_open())
@@ -44,8 +51,24 @@ void lzma_file_compressor::compress(const std::string& file_name)
         ~sentry() { lzma_end(lzmap); }
         lzma_stream* lzmap;
     } sent(&lzma);
-    if (lzma_easy_encoder(&lzma, 6, LZMA_CHECK_CRC64) == LZMA_MEM_ERROR)
+    lzma_ret init_rc;
+    if (get_threads() == 1)
+    {
+        init_rc = lzma_easy_encoder(&lzma, 6, LZMA_CHECK_CRC64);
+    }
+    else
+    {
+        lzma_mt mt;
+        std::memset(&mt, 0, sizeof(mt));
+        mt.threads = get_threads() == 0 ? std::max(lzma_cputhreads(), 1U) : get_threads();
+        mt.preset = 6;
+        mt.check = LZMA_CHECK_CRC64;
+        init_rc = lzma_stream_encoder_mt(&lzma, &mt);
+    }
+    if (init_rc == LZMA_MEM_ERROR)
         throw std::runtime_error("Out of memory");
+    else if (init_rc != LZMA_OK)
+        throw exception("Could not initialize lzma compression: " + std::to_string(init_rc));
     lzma_action action = LZMA_RUN;
     std::uint8_t in_buf[BUFSIZ];
     std::uint8_t out_buf[BUFSIZ];
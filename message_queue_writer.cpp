@@ -57,11 +57,21 @@ message_queue_writer::~message_queue_writer()
 }
 
 void message_queue_writer::flush()
+{
+    flush_coalesced();
+}
+
+void message_queue_writer::flush_blob(std::vector<std::uint8_t>&& blob)
+{
+    flush_impl(blob);
+}
+
+void message_queue_writer::flush_coalesced()
 {
     auto bytes = serializer_->finish_blob();
     if (compressor_)
         bytes = compressor_->compress(bytes);
-    flush_impl(bytes);
+    flush_blob(std::move(bytes));
     number_coalesced_ = 0;
 }
 
@@ -69,7 +79,7 @@ void message_queue_writer::write_impl(const event& evt)
 {
     serializer_->serialize(evt, *formatter_);
     if (++number_coalesced_ == coalesce_max_)
-        flush();
+        flush_coalesced();
 }
 
 }
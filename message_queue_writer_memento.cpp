@@ -22,8 +22,13 @@ namespace chucho
 {
 
 message_queue_writer_memento::message_queue_writer_memento(configurator& cfg)
+    : message_queue_writer_memento(cfg, message_queue_writer::DEFAULT_COALESCE_MAX)
+{
+}
+
+message_queue_writer_memento::message_queue_writer_memento(configurator& cfg, std::size_t coalesce_max)
     : writer_memento(cfg),
-      coalesce_max_(message_queue_writer::DEFAULT_COALESCE_MAX)
+      coalesce_max_(coalesce_max)
 {
     set_status_origin("message_queue_writer_memento");
     cfg.get_security_policy().set_integer("message_queue_writer::coalesce_max", 0, 10000);
@@ -61,6 +61,7 @@ std::string numbered_file_roller::get_name(int number, bool with_compression_ext
 
 void numbered_file_roller::roll()
 {
+    wait_for_compression();
     try
     {
         file::remove(get_name(max_index_));
@@ -75,7 +76,7 @@ void numbered_file_roller::roll()
                 {
                     to_name = get_name(i, false);
                     std::rename(from_name.c_str(), to_name.c_str());
-                    compressor_->compress(to_name);
+                    compress(to_name);
                 }
                 else
                 {
@@ -86,7 +87,7 @@ void numbered_file_roller::roll()
         to_name = get_name(min_index_, false);
         std::rename(file_writer_->get_file_name().c_str(), to_name.c_str());
         if (is_compressed(min_index_))
-            compressor_->compress(to_name);
+            compress(to_name);
     }
     catch (std::exception& e)
     {
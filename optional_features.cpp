@@ -80,6 +80,12 @@ void init_feature_set(chucho::optional_features::feature_set& fs)
 #if defined(CHUCHO_HAVE_RDKAFKA)
     fs.set(chucho::optional_features::KAFKA_WRITER);
 #endif
+#if defined(CHUCHO_HAVE_SHM_OPEN)
+    fs.set(chucho::optional_features::SHM_RING_WRITER);
+#endif
+#if defined(CHUCHO_HAVE_IO_URING)
+    fs.set(chucho::optional_features::IO_URING_FILE_WRITER);
+#endif
 }
 
 }
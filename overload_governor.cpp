@@ -0,0 +1,286 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/overload_governor.hpp>
+#include <chucho/garbage_cleaner.hpp>
+#include <chucho/text_util.hpp>
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+
+constexpr std::size_t BAND_COUNT = 6;
+
+// These are touched by every call to logger::permits(), so they are
+// plain statics that need no initialization at run time.
+std::atomic<int> shed_threshold(std::numeric_limits<int>::min());
+std::atomic<std::size_t> shed_counts[BAND_COUNT];
+std::atomic<std::uint64_t> next_id(1);
+
+struct static_data
+{
+    static_data();
+
+    std::vector<chucho::overload_governor*> governors_;
+    std::mutex guard_;
+};
+
+static_data::static_data()
+{
+    chucho::garbage_cleaner::get().add([this] () { delete this; });
+}
+
+static_data& data()
+{
+    static std::once_flag once;
+    // This will be cleaned in finalize()
+    static static_data* sd;
+
+    std::call_once(once, [&] () { sd = new static_data(); });
+    return *sd;
+}
+
+// Shed events are counted in bands named for the standard levels
+std::size_t band(int value)
+{
+    return value < 0 ? 0 : std::min(static_cast<std::size_t>(value / 10000), BAND_COUNT - 1);
+}
+
+std::shared_ptr<chucho::level> band_level(std::size_t idx)
+{
+    switch (idx)
+    {
+    case 0:
+        return chucho::level::TRACE_();
+    case 1:
+        return chucho::level::DEBUG_();
+    case 2:
+        return chucho::level::INFO_();
+    case 3:
+        return chucho::level::WARN_();
+    case 4:
+        return chucho::level::ERROR_();
+    default:
+        return chucho::level::FATAL_();
+    }
+}
+
+}
+
+namespace chucho
+{
+
+constexpr double overload_governor::DEFAULT_HYSTERESIS;
+
+overload_governor::overload_governor(const std::vector<watermark>& marks,
+                                     double hysteresis)
+    : marks_(marks),
+      hysteresis_(hysteresis),
+      current_(-1),
+      summary_pending_(false),
+      peak_(-1),
+      id_(next_id++)
+{
+    if (marks_.empty())
+        throw std::invalid_argument("The overload_governor must have at least one watermark");
+    for (std::size_t i = 0; i < marks_.size(); i++)
+    {
+        if (!marks_[i].shed)
+            throw std::invalid_argument("The overload_governor watermark at index " + std::to_string(i) + " has no level");
+        if (marks_[i].fullness <= 0.0 || marks_[i].fullness > 1.0)
+            throw std::invalid_argument("The overload_governor watermark at index " + std::to_string(i) + " must be greater than 0% and no greater than 100%");
+        if (i > 0 && (marks_[i].fullness <= marks_[i - 1].fullness || *marks_[i].shed <= *marks_[i - 1].shed))
+            throw std::invalid_argument("The overload_governor watermarks must be in ascending order of fullness and level");
+    }
+    if (hysteresis_ < 0.0 || hysteresis_ >= 1.0)
+        throw std::invalid_argument("The overload_governor hysteresis must be at least 0% and less than 100%");
+    static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.guard_);
+    sd.governors_.push_back(this);
+}
+
+overload_governor::~overload_governor()
+{
+    static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.guard_);
+    sd.governors_.erase(std::remove(sd.governors_.begin(), sd.governors_.end(), this), sd.governors_.end());
+    int thresh = std::numeric_limits<int>::min();
+    for (auto gov : sd.governors_)
+    {
+        int cur = gov->current_.load();
+        if (cur >= 0)
+            thresh = std::max(thresh, gov->marks_[cur].shed->get_value());
+    }
+    shed_threshold.store(thresh);
+}
+
+bool overload_governor::admits(const level& lvl)
+{
+    int value = lvl.get_value();
+    if (value > shed_threshold.load(std::memory_order_relaxed))
+        return true;
+    shed_counts[band(value)].fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+bool overload_governor::sheds(const level& lvl)
+{
+    return lvl.get_value() <= shed_threshold.load(std::memory_order_relaxed);
+}
+
+bool overload_governor::sheds(const level& lvl, const std::vector<std::uint64_t>& ids)
+{
+    static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.guard_);
+    for (auto gov : sd.governors_)
+    {
+        if (std::find(ids.begin(), ids.end(), gov->id_) != ids.end())
+        {
+            int cur = gov->current_.load();
+            if (cur >= 0 && lvl <= *gov->marks_[cur].shed)
+                return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<level> overload_governor::get_shed_level() const
+{
+    int cur = current_.load();
+    return cur < 0 ? std::shared_ptr<level>() : marks_[cur].shed;
+}
+
+std::vector<overload_governor::watermark> overload_governor::parse_watermarks(const std::string& text)
+{
+    std::vector<watermark> result;
+    std::istringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        auto colon = item.find(':');
+        if (colon == std::string::npos)
+            throw std::invalid_argument("The watermark '" + item + "' must be in the form percent:level");
+        std::string pct = item.substr(0, colon);
+        std::string lvl = item.substr(colon + 1);
+        text_util::trim(pct);
+        text_util::trim(lvl);
+        watermark mark;
+        try
+        {
+            mark.fullness = std::stod(pct) / 100.0;
+        }
+        catch (std::exception&)
+        {
+            throw std::invalid_argument("The watermark '" + item + "' does not have a valid percentage");
+        }
+        mark.shed = level::from_text(lvl);
+        result.push_back(mark);
+    }
+    if (result.empty())
+        throw std::invalid_argument("No watermarks were found in '" + text + "'");
+    return result;
+}
+
+void overload_governor::set_current(int idx)
+{
+    int prev = current_.exchange(idx);
+    if (prev < 0 && idx >= 0)
+    {
+        started_ = std::chrono::steady_clock::now();
+        peak_ = idx;
+    }
+    else if (idx > peak_)
+    {
+        peak_ = idx;
+    }
+    static_data& sd(data());
+    std::lock_guard<std::mutex> lg(sd.guard_);
+    int thresh = std::numeric_limits<int>::min();
+    for (auto gov : sd.governors_)
+    {
+        int cur = gov->current_.load();
+        if (cur >= 0)
+            thresh = std::max(thresh, gov->marks_[cur].shed->get_value());
+    }
+    shed_threshold.store(thresh);
+    if (prev >= 0 && idx < 0)
+    {
+        auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started_);
+        std::ostringstream stream;
+        stream << "Events at or below " << marks_[peak_].shed->get_name() << " were shed for "
+               << millis.count() << " milliseconds because the cache was congested";
+        // If another governor is still shedding, it will report the
+        // counts when it finishes.
+        if (thresh == std::numeric_limits<int>::min())
+        {
+            bool first = true;
+            for (std::size_t i = 0; i < BAND_COUNT; i++)
+            {
+                auto count = shed_counts[i].exchange(0);
+                if (count > 0)
+                {
+                    stream << (first ? ": " : ", ") << band_level(i)->get_name() << " " << count;
+                    first = false;
+                }
+            }
+        }
+        summary_ = stream.str();
+        summary_pending_ = true;
+    }
+}
+
+optional<std::string> overload_governor::take_summary()
+{
+    optional<std::string> result;
+    if (summary_pending_.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lg(guard_);
+        if (summary_pending_)
+        {
+            result = summary_;
+            summary_pending_ = false;
+        }
+    }
+    return result;
+}
+
+void overload_governor::update(double fullness)
+{
+    int cur = current_.load(std::memory_order_relaxed);
+    // Quick check to avoid the lock when nothing changes
+    if ((cur + 1 == static_cast<int>(marks_.size()) || fullness < marks_[cur + 1].fullness) &&
+        (cur < 0 || fullness >= marks_[cur].fullness - hysteresis_))
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lg(guard_);
+    cur = current_.load();
+    int idx = cur;
+    while (idx + 1 < static_cast<int>(marks_.size()) && fullness >= marks_[idx + 1].fullness)
+        ++idx;
+    if (idx == cur)
+    {
+        while (idx >= 0 && fullness < marks_[idx].fullness - hysteresis_)
+            --idx;
+    }
+    if (idx != cur)
+        set_current(idx);
+}
+
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/parallel_compressor.hpp>
+#include <chucho/thread_util.hpp>
+#include <chucho/exception.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+
+struct block
+{
+    std::vector<char> in;
+    std::vector<char> out;
+    bool done = false;
+    std::exception_ptr error;
+};
+
+}
+
+namespace chucho
+{
+
+parallel_compressor::parallel_compressor(unsigned threads, int nice, std::size_t block_size, block_function fn)
+    : threads_(threads == 0 ? std::max(std::thread::hardware_concurrency(), 1U) : threads),
+      nice_(nice),
+      block_size_(block_size),
+      fn_(fn)
+{
+}
+
+void parallel_compressor::compress(std::istream& in, std::ostream& out)
+{
+    // Blocks in input order, some of which are waiting for a thread
+    std::deque<std::shared_ptr<block>> blocks;
+    std::deque<std::shared_ptr<block>> waiting;
+    std::size_t max_blocks = threads_ * 2;
+    bool stop = false;
+    std::mutex guard;
+    std::condition_variable waiting_condition;
+    std::condition_variable done_condition;
+    // The threads take after the one that compresses, which has
+    // its writer's settings
+    auto ts = thread_util::get_applied_settings();
+    auto thread_main = [&] ()
+    {
+        thread_util::configure(ts, "chucho-compress");
+        if (nice_ != 0)
+            thread_util::adjust_nice(nice_);
+        std::unique_lock<std::mutex> ul(guard);
+        while (true)
+        {
+            waiting_condition.wait(ul, [&] () { return stop || !waiting.empty(); });
+            if (waiting.empty())
+                break;
+            auto blk = waiting.front();
+            waiting.pop_front();
+            ul.unlock();
+            try
+            {
+                fn_(blk->in, blk->out);
+            }
+            catch (...)
+            {
+                blk->error = std::current_exception();
+            }
+            std::vector<char>().swap(blk->in);
+            ul.lock();
+            blk->done = true;
+            done_condition.notify_one();
+        }
+    };
+    std::vector<std::thread> threads;
+    struct sentry
+    {
+        sentry(std::vector<std::thread>& thr, bool& stp, std::mutex& grd, std::condition_variable& cond)
+            : thr_(thr), stp_(stp), grd_(grd), cond_(cond) { }
+        ~sentry()
+        {
+            std::unique_lock<std::mutex> ul(grd_);
+            stp_ = true;
+            ul.unlock();
+            cond_.notify_all();
+            for (auto& t : thr_)
+                t.join();
+        }
+        std::vector<std::thread>& thr_;
+        bool& stp_;
+        std::mutex& grd_;
+        std::condition_variable& cond_;
+    } sent(threads, stop, guard, waiting_condition);
+    for (unsigned i = 0; i < threads_; i++)
+        threads.emplace_back(thread_main);
+    bool at_end = false;
+    bool written = false;
+    std::unique_lock<std::mutex> ul(guard);
+    while (!at_end || !blocks.empty())
+    {
+        while (!blocks.empty() && blocks.front()->done)
+        {
+            auto blk = blocks.front();
+            blocks.pop_front();
+            ul.unlock();
+            if (blk->error)
+                std::rethrow_exception(blk->error);
+            out.write(blk->out.data(), blk->out.size());
+            if (!out)
+                throw exception("Error writing compressed data");
+            written = true;
+            ul.lock();
+        }
+        if (at_end || blocks.size() >= max_blocks)
+        {
+            if (!blocks.empty())
+                done_condition.wait(ul, [&] () { return blocks.front()->done; });
+        }
+        else
+        {
+            ul.unlock();
+            auto blk = std::make_shared<block>();
+            blk->in.resize(block_size_);
+            in.read(blk->in.data(), block_size_);
+            blk->in.resize(in.gcount());
+            if (!in && !in.eof())
+                throw exception("Error reading data to compress");
+            at_end = in.eof();
+            ul.lock();
+            if (!blk->in.empty())
+            {
+                blocks.push_back(blk);
+                waiting.push_back(blk);
+                waiting_condition.notify_one();
+            }
+        }
+    }
+    ul.unlock();
+    // Empty input still has to be a valid compressed file
+    if (!written)
+    {
+        std::vector<char> empty;
+        std::vector<char> result;
+        fn_(empty, result);
+        out.write(result.data(), result.size());
+        if (!out)
+            throw exception("Error writing compressed data");
+    }
+}
+
+}
@@ -19,6 +19,7 @@
 #include <chucho/calendar.hpp>
 #include <chucho/file.hpp>
 #include <chucho/exception.hpp>
+#include <chucho/format_memo.hpp>
 #include <chucho/marker.hpp>
 #include <chucho/diagnostic_context.hpp>
 #include <chucho/line_ending.hpp>
@@ -65,6 +66,7 @@ namespace chucho
 {
 
 pattern_formatter::pattern_formatter(const std::string& pattern)
+    : pattern_(pattern)
 {
     set_status_origin("pattern_formatter");
     parse(pattern);
@@ -155,9 +157,15 @@ std::unique_ptr<pattern_formatter::piece> pattern_formatter::create_piece(std::s
 
 std::string pattern_formatter::format(const event& evt)
 {
+    // The text depends only on the pattern and the event, so any
+    // formatter with the same pattern can reuse it
+    auto found = format_memo::find(evt, pattern_);
+    if (found != nullptr)
+        return *found;
     std::string result;
     for (auto& p : pieces_)
         result += p->get_text(evt);
+    format_memo::remember(evt, pattern_, result);
     return result;
 }
 
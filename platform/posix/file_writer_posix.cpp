@@ -15,13 +15,38 @@
  */
 
 #include <chucho/file_writer.hpp>
+#include <chucho/exception.hpp>
 #include <errno.h>
 #include <cstring>
 #include <fcntl.h>
+#include <unistd.h>
 
 namespace chucho
 {
 
+void file_writer::close_sync_handle()
+{
+    if (sync_handle_ != -1)
+    {
+        ::close(sync_handle_);
+        sync_handle_ = -1;
+    }
+}
+
+void file_writer::duplicate_sync_handle()
+{
+    close_sync_handle();
+    if (is_open_)
+    {
+        sync_handle_ = ::dup(get_file_descriptor());
+        if (sync_handle_ == -1)
+        {
+            int err = errno;
+            report_error("Unable to duplicate the descriptor of " + file_name_ + " for syncing: " + std::strerror(err));
+        }
+    }
+}
+
 void file_writer::open_impl(const std::string& file_name)
 {
     int flag = O_WRONLY;
@@ -48,4 +73,21 @@ void file_writer::open_impl(const std::string& file_name)
     }
 }
 
+void file_writer::sync_handle()
+{
+    if (sync_handle_ != -1)
+    {
+#if defined(CHUCHO_HAVE_FDATASYNC)
+        int rc = ::fdatasync(sync_handle_);
+#else
+        int rc = ::fsync(sync_handle_);
+#endif
+        if (rc != 0)
+        {
+            int err = errno;
+            throw exception(std::strerror(err));
+        }
+    }
+}
+
 }
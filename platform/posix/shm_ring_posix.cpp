@@ -0,0 +1,160 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/shm_ring.hpp>
+#include <chucho/exception.hpp>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+namespace
+{
+
+class fd_closer
+{
+public:
+    fd_closer(int fd) : fd_(fd) { }
+    ~fd_closer() { close(fd_); }
+
+private:
+    int fd_;
+};
+
+}
+
+namespace chucho
+{
+
+shm_ring::~shm_ring()
+{
+    if (base_ != nullptr)
+        munmap(base_, size_);
+}
+
+void shm_ring::map(bool create, std::uint32_t slot_count, std::uint32_t slot_size, overflow ovr)
+{
+    int fd = -1;
+    bool created = false;
+    if (create)
+    {
+        fd = shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd >= 0)
+            created = true;
+        else if (errno != EEXIST)
+            throw exception("Could not create the shared memory segment " + name_ + ": " + std::strerror(errno));
+    }
+    if (fd == -1)
+    {
+        fd = shm_open(name_.c_str(), O_RDWR, 0);
+        if (fd == -1)
+            throw exception("Could not open the shared memory segment " + name_ + ": " + std::strerror(errno));
+    }
+    fd_closer closer(fd);
+    if (created)
+    {
+        size_ = segment_size(slot_count, slot_size);
+        if (ftruncate(fd, size_) != 0)
+        {
+            int err = errno;
+            shm_unlink(name_.c_str());
+            throw exception("Could not size the shared memory segment " + name_ + ": " + std::strerror(err));
+        }
+    }
+    else
+    {
+        // The process that created it may not have sized it yet
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        struct stat st;
+        while (true)
+        {
+            if (fstat(fd, &st) != 0)
+                throw exception("Could not examine the shared memory segment " + name_ + ": " + std::strerror(errno));
+            if (st.st_size >= static_cast<off_t>(sizeof(header)))
+                break;
+            if (std::chrono::steady_clock::now() >= deadline)
+                throw exception("The shared memory segment " + name_ + " was never initialized");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        size_ = st.st_size;
+    }
+    base_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base_ == MAP_FAILED)
+    {
+        base_ = nullptr;
+        throw exception("Could not map the shared memory segment " + name_ + ": " + std::strerror(errno));
+    }
+    if (created)
+    {
+        header_ = new (base_) header();
+        header_->version = VERSION;
+        header_->slot_count = slot_count;
+        header_->slot_size = slot_size;
+        header_->policy = static_cast<std::uint32_t>(ovr);
+        header_->magic.store(MAGIC, std::memory_order_release);
+    }
+    else
+    {
+        header_ = static_cast<header*>(base_);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (header_->magic.load(std::memory_order_acquire) != MAGIC)
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                munmap(base_, size_);
+                base_ = nullptr;
+                throw exception("The shared memory segment " + name_ + " is not a Chucho ring");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        std::uint32_t cnt = header_->slot_count;
+        if (header_->version != VERSION ||
+            cnt < 2 ||
+            (cnt & (cnt - 1)) != 0 ||
+            header_->slot_size < 64 ||
+            size_ < segment_size(cnt, header_->slot_size))
+        {
+            munmap(base_, size_);
+            base_ = nullptr;
+            throw exception("The shared memory segment " + name_ + " has an incompatible layout");
+        }
+        if (create)
+        {
+            geometry_matched_ = slot_count == cnt &&
+                                slot_size == header_->slot_size &&
+                                static_cast<std::uint32_t>(ovr) == header_->policy;
+        }
+    }
+    slots_ = static_cast<std::uint8_t*>(base_) + sizeof(header);
+    mask_ = header_->slot_count - 1;
+}
+
+std::string shm_ring::normalize_name(const std::string& name)
+{
+    return (!name.empty() && name[0] == '/') ? name : '/' + name;
+}
+
+void shm_ring::remove(const std::string& name)
+{
+    shm_unlink(normalize_name(name).c_str());
+}
+
+}
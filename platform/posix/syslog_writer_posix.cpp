@@ -15,21 +15,28 @@
  */
 
 #include <chucho/syslog_writer.hpp>
+#include <chucho/syslog_message_builder.hpp>
 #include <chucho/exception.hpp>
-#include <chucho/calendar.hpp>
-#include <chucho/host.hpp>
+#include <chucho/status_reporter.hpp>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <assert.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 #include <syslog.h>
-#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <mutex>
+#include <thread>
 #include <vector>
-#include <array>
 #include <cerrno>
+#include <stdexcept>
 
 namespace chucho
 {
@@ -39,12 +46,9 @@ class syslog_transport_handle
 public:
     virtual ~syslog_transport_handle() { }
 
-    virtual std::string format(syslog::facility fcl,
-                               syslog::severity sev,
-                               const event::time_type& when,
-                               const std::string& message) = 0;
-    virtual void send(syslog::facility fcl,
-                      syslog::severity sev,
+    virtual void flush() { }
+    virtual void send(syslog::severity sev,
+                      const event& evt,
                       const std::string& message) = 0;
 };
 
@@ -53,113 +57,495 @@ public:
 namespace
 {
 
-std::string format_time(const chucho::event::time_type& when)
-{
-    static const char* english_months[] =
-    {
-        "Jan", "Feb", "Mar", "Apr", "May", "Jun",
-        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
-    };
+#if defined(MSG_NOSIGNAL)
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+constexpr int SEND_FLAGS = 0;
+#endif
 
-    chucho::calendar::pieces cal = chucho::calendar::get_local(std::chrono::system_clock::to_time_t(when));
-    std::string result = english_months[cal.tm_mon];
-    result += chucho::calendar::format(cal, " %e %H:%M:%S");
-    return result;
-}
+// Held messages are sent by the flusher once the oldest is this old
+constexpr std::chrono::seconds MAX_HOLD(1);
+// The sender waits no longer than this for a connection to complete
+constexpr std::chrono::milliseconds CONNECT_TIMEOUT(500);
+// The sender gives up on a connection that accepts nothing for this long
+constexpr std::chrono::seconds SEND_TIMEOUT(1);
+// Reconnection is not attempted more often than this
+constexpr std::chrono::seconds RECONNECT_INTERVAL(1);
+// TCP messages waiting to be sent may take no more than this, and
+// messages that would not fit are dropped
+constexpr std::size_t MAX_PENDING_BYTES = 1024 * 1024;
 
 class local_syslog_transport_handle : public chucho::syslog_transport_handle
 {
 public:
-    virtual std::string format(chucho::syslog::facility fcl,
-                               chucho::syslog::severity sev,
-                               const chucho::event::time_type& when,
-                               const std::string& message) override;
-    virtual void send(chucho::syslog::facility fcl,
-                      chucho::syslog::severity sev,
+    local_syslog_transport_handle(chucho::syslog::facility fcl);
+
+    virtual void send(chucho::syslog::severity sev,
+                      const chucho::event& evt,
                       const std::string& message) override;
+
+private:
+    chucho::syslog::facility facility_;
 };
 
-class remote_syslog_transport_handle : public chucho::syslog_transport_handle
+class remote_syslog_transport_handle : public chucho::syslog_transport_handle,
+                                       public chucho::status_reporter
 {
 public:
-    remote_syslog_transport_handle(const std::string& host, std::uint16_t port);
+    remote_syslog_transport_handle(chucho::syslog::facility fcl,
+                                   const std::string& host,
+                                   std::uint16_t port,
+                                   chucho::syslog::transport_protocol proto,
+                                   chucho::syslog::message_format mfmt,
+                                   std::size_t batch_size,
+                                   const std::string& structured_data_id,
+                                   std::function<void()> configure_thread);
     ~remote_syslog_transport_handle();
 
-    virtual std::string format(chucho::syslog::facility fcl,
-                               chucho::syslog::severity sev,
-                               const chucho::event::time_type& when,
-                               const std::string& message) override;
-    virtual void send(chucho::syslog::facility fcl,
-                      chucho::syslog::severity sev,
+    virtual void flush() override;
+    virtual void send(chucho::syslog::severity sev,
+                      const chucho::event& evt,
                       const std::string& message) override;
 
 private:
-    std::string get_timestamp();
+    void close_socket();
+    // Start connecting without blocking
+    void connect_stream();
+    void finish_connect();
+    // NOTE: guard_ must be locked on entry
+    void flush_held();
+    void flusher_main();
+    void send_datagrams(std::size_t count);
+    // Only the sender calls this, and guard_ is not locked
+    void send_stream(const std::string& text);
+    void sender_main();
+    // Wait for the socket to become writable
+    bool wait_writable(std::chrono::milliseconds timeout);
 
+    chucho::syslog_message_builder builder_;
+    // Applies the writer's thread settings to the flusher or sender
+    std::function<void()> configure_thread_;
+    chucho::syslog::transport_protocol protocol_;
+    std::size_t batch_size_;
     int socket_;
+    int family_;
     std::vector<std::uint8_t> address_;
+    std::mutex guard_;
+    // For UDP, one entry per held message. The strings are reused
+    // so that their buffers don't have to be allocated each time.
+    std::vector<std::string> datagrams_;
+#if defined(CHUCHO_HAVE_SENDMMSG)
+    std::vector<struct mmsghdr> headers_;
+    std::vector<struct iovec> vectors_;
+#endif
+    // For TCP, the framed held messages. The socket belongs to the
+    // sender thread, so writing never waits for the network.
+    std::string stream_;
+    std::string sending_;
+    std::string scratch_;
+    std::size_t held_;
+    std::size_t dropped_;
+    std::size_t flush_requested_;
+    std::size_t flush_completed_;
+    std::chrono::steady_clock::time_point oldest_;
+    std::chrono::steady_clock::time_point last_connect_attempt_;
+    bool connecting_;
+    std::condition_variable flusher_cond_;
+    std::condition_variable flushed_cond_;
+    bool stop_;
+    std::unique_ptr<std::thread> flusher_;
 };
 
-std::string local_syslog_transport_handle::format(chucho::syslog::facility fcl,
-                                                  chucho::syslog::severity sev,
-                                                  const chucho::event::time_type& when,
-                                                  const std::string& message)
+local_syslog_transport_handle::local_syslog_transport_handle(chucho::syslog::facility fcl)
+    : facility_(fcl)
 {
-    return message;
 }
 
-void local_syslog_transport_handle::send(chucho::syslog::facility fcl,
-                                         chucho::syslog::severity sev,
+void local_syslog_transport_handle::send(chucho::syslog::severity sev,
+                                         const chucho::event&,
                                          const std::string& message)
 {
-    syslog(static_cast<int>(fcl) | static_cast<int>(sev), "%s", message.c_str());
+    syslog(static_cast<int>(facility_) | static_cast<int>(sev), "%s", message.c_str());
 }
 
-remote_syslog_transport_handle::remote_syslog_transport_handle(const std::string& host, std::uint16_t port)
-    : socket_(-1)
+remote_syslog_transport_handle::remote_syslog_transport_handle(chucho::syslog::facility fcl,
+                                                               const std::string& host,
+                                                               std::uint16_t port,
+                                                               chucho::syslog::transport_protocol proto,
+                                                               chucho::syslog::message_format mfmt,
+                                                               std::size_t batch_size,
+                                                               const std::string& structured_data_id,
+                                                               std::function<void()> configure_thread)
+    : builder_(fcl, mfmt, structured_data_id),
+      configure_thread_(configure_thread),
+      protocol_(proto),
+      batch_size_(batch_size),
+      socket_(-1),
+      held_(0),
+      dropped_(0),
+      flush_requested_(0),
+      flush_completed_(0),
+      connecting_(false),
+      stop_(false)
 {
+    set_status_origin("syslog_writer");
+    if (batch_size_ == 0)
+        throw std::invalid_argument("The syslog batch size must be greater than zero");
+    struct addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = protocol_ == chucho::syslog::transport_protocol::TCP ? SOCK_STREAM : SOCK_DGRAM;
     struct addrinfo* info;
-    int rc = getaddrinfo(host.c_str(), std::to_string(port).c_str(), nullptr, &info);
+    int rc = getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &info);
     if (rc != 0)
         throw chucho::exception("Could not resolve address of " + host + ": " + gai_strerror(rc));
     address_.resize(info->ai_addrlen);
     std::memcpy(&address_[0], info->ai_addr, info->ai_addrlen);
-    socket_ = socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+    family_ = info->ai_family;
     freeaddrinfo(info);
+    if (protocol_ == chucho::syslog::transport_protocol::TCP)
+    {
+        // A syslog relay that is down now might not be later, so
+        // failure to connect is only reported when writing.
+        try
+        {
+            connect_stream();
+        }
+        catch (chucho::exception&)
+        {
+        }
+    }
+    else
+    {
+        socket_ = socket(family_, SOCK_DGRAM, 0);
+        if (socket_ == -1)
+            throw chucho::exception(std::string("Could not create socket: ") + std::strerror(errno));
+        datagrams_.resize(batch_size_);
+#if defined(CHUCHO_HAVE_SENDMMSG)
+        if (batch_size_ > 1)
+        {
+            headers_.resize(batch_size_);
+            vectors_.resize(batch_size_);
+        }
+#endif
+    }
+    if (protocol_ == chucho::syslog::transport_protocol::TCP)
+        flusher_ = std::make_unique<std::thread>(&remote_syslog_transport_handle::sender_main, this);
+    else if (batch_size_ > 1)
+        flusher_ = std::make_unique<std::thread>(&remote_syslog_transport_handle::flusher_main, this);
+}
+
+remote_syslog_transport_handle::~remote_syslog_transport_handle()
+{
+    if (flusher_)
+    {
+        {
+            std::lock_guard<std::mutex> lg(guard_);
+            stop_ = true;
+        }
+        flusher_cond_.notify_all();
+        flusher_->join();
+    }
+    close_socket();
+}
+
+void remote_syslog_transport_handle::close_socket()
+{
+    if (socket_ != -1)
+    {
+        close(socket_);
+        socket_ = -1;
+    }
+    connecting_ = false;
+}
+
+void remote_syslog_transport_handle::connect_stream()
+{
+    last_connect_attempt_ = std::chrono::steady_clock::now();
+    socket_ = socket(family_, SOCK_STREAM, 0);
     if (socket_ == -1)
         throw chucho::exception(std::string("Could not create socket: ") + std::strerror(errno));
+#if !defined(MSG_NOSIGNAL) && defined(SO_NOSIGPIPE)
+    int on = 1;
+    setsockopt(socket_, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+    // The socket stays non-blocking, so a slow collector can only
+    // hold up the sender
+    fcntl(socket_, F_SETFL, fcntl(socket_, F_GETFL, 0) | O_NONBLOCK);
+    if (connect(socket_, reinterpret_cast<struct sockaddr*>(&address_[0]), address_.size()) == -1)
+    {
+        int err = errno;
+        if (err == EINPROGRESS)
+        {
+            connecting_ = true;
+            return;
+        }
+        close_socket();
+        throw chucho::exception(std::string("Could not connect to the syslog host: ") + std::strerror(err));
+    }
 }
 
-remote_syslog_transport_handle::~remote_syslog_transport_handle()
+void remote_syslog_transport_handle::finish_connect()
 {
-    close(socket_);
+    int err = 0;
+    if (!wait_writable(CONNECT_TIMEOUT))
+    {
+        err = errno;
+    }
+    else
+    {
+        socklen_t len = sizeof(err);
+        if (getsockopt(socket_, SOL_SOCKET, SO_ERROR, &err, &len) == -1)
+            err = errno;
+    }
+    if (err != 0)
+    {
+        close_socket();
+        throw chucho::exception(std::string("Could not connect to the syslog host: ") + std::strerror(err));
+    }
+    connecting_ = false;
 }
 
-std::string remote_syslog_transport_handle::format(chucho::syslog::facility fcl,
-                                                   chucho::syslog::severity sev,
-                                                   const chucho::event::time_type& when,
-                                                   const std::string& message)
+void remote_syslog_transport_handle::flush()
 {
-    std::ostringstream stream;
-    stream << '<' << (static_cast<int>(fcl) | static_cast<int>(sev)) << '>' <<
-        format_time(when) << ' ' << chucho::host::get_base_name() << ' ' << message;
-    return stream.str();
+    std::unique_lock<std::mutex> ul(guard_);
+    if (protocol_ == chucho::syslog::transport_protocol::TCP)
+    {
+        // The sender does the work, so just wait for it
+        std::size_t target = ++flush_requested_;
+        flusher_cond_.notify_all();
+        flushed_cond_.wait(ul, [this, target] () { return flush_completed_ >= target; });
+    }
+    else
+    {
+        flush_held();
+    }
+}
+
+void remote_syslog_transport_handle::flush_held()
+{
+    if (held_ == 0)
+        return;
+    std::size_t count = held_;
+    held_ = 0;
+    send_datagrams(count);
 }
 
-void remote_syslog_transport_handle::send(chucho::syslog::facility fcl,
-                                          chucho::syslog::severity sev,
+void remote_syslog_transport_handle::flusher_main()
+{
+    std::unique_lock<std::mutex> ul(guard_);
+    while (!stop_)
+    {
+        configure_thread_();
+        if (held_ == 0)
+        {
+            flusher_cond_.wait(ul);
+        }
+        else if (std::chrono::steady_clock::now() - oldest_ >= MAX_HOLD)
+        {
+            try
+            {
+                flush_held();
+            }
+            catch (std::exception& e)
+            {
+                report_error(std::string("Error sending held syslog messages: ") + e.what());
+            }
+        }
+        else
+        {
+            flusher_cond_.wait_until(ul, oldest_ + MAX_HOLD);
+        }
+    }
+}
+
+void remote_syslog_transport_handle::send(chucho::syslog::severity sev,
+                                          const chucho::event& evt,
                                           const std::string& message)
 {
-    if (socket_ != -1 &&
-        sendto(socket_,
-               message.data(),
-               message.length(),
-               0,
-               reinterpret_cast<struct sockaddr*>(&address_[0]),
-               address_.size()) == -1)
+    std::lock_guard<std::mutex> lg(guard_);
+    if (protocol_ == chucho::syslog::transport_protocol::TCP)
+    {
+        // RFC 6587 octet counting: the length, a space, then the message
+        scratch_.clear();
+        builder_.append(scratch_, sev, evt, message);
+        std::string count = std::to_string(scratch_.length());
+        if (stream_.length() + count.length() + 1 + scratch_.length() > MAX_PENDING_BYTES)
+        {
+            // The sender will report it
+            ++dropped_;
+            return;
+        }
+        stream_ += count;
+        stream_ += ' ';
+        stream_ += scratch_;
+        if (held_++ == 0)
+            oldest_ = std::chrono::steady_clock::now();
+        if (held_ >= batch_size_ || held_ == 1)
+            flusher_cond_.notify_all();
+        return;
+    }
+    std::string& text(datagrams_[held_]);
+    text.clear();
+    builder_.append(text, sev, evt, message);
+    if (held_++ == 0 && batch_size_ > 1)
+    {
+        oldest_ = std::chrono::steady_clock::now();
+        flusher_cond_.notify_one();
+    }
+    if (held_ >= batch_size_)
+        flush_held();
+}
+
+void remote_syslog_transport_handle::send_datagrams(std::size_t count)
+{
+    auto addr = reinterpret_cast<struct sockaddr*>(&address_[0]);
+#if defined(CHUCHO_HAVE_SENDMMSG)
+    if (count > 1)
     {
-        throw chucho::exception(std::string("Unable to send syslog data: ") + std::strerror(errno));
+        for (std::size_t i = 0; i < count; i++)
+        {
+            vectors_[i].iov_base = const_cast<char*>(datagrams_[i].data());
+            vectors_[i].iov_len = datagrams_[i].length();
+            std::memset(&headers_[i], 0, sizeof(headers_[i]));
+            headers_[i].msg_hdr.msg_name = addr;
+            headers_[i].msg_hdr.msg_namelen = address_.size();
+            headers_[i].msg_hdr.msg_iov = &vectors_[i];
+            headers_[i].msg_hdr.msg_iovlen = 1;
+        }
+        std::size_t sent = 0;
+        while (sent < count)
+        {
+            int rc = sendmmsg(socket_, &headers_[sent], count - sent, SEND_FLAGS);
+            if (rc == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+                throw chucho::exception("Unable to send syslog data (" + std::to_string(count - sent) + " messages lost): " + std::strerror(errno));
+            }
+            sent += rc;
+        }
+        return;
     }
+#endif
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (sendto(socket_,
+                   datagrams_[i].data(),
+                   datagrams_[i].length(),
+                   SEND_FLAGS,
+                   addr,
+                   address_.size()) == -1)
+        {
+            throw chucho::exception(std::string("Unable to send syslog data: ") + std::strerror(errno));
+        }
+    }
+}
+
+void remote_syslog_transport_handle::send_stream(const std::string& text)
+{
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        if (socket_ == -1)
+        {
+            if (std::chrono::steady_clock::now() - last_connect_attempt_ < RECONNECT_INTERVAL)
+                throw chucho::exception("Not connected to the syslog host");
+            connect_stream();
+        }
+        if (connecting_)
+            finish_connect();
+        std::size_t sent = 0;
+        while (sent < text.length())
+        {
+            auto rc = ::send(socket_, text.data() + sent, text.length() - sent, SEND_FLAGS);
+            if (rc == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+                if ((errno == EAGAIN || errno == EWOULDBLOCK) && wait_writable(SEND_TIMEOUT))
+                    continue;
+                break;
+            }
+            sent += rc;
+        }
+        if (sent == text.length())
+            return;
+        // The connection is broken, so try again once on a new one.
+        // The receiver may see some messages twice, but that's
+        // better than losing them.
+        int err = errno;
+        close_socket();
+        if (attempt == 1)
+            throw chucho::exception(std::string("Unable to send syslog data: ") + std::strerror(err));
+    }
+}
+
+void remote_syslog_transport_handle::sender_main()
+{
+    std::unique_lock<std::mutex> ul(guard_);
+    while (true)
+    {
+        configure_thread_();
+        auto now = std::chrono::steady_clock::now();
+        bool flushing = flush_requested_ != flush_completed_;
+        if (held_ > 0 && (held_ >= batch_size_ || now - oldest_ >= MAX_HOLD || flushing || stop_))
+        {
+            std::size_t count = held_;
+            std::size_t target = flush_requested_;
+            sending_.swap(stream_);
+            stream_.clear();
+            held_ = 0;
+            std::size_t dropped = dropped_;
+            dropped_ = 0;
+            ul.unlock();
+            if (dropped > 0)
+                report_warning(std::to_string(dropped) + " syslog messages were dropped because they could not be sent quickly enough");
+            try
+            {
+                send_stream(sending_);
+            }
+            catch (std::exception& e)
+            {
+                report_error(std::to_string(count) + " syslog messages were lost: " + e.what());
+            }
+            ul.lock();
+            flush_completed_ = std::max(flush_completed_, target);
+            flushed_cond_.notify_all();
+        }
+        else if (flushing)
+        {
+            flush_completed_ = flush_requested_;
+            flushed_cond_.notify_all();
+        }
+        else if (stop_)
+        {
+            break;
+        }
+        else if (held_ == 0)
+        {
+            flusher_cond_.wait(ul);
+        }
+        else
+        {
+            flusher_cond_.wait_until(ul, oldest_ + MAX_HOLD);
+        }
+    }
+}
+
+bool remote_syslog_transport_handle::wait_writable(std::chrono::milliseconds timeout)
+{
+    struct pollfd pfd;
+    pfd.fd = socket_;
+    pfd.events = POLLOUT;
+    int rc;
+    do
+    {
+        rc = poll(&pfd, 1, static_cast<int>(timeout.count()));
+    } while (rc == -1 && errno == EINTR);
+    if (rc == 0)
+        errno = ETIMEDOUT;
+    return rc > 0;
+
 }
 
 }
@@ -167,13 +553,20 @@ void remote_syslog_transport_handle::send(chucho::syslog::facility fcl,
 namespace chucho
 {
 
-syslog_writer::transport::transport()
-    : handle_(new local_syslog_transport_handle())
+syslog_writer::transport::transport(syslog::facility fcl)
+    : handle_(new local_syslog_transport_handle(fcl))
 {
 }
 
-syslog_writer::transport::transport(const std::string& host, std::uint16_t port)
-    : handle_(new remote_syslog_transport_handle(host, port))
+syslog_writer::transport::transport(syslog::facility fcl,
+                                    const std::string& host,
+                                    std::uint16_t port,
+                                    syslog::transport_protocol proto,
+                                    syslog::message_format mfmt,
+                                    std::size_t batch_size,
+                                    const std::string& structured_data_id,
+                                    std::function<void()> configure_thread)
+    : handle_(new remote_syslog_transport_handle(fcl, host, port, proto, mfmt, batch_size, structured_data_id, configure_thread))
 {
 }
 
@@ -182,17 +575,16 @@ syslog_writer::transport::~transport()
     delete handle_;
 }
 
-std::string syslog_writer::transport::format(syslog::facility fcl,
-                                             syslog::severity sev,
-                                             const chucho::event::time_type& when,
-                                             const std::string& message)
+void syslog_writer::transport::flush()
 {
-    return handle_->format(fcl, sev, when, message);
+    handle_->flush();
 }
 
-void syslog_writer::transport::send(syslog::facility fcl, syslog::severity sev, const std::string& message)
+void syslog_writer::transport::send(syslog::severity sev,
+                                    const event& evt,
+                                    const std::string& message)
 {
-    handle_->send(fcl, sev, message);
+    handle_->send(sev, evt, message);
 }
 
 }
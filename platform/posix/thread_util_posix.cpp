@@ -0,0 +1,195 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/thread_util.hpp>
+#if defined(__linux__)
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+namespace
+{
+
+#if defined(__linux__)
+
+// The task id, to which Linux attaches niceness per thread
+id_t get_tid()
+{
+    return static_cast<id_t>(::syscall(SYS_gettid));
+}
+
+#endif
+
+}
+
+namespace chucho
+{
+
+namespace thread_util
+{
+
+bool adjust_nice(int nice)
+{
+#if defined(__linux__)
+    errno = 0;
+    int cur = ::getpriority(PRIO_PROCESS, get_tid());
+    if (cur == -1 && errno != 0)
+        return false;
+    return ::setpriority(PRIO_PROCESS, get_tid(), cur + nice) == 0;
+#else
+    // Elsewhere niceness belongs to the whole process
+    return nice == 0;
+#endif
+}
+
+bool clear_affinity()
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    // CPUs that do not exist are ignored
+    for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        CPU_SET(cpu, &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+bool clear_numa_node()
+{
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    // MPOL_DEFAULT from numaif.h
+    constexpr int MPOL_DEFAULT_ = 0;
+    return ::syscall(SYS_set_mempolicy, MPOL_DEFAULT_, nullptr, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+std::vector<unsigned> get_numa_node_cpus(unsigned node)
+{
+    std::vector<unsigned> result;
+#if defined(__linux__)
+    std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (std::getline(in, list))
+    {
+        try
+        {
+            result = thread_settings::parse_cpu_list(list);
+        }
+        catch (std::invalid_argument&)
+        {
+        }
+    }
+#endif
+    return result;
+}
+
+std::string make_name(const std::string& role, const std::string& owner)
+{
+    std::string result = role + ':' + owner;
+#if defined(__linux__)
+    // Linux allows 15 characters plus the terminator
+    constexpr std::size_t MAX_NAME = 15;
+#elif defined(__APPLE__)
+    constexpr std::size_t MAX_NAME = 63;
+#else
+    constexpr std::size_t MAX_NAME = std::string::npos;
+#endif
+    if (result.length() > MAX_NAME && role.length() + 1 < MAX_NAME)
+        result = role + ':' + owner.substr(owner.length() - (MAX_NAME - role.length() - 1));
+    return result;
+}
+
+bool set_affinity(const std::vector<unsigned>& cpus)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu : cpus)
+    {
+        if (cpu >= CPU_SETSIZE)
+            return false;
+        CPU_SET(cpu, &set);
+    }
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+bool set_name(const std::string& name)
+{
+#if defined(__linux__)
+    // Linux allows 15 characters plus the terminator
+    return ::pthread_setname_np(::pthread_self(), name.substr(0, 15).c_str()) == 0;
+#elif defined(__APPLE__)
+    return ::pthread_setname_np(name.substr(0, 63).c_str()) == 0;
+#else
+    return false;
+#endif
+}
+
+bool set_nice(int nice)
+{
+#if defined(__linux__)
+    return ::setpriority(PRIO_PROCESS, get_tid(), nice) == 0;
+#else
+    return nice == 0;
+#endif
+}
+
+bool set_numa_node(unsigned node)
+{
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    // MPOL_PREFERRED from numaif.h, which would otherwise require
+    // libnuma's headers
+    constexpr int MPOL_PREFERRED_ = 1;
+    constexpr unsigned BITS = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> mask(node / BITS + 1, 0);
+    mask[node / BITS] |= 1UL << (node % BITS);
+    return ::syscall(SYS_set_mempolicy, MPOL_PREFERRED_, mask.data(), mask.size() * BITS + 1) == 0;
+#else
+    return false;
+#endif
+}
+
+bool set_scheduling(thread_settings::scheduling sched)
+{
+#if defined(__linux__)
+    int policy = SCHED_OTHER;
+    if (sched == thread_settings::scheduling::BATCH)
+        policy = SCHED_BATCH;
+    else if (sched == thread_settings::scheduling::IDLE)
+        policy = SCHED_IDLE;
+    sched_param param;
+    param.sched_priority = 0;
+    return ::pthread_setschedparam(::pthread_self(), policy, &param) == 0;
+#else
+    return sched == thread_settings::scheduling::NORMAL;
+#endif
+}
+
+}
+
+}
@@ -15,11 +15,38 @@
  */
 
 #include <chucho/file_writer.hpp>
+#include <chucho/exception.hpp>
 #include "error_util.hpp"
 
 namespace chucho
 {
 
+void file_writer::close_sync_handle()
+{
+    if (sync_handle_ != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(sync_handle_);
+        sync_handle_ = INVALID_HANDLE_VALUE;
+    }
+}
+
+void file_writer::duplicate_sync_handle()
+{
+    close_sync_handle();
+    if (is_open_ &&
+        !DuplicateHandle(GetCurrentProcess(),
+                         get_file_handle(),
+                         GetCurrentProcess(),
+                         &sync_handle_,
+                         0,
+                         FALSE,
+                         DUPLICATE_SAME_ACCESS))
+    {
+        sync_handle_ = INVALID_HANDLE_VALUE;
+        report_error("Unable to duplicate the handle of " + file_name_ + " for syncing: " + error_util::message(GetLastError()));
+    }
+}
+
 void file_writer::open_impl(const std::string& file_name)
 {
     DWORD dis;
@@ -52,5 +79,10 @@ void file_writer::open_impl(const std::string& file_name)
     }
 }
 
+void file_writer::sync_handle()
+{
+    if (sync_handle_ != INVALID_HANDLE_VALUE && !FlushFileBuffers(sync_handle_))
+        throw exception(error_util::message(GetLastError()));
 }
 
+}
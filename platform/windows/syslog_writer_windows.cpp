@@ -15,33 +15,15 @@
  */
 
 #include <chucho/syslog_writer.hpp>
+#include <chucho/syslog_message_builder.hpp>
 #include <chucho/host.hpp>
-#include <chucho/calendar.hpp>
 #include <chucho/exception.hpp>
 #include <winsock2.h>
 #include <ws2tcpip.h>
 #include "winsock_startup.hpp"
 #include "error_util.hpp"
-#include <sstream>
-
-namespace
-{
-
-std::string format_time(const chucho::event::time_type& when)
-{
-    static const char* english_months[] =
-    {
-        "Jan", "Feb", "Mar", "Apr", "May", "Jun",
-        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
-    };
-
-    struct std::tm cal = chucho::calendar::get_local(std::chrono::system_clock::to_time_t(when));
-    std::string result = english_months[cal.tm_mon];
-    result += chucho::calendar::format(cal, " %d %H:%M:%S");
-    return result;
-}
-
-}
+#include <mutex>
+#include <vector>
 
 namespace chucho
 {
@@ -49,29 +31,44 @@ namespace chucho
 class syslog_transport_handle
 {
 public:
-    syslog_transport_handle(const std::string& host, std::uint16_t port);
+    syslog_transport_handle(syslog::facility fcl,
+                            const std::string& host,
+                            std::uint16_t port,
+                            syslog::transport_protocol proto,
+                            syslog::message_format mfmt,
+                            const std::string& structured_data_id);
     ~syslog_transport_handle();
 
-    std::string format(syslog::facility fcl,
-                       syslog::severity sev,
-                       const event::time_type& when,
-                       const std::string& message);
-    void send(syslog::facility fcl,
-              syslog::severity sev,
+    void send(syslog::severity sev,
+              const event& evt,
               const std::string& message);
 
 private:
+    syslog_message_builder builder_;
     SOCKET socket_;
     std::vector<std::uint8_t> address_;
+    std::mutex guard_;
+    std::string text_;
 };
 
-syslog_transport_handle::syslog_transport_handle(const std::string& host,
-                                                 std::uint16_t port)
-    : socket_(INVALID_SOCKET)
+syslog_transport_handle::syslog_transport_handle(syslog::facility fcl,
+                                                 const std::string& host,
+                                                 std::uint16_t port,
+                                                 syslog::transport_protocol proto,
+                                                 syslog::message_format mfmt,
+                                                 const std::string& structured_data_id)
+    : builder_(fcl, mfmt, structured_data_id),
+      socket_(INVALID_SOCKET)
 {
+    if (proto != syslog::transport_protocol::UDP)
+        throw exception("Only UDP syslog transport is supported on Windows");
     std::call_once(winsock::once, winsock::startup);
+    struct addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
     struct addrinfo* info;
-    int rc = getaddrinfo(host.c_str(), std::to_string(port).c_str(), nullptr, &info);
+    int rc = getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &info);
     if (rc != 0)
         throw exception("Could not resolve address of " + host + ": " + gai_strerror(rc));
     address_.resize(info->ai_addrlen);
@@ -87,25 +84,18 @@ syslog_transport_handle::~syslog_transport_handle()
     closesocket(socket_);
 }
 
-std::string syslog_transport_handle::format(syslog::facility fcl,
-                                            syslog::severity sev,
-                                            const chucho::event::time_type& when,
-                                            const std::string& message)
-{
-    std::ostringstream stream;
-    stream << '<' << (static_cast<int>(fcl) | static_cast<int>(sev)) << '>' <<
-        format_time(when) << ' ' << host::get_base_name() << ' ' << message;
-    return stream.str();
-}
-
-void syslog_transport_handle::send(chucho::syslog::facility fcl,
-                                   chucho::syslog::severity sev,
+void syslog_transport_handle::send(syslog::severity sev,
+                                   const event& evt,
                                    const std::string& message)
 {
-    if (socket_ != INVALID_SOCKET &&
-        sendto(socket_,
-               message.data(),
-               static_cast<int>(message.length()),
+    // There is no sendmmsg here, so batches are sent one datagram
+    // at a time as they arrive.
+    std::lock_guard<std::mutex> lg(guard_);
+    text_.clear();
+    builder_.append(text_, sev, evt, message);
+    if (sendto(socket_,
+               text_.data(),
+               static_cast<int>(text_.length()),
                0,
                reinterpret_cast<struct sockaddr*>(&address_[0]),
                static_cast<int>(address_.size())) == SOCKET_ERROR)
@@ -114,13 +104,25 @@ void syslog_transport_handle::send(chucho::syslog::facility fcl,
     }
 }
 
-syslog_writer::transport::transport()
-    : handle_(new syslog_transport_handle(host::get_base_name(), syslog::DEFAULT_PORT))
+syslog_writer::transport::transport(syslog::facility fcl)
+    : handle_(new syslog_transport_handle(fcl,
+                                          host::get_base_name(),
+                                          syslog::DEFAULT_PORT,
+                                          syslog::transport_protocol::UDP,
+                                          syslog::message_format::RFC3164,
+                                          std::string()))
 {
 }
 
-syslog_writer::transport::transport(const std::string& host, std::uint16_t port)
-    : handle_(new syslog_transport_handle(host, port))
+syslog_writer::transport::transport(syslog::facility fcl,
+                                    const std::string& host,
+                                    std::uint16_t port,
+                                    syslog::transport_protocol proto,
+                                    syslog::message_format mfmt,
+                                    std::size_t batch_size,
+                                    const std::string& structured_data_id,
+                                    std::function<void()>)
+    : handle_(new syslog_transport_handle(fcl, host, port, proto, mfmt, structured_data_id))
 {
 }
 
@@ -129,19 +131,15 @@ syslog_writer::transport::~transport()
     delete handle_;
 }
 
-std::string syslog_writer::transport::format(syslog::facility fcl,
-                                             syslog::severity sev,
-                                             const chucho::event::time_type& when,
-                                             const std::string& message)
+void syslog_writer::transport::flush()
 {
-    return handle_->format(fcl, sev, when, message);
 }
 
-void syslog_writer::transport::send(syslog::facility fcl,
-                                    syslog::severity sev,
+void syslog_writer::transport::send(syslog::severity sev,
+                                    const event& evt,
                                     const std::string& message)
 {
-    handle_->send(fcl, sev, message);
+    handle_->send(sev, evt, message);
 }
 
 }
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/thread_util.hpp>
+#include <windows.h>
+
+namespace chucho
+{
+
+namespace thread_util
+{
+
+bool adjust_nice(int nice)
+{
+    // Windows has no niceness to adjust, so map it to a priority
+    return nice == 0 || set_nice(nice);
+}
+
+bool clear_affinity()
+{
+    DWORD_PTR process_mask;
+    DWORD_PTR system_mask;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask))
+        return false;
+    return SetThreadAffinityMask(GetCurrentThread(), process_mask) != 0;
+}
+
+bool clear_numa_node()
+{
+    return false;
+}
+
+std::vector<unsigned> get_numa_node_cpus(unsigned node)
+{
+    return std::vector<unsigned>();
+}
+
+std::string make_name(const std::string& role, const std::string& owner)
+{
+    return role + ':' + owner;
+}
+
+bool set_affinity(const std::vector<unsigned>& cpus)
+{
+    DWORD_PTR mask = 0;
+    for (auto cpu : cpus)
+    {
+        if (cpu >= sizeof(mask) * 8)
+            return false;
+        mask |= static_cast<DWORD_PTR>(1) << cpu;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+}
+
+bool set_name(const std::string& name)
+{
+    // SetThreadDescription is not available on older versions of
+    // Windows, so the name is only visible in the log
+    return false;
+}
+
+bool set_nice(int nice)
+{
+    int pri;
+    if (nice >= 10)
+        pri = THREAD_PRIORITY_LOWEST;
+    else if (nice > 0)
+        pri = THREAD_PRIORITY_BELOW_NORMAL;
+    else if (nice == 0)
+        pri = THREAD_PRIORITY_NORMAL;
+    else if (nice > -10)
+        pri = THREAD_PRIORITY_ABOVE_NORMAL;
+    else
+        pri = THREAD_PRIORITY_HIGHEST;
+    return SetThreadPriority(GetCurrentThread(), pri) != 0;
+}
+
+bool set_numa_node(unsigned node)
+{
+    return false;
+}
+
+bool set_scheduling(thread_settings::scheduling sched)
+{
+    if (sched == thread_settings::scheduling::IDLE)
+        return SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_IDLE) != 0;
+    return sched == thread_settings::scheduling::NORMAL;
+}
+
+}
+
+}
@@ -17,12 +17,455 @@
 #include <chucho/regex.hpp>
 #include <chucho/regex_exception.hpp>
 #include <limits>
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
 #if defined(CHUCHO_HAVE_STD_REGEX)
 #include <regex>
 #elif defined(CHUCHO_HAVE_POSIX_REGEX)
 #include <regex.h>
 #endif
 
+namespace
+{
+
+// A top-level piece of an extended regular expression with its
+// repetition
+struct atom
+{
+    enum class kind
+    {
+        ALTERNATION,
+        BEGIN,
+        CHARACTER,
+        END,
+        GROUP,
+        SET
+    };
+
+    kind type;
+    char ch;
+    std::bitset<256> set;
+    // False if the set contains something that is not understood
+    // here, like an equivalence class
+    bool exact;
+    unsigned min;
+    unsigned max;
+};
+
+constexpr unsigned UNBOUNDED = std::numeric_limits<unsigned>::max();
+
+bool parse_bracket(const std::string& re, std::size_t& pos, atom& at)
+{
+    static const struct
+    {
+        const char* name;
+        int (*test)(int);
+    } classes[] =
+    {
+        { "alnum", std::isalnum }, { "alpha", std::isalpha }, { "blank", std::isblank },
+        { "cntrl", std::iscntrl }, { "digit", std::isdigit }, { "graph", std::isgraph },
+        { "lower", std::islower }, { "print", std::isprint }, { "punct", std::ispunct },
+        { "space", std::isspace }, { "upper", std::isupper }, { "xdigit", std::isxdigit }
+    };
+
+    at.type = atom::kind::SET;
+    at.exact = true;
+    bool negate = false;
+    if (++pos < re.length() && re[pos] == '^')
+    {
+        negate = true;
+        pos++;
+    }
+    bool first = true;
+    while (pos < re.length() && (first || re[pos] != ']'))
+    {
+        first = false;
+        unsigned char c = re[pos];
+        if (c == '[' && pos + 1 < re.length() && (re[pos + 1] == ':' || re[pos + 1] == '=' || re[pos + 1] == '.'))
+        {
+            char delim = re[pos + 1];
+            auto end = re.find(std::string(1, delim) + ']', pos + 2);
+            if (end == std::string::npos)
+                return false;
+            bool found = false;
+            if (delim == ':')
+            {
+                auto name = re.substr(pos + 2, end - pos - 2);
+                for (const auto& cls : classes)
+                {
+                    if (name == cls.name)
+                    {
+                        for (int i = 0; i < 128; i++)
+                        {
+                            if (cls.test(i))
+                                at.set.set(i);
+                        }
+                        found = true;
+                        break;
+                    }
+                }
+            }
+            if (!found)
+                at.exact = false;
+            pos = end + 2;
+            continue;
+        }
+        // Backslashes and bytes outside of ASCII are treated
+        // differently by the different engines
+        if (c == '\\' || c >= 0x80)
+            at.exact = false;
+        if (pos + 2 < re.length() && re[pos + 1] == '-' && re[pos + 2] != ']')
+        {
+            unsigned char last = re[pos + 2];
+            if (last >= 0x80 || last == '\\' || last == '[')
+                at.exact = false;
+            for (unsigned i = c; i <= last; i++)
+                at.set.set(i);
+            pos += 3;
+        }
+        else
+        {
+            at.set.set(c);
+            pos++;
+        }
+    }
+    if (pos == re.length())
+        return false;
+    pos++;
+    if (negate)
+        at.set.flip();
+    return true;
+}
+
+bool parse_repetition(const std::string& re, std::size_t& pos, atom& at)
+{
+    char c = re[pos];
+    if (c == '*')
+    {
+        at.min = 0;
+        at.max = UNBOUNDED;
+    }
+    else if (c == '+')
+    {
+        at.min = 1;
+        at.max = UNBOUNDED;
+    }
+    else if (c == '?')
+    {
+        at.min = 0;
+        at.max = 1;
+    }
+    else
+    {
+        auto end = re.find('}', pos);
+        if (end == std::string::npos || !std::isdigit(static_cast<unsigned char>(re[pos + 1])))
+            return false;
+        auto spec = re.substr(pos + 1, end - pos - 1);
+        auto comma = spec.find(',');
+        try
+        {
+            at.min = std::stoul(spec.substr(0, comma));
+            if (comma == std::string::npos)
+                at.max = at.min;
+            else if (comma + 1 == spec.length())
+                at.max = UNBOUNDED;
+            else
+                at.max = std::stoul(spec.substr(comma + 1));
+        }
+        catch (std::exception&)
+        {
+            return false;
+        }
+        if (at.max < at.min)
+            return false;
+        pos = end;
+    }
+    pos++;
+    return true;
+}
+
+// Returns false if the expression uses something that is not
+// understood here, in which case it is left entirely to the engine
+bool parse(const std::string& re, std::vector<atom>& atoms)
+{
+    std::size_t pos = 0;
+    while (pos < re.length())
+    {
+        atom at;
+        at.exact = true;
+        at.min = 1;
+        at.max = 1;
+        char c = re[pos];
+        if (c == '|')
+        {
+            at.type = atom::kind::ALTERNATION;
+            pos++;
+        }
+        else if (c == '^')
+        {
+            at.type = atom::kind::BEGIN;
+            pos++;
+        }
+        else if (c == '$')
+        {
+            at.type = atom::kind::END;
+            pos++;
+        }
+        else if (c == '.')
+        {
+            at.type = atom::kind::SET;
+            at.set.set();
+            at.set.reset(0);
+            pos++;
+        }
+        else if (c == '[')
+        {
+            if (!parse_bracket(re, pos, at))
+                return false;
+        }
+        else if (c == '(')
+        {
+            // Groups are opaque here, but they must be skipped
+            at.type = atom::kind::GROUP;
+            unsigned depth = 0;
+            do
+            {
+                if (re[pos] == '(')
+                {
+                    depth++;
+                    pos++;
+                }
+                else if (re[pos] == ')')
+                {
+                    depth--;
+                    pos++;
+                }
+                else if (re[pos] == '\\')
+                {
+                    pos += 2;
+                }
+                else if (re[pos] == '[')
+                {
+                    atom ignored;
+                    if (!parse_bracket(re, pos, ignored))
+                        return false;
+                }
+                else
+                {
+                    pos++;
+                }
+            } while (depth > 0 && pos < re.length());
+            if (depth > 0)
+                return false;
+        }
+        else if (c == '\\')
+        {
+            if (pos + 1 == re.length() || std::isalnum(static_cast<unsigned char>(re[pos + 1])))
+                return false;
+            at.type = atom::kind::CHARACTER;
+            at.ch = re[pos + 1];
+            pos += 2;
+        }
+        else if (c == '*' || c == '+' || c == '?' || c == '{' || c == ')')
+        {
+            return false;
+        }
+        else
+        {
+            at.type = atom::kind::CHARACTER;
+            at.ch = c;
+            pos++;
+        }
+        if (pos < re.length() && (re[pos] == '*' || re[pos] == '+' || re[pos] == '?' || re[pos] == '{'))
+        {
+            if (at.type == atom::kind::ALTERNATION || at.type == atom::kind::BEGIN || at.type == atom::kind::END)
+                return false;
+            if (!parse_repetition(re, pos, at))
+                return false;
+            if (pos < re.length() && (re[pos] == '*' || re[pos] == '+' || re[pos] == '?' || re[pos] == '{'))
+                return false;
+        }
+        atoms.push_back(at);
+    }
+    return true;
+}
+
+// The longest run of characters that every match must contain
+std::string find_required(const std::vector<atom>& atoms)
+{
+    std::string result;
+    std::string cur;
+    for (const auto& at : atoms)
+    {
+        if (at.type == atom::kind::ALTERNATION)
+            return std::string();
+        if (at.type == atom::kind::CHARACTER && at.min > 0)
+            cur += at.ch;
+        if (at.type != atom::kind::CHARACTER || at.min != 1 || at.max != 1)
+        {
+            if (cur.length() > result.length())
+                result = cur;
+            cur.clear();
+        }
+    }
+    return cur.length() > result.length() ? cur : result;
+}
+
+bool contains(const char* text, std::size_t len, const std::string& lit)
+{
+    if (lit.length() > len)
+        return false;
+    const char* end = text + len - lit.length() + 1;
+    const char* cur = text;
+    while (cur < end)
+    {
+        // memchr is vectorized by the C library, so the scan for
+        // the first character is fast
+        cur = static_cast<const char*>(std::memchr(cur, lit[0], end - cur));
+        if (cur == nullptr)
+            return false;
+        if (std::memcmp(cur, lit.data(), lit.length()) == 0)
+            return true;
+        ++cur;
+    }
+    return false;
+}
+
+// A bit-parallel automaton for the expressions that have no groups,
+// alternation or back references. Each bit is a state, which is
+// the number of pieces matched so far, and all states advance
+// together on each character, so there is never any backtracking.
+class automaton
+{
+public:
+    static std::unique_ptr<automaton> compile(const std::vector<atom>& atoms);
+
+    bool search(const char* text, std::size_t len) const;
+
+private:
+    std::uint64_t close(std::uint64_t states) const;
+
+    // The states that advance on a character
+    std::uint64_t advance_[256];
+    // The states that loop on a character
+    std::uint64_t stay_[256];
+    // The states that may advance without a character
+    std::uint64_t epsilon_;
+    std::uint64_t initial_;
+    std::uint64_t accept_;
+    bool anchored_begin_;
+    bool anchored_end_;
+};
+
+std::unique_ptr<automaton> automaton::compile(const std::vector<atom>& atoms)
+{
+    enum class repeat { ONE, OPTIONAL, STAR };
+    std::vector<std::pair<const std::bitset<256>*, repeat>> pieces;
+    std::vector<std::bitset<256>> chars(atoms.size());
+    bool begin = false;
+    bool end = false;
+    for (std::size_t i = 0; i < atoms.size(); i++)
+    {
+        const auto& at = atoms[i];
+        if (at.type == atom::kind::BEGIN && i == 0)
+        {
+            begin = true;
+            continue;
+        }
+        if (at.type == atom::kind::END && i + 1 == atoms.size())
+        {
+            end = true;
+            continue;
+        }
+        const std::bitset<256>* set;
+        if (at.type == atom::kind::CHARACTER)
+        {
+            chars[i].set(static_cast<unsigned char>(at.ch));
+            set = &chars[i];
+        }
+        else if (at.type == atom::kind::SET && at.exact)
+        {
+            set = &at.set;
+        }
+        else
+        {
+            return std::unique_ptr<automaton>();
+        }
+        // The accepting state also needs a bit, and the repeat count
+        // is checked before expanding, since it can be huge
+        std::uint64_t count = at.max == UNBOUNDED ? static_cast<std::uint64_t>(at.min) + 1 : at.max;
+        if (pieces.size() + count > 63)
+            return std::unique_ptr<automaton>();
+        for (unsigned j = 0; j < at.min; j++)
+            pieces.emplace_back(set, repeat::ONE);
+        if (at.max == UNBOUNDED)
+        {
+            pieces.emplace_back(set, repeat::STAR);
+        }
+        else
+        {
+            for (unsigned j = at.min; j < at.max; j++)
+                pieces.emplace_back(set, repeat::OPTIONAL);
+        }
+    }
+    std::unique_ptr<automaton> result(new automaton());
+    std::memset(result->advance_, 0, sizeof(result->advance_));
+    std::memset(result->stay_, 0, sizeof(result->stay_));
+    result->epsilon_ = 0;
+    for (std::size_t i = 0; i < pieces.size(); i++)
+    {
+        std::uint64_t bit = static_cast<std::uint64_t>(1) << i;
+        auto& tbl = pieces[i].second == repeat::STAR ? result->stay_ : result->advance_;
+        for (unsigned c = 0; c < 256; c++)
+        {
+            if (pieces[i].first->test(c))
+                tbl[c] |= bit;
+        }
+        if (pieces[i].second != repeat::ONE)
+            result->epsilon_ |= bit;
+    }
+    result->accept_ = static_cast<std::uint64_t>(1) << pieces.size();
+    result->anchored_begin_ = begin;
+    result->anchored_end_ = end;
+    result->initial_ = result->close(1);
+    return result;
+}
+
+std::uint64_t automaton::close(std::uint64_t states) const
+{
+    while (true)
+    {
+        auto next = states | ((states & epsilon_) << 1);
+        if (next == states)
+            return states;
+        states = next;
+    }
+}
+
+bool automaton::search(const char* text, std::size_t len) const
+{
+    auto states = initial_;
+    if (!anchored_end_ && (states & accept_) != 0)
+        return true;
+    for (std::size_t i = 0; i < len; i++)
+    {
+        unsigned char c = text[i];
+        states = close(((states & advance_[c]) << 1) | (states & stay_[c]));
+        if (!anchored_begin_)
+            states |= initial_;
+        else if (states == 0)
+            return false;
+        if (!anchored_end_ && (states & accept_) != 0)
+            return true;
+    }
+    return (states & accept_) != 0;
+}
+
+}
+
 namespace chucho
 {
 
@@ -36,13 +479,30 @@ struct expression_impl
 #elif defined(CHUCHO_HAVE_POSIX_REGEX)
     regex_t re_;
 #endif
+    // Every match contains this text, so if a piece of text does
+    // not, then the engine need not be consulted. It is empty if
+    // nothing is required.
+    std::string required_;
+    // Set when the expression is nothing but the required text,
+    // possibly anchored
+    bool literal_ = false;
+    bool anchored_begin_ = false;
+    bool anchored_end_ = false;
+    std::unique_ptr<automaton> automaton_;
 };
 
 expression::expression(const std::string& re)
     : pimpl_(new expression_impl)
 {
 #if defined(CHUCHO_HAVE_STD_REGEX)
-    pimpl_->re_ = std::regex(re, std::regex_constants::extended);
+    try
+    {
+        pimpl_->re_ = std::regex(re, std::regex_constants::extended);
+    }
+    catch (std::regex_error& e)
+    {
+        throw chucho::regex_exception(e.what());
+    }
 #elif defined(CHUCHO_HAVE_POSIX_REGEX)
     int rc = regcomp(&pimpl_->re_, re.c_str(), REG_EXTENDED);
     if (rc != 0)
@@ -52,6 +512,29 @@ expression::expression(const std::string& re)
         throw chucho::regex_exception(buf);
     }
 #endif
+    std::vector<atom> atoms;
+    if (parse(re, atoms))
+    {
+        pimpl_->required_ = find_required(atoms);
+        std::size_t first = 0;
+        std::size_t last = atoms.size();
+        if (first < last && atoms[first].type == atom::kind::BEGIN)
+        {
+            pimpl_->anchored_begin_ = true;
+            first++;
+        }
+        if (first < last && atoms[last - 1].type == atom::kind::END)
+        {
+            pimpl_->anchored_end_ = true;
+            last--;
+        }
+        pimpl_->literal_ = !pimpl_->required_.empty() &&
+            std::all_of(atoms.begin() + first,
+                        atoms.begin() + last,
+                        [] (const atom& at) { return at.type == atom::kind::CHARACTER && at.min == 1 && at.max == 1; });
+        if (!pimpl_->literal_)
+            pimpl_->automaton_ = automaton::compile(atoms);
+    }
 }
 
 expression::~expression()
@@ -201,6 +684,30 @@ iterator& iterator::operator++ ()
 
 std::string replace(const std::string& text, expression& re, const std::string& rep)
 {
+    auto& impl = *re.pimpl_;
+    if (!impl.required_.empty() && !contains(text.data(), text.length(), impl.required_))
+        return text;
+#if defined(CHUCHO_HAVE_STD_REGEX)
+    // The replacement may refer to the match with '$'
+    bool plain = rep.find('$') == std::string::npos;
+#elif defined(CHUCHO_HAVE_POSIX_REGEX)
+    bool plain = true;
+#endif
+    if (impl.literal_ && plain && !impl.anchored_begin_ && !impl.anchored_end_)
+    {
+        std::string result;
+        std::size_t cur = 0;
+        for (auto found = text.find(impl.required_);
+             found != std::string::npos;
+             found = text.find(impl.required_, cur))
+        {
+            result.append(text, cur, found - cur);
+            result.append(rep);
+            cur = found + impl.required_.length();
+        }
+        result.append(text, cur, std::string::npos);
+        return result;
+    }
 #if defined(CHUCHO_HAVE_STD_REGEX)
     return std::regex_replace(text, re.pimpl_->re_, rep);
 #elif defined(CHUCHO_HAVE_POSIX_REGEX)
@@ -208,19 +715,48 @@ std::string replace(const std::string& text, expression& re, const std::string&
     const char* end = text.data() + text.length();
     std::string result;
     regmatch_t mch;
-    while (cur < end && regexec(&re.pimpl_->re_, cur, 1, &mch, 0) == 0)
+    while (cur <= end && regexec(&re.pimpl_->re_, cur, 1, &mch, cur == text.c_str() ? 0 : REG_NOTBOL) == 0)
     {
         result.append(cur, mch.rm_so);
         result.append(rep);
-        cur += mch.rm_eo;
+        if (mch.rm_eo == mch.rm_so)
+        {
+            // An empty match would never move forward
+            if (cur + mch.rm_eo < end)
+                result.append(1, cur[mch.rm_eo]);
+            cur += mch.rm_eo + 1;
+        }
+        else
+        {
+            cur += mch.rm_eo;
+        }
     }
-    result.append(cur, end - cur);
+    if (cur < end)
+        result.append(cur, end - cur);
     return result;
 #endif
 }
 
 bool search(const std::string& text, expression& re)
 {
+    auto& impl = *re.pimpl_;
+    if (impl.literal_)
+    {
+        if (impl.anchored_begin_ && impl.anchored_end_)
+            return text == impl.required_;
+        if (impl.anchored_begin_)
+            return text.compare(0, impl.required_.length(), impl.required_) == 0;
+        if (impl.anchored_end_)
+        {
+            return text.length() >= impl.required_.length() &&
+                text.compare(text.length() - impl.required_.length(), std::string::npos, impl.required_) == 0;
+        }
+        return contains(text.data(), text.length(), impl.required_);
+    }
+    if (!impl.required_.empty() && !contains(text.data(), text.length(), impl.required_))
+        return false;
+    if (impl.automaton_)
+        return impl.automaton_->search(text.data(), text.length());
 #if defined(CHUCHO_HAVE_STD_REGEX)
     return std::regex_search(text, re.pimpl_->re_);
 #elif defined(CHUCHO_HAVE_POSIX_REGEX)
@@ -231,6 +767,8 @@ bool search(const std::string& text, expression& re)
 bool search(const std::string& text, expression& re, match& mch)
 {
     mch.subs_.clear();
+    if (!re.pimpl_->required_.empty() && !contains(text.data(), text.length(), re.pimpl_->required_))
+        return false;
 #if defined(CHUCHO_HAVE_STD_REGEX)
     std::smatch res;
     if (std::regex_search(text, res, re.pimpl_->re_))
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/regex_filter.hpp>
+#include <chucho/regex.hpp>
+#include <chucho/logger.hpp>
+
+namespace chucho
+{
+
+regex_filter::regex_filter(const std::string& name,
+                           const std::string& regex,
+                           field fld,
+                           result on_match,
+                           result on_mismatch)
+    : filter(name),
+      regex_(regex),
+      re_(std::make_unique<regex::expression>(regex)),
+      field_(fld),
+      on_match_(on_match),
+      on_mismatch_(on_mismatch)
+{
+    set_status_origin("regex_filter");
+}
+
+regex_filter::~regex_filter()
+{
+}
+
+filter::result regex_filter::evaluate(const event& evt)
+{
+    bool found;
+    if (field_ == field::LOGGER)
+    {
+        auto lgr = evt.get_logger();
+        found = lgr && regex::search(lgr->get_name(), *re_);
+    }
+    else
+    {
+        found = regex::search(evt.get_message(), *re_);
+    }
+    return found ? on_match_ : on_mismatch_;
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/regex_filter_factory.hpp>
+#include <chucho/regex_filter_memento.hpp>
+#include <chucho/regex_filter.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/demangle.hpp>
+#include <assert.h>
+
+namespace chucho
+{
+
+regex_filter_factory::regex_filter_factory()
+{
+    set_status_origin("regex_filter_factory");
+}
+
+std::unique_ptr<configurable> regex_filter_factory::create_configurable(std::unique_ptr<memento>& mnto)
+{
+    auto rfm = dynamic_cast<regex_filter_memento*>(mnto.get());
+    assert(rfm != nullptr);
+    if (rfm->get_name().empty())
+        throw exception("regex_filter_factory: The name must be set");
+    if (rfm->get_regex().empty())
+        throw exception("regex_filter_factory: The regex must be set");
+    auto cnf = std::make_unique<regex_filter>(rfm->get_name(),
+                                              rfm->get_regex(),
+                                              rfm->get_field() ? *rfm->get_field() : regex_filter::field::MESSAGE,
+                                              rfm->get_on_match() ? *rfm->get_on_match() : filter::result::NEUTRAL,
+                                              rfm->get_on_mismatch() ? *rfm->get_on_mismatch() : filter::result::DENY);
+    report_info("Created a " + demangle::get_demangled_name(typeid(*cnf)));
+    return std::move(cnf);
+}
+
+std::unique_ptr<memento> regex_filter_factory::create_memento(configurator& cfg)
+{
+    auto mnto = std::make_unique<regex_filter_memento>(cfg);
+    return std::move(mnto);
+}
+
+}
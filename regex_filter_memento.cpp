@@ -0,0 +1,47 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/regex_filter_memento.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/text_util.hpp>
+
+namespace chucho
+{
+
+regex_filter_memento::regex_filter_memento(configurator& cfg)
+    : filter_memento(cfg)
+{
+    set_status_origin("regex_filter_memento");
+    set_default_name(typeid(regex_filter));
+    cfg.get_security_policy().set_text("regex_filter::field", 7);
+    cfg.get_security_policy().set_text("regex_filter::on_match", 7);
+    cfg.get_security_policy().set_text("regex_filter::on_mismatch", 7);
+    set_handler("field", [this] (const std::string& val)
+    {
+        auto low = text_util::to_lower(validate("regex_filter::field", val));
+        if (low == "logger")
+            field_ = regex_filter::field::LOGGER;
+        else if (low == "message")
+            field_ = regex_filter::field::MESSAGE;
+        else
+            throw exception("regex_filter_memento: The field must be either logger or message");
+    });
+    set_handler("on_match", [this] (const std::string& val) { on_match_ = text_to_result(validate("regex_filter::on_match", val)); });
+    set_handler("on_mismatch", [this] (const std::string& val) { on_mismatch_ = text_to_result(validate("regex_filter::on_mismatch", val)); });
+    set_handler("regex", [this] (const std::string& val) { regex_ = validate("regex_filter::regex", val); });
+}
+
+}
@@ -98,11 +98,12 @@ void rolling_file_writer::init()
 
 void rolling_file_writer::write_impl(const event& evt)
 {
-    if (effective_trigger_->is_triggered(get_file_name(), evt))
+    if (effective_trigger_->is_triggered(*this, evt))
     {
         close();
         roller_->roll();
         open(roller_->get_active_file_name());
+        report_info("Rolled over to " + get_file_name());
     }
     file_writer::write_impl(evt);
 }
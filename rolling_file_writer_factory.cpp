@@ -41,7 +41,7 @@ std::unique_ptr<configurable> rolling_file_writer_factory::create_configurable(s
     auto fmt = std::move(rfwm->get_formatter());
     if (!fmt)
         throw exception("rolling_file_writer_factory: The writer's formatter is not set");
-    std::unique_ptr<configurable> cnf;
+    std::unique_ptr<rolling_file_writer> cnf;
     if (rfwm->get_file_name().empty())
     {
         if (rfwm->get_on_start() && rfwm->get_flush())
@@ -120,7 +120,22 @@ std::unique_ptr<configurable> rolling_file_writer_factory::create_configurable(s
                                                         std::move(rfwm->get_file_roll_trigger()));
         }
     }
+    if (rfwm->get_durability())
+    {
+        cnf->set_durability(*rfwm->get_durability(),
+                            rfwm->get_sync_interval() ? *rfwm->get_sync_interval() : std::chrono::milliseconds(0),
+                            rfwm->get_sync_level());
+    }
+    auto cmp = rfwm->get_stream_compressor();
+    if (cmp)
+        cnf->set_stream_compressor(std::move(cmp));
+    if (rfwm->get_compressed_sync_bytes() || rfwm->get_compressed_sync_interval())
+    {
+        cnf->set_compressed_sync(rfwm->get_compressed_sync_bytes() ? *rfwm->get_compressed_sync_bytes() : file_writer::DEFAULT_COMPRESSED_SYNC_BYTES,
+                                 rfwm->get_compressed_sync_interval() ? *rfwm->get_compressed_sync_interval() : file_writer::DEFAULT_COMPRESSED_SYNC_INTERVAL);
+    }
     set_filters(*cnf, *rfwm);
+    set_thread_settings(*cnf, *rfwm);
     report_info("Created a " + demangle::get_demangled_name(typeid(*cnf)));
     return std::move(cnf);
 }
@@ -0,0 +1,212 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/shm_ring.hpp>
+#include <chucho/exception.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace chucho
+{
+
+constexpr std::uint32_t shm_ring::MAGIC;
+constexpr std::uint32_t shm_ring::VERSION;
+
+shm_ring::shm_ring(const std::string& name,
+                   std::uint32_t slot_count,
+                   std::uint32_t slot_size,
+                   overflow ovr)
+    : name_(normalize_name(name)),
+      base_(nullptr),
+      size_(0),
+      header_(nullptr),
+      slots_(nullptr),
+      mask_(0),
+      geometry_matched_(true)
+{
+    if (slot_count < 2 || (slot_count & (slot_count - 1)) != 0)
+        throw exception("The slot count of a shared memory ring must be a power of two greater than one");
+    if (slot_size < 64 || slot_size % 8 != 0)
+        throw exception("The slot size of a shared memory ring must be a multiple of eight that is at least 64");
+    map(true, slot_count, slot_size, ovr);
+}
+
+shm_ring::shm_ring(const std::string& name)
+    : name_(normalize_name(name)),
+      base_(nullptr),
+      size_(0),
+      header_(nullptr),
+      slots_(nullptr),
+      mask_(0),
+      geometry_matched_(true)
+{
+    map(false, 0, 0, overflow::OVERWRITE);
+}
+
+bool shm_ring::lock(std::uint64_t pos)
+{
+    auto& s = slot_at(pos);
+    std::uint64_t want = 2 * pos + 1;
+    auto cur = s.seq.load(std::memory_order_relaxed);
+    do
+    {
+        // Either a writer that was lapped is still filling it, or a
+        // newer position already owns it
+        if ((cur & 1) != 0 || cur >= want)
+            return false;
+    } while (!s.seq.compare_exchange_weak(cur, want, std::memory_order_relaxed, std::memory_order_relaxed));
+    return true;
+}
+
+std::size_t shm_ring::max_record_size() const
+{
+    return payload_size() * (header_->slot_count / 2);
+}
+
+shm_ring::read_result shm_ring::read(std::uint64_t& cursor, std::vector<std::uint8_t>& rec, std::uint64_t& lost)
+{
+    std::uint64_t count = header_->slot_count;
+    std::size_t pay = payload_size();
+    while (true)
+    {
+        auto& head = slot_at(cursor);
+        std::uint64_t expected = 2 * cursor + 2;
+        auto seq = head.seq.load(std::memory_order_acquire);
+        if (seq < expected)
+            return cursor < get_write_position() ? read_result::PENDING : read_result::EMPTY;
+        if (seq == expected)
+        {
+            std::uint32_t span = head.span;
+            std::uint32_t len = head.length;
+            if (span == 0)
+            {
+                // Either abandoned by a writer or the rest of a record
+                // whose head has already been overwritten
+                set_read_position(++cursor);
+                continue;
+            }
+            if (span <= count / 2 && len <= span * pay && (span == 1 || len > (span - 1) * pay))
+            {
+                rec.resize(len);
+                std::memcpy(rec.data(), data_of(head), std::min(static_cast<std::size_t>(len), pay));
+                std::size_t off = pay;
+                bool intact = true;
+                for (std::uint32_t i = 1; i < span && intact; i++)
+                {
+                    auto& s = slot_at(cursor + i);
+                    std::uint64_t cexp = 2 * (cursor + i) + 2;
+                    if (s.seq.load(std::memory_order_acquire) == cexp)
+                    {
+                        std::size_t n = std::min(pay, len - off);
+                        std::memcpy(rec.data() + off, data_of(s), n);
+                        off += n;
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        intact = s.seq.load(std::memory_order_relaxed) == cexp;
+                    }
+                    else
+                    {
+                        intact = false;
+                    }
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (intact && head.seq.load(std::memory_order_relaxed) == expected)
+                {
+                    cursor += span;
+                    set_read_position(cursor);
+                    return read_result::RECORD;
+                }
+            }
+        }
+        // Overwritten before or while it was read, so move to the
+        // oldest position that may still be intact
+        auto wpos = get_write_position();
+        auto next = std::max(cursor + 1, wpos > count ? wpos - count : 0);
+        lost = next - cursor;
+        cursor = next;
+        set_read_position(cursor);
+        return read_result::LOST;
+    }
+}
+
+std::size_t shm_ring::segment_size(std::uint32_t slot_count, std::uint32_t slot_size)
+{
+    return sizeof(header) + static_cast<std::size_t>(slot_count) * slot_size;
+}
+
+void shm_ring::unlock(std::uint64_t pos, std::uint32_t length, std::uint32_t span)
+{
+    auto& s = slot_at(pos);
+    s.length = length;
+    s.span = span;
+    s.seq.store(2 * pos + 2, std::memory_order_release);
+}
+
+bool shm_ring::write(const std::uint8_t* data, std::size_t len)
+{
+    std::size_t pay = payload_size();
+    std::size_t max = max_record_size();
+    if (len > max)
+    {
+        len = max;
+        header_->truncated.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::uint64_t span = std::max(static_cast<std::size_t>(1), (len + pay - 1) / pay);
+    std::uint64_t count = header_->slot_count;
+    std::uint64_t pos;
+    if (get_overflow() == overflow::DROP)
+    {
+        pos = header_->reserve.load(std::memory_order_relaxed);
+        do
+        {
+            if (pos + span > header_->read_pos.load(std::memory_order_acquire) + count)
+            {
+                header_->dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        } while (!header_->reserve.compare_exchange_weak(pos, pos + span, std::memory_order_relaxed, std::memory_order_relaxed));
+    }
+    else
+    {
+        pos = header_->reserve.fetch_add(span, std::memory_order_relaxed);
+        if (pos + span > header_->read_pos.load(std::memory_order_relaxed) + count)
+            header_->overwritten.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::uint64_t locked = 0;
+    while (locked < span && lock(pos + locked))
+        ++locked;
+    // The odd sequence numbers must be visible before any of the bytes
+    std::atomic_thread_fence(std::memory_order_release);
+    if (locked < span)
+    {
+        for (std::uint64_t i = 0; i < locked; i++)
+            unlock(pos + i, 0, 0);
+        header_->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    std::size_t off = pay;
+    for (std::uint64_t i = 1; i < span; i++)
+    {
+        std::size_t n = std::min(pay, len - off);
+        std::memcpy(data_of(slot_at(pos + i)), data + off, n);
+        off += n;
+        unlock(pos + i, n, 0);
+    }
+    std::memcpy(data_of(slot_at(pos)), data, std::min(pay, len));
+    unlock(pos, len, span);
+    return true;
+}
+
+}
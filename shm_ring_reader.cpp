@@ -0,0 +1,139 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/shm_ring_reader.hpp>
+#include <chucho/shm_ring.hpp>
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace chucho
+{
+
+constexpr std::chrono::milliseconds shm_ring_reader::DEFAULT_STALL_TIMEOUT;
+
+shm_ring_reader::shm_ring_reader(const std::string& ring_name,
+                                 std::chrono::milliseconds stall_timeout)
+    : ring_(std::make_unique<shm_ring>(ring_name)),
+      cursor_(ring_->get_read_position()),
+      lost_(0),
+      stall_timeout_(stall_timeout),
+      stalled_at_(std::numeric_limits<std::uint64_t>::max())
+{
+    // Whatever the writers lapped while nobody was reading is gone
+    auto wpos = ring_->get_write_position();
+    std::uint64_t count = ring_->get_slot_count();
+    if (wpos > count && cursor_ < wpos - count)
+    {
+        lost_ = wpos - count - cursor_;
+        cursor_ = wpos - count;
+        ring_->set_read_position(cursor_);
+    }
+}
+
+shm_ring_reader::~shm_ring_reader()
+{
+}
+
+std::uint64_t shm_ring_reader::get_dropped() const
+{
+    return ring_->get_dropped();
+}
+
+std::uint64_t shm_ring_reader::get_overwritten() const
+{
+    return ring_->get_overwritten();
+}
+
+const std::string& shm_ring_reader::get_ring_name() const
+{
+    return ring_->get_name();
+}
+
+std::uint32_t shm_ring_reader::get_slot_count() const
+{
+    return ring_->get_slot_count();
+}
+
+std::uint32_t shm_ring_reader::get_slot_size() const
+{
+    return ring_->get_slot_size();
+}
+
+std::uint64_t shm_ring_reader::get_truncated() const
+{
+    return ring_->get_truncated();
+}
+
+std::uint64_t shm_ring_reader::get_unread() const
+{
+    return ring_->get_write_position() - cursor_;
+}
+
+bool shm_ring_reader::read(std::vector<std::uint8_t>& rec, std::chrono::milliseconds timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::chrono::microseconds pause(50);
+    while (true)
+    {
+        std::uint64_t lost = 0;
+        auto res = ring_->read(cursor_, rec, lost);
+        if (res == shm_ring::read_result::RECORD)
+            return true;
+        if (res == shm_ring::read_result::LOST)
+        {
+            lost_ += lost;
+            continue;
+        }
+        if (res == shm_ring::read_result::PENDING && stalled())
+            continue;
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+            return false;
+        std::this_thread::sleep_for(std::min(std::chrono::duration_cast<std::chrono::microseconds>(deadline - now), pause));
+        pause = std::min(pause * 2, std::chrono::microseconds(std::chrono::milliseconds(10)));
+    }
+}
+
+void shm_ring_reader::remove(const std::string& ring_name)
+{
+    shm_ring::remove(ring_name);
+}
+
+void shm_ring_reader::seek_to_end()
+{
+    cursor_ = ring_->get_write_position();
+    ring_->set_read_position(cursor_);
+}
+
+bool shm_ring_reader::stalled()
+{
+    auto now = std::chrono::steady_clock::now();
+    if (stalled_at_ != cursor_)
+    {
+        stalled_at_ = cursor_;
+        stalled_since_ = now;
+        return false;
+    }
+    if (now - stalled_since_ < stall_timeout_)
+        return false;
+    // The writer that claimed the slot is presumed dead
+    ring_->set_read_position(++cursor_);
+    ++lost_;
+    return true;
+}
+
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/shm_ring_writer.hpp>
+#include <chucho/shm_ring.hpp>
+
+namespace
+{
+
+chucho::shm_ring::overflow to_ring_overflow(chucho::shm_ring_writer::overflow_policy ovr)
+{
+    return ovr == chucho::shm_ring_writer::overflow_policy::DROP ?
+        chucho::shm_ring::overflow::DROP : chucho::shm_ring::overflow::OVERWRITE;
+}
+
+}
+
+namespace chucho
+{
+
+constexpr std::uint32_t shm_ring_writer::DEFAULT_SLOT_COUNT;
+constexpr std::uint32_t shm_ring_writer::DEFAULT_SLOT_SIZE;
+
+shm_ring_writer::shm_ring_writer(const std::string& name,
+                                 std::unique_ptr<formatter>&& fmt,
+                                 std::unique_ptr<serializer>&& ser,
+                                 const std::string& ring_name,
+                                 std::uint32_t slot_count,
+                                 std::uint32_t slot_size,
+                                 overflow_policy ovr,
+                                 std::unique_ptr<compressor>&& cmp)
+    : message_queue_writer(name, std::move(fmt), std::move(ser), 1, std::move(cmp)),
+      ring_(std::make_unique<shm_ring>(ring_name, slot_count, slot_size, to_ring_overflow(ovr)))
+{
+    set_status_origin("shm_ring_writer");
+    if (!ring_->geometry_matched())
+    {
+        report_warning("The shared memory ring " + ring_->get_name() + " already exists with " +
+            std::to_string(ring_->get_slot_count()) + " slots of " + std::to_string(ring_->get_slot_size()) +
+            " bytes that " + (ring_->get_overflow() == shm_ring::overflow::DROP ? "drop" : "overwrite") +
+            " when full, and that layout will be used");
+    }
+}
+
+shm_ring_writer::~shm_ring_writer()
+{
+    if (number_coalesced_ > 0)
+        flush_coalesced();
+}
+
+void shm_ring_writer::flush_impl(const std::vector<std::uint8_t>& blob)
+{
+    ring_->write(blob.data(), blob.size());
+}
+
+std::uint64_t shm_ring_writer::get_dropped() const
+{
+    return ring_->get_dropped();
+}
+
+shm_ring_writer::overflow_policy shm_ring_writer::get_overflow_policy() const
+{
+    return ring_->get_overflow() == shm_ring::overflow::DROP ? overflow_policy::DROP : overflow_policy::OVERWRITE;
+}
+
+std::uint64_t shm_ring_writer::get_overwritten() const
+{
+    return ring_->get_overwritten();
+}
+
+const std::string& shm_ring_writer::get_ring_name() const
+{
+    return ring_->get_name();
+}
+
+std::uint32_t shm_ring_writer::get_slot_count() const
+{
+    return ring_->get_slot_count();
+}
+
+std::uint32_t shm_ring_writer::get_slot_size() const
+{
+    return ring_->get_slot_size();
+}
+
+std::uint64_t shm_ring_writer::get_truncated() const
+{
+    return ring_->get_truncated();
+}
+
+}
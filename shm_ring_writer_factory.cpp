@@ -0,0 +1,63 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/shm_ring_writer_factory.hpp>
+#include <chucho/shm_ring_writer_memento.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/demangle.hpp>
+
+namespace chucho
+{
+
+shm_ring_writer_factory::shm_ring_writer_factory()
+{
+    set_status_origin("shm_ring_writer_factory");
+}
+
+std::unique_ptr<configurable> shm_ring_writer_factory::create_configurable(std::unique_ptr<memento>& mnto)
+{
+    auto sm = dynamic_cast<shm_ring_writer_memento*>(mnto.get());
+    if (sm->get_name().empty())
+        throw exception("shm_ring_writer_factory: The name is not set");
+    auto fmt = std::move(sm->get_formatter());
+    if (!fmt)
+        throw exception("shm_ring_writer_factory: The writer's formatter is not set");
+    auto ser = std::move(sm->get_serializer());
+    if (!ser)
+        throw exception("shm_ring_writer_factory: The writer's serializer is not set");
+    if (sm->get_ring_name().empty())
+        throw exception("shm_ring_writer_factory: The ring's name must be set");
+    auto sw = std::make_unique<shm_ring_writer>(sm->get_name(),
+                                                std::move(fmt),
+                                                std::move(ser),
+                                                sm->get_ring_name(),
+                                                sm->get_slot_count() ? *sm->get_slot_count() : shm_ring_writer::DEFAULT_SLOT_COUNT,
+                                                sm->get_slot_size() ? *sm->get_slot_size() : shm_ring_writer::DEFAULT_SLOT_SIZE,
+                                                sm->get_overflow() ? *sm->get_overflow() : shm_ring_writer::overflow_policy::OVERWRITE,
+                                                std::move(sm->get_compressor()));
+    sw->set_coalesce_max(sm->get_coalesce_max());
+    set_filters(*sw, *sm);
+    report_info("Created a " + demangle::get_demangled_name(typeid(*sw)));
+    return std::move(sw);
+}
+
+std::unique_ptr<memento> shm_ring_writer_factory::create_memento(configurator& cfg)
+{
+    auto mnto = std::make_unique<shm_ring_writer_memento>(cfg);
+    return std::move(mnto);
+}
+
+}
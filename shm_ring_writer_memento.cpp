@@ -0,0 +1,53 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/shm_ring_writer_memento.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/text_util.hpp>
+
+namespace chucho
+{
+
+shm_ring_writer_memento::shm_ring_writer_memento(configurator& cfg)
+    // Each event is its own record unless coalescing is asked for
+    : message_queue_writer_memento(cfg, 1)
+{
+    set_status_origin("shm_ring_writer_memento");
+    set_default_name(typeid(shm_ring_writer));
+    cfg.get_security_policy().set_text("shm_ring_writer::ring_name", 255);
+    cfg.get_security_policy().set_integer("shm_ring_writer::slot_count", 2U, 1U << 24);
+    cfg.get_security_policy().set_text("shm_ring_writer::slot_count(text)", 8);
+    cfg.get_security_policy().set_integer("shm_ring_writer::slot_size", 64U, 1U << 20);
+    cfg.get_security_policy().set_text("shm_ring_writer::slot_size(text)", 7);
+    cfg.get_security_policy().set_text("shm_ring_writer::overflow", 9);
+    set_handler("ring_name", [this] (const std::string& val) { ring_name_ = validate("shm_ring_writer::ring_name", val); });
+    set_handler("slot_count", [this] (const std::string& val) { slot_count_ = static_cast<std::uint32_t>(validate("shm_ring_writer::slot_count", std::stoul(validate("shm_ring_writer::slot_count(text)", val)))); });
+    set_handler("slot_size", [this] (const std::string& val) { slot_size_ = static_cast<std::uint32_t>(validate("shm_ring_writer::slot_size", std::stoul(validate("shm_ring_writer::slot_size(text)", val)))); });
+    set_handler("overflow", std::bind(&shm_ring_writer_memento::set_overflow, this, std::placeholders::_1));
+}
+
+void shm_ring_writer_memento::set_overflow(const std::string& ovr)
+{
+    auto low = text_util::to_lower(validate("shm_ring_writer::overflow", ovr));
+    if (low == "overwrite")
+        overflow_ = shm_ring_writer::overflow_policy::OVERWRITE;
+    else if (low == "drop")
+        overflow_ = shm_ring_writer::overflow_policy::DROP;
+    else
+        throw exception("shm_ring_writer_memento: The overflow policy must be overwrite or drop");
+}
+
+}
@@ -16,12 +16,21 @@
 
 #include <chucho/size_file_roll_trigger.hpp>
 #include <chucho/file.hpp>
+#include <algorithm>
 
 namespace chucho
 {
 
+constexpr std::uintmax_t size_file_roll_trigger::UNLIMITED;
+
 size_file_roll_trigger::size_file_roll_trigger(std::uintmax_t max_size)
-    : max_size_(max_size)
+    : size_file_roll_trigger(max_size, UNLIMITED)
+{
+}
+
+size_file_roll_trigger::size_file_roll_trigger(std::uintmax_t max_size, std::uintmax_t max_uncompressed_size)
+    : max_size_(max_size),
+      max_uncompressed_size_(max_uncompressed_size)
 {
     set_status_origin("size_file_roll_trigger");
 }
@@ -38,4 +47,18 @@ bool size_file_roll_trigger::is_triggered(const std::string& active_file, const
     return false;
 }
 
+bool size_file_roll_trigger::is_triggered(const file_writer& writer, const event& e)
+{
+    if (writer.get_stream_compressor() != nullptr)
+        return writer.get_uncompressed_size() >= max_uncompressed_size_ || is_triggered(writer.get_file_name(), e);
+    try
+    {
+        return file::size(writer.get_file_name()) >= std::min(max_size_, max_uncompressed_size_);
+    }
+    catch (...)
+    {
+    }
+    return false;
+}
+
 }
@@ -33,9 +33,10 @@ std::unique_ptr<configurable> size_file_roll_trigger_factory::create_configurabl
 {
     auto sfrtm = dynamic_cast<size_file_roll_trigger_memento*>(mnto.get());
     assert(sfrtm != nullptr);
-    if (!sfrtm->get_max_size())
-        throw exception("size_file_roll_trigger_factory: The max_size field must be set to create a size_file_roll_trigger");
-    auto cnf = std::make_unique<size_file_roll_trigger>(*sfrtm->get_max_size());
+    if (!sfrtm->get_max_size() && !sfrtm->get_max_uncompressed_size())
+        throw exception("size_file_roll_trigger_factory: The max_size or max_uncompressed_size field must be set to create a size_file_roll_trigger");
+    auto cnf = std::make_unique<size_file_roll_trigger>(sfrtm->get_max_size() ? *sfrtm->get_max_size() : size_file_roll_trigger::UNLIMITED,
+                                                        sfrtm->get_max_uncompressed_size() ? *sfrtm->get_max_uncompressed_size() : size_file_roll_trigger::UNLIMITED);
     report_info("Created a " + demangle::get_demangled_name(typeid(*cnf)));
     return std::move(cnf);
 }
@@ -26,8 +26,12 @@ size_file_roll_trigger_memento::size_file_roll_trigger_memento(configurator& cfg
     set_status_origin("size_file_roll_trigger_memento");
     cfg.get_security_policy().set_integer("size_file_roll_trigger::max_size", static_cast<std::uintmax_t>(1), static_cast<std::uintmax_t>(1024 * 1024 * 1024));
     cfg.get_security_policy().set_text("size_file_roll_trigger::max_size(text)", 50);
+    cfg.get_security_policy().set_integer("size_file_roll_trigger::max_uncompressed_size", static_cast<std::uintmax_t>(1), static_cast<std::uintmax_t>(1024) * 1024 * 1024 * 1024);
+    cfg.get_security_policy().set_text("size_file_roll_trigger::max_uncompressed_size(text)", 50);
     set_handler("max_size", [this] (const std::string& s) { max_size_ = validate("size_file_roll_trigger::max_size",
          text_util::parse_byte_size(validate("size_file_roll_trigger::max_size(text)", s))); });
+    set_handler("max_uncompressed_size", [this] (const std::string& s) { max_uncompressed_size_ = validate("size_file_roll_trigger::max_uncompressed_size",
+         text_util::parse_byte_size(validate("size_file_roll_trigger::max_uncompressed_size(text)", s))); });
 }
 
 }
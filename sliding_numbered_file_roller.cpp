@@ -63,6 +63,7 @@ std::string sliding_numbered_file_roller::get_file_name(int idx, bool with_compr
 
 void sliding_numbered_file_roller::roll()
 {
+    wait_for_compression();
     std::string fn;
     try
     {
@@ -84,7 +85,7 @@ void sliding_numbered_file_roller::roll()
         {
             std::string nm = get_file_name(cmp, false);
             if (file::exists(nm))
-                compressor_->compress(nm);
+                compress(nm);
         }
     }
 }
@@ -16,7 +16,7 @@
 
 CREATE TABLE chucho_event
 (
-    event_id INTEGER NOT NULL GENERATED ALWAYS AS IDENTITY (START WITH 1, INCREMENT BY 1, NO CACHE),
+    event_id INTEGER NOT NULL GENERATED ALWAYS AS IDENTITY (START WITH 1, INCREMENT BY 1, CACHE 1000),
     formatted_message VARCHAR(4000) NOT NULL,
     timestmp TIMESTAMP NOT NULL,
     file_name VARCHAR(1024) NOT NULL,
@@ -28,4 +28,7 @@ CREATE TABLE chucho_event
     thread VARCHAR(256) NOT NULL,
     host_name VARCHAR(256) NOT NULL,
     process_id INTEGER NOT NULL
-);
+) APPEND ON;
+
+-- For time range queries and pruning of old events
+CREATE INDEX chucho_event_timestmp_idx ON chucho_event ( timestmp );
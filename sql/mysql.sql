@@ -32,6 +32,8 @@ CREATE TABLE chucho_event
    marker VARCHAR(1024),
    thread VARCHAR(256) NOT NULL,
    host_name VARCHAR(256) NOT NULL,
-   process_id INT UNSIGNED NOT NULL
-);
+   process_id INT UNSIGNED NOT NULL,
+   -- For time range queries and pruning of old events
+   INDEX chucho_event_timestmp_idx ( timestmp )
+) ENGINE=InnoDB;
 COMMIT;
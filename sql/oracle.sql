@@ -30,7 +30,12 @@ CREATE TABLE chucho_event
     process_id INTEGER NOT NULL
 );
 
-CREATE SEQUENCE chucho_event_id_seq MINVALUE 1 START WITH 1;
+-- For time range queries and pruning of old events
+CREATE INDEX chucho_event_timestmp_idx ON chucho_event ( timestmp );
+
+-- Caching sequence values saves a trip to the sequence for every row
+-- of a batched insert
+CREATE SEQUENCE chucho_event_id_seq MINVALUE 1 START WITH 1 CACHE 1000;
 
 CREATE TRIGGER chucho_event_id_seq_trigger
     BEFORE INSERT ON chucho_event
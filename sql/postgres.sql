@@ -17,7 +17,9 @@
 DROP TABLE IF EXISTS chucho_event;
 DROP SEQUENCE IF EXISTS chucho_id_seq;
 
-CREATE SEQUENCE chucho_id_seq MINVALUE 1 START 1;
+-- Caching sequence values saves a trip to the sequence for every row
+-- of a batched insert
+CREATE SEQUENCE chucho_id_seq MINVALUE 1 START 1 CACHE 1000;
 
 CREATE TABLE chucho_event
 (
@@ -34,3 +36,9 @@ CREATE TABLE chucho_event
     host_name TEXT NOT NULL,
     process_id INTEGER NOT NULL
 );
+
+-- Events are appended in time order, so a BRIN index serves time range
+-- queries and pruning of old events at almost no cost to inserts. For
+-- very high volumes consider declaring the table PARTITION BY RANGE
+-- ( timestmp ) and dropping old partitions instead of deleting rows.
+CREATE INDEX chucho_event_timestmp_idx ON chucho_event USING BRIN ( timestmp );
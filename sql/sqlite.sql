@@ -21,7 +21,8 @@ COMMIT;
 BEGIN;
 CREATE TABLE chucho_event
 (
-   event_id INTEGER PRIMARY KEY AUTOINCREMENT,
+   -- Without AUTOINCREMENT SQLite does not have to update sqlite_sequence on every insert
+   event_id INTEGER PRIMARY KEY,
    formatted_message TEXT NOT NULL,
    timestmp INTEGER NOT NULL,
    file_name TEXT NOT NULL,
@@ -34,4 +35,6 @@ CREATE TABLE chucho_event
    host_name TEXT NOT NULL,
    process_id INTEGER NOT NULL
 );
+-- For time range queries and pruning of old events
+CREATE INDEX chucho_event_timestmp_idx ON chucho_event ( timestmp );
 COMMIT;
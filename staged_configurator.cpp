@@ -0,0 +1,391 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <chucho/staged_configurator.hpp>
+#include <chucho/logger.hpp>
+#include <chucho/logger_factory.hpp>
+#include <chucho/logger_memento.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/demangle.hpp>
+#include <chucho/garbage_cleaner.hpp>
+#include <chucho/move_util.hpp>
+#include <assert.h>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+
+struct published_writer
+{
+    std::string name;
+    chucho::writer* wrt;
+    std::string fingerprint;
+};
+
+struct static_data
+{
+    static_data();
+
+    // The writers that the last configuration gave to each logger
+    std::map<std::string, std::vector<published_writer>> published_;
+};
+
+static_data::static_data()
+{
+    chucho::garbage_cleaner::get().add([this] () { delete this; });
+}
+
+static_data& data()
+{
+    static std::once_flag once;
+    // This gets cleaned up in finalize()
+    static static_data* sd;
+
+    std::call_once(once, [&] () { sd = new static_data(); });
+    return *sd;
+}
+
+bool is_current(chucho::logger& lgr, const published_writer& pub)
+{
+    try
+    {
+        return &lgr.get_writer(pub.name) == pub.wrt;
+    }
+    catch (std::invalid_argument&)
+    {
+        return false;
+    }
+}
+
+}
+
+namespace chucho
+{
+
+struct staged_configurator::prepared
+{
+    prepared() : kept(0), created(0) { }
+
+    logger::replacement rep;
+    std::vector<published_writer> published;
+    std::size_t kept;
+    std::size_t created;
+};
+
+staged_configurator::staged_configurator(configurator& cfg)
+    : cfg_(cfg)
+{
+    set_status_origin("staged_configurator");
+    for (auto& fact : configurator::get_factories())
+        factories_[fact.first] = std::make_unique<recording_factory>(*this, *fact.second, fact.first);
+    cfg_.staged_factories_ = &factories_;
+}
+
+staged_configurator::~staged_configurator()
+{
+    cfg_.staged_factories_ = nullptr;
+}
+
+std::unique_ptr<configurable> staged_configurator::create(recorded& rec)
+{
+    auto mnto = rec.factory_.create_memento(cfg_);
+    for (auto& i : rec.items_)
+    {
+        try
+        {
+            if (i.child)
+            {
+                auto cnf = create(*i.child);
+                if (cnf)
+                    mnto->handle(std::move(cnf));
+            }
+            else
+            {
+                mnto->handle(i.key, i.value);
+            }
+        }
+        catch (std::exception& e)
+        {
+            report_error("An error occurred processing " + rec.type_ + ": " + exception::nested_whats(e));
+        }
+    }
+    return rec.factory_.create_configurable(mnto);
+}
+
+void staged_configurator::publish(bool replace)
+{
+    struct staged_logger
+    {
+        std::shared_ptr<level> lvl;
+        optional<bool> wta;
+        std::vector<recorded*> writers;
+    };
+
+    cfg_.staged_factories_ = nullptr;
+    // A logger may appear more than once, in which case its parts
+    // are combined as they would have been if configured directly
+    std::vector<std::string> names;
+    std::map<std::string, staged_logger> staged;
+    for (auto& rec : loggers_)
+    {
+        try
+        {
+            auto mnto = rec->factory_.create_memento(cfg_);
+            auto lm = dynamic_cast<logger_memento*>(mnto.get());
+            assert(lm != nullptr);
+            std::vector<recorded*> wrts;
+            for (auto& i : rec->items_)
+            {
+                try
+                {
+                    if (i.child && i.child->factory_.creates_writer())
+                    {
+                        wrts.push_back(i.child.get());
+                    }
+                    else if (i.child)
+                    {
+                        auto cnf = create(*i.child);
+                        if (cnf)
+                            mnto->handle(std::move(cnf));
+                    }
+                    else
+                    {
+                        mnto->handle(i.key, i.value);
+                    }
+                }
+                catch (std::exception& e)
+                {
+                    report_error("An error occurred processing chucho::logger: " + exception::nested_whats(e));
+                }
+            }
+            if (!lm->get_name())
+                throw exception("logger_memento: The logger's name must be set");
+            auto nm = *lm->get_name();
+            if (nm == "<root>")
+                nm.clear();
+            auto found = staged.find(nm);
+            if (found == staged.end())
+            {
+                names.push_back(nm);
+                found = staged.emplace(nm, staged_logger()).first;
+            }
+            if (lm->get_level())
+                found->second.lvl = lm->get_level();
+            if (lm->get_writes_to_ancestors())
+                found->second.wta = lm->get_writes_to_ancestors();
+            found->second.writers.insert(found->second.writers.end(), wrts.begin(), wrts.end());
+        }
+        catch (std::exception& e)
+        {
+            report_error("An error occurred processing chucho::logger: " + exception::nested_whats(e));
+        }
+    }
+    // Every logger's replacement is built before any of them is
+    // swapped in, so that a reload is seen all at once
+    std::vector<prepared> preps;
+    for (const auto& nm : names)
+    {
+        auto lgr = logger::get_impl(nm);
+        auto& stg = staged[nm];
+        auto lvl = stg.lvl;
+        if (!lvl && !replace)
+            lvl = lgr->get_level();
+        bool wta = stg.wta ? *stg.wta : (replace || lgr->writes_to_ancestors());
+        preps.emplace_back();
+        prepare(lgr, lvl, wta, stg.writers, replace, preps.back());
+    }
+    if (replace)
+    {
+        for (auto lgr : logger::get_existing_loggers())
+        {
+            if (staged.find(lgr->get_name()) == staged.end())
+            {
+                preps.emplace_back();
+                preps.back().rep.lgr = lgr;
+                preps.back().rep.wta = true;
+            }
+        }
+    }
+    std::vector<logger::replacement> reps;
+    for (auto& prep : preps)
+        reps.push_back(std::move(prep.rep));
+    // The writers that are no longer used are destroyed when this
+    // goes out of scope, after the loggers have let go of their locks
+    auto unused = logger::replace(reps);
+    auto& published = data().published_;
+    for (std::size_t i = 0; i < preps.size(); i++)
+    {
+        auto& lgr = *reps[i].lgr;
+        if (staged.find(lgr.get_name()) == staged.end())
+        {
+            published.erase(lgr.get_name());
+            continue;
+        }
+        published[lgr.get_name()] = std::move(preps[i].published);
+        if (!lgr.get_name().empty())
+        {
+            report_info("Configured the " + demangle::get_demangled_name(typeid(lgr)) + " named " + lgr.get_name() +
+                ", keeping " + std::to_string(preps[i].kept) + " writers and creating " + std::to_string(preps[i].created));
+        }
+    }
+}
+
+void staged_configurator::prepare(std::shared_ptr<logger> lgr,
+                                  std::shared_ptr<level> lvl,
+                                  bool wta,
+                                  const std::vector<recorded*>& wrts,
+                                  bool replace,
+                                  prepared& prep)
+{
+    auto found = data().published_.find(lgr->get_name());
+    const std::vector<published_writer> none;
+    const auto& published = found == data().published_.end() ? none : found->second;
+    auto& next = prep.rep.writers;
+    auto& next_published = prep.published;
+    prep.rep.lgr = lgr;
+    prep.rep.lvl = lvl;
+    prep.rep.wta = wta;
+    if (!replace)
+    {
+        for (const auto& nm : lgr->get_writer_names())
+            next.emplace_back(&lgr->get_writer(nm), std::unique_ptr<writer>());
+        for (const auto& pub : published)
+        {
+            if (is_current(*lgr, pub))
+                next_published.push_back(pub);
+        }
+    }
+    std::set<writer*> kept;
+    for (auto rec : wrts)
+    {
+        auto fp = rec->get_fingerprint();
+        writer* keep = nullptr;
+        if (replace)
+        {
+            for (const auto& pub : published)
+            {
+                if (pub.fingerprint == fp && kept.count(pub.wrt) == 0 && is_current(*lgr, pub))
+                {
+                    keep = pub.wrt;
+                    break;
+                }
+            }
+        }
+        if (keep == nullptr)
+        {
+            try
+            {
+                auto wrt = dynamic_move<writer>(create(*rec));
+                if (wrt)
+                {
+                    next_published.push_back(published_writer{wrt->get_name(), wrt.get(), fp});
+                    next.emplace_back(nullptr, std::move(wrt));
+                    prep.created++;
+                }
+            }
+            catch (std::exception& e)
+            {
+                report_error("An error occurred processing " + rec->type_ + ": " + exception::nested_whats(e));
+            }
+        }
+        else
+        {
+            kept.insert(keep);
+            next_published.push_back(published_writer{keep->get_name(), keep, fp});
+            next.emplace_back(keep, std::unique_ptr<writer>());
+        }
+    }
+    prep.kept = kept.size();
+}
+
+staged_configurator::recorded::recorded(configurable_factory& fact, const std::string& type)
+    : factory_(fact),
+      type_(type)
+{
+}
+
+std::string staged_configurator::recorded::get_fingerprint() const
+{
+    // Lengths are included, so that no two configurations can
+    // result in the same text
+    std::ostringstream stream;
+    stream << type_ << '{';
+    for (const auto& i : items_)
+    {
+        if (i.child)
+            stream << i.child->get_fingerprint();
+        else
+            stream << i.key.length() << ':' << i.key << i.value.length() << ':' << i.value;
+    }
+    stream << '}';
+    return stream.str();
+}
+
+staged_configurator::recording_memento::recording_memento(configurator& cfg)
+    : memento(cfg)
+{
+    set_status_origin("staged_configurator");
+}
+
+void staged_configurator::recording_memento::default_handler(const std::string& key, const std::string& value)
+{
+    items_.push_back(recorded::item{key, value, std::unique_ptr<recorded>()});
+}
+
+void staged_configurator::recording_memento::handle(std::unique_ptr<configurable>&& cnf)
+{
+    auto rec = dynamic_move<recorded>(std::move(cnf));
+    if (rec)
+        items_.push_back(recorded::item{std::string(), std::string(), std::move(rec)});
+    else
+        memento::handle(std::move(cnf));
+}
+
+staged_configurator::recording_factory::recording_factory(staged_configurator& stg,
+                                                          configurable_factory& fact,
+                                                          const std::string& type)
+    : staged_(stg),
+      factory_(fact),
+      type_(type)
+{
+    set_status_origin("staged_configurator");
+}
+
+std::unique_ptr<configurable> staged_configurator::recording_factory::create_configurable(std::unique_ptr<memento>& mnto)
+{
+    auto rm = dynamic_cast<recording_memento*>(mnto.get());
+    assert(rm != nullptr);
+    auto rec = std::make_unique<recorded>(factory_, type_);
+    rec->items_ = std::move(rm->items_);
+    // Loggers are not handed to anything, so they are kept here
+    // until they are published
+    if (dynamic_cast<logger_factory*>(&factory_) != nullptr)
+    {
+        staged_.loggers_.push_back(std::move(rec));
+        return std::unique_ptr<configurable>();
+    }
+    return std::move(rec);
+}
+
+std::unique_ptr<memento> staged_configurator::recording_factory::create_memento(configurator& cfg)
+{
+    auto mnto = std::make_unique<recording_memento>(cfg);
+    return std::move(mnto);
+}
+
+}
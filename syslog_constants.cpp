@@ -23,6 +23,7 @@ namespace syslog
 {
 
 const std::uint16_t DEFAULT_PORT(514);
+const std::uint16_t DEFAULT_TCP_PORT(601);
 
 }
 
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/syslog_message_builder.hpp>
+#include <chucho/calendar.hpp>
+#include <chucho/host.hpp>
+#include <chucho/logger.hpp>
+#include <chucho/process.hpp>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+
+// RFC 5424 requires that '"', '\' and ']' be escaped in parameter values
+void append_param(std::string& text, const char* name, const std::string& value)
+{
+    text += ' ';
+    text += name;
+    text += "=\"";
+    for (char c : value)
+    {
+        if (c == '"' || c == '\\' || c == ']')
+            text += '\\';
+        text += c;
+    }
+    text += '"';
+}
+
+}
+
+namespace chucho
+{
+
+syslog_message_builder::syslog_message_builder(syslog::facility fcl,
+                                               syslog::message_format mfmt,
+                                               const std::string& structured_data_id)
+    : format_(mfmt),
+      structured_data_id_(structured_data_id),
+      cached_second_(-1)
+{
+    for (std::size_t i = 0; i < priorities_.size(); i++)
+    {
+        priorities_[i] = '<' + std::to_string(static_cast<int>(fcl) | static_cast<int>(i)) + '>';
+        if (format_ == syslog::message_format::RFC5424)
+            priorities_[i] += "1 ";
+    }
+    host_part_ = ' ' + host::get_base_name() + ' ';
+    // APP-NAME is not known, and MSGID is not used
+    if (format_ == syslog::message_format::RFC5424)
+        host_part_ += "- " + std::to_string(process::id()) + " - ";
+}
+
+void syslog_message_builder::append(std::string& text,
+                                    syslog::severity sev,
+                                    const event& evt,
+                                    const std::string& message)
+{
+    text += priorities_[static_cast<std::size_t>(sev) & 7];
+    append_time(text, evt.get_time());
+    text += host_part_;
+    if (format_ == syslog::message_format::RFC5424)
+    {
+        append_structured_data(text, evt);
+        text += ' ';
+    }
+    text += message;
+}
+
+void syslog_message_builder::append_structured_data(std::string& text, const event& evt)
+{
+    if (structured_data_id_.empty())
+    {
+        text += '-';
+        return;
+    }
+    text += '[';
+    text += structured_data_id_;
+    append_param(text, "logger", evt.get_logger() ? evt.get_logger()->get_name() : std::string());
+    append_param(text, "file", evt.get_file_name() == nullptr ? std::string() : std::string(evt.get_file_name()));
+    append_param(text, "line", std::to_string(evt.get_line_number()));
+    append_param(text, "function", evt.get_function_name() == nullptr ? std::string() : std::string(evt.get_function_name()));
+    if (evt.get_thread_id())
+    {
+        append_param(text, "thread", *evt.get_thread_id());
+    }
+    else
+    {
+        std::ostringstream stream;
+        stream << std::this_thread::get_id();
+        append_param(text, "thread", stream.str());
+    }
+    if (evt.get_marker())
+    {
+        std::ostringstream stream;
+        stream << *evt.get_marker();
+        append_param(text, "marker", stream.str());
+    }
+    text += ']';
+}
+
+void syslog_message_builder::append_time(std::string& text, const event::time_type& when)
+{
+    static const char* english_months[] =
+    {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+    };
+
+    std::time_t secs = event::clock_type::to_time_t(when);
+    if (secs != cached_second_)
+    {
+        if (format_ == syslog::message_format::RFC5424)
+        {
+            cached_time_ = calendar::format(calendar::get_utc(secs), "%Y-%m-%dT%H:%M:%S");
+        }
+        else
+        {
+            calendar::pieces cal = calendar::get_local(secs);
+            cached_time_ = english_months[cal.tm_mon];
+#if defined(_WIN32)
+            cached_time_ += calendar::format(cal, " %d %H:%M:%S");
+#else
+            cached_time_ += calendar::format(cal, " %e %H:%M:%S");
+#endif
+        }
+        cached_second_ = secs;
+    }
+    text += cached_time_;
+    if (format_ == syslog::message_format::RFC5424)
+    {
+        auto micros = std::chrono::duration_cast<std::chrono::microseconds>(when.time_since_epoch()).count() % 1000000;
+        if (micros < 0)
+            micros += 1000000;
+        char frac[8];
+        frac[0] = '.';
+        for (int i = 6; i > 0; i--)
+        {
+            frac[i] = static_cast<char>('0' + micros % 10);
+            micros /= 10;
+        }
+        frac[7] = 'Z';
+        text.append(frac, sizeof(frac));
+    }
+}
+
+}
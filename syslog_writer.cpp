@@ -15,7 +15,7 @@
  */
 
 #include <chucho/syslog_writer.hpp>
-#include <chucho/calendar.hpp>
+#include <chucho/exception.hpp>
 
 namespace chucho
 {
@@ -24,7 +24,11 @@ syslog_writer::syslog_writer(const std::string& name,
                              std::unique_ptr<formatter>&& fmt,
                              syslog::facility fcl)
     : writer(name, std::move(fmt)),
-      facility_(fcl)
+      transport_(fcl),
+      facility_(fcl),
+      protocol_(syslog::transport_protocol::UDP),
+      message_format_(syslog::message_format::RFC3164),
+      batch_size_(1)
 {
     set_status_origin("syslog_writer");
 }
@@ -34,23 +38,64 @@ syslog_writer::syslog_writer(const std::string& name,
                              syslog::facility fcl,
                              const std::string& host,
                              std::uint16_t port)
+    : syslog_writer(name,
+                    std::move(fmt),
+                    fcl,
+                    host,
+                    port,
+                    syslog::transport_protocol::UDP)
+{
+}
+
+syslog_writer::syslog_writer(const std::string& name,
+                             std::unique_ptr<formatter>&& fmt,
+                             syslog::facility fcl,
+                             const std::string& host,
+                             std::uint16_t port,
+                             syslog::transport_protocol proto,
+                             syslog::message_format mfmt,
+                             std::size_t batch_size,
+                             const std::string& structured_data_id)
     : writer(name, std::move(fmt)),
-      transport_(host, port),
+      transport_(fcl,
+                 host,
+                 port,
+                 proto,
+                 mfmt,
+                 batch_size,
+                 structured_data_id,
+                 [this, state = thread_state()] () mutable { configure_thread("syslog", state); }),
       facility_(fcl),
       host_name_(host),
-      port_(port)
+      port_(port),
+      protocol_(proto),
+      message_format_(mfmt),
+      batch_size_(batch_size),
+      structured_data_id_(structured_data_id)
 {
     set_status_origin("syslog_writer");
 }
 
+syslog_writer::~syslog_writer()
+{
+    try
+    {
+        flush();
+    }
+    catch (std::exception& e)
+    {
+        report_error("Unable to send held syslog messages: " + exception::nested_whats(e));
+    }
+}
+
+void syslog_writer::flush()
+{
+    transport_.flush();
+}
+
 void syslog_writer::write_impl(const event& evt)
 {
-    syslog::severity sev = evt.get_level()->get_syslog_severity();
-    std::string msg = transport_.format(facility_,
-                                        sev,
-                                        evt.get_time(),
-                                        formatter_->format(evt));
-    transport_.send(facility_, sev, msg);
+    transport_.send(evt.get_level()->get_syslog_severity(), evt, formatter_->format(evt));
 }
 
 }
@@ -41,12 +41,36 @@ std::unique_ptr<configurable> syslog_writer_factory::create_configurable(std::un
         throw exception("syslog_writer_factory: The writer's formatter is not set");
     if (!swm->get_facility())
         throw exception("syslog_writer_factory: The writer's facility is not set");
+    bool is_extended = swm->get_protocol() ||
+                       swm->get_message_format() ||
+                       swm->get_batch_size() ||
+                       !swm->get_structured_data_id().empty();
     if (swm->get_host_name().empty())
     {
+        if (is_extended)
+            throw exception("syslog_writer_factory: The protocol, format, batch_size and structured_data_id can only be set when the host_name is set");
         cnf = std::make_unique<syslog_writer>(swm->get_name(),
                                               std::move(fmt),
                                               *swm->get_facility());
     }
+    else if (is_extended)
+    {
+        auto proto = swm->get_protocol() ? *swm->get_protocol() : syslog::transport_protocol::UDP;
+        std::uint16_t port;
+        if (swm->get_port())
+            port = *swm->get_port();
+        else
+            port = proto == syslog::transport_protocol::TCP ? syslog::DEFAULT_TCP_PORT : syslog::DEFAULT_PORT;
+        cnf = std::make_unique<syslog_writer>(swm->get_name(),
+                                              std::move(fmt),
+                                              *swm->get_facility(),
+                                              swm->get_host_name(),
+                                              port,
+                                              proto,
+                                              swm->get_message_format() ? *swm->get_message_format() : syslog::message_format::RFC3164,
+                                              swm->get_batch_size() ? *swm->get_batch_size() : 1,
+                                              swm->get_structured_data_id());
+    }
     else
     {
         if (swm->get_port())
@@ -31,10 +31,19 @@ syslog_writer_memento::syslog_writer_memento(configurator& cfg)
     cfg.get_security_policy().set_text("syslog_writer::port(text)", 5);
     cfg.get_security_policy().set_text("syslog_writer::facility", 8);
     cfg.get_security_policy().set_text("syslog_writer::host_name", 253);
+    cfg.get_security_policy().set_text("syslog_writer::protocol", 3);
+    cfg.get_security_policy().set_text("syslog_writer::format", 7);
+    cfg.get_security_policy().set_integer("syslog_writer::batch_size", static_cast<std::size_t>(1), static_cast<std::size_t>(1024));
+    cfg.get_security_policy().set_text("syslog_writer::batch_size(text)", 4);
+    cfg.get_security_policy().set_text("syslog_writer::structured_data_id", 32);
     set_handler("facility", std::bind(&syslog_writer_memento::set_facility, this, std::placeholders::_1));
     set_handler("host_name", [this] (const std::string& name) { host_name_ = validate("syslog_writer::host_name", name); });
     set_alias("host_name", "host");
     set_handler("port", [this] (const std::string& port) { port_ = validate("syslog_writer::port", static_cast<std::uint16_t>(std::stoul(validate("syslog_writer::port(text)", port)))); });
+    set_handler("protocol", std::bind(&syslog_writer_memento::set_protocol, this, std::placeholders::_1));
+    set_handler("format", std::bind(&syslog_writer_memento::set_message_format, this, std::placeholders::_1));
+    set_handler("batch_size", [this] (const std::string& sz) { batch_size_ = validate("syslog_writer::batch_size", static_cast<std::size_t>(std::stoul(validate("syslog_writer::batch_size(text)", sz)))); });
+    set_handler("structured_data_id", [this] (const std::string& id) { structured_data_id_ = validate("syslog_writer::structured_data_id", id); });
 }
 
 void syslog_writer_memento::set_facility(const std::string& name)
@@ -84,4 +93,26 @@ void syslog_writer_memento::set_facility(const std::string& name)
         throw exception("facility has an invalid value of " + name);
 }
 
+void syslog_writer_memento::set_message_format(const std::string& name)
+{
+    auto lname = text_util::to_lower(validate("syslog_writer::format", name));
+    if (lname == "rfc3164")
+        message_format_ = syslog::message_format::RFC3164;
+    else if (lname == "rfc5424")
+        message_format_ = syslog::message_format::RFC5424;
+    else
+        throw exception("format has an invalid value of " + name);
+}
+
+void syslog_writer_memento::set_protocol(const std::string& name)
+{
+    auto lname = text_util::to_lower(validate("syslog_writer::protocol", name));
+    if (lname == "udp")
+        protocol_ = syslog::transport_protocol::UDP;
+    else if (lname == "tcp")
+        protocol_ = syslog::transport_protocol::TCP;
+    else
+        throw exception("protocol has an invalid value of " + name);
+}
+
 }
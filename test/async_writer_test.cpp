@@ -18,8 +18,14 @@
 #include <chucho/async_writer.hpp>
 #include <chucho/pattern_formatter.hpp>
 #include <chucho/logger.hpp>
+#include <chucho/diagnostic_context.hpp>
 #include <chrono>
 #include <vector>
+#include <algorithm>
+#include <map>
+#if defined(__linux__)
+#include <pthread.h>
+#endif
 
 namespace
 {
@@ -39,6 +45,27 @@ private:
     std::chrono::milliseconds delay_;
 };
 
+#if defined(__linux__)
+
+class thread_name_writer : public chucho::writer
+{
+public:
+    thread_name_writer();
+
+    int get_scheduling_policy();
+    std::string get_thread_name();
+
+protected:
+    virtual void write_impl(const chucho::event&) override;
+
+private:
+    std::mutex guard_;
+    std::string thread_name_;
+    int scheduling_policy_;
+};
+
+#endif
+
 class async_writer_test : public ::testing::Test
 {
 public:
@@ -63,6 +90,40 @@ void slow_writer::write_impl(const chucho::event& evt)
     events_.push_back(formatter_->format(evt));
 }
 
+#if defined(__linux__)
+
+thread_name_writer::thread_name_writer()
+    : chucho::writer("thread_name", std::make_unique<chucho::pattern_formatter>("%m")),
+      scheduling_policy_(-1)
+{
+}
+
+int thread_name_writer::get_scheduling_policy()
+{
+    std::lock_guard<std::mutex> lg(guard_);
+    return scheduling_policy_;
+}
+
+std::string thread_name_writer::get_thread_name()
+{
+    std::lock_guard<std::mutex> lg(guard_);
+    return thread_name_;
+}
+
+void thread_name_writer::write_impl(const chucho::event&)
+{
+    char name[16];
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    int policy;
+    sched_param param;
+    pthread_getschedparam(pthread_self(), &policy, &param);
+    std::lock_guard<std::mutex> lg(guard_);
+    thread_name_ = name;
+    scheduling_policy_ = policy;
+}
+
+#endif
+
 chucho::event async_writer_test::get_event(const std::string& msg, std::shared_ptr<chucho::level> lvl)
 {
     return chucho::event(chucho::logger::get("will"),
@@ -138,3 +199,173 @@ TEST_F(async_writer_test, slow)
     for (int i = 0; i < 10; i++)
         EXPECT_EQ(i, std::stoi(slow.get_events()[i]));
 }
+
+TEST_F(async_writer_test, shed)
+{
+    auto wrt = std::make_unique<slow_writer>(20ms);
+    auto& slow = *wrt;
+    auto gov = std::make_unique<chucho::overload_governor>(chucho::overload_governor::parse_watermarks("50:DEBUG"));
+    auto owned = std::make_unique<chucho::async_writer>("async", std::move(wrt), 1024, 2, std::move(gov));
+    auto as = owned.get();
+    auto lgr = chucho::logger::get("will");
+    lgr->set_level(chucho::level::TRACE_());
+    lgr->add_writer(std::move(owned));
+    auto child = chucho::logger::get("will.child");
+    auto sync = chucho::logger::get("will.sync");
+    sync->set_writes_to_ancestors(false);
+    auto info = chucho::logger::get("will.info");
+    info->set_level(chucho::level::INFO_());
+    // This one has an async_writer of its own that is not congested
+    auto idle = chucho::logger::get("idle");
+    idle->set_level(chucho::level::TRACE_());
+    idle->add_writer(std::make_unique<chucho::async_writer>("idle_async",
+                                                            std::make_unique<slow_writer>(0ms),
+                                                            1024,
+                                                            2,
+                                                            std::make_unique<chucho::overload_governor>(chucho::overload_governor::parse_watermarks("50:DEBUG"))));
+    int count = 0;
+    while (!as->get_overload_governor()->get_shed_level() && count < 100)
+        as->write(get_event(std::to_string(count++)));
+    ASSERT_LT(count, 100);
+    EXPECT_FALSE(lgr->permits(chucho::level::TRACE_()));
+    EXPECT_FALSE(lgr->permits(chucho::level::DEBUG_()));
+    EXPECT_TRUE(lgr->permits(chucho::level::INFO_()));
+    EXPECT_FALSE(child->permits(chucho::level::DEBUG_()));
+    // This one can't reach the async_writer
+    EXPECT_TRUE(sync->permits(chucho::level::DEBUG_()));
+    // This one wouldn't have written the event, so it is not counted
+    EXPECT_FALSE(info->permits(chucho::level::DEBUG_()));
+    EXPECT_TRUE(idle->permits(chucho::level::DEBUG_()));
+    for (int i = 0; i < 100 && as->get_cache_stats().get_current_size() > 0; i++)
+        std::this_thread::sleep_for(50ms);
+    std::this_thread::sleep_for(300ms);
+    EXPECT_FALSE(as->get_overload_governor()->get_shed_level());
+    EXPECT_TRUE(lgr->permits(chucho::level::DEBUG_()));
+    ASSERT_EQ(count + 1, slow.get_events().size());
+    auto found = std::find_if(slow.get_events().begin(),
+                              slow.get_events().end(),
+                              [] (const std::string& msg) { return msg.find("async: Events at or below DEBUG were shed") == 0; });
+    ASSERT_NE(slow.get_events().end(), found);
+    EXPECT_NE(std::string::npos, found->find("TRACE 1, DEBUG 2"));
+    info->set_level(std::shared_ptr<chucho::level>());
+    sync->set_writes_to_ancestors(true);
+    lgr->clear_writers();
+    lgr->set_level(std::shared_ptr<chucho::level>());
+    idle->clear_writers();
+    idle->set_level(std::shared_ptr<chucho::level>());
+}
+
+TEST_F(async_writer_test, sharded)
+{
+    std::vector<std::unique_ptr<chucho::writer>> wrts;
+    for (int i = 0; i < 4; i++)
+        wrts.push_back(std::make_unique<slow_writer>(1ms));
+    auto as = std::make_unique<chucho::async_writer>("async", std::move(wrts), "request_id", chucho::async_writer::DEFAULT_CHUNK_SIZE, chucho::async_writer::DEFAULT_MAX_CHUNKS, std::unique_ptr<chucho::overload_governor>());
+    EXPECT_EQ(4, as->get_shard_count());
+    EXPECT_EQ(std::string("request_id"), as->get_shard_key());
+    EXPECT_THROW(as->get_shard_cache_stats(4), std::out_of_range);
+    for (int i = 0; i < 200; i++)
+    {
+        chucho::diagnostic_context::at("request_id") = std::to_string(i % 10);
+        as->write(get_event(std::to_string(i % 10) + ':' + std::to_string(i)));
+    }
+    chucho::diagnostic_context::erase("request_id");
+    for (int i = 0; i < 100; i++)
+    {
+        std::size_t depth = 0;
+        for (std::size_t s = 0; s < as->get_shard_count(); s++)
+            depth += as->get_shard_cache_stats(s).get_current_size();
+        if (depth == 0)
+            break;
+        std::this_thread::sleep_for(50ms);
+    }
+    // The last event of each shard may still be being written
+    std::this_thread::sleep_for(100ms);
+    std::size_t total = 0;
+    std::map<std::string, int> last;
+    for (std::size_t s = 0; s < as->get_shard_count(); s++)
+    {
+        auto& slow = dynamic_cast<slow_writer&>(as->get_writer(s));
+        for (const auto& msg : slow.get_events())
+        {
+            auto colon = msg.find(':');
+            auto key = msg.substr(0, colon);
+            int seq = std::stoi(msg.substr(colon + 1));
+            // A key belongs to one shard and stays in order
+            auto found = last.find(key);
+            if (found != last.end())
+            {
+                EXPECT_LT(found->second, seq);
+            }
+            last[key] = seq;
+        }
+        total += slow.get_events().size();
+    }
+    EXPECT_EQ(200, total);
+    EXPECT_EQ(10, last.size());
+}
+
+TEST_F(async_writer_test, sharded_shared_writer)
+{
+    auto wrt = std::make_unique<slow_writer>(1ms);
+    auto& slow = *wrt;
+    auto as = std::make_unique<chucho::async_writer>("async", std::move(wrt), 3, "", chucho::async_writer::DEFAULT_CHUNK_SIZE, chucho::async_writer::DEFAULT_MAX_CHUNKS, std::unique_ptr<chucho::overload_governor>());
+    EXPECT_EQ(3, as->get_shard_count());
+    EXPECT_EQ(&as->get_writer(0), &as->get_writer(2));
+    for (int i = 0; i < 50; i++)
+        as->write(get_event(std::to_string(i)));
+    as.reset();
+    // Everything came from one logger, so it all went through one shard
+    ASSERT_EQ(50, slow.get_events().size());
+    for (int i = 0; i < 50; i++)
+        EXPECT_EQ(i, std::stoi(slow.get_events()[i]));
+}
+
+#if defined(__linux__)
+
+TEST_F(async_writer_test, thread_settings)
+{
+    auto wrt = std::make_unique<thread_name_writer>();
+    auto& named = *wrt;
+    auto as = std::make_unique<chucho::async_writer>("aw", std::move(wrt));
+    as->write(get_event("one"));
+    for (int i = 0; i < 40 && named.get_thread_name().empty(); i++)
+        std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(std::string("async:aw"), named.get_thread_name());
+    chucho::thread_settings ts;
+    ts.set_name("my-async");
+    as->set_thread_settings(ts);
+    EXPECT_EQ(std::string("my-async"), as->get_thread_settings().get_name());
+    // The worker wakes up at least every 250 milliseconds
+    std::this_thread::sleep_for(400ms);
+    as->write(get_event("two"));
+    for (int i = 0; i < 40 && named.get_thread_name() != "my-async"; i++)
+        std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(std::string("my-async"), named.get_thread_name());
+}
+
+TEST_F(async_writer_test, thread_settings_cleared)
+{
+    auto wrt = std::make_unique<thread_name_writer>();
+    auto& named = *wrt;
+    auto as = std::make_unique<chucho::async_writer>("my_rolling_writer", std::move(wrt));
+    chucho::thread_settings ts;
+    ts.set_scheduling(chucho::thread_settings::scheduling::BATCH);
+    as->set_thread_settings(ts);
+    as->write(get_event("one"));
+    for (int i = 0; i < 40 && named.get_thread_name().empty(); i++)
+        std::this_thread::sleep_for(50ms);
+    // Linux keeps 15 characters, so the role stays and the start
+    // of the writer's name goes
+    EXPECT_EQ(std::string("async:ng_writer"), named.get_thread_name());
+    EXPECT_EQ(SCHED_BATCH, named.get_scheduling_policy());
+    as->set_thread_settings(chucho::thread_settings());
+    // The worker wakes up at least every 250 milliseconds
+    std::this_thread::sleep_for(400ms);
+    as->write(get_event("two"));
+    for (int i = 0; i < 40 && named.get_scheduling_policy() != SCHED_OTHER; i++)
+        std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(SCHED_OTHER, named.get_scheduling_policy());
+}
+
+#endif
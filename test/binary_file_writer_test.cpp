@@ -0,0 +1,234 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chucho/binary_file_writer.hpp>
+#include <chucho/binary_file_reader.hpp>
+#include <chucho/numbered_file_roller.hpp>
+#include <chucho/size_file_roll_trigger.hpp>
+#include <chucho/file.hpp>
+#include <chucho/logger.hpp>
+#include <chucho/host.hpp>
+#include <chucho/process.hpp>
+#include <chucho/status_manager.hpp>
+#include <chucho/exception.hpp>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+
+class custom_level : public chucho::level
+{
+public:
+    virtual const char* get_name() const override
+    {
+        return "BINARY_CUSTOM";
+    }
+
+    virtual chucho::syslog::severity get_syslog_severity() const override
+    {
+        return chucho::syslog::severity::NOTICE;
+    }
+
+    virtual int get_value() const override
+    {
+        return 35000;
+    }
+};
+
+class binary_file_writer_test : public ::testing::Test
+{
+protected:
+    binary_file_writer_test()
+        : logger_(chucho::logger::get("binary_file_writer_test")),
+          dir_name_("binary_file_writer_test")
+    {
+        if (chucho::file::exists(dir_name_))
+            chucho::file::remove_all(dir_name_);
+        chucho::file::create_directory(dir_name_);
+        chucho::status_manager::get().clear();
+    }
+
+    ~binary_file_writer_test()
+    {
+        try
+        {
+            chucho::file::remove_all(dir_name_);
+        }
+        catch (...)
+        {
+        }
+    }
+
+    chucho::event get_event(const std::string& msg)
+    {
+        return chucho::event(logger_, chucho::level::INFO_(), msg, __FILE__, __LINE__, __FUNCTION__);
+    }
+
+    std::string get_file_name(const std::string& base)
+    {
+        return dir_name_ + chucho::file::dir_sep + base;
+    }
+
+    std::vector<chucho::event> read_all(const std::string& file_name)
+    {
+        std::vector<chucho::event> result;
+        chucho::binary_file_reader rdr(file_name);
+        while (auto evt = rdr.read())
+            result.push_back(*evt);
+        return result;
+    }
+
+    std::shared_ptr<chucho::logger> logger_;
+    std::string dir_name_;
+};
+
+}
+
+TEST_F(binary_file_writer_test, append)
+{
+    std::string fn = get_file_name("append");
+    {
+        chucho::binary_file_writer w("binary", fn);
+        w.write(get_event("one"));
+    }
+    {
+        chucho::binary_file_writer w("binary", fn);
+        w.write(get_event("two"));
+    }
+    auto evts = read_all(fn);
+    ASSERT_EQ(2, evts.size());
+    EXPECT_EQ(std::string("one"), evts[0].get_message());
+    EXPECT_EQ(std::string("two"), evts[1].get_message());
+    EXPECT_STREQ(__FILE__, evts[1].get_file_name());
+    EXPECT_EQ(logger_, evts[1].get_logger());
+}
+
+TEST_F(binary_file_writer_test, interning)
+{
+    std::string fn = get_file_name("interning");
+    chucho::binary_file_writer w("binary", fn, chucho::file_writer::on_start::TRUNCATE);
+    w.write(get_event("x"));
+    auto first = chucho::file::size(fn);
+    for (int i = 0; i < 100; i++)
+        w.write(get_event("x"));
+    auto per_event = (chucho::file::size(fn) - first) / 100;
+    // Only the message and a handful of small numbers are written
+    // once the strings are known.
+    EXPECT_LT(per_event, 16U);
+    EXPECT_EQ(101, read_all(fn).size());
+}
+
+TEST_F(binary_file_writer_test, not_binary)
+{
+    std::string fn = get_file_name("text");
+    std::ofstream stream(fn);
+    stream << "This is not a binary log" << std::endl;
+    stream.close();
+    EXPECT_THROW(chucho::binary_file_reader rdr(fn), chucho::exception);
+}
+
+TEST_F(binary_file_writer_test, rolling)
+{
+    std::string fn = get_file_name("rolling");
+    auto trig = std::make_unique<chucho::size_file_roll_trigger>(200);
+    auto roll = std::make_unique<chucho::numbered_file_roller>(1, 5);
+    chucho::binary_file_writer w("binary", fn, std::move(roll), std::move(trig));
+    ASSERT_NE(nullptr, w.get_file_roller());
+    for (int i = 0; i < 10; i++)
+        w.write(get_event("message " + std::to_string(i)));
+    ASSERT_TRUE(chucho::file::exists(fn + ".1"));
+    // Each file must decode without the ones before it
+    std::vector<std::string> msgs;
+    for (int i = 5; i > 0; i--)
+    {
+        if (chucho::file::exists(fn + "." + std::to_string(i)))
+        {
+            for (auto& evt : read_all(fn + "." + std::to_string(i)))
+                msgs.push_back(evt.get_message());
+        }
+    }
+    for (auto& evt : read_all(fn))
+        msgs.push_back(evt.get_message());
+    ASSERT_FALSE(msgs.empty());
+    EXPECT_EQ(std::string("message 9"), msgs.back());
+    for (std::size_t i = 1; i < msgs.size(); i++)
+        EXPECT_EQ(std::stoi(msgs[i - 1].substr(8)) + 1, std::stoi(msgs[i].substr(8)));
+}
+
+TEST_F(binary_file_writer_test, round_trip)
+{
+    std::string fn = get_file_name("round_trip");
+    auto lvl = std::make_shared<custom_level>();
+    auto then = chucho::event::clock_type::now();
+    {
+        chucho::binary_file_writer w("binary", fn);
+        w.write(get_event("plain"));
+        w.write(chucho::event(logger_, lvl, "custom", "other.cpp", 72, "func", chucho::marker("mark")));
+        w.write(chucho::event(logger_, chucho::level::ERROR_(), "", nullptr, 0, nullptr));
+    }
+    chucho::binary_file_reader rdr(fn);
+    EXPECT_EQ(chucho::host::get_full_name(), rdr.get_host_name());
+    EXPECT_EQ(chucho::process::id(), rdr.get_process_id());
+    auto evt = rdr.read();
+    ASSERT_TRUE(static_cast<bool>(evt));
+    EXPECT_EQ(std::string("plain"), evt->get_message());
+    EXPECT_EQ(chucho::level::INFO_(), evt->get_level());
+    EXPECT_STREQ("get_event", evt->get_function_name());
+    EXPECT_FALSE(static_cast<bool>(evt->get_marker()));
+    ASSERT_TRUE(static_cast<bool>(evt->get_thread_id()));
+    EXPECT_GE(evt->get_time(), then);
+    EXPECT_LT(evt->get_time(), then + std::chrono::seconds(5));
+    evt = rdr.read();
+    ASSERT_TRUE(static_cast<bool>(evt));
+    EXPECT_EQ(std::string("custom"), evt->get_message());
+    EXPECT_STREQ("BINARY_CUSTOM", evt->get_level()->get_name());
+    EXPECT_EQ(35000, evt->get_level()->get_value());
+    EXPECT_EQ(chucho::syslog::severity::NOTICE, evt->get_level()->get_syslog_severity());
+    EXPECT_STREQ("other.cpp", evt->get_file_name());
+    EXPECT_EQ(72, evt->get_line_number());
+    EXPECT_STREQ("func", evt->get_function_name());
+    ASSERT_TRUE(static_cast<bool>(evt->get_marker()));
+    EXPECT_EQ(std::string("mark"), evt->get_marker()->get_name());
+    evt = rdr.read();
+    ASSERT_TRUE(static_cast<bool>(evt));
+    EXPECT_TRUE(evt->get_message().empty());
+    EXPECT_EQ(nullptr, evt->get_file_name());
+    EXPECT_EQ(nullptr, evt->get_function_name());
+    EXPECT_FALSE(static_cast<bool>(rdr.read()));
+}
+
+TEST_F(binary_file_writer_test, truncated)
+{
+    std::string fn = get_file_name("truncated");
+    {
+        chucho::binary_file_writer w("binary", fn);
+        w.write(get_event("one"));
+        w.write(get_event("two"));
+    }
+    auto full = chucho::file::size(fn);
+    std::string bytes(full, 0);
+    std::ifstream in(fn, std::ios::binary);
+    in.read(&bytes[0], full);
+    in.close();
+    std::ofstream out(fn, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), full - 2);
+    out.close();
+    auto evts = read_all(fn);
+    ASSERT_EQ(1, evts.size());
+    EXPECT_EQ(std::string("one"), evts[0].get_message());
+}
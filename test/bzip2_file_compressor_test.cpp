@@ -17,6 +17,9 @@
 #include <gtest/gtest.h>
 #include <chucho/bzip2_file_compressor.hpp>
 #include <chucho/file.hpp>
+#include <bzlib.h>
+#include <cstring>
+#include <iterator>
 #include <fstream>
 #include <algorithm>
 #include <random>
@@ -37,6 +40,49 @@ void make_file(const std::string& name)
     }
 }
 
+std::string make_big_file(const std::string& name)
+{
+    std::string text;
+    std::string chars("abcdefghijklmnopqrstuvxyzABCDEFGHIJKLMNOPQRSTUVXYZ");
+    std::mt19937 gen(7);
+    while (text.length() < 3 * 1024 * 1024)
+    {
+        std::shuffle(chars.begin(), chars.end(), gen);
+        text += chars;
+    }
+    std::ofstream stream(name.c_str(), std::ios::out | std::ios::binary);
+    stream << text;
+    return text;
+}
+
+std::string bunzip2(const std::string& name)
+{
+    std::ifstream stream(name.c_str(), std::ios::in | std::ios::binary);
+    std::string in((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    std::string result;
+    bz_stream bz;
+    std::memset(&bz, 0, sizeof(bz));
+    bz.next_in = const_cast<char*>(in.data());
+    bz.avail_in = in.length();
+    // Each block is a complete bzip2 stream, so start over at each end
+    while (bz.avail_in > 0 && BZ2_bzDecompressInit(&bz, 0, 0) == BZ_OK)
+    {
+        char buf[8192];
+        int rc;
+        do
+        {
+            bz.next_out = buf;
+            bz.avail_out = sizeof(buf);
+            rc = BZ2_bzDecompress(&bz);
+            result.append(buf, sizeof(buf) - bz.avail_out);
+        } while (rc == BZ_OK);
+        BZ2_bzDecompressEnd(&bz);
+        if (rc != BZ_STREAM_END)
+            break;
+    }
+    return result;
+}
+
 }
 
 TEST(bzip2_file_compressor, compress)
@@ -53,3 +99,18 @@ TEST(bzip2_file_compressor, compress)
     EXPECT_TRUE(chucho::file::exists(name));
     chucho::file::remove(name);
 }
+
+TEST(bzip2_file_compressor, parallel)
+{
+    std::string name("bzip2_file_compressor_parallel_test");
+    std::string text = make_big_file(name);
+    chucho::bzip2_file_compressor bz(1);
+    bz.set_threads(3);
+    EXPECT_EQ(3, bz.get_threads());
+    ASSERT_NO_THROW(bz.compress(name));
+    EXPECT_FALSE(chucho::file::exists(name));
+    name += ".bz2";
+    ASSERT_TRUE(chucho::file::exists(name));
+    EXPECT_EQ(text, bunzip2(name));
+    chucho::file::remove(name);
+}
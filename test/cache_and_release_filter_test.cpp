@@ -18,6 +18,9 @@
 #include <chucho/cache_and_release_filter.hpp>
 #include <chucho/pattern_formatter.hpp>
 #include <chucho/logger.hpp>
+#include <future>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -59,9 +62,9 @@ protected:
         logger_->add_writer(std::move(std::make_unique<string_writer>()));
     }
 
-    chucho::event get_event(std::shared_ptr<chucho::level> lvl)
+    chucho::event get_event(std::shared_ptr<chucho::level> lvl, const std::string& msg = "hello")
     {
-        return chucho::event(logger_, lvl, "hello", __FILE__, __LINE__, __FUNCTION__);
+        return chucho::event(logger_, lvl, msg, __FILE__, __LINE__, __FUNCTION__);
     }
 
     std::unique_ptr<chucho::cache_and_release_filter> get_carf(std::shared_ptr<chucho::level> c, std::shared_ptr<chucho::level> r)
@@ -69,6 +72,16 @@ protected:
         return std::make_unique<chucho::cache_and_release_filter>("howdy", logger_->get_writer("string"), c, r);
     }
 
+    std::unique_ptr<chucho::cache_and_release_filter> get_recorder(std::size_t num, const std::chrono::milliseconds& age)
+    {
+        return std::make_unique<chucho::cache_and_release_filter>("howdy",
+                                                                  logger_->get_writer("string"),
+                                                                  chucho::level::DEBUG_(),
+                                                                  chucho::level::ERROR_(),
+                                                                  num,
+                                                                  age);
+    }
+
     std::string get_writer_text()
     {
         auto& wrt = static_cast<string_writer&>(logger_->get_writer("string"));
@@ -91,3 +104,62 @@ TEST_F(cache_and_release_filter_test, simple)
     EXPECT_EQ(chucho::filter::result::ACCEPT, carf->evaluate(get_event(chucho::level::ERROR_())));
     EXPECT_STREQ("hello", get_writer_text().c_str());
 }
+
+TEST_F(cache_and_release_filter_test, flight_recorder)
+{
+    auto carf = get_recorder(3, std::chrono::milliseconds(0));
+    EXPECT_TRUE(carf->is_flight_recorder());
+    EXPECT_EQ(3, carf->get_events_per_thread());
+    for (char c = 'a'; c <= 'e'; c++)
+        EXPECT_EQ(chucho::filter::result::DENY, carf->evaluate(get_event(chucho::level::DEBUG_(), std::string(1, c))));
+    std::thread thr([&carf, this] () { carf->evaluate(get_event(chucho::level::TRACE_(), "f")); });
+    thr.join();
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, carf->evaluate(get_event(chucho::level::INFO_())));
+    EXPECT_TRUE(get_writer_text().empty());
+    EXPECT_EQ(chucho::filter::result::ACCEPT, carf->evaluate(get_event(chucho::level::ERROR_())));
+    EXPECT_STREQ("cdef", get_writer_text().c_str());
+    EXPECT_EQ(chucho::filter::result::ACCEPT, carf->evaluate(get_event(chucho::level::ERROR_())));
+    EXPECT_TRUE(get_writer_text().empty());
+}
+
+TEST_F(cache_and_release_filter_test, flight_recorder_max_age)
+{
+    auto carf = get_recorder(10, std::chrono::milliseconds(200));
+    EXPECT_EQ(std::chrono::milliseconds(200), carf->get_max_age());
+    EXPECT_EQ(chucho::filter::result::DENY, carf->evaluate(get_event(chucho::level::DEBUG_(), "old")));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(chucho::filter::result::DENY, carf->evaluate(get_event(chucho::level::DEBUG_(), "new")));
+    EXPECT_EQ(chucho::filter::result::ACCEPT, carf->evaluate(get_event(chucho::level::ERROR_())));
+    EXPECT_STREQ("new", get_writer_text().c_str());
+}
+
+TEST_F(cache_and_release_filter_test, flight_recorder_many_threads)
+{
+    auto carf = get_recorder(2, std::chrono::milliseconds(0));
+    std::size_t count = chucho::cache_and_release_filter::MAX_THREADS + 50;
+    // The threads stay alive until they have all logged, so that
+    // none of them reuses the id of one that has ended
+    std::promise<void> done;
+    std::shared_future<void> all_done = done.get_future().share();
+    std::vector<std::promise<void>> logged(count);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        threads.emplace_back([&carf, &logged, all_done, i, this] ()
+        {
+            carf->evaluate(get_event(chucho::level::DEBUG_(), std::to_string(i) + ','));
+            logged[i].set_value();
+            all_done.wait();
+        });
+        logged[i].get_future().wait();
+    }
+    done.set_value();
+    for (auto& thr : threads)
+        thr.join();
+    EXPECT_EQ(chucho::filter::result::ACCEPT, carf->evaluate(get_event(chucho::level::ERROR_(), "")));
+    // Only the threads that logged most recently keep their rings
+    std::string expected;
+    for (std::size_t i = count - chucho::cache_and_release_filter::MAX_THREADS; i < count; i++)
+        expected += std::to_string(i) + ',';
+    EXPECT_EQ(expected, get_writer_text());
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chucho/log.hpp>
+#include <chucho/pattern_formatter.hpp>
+#include "string_writer.hpp"
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
+
+namespace
+{
+
+class callsite : public ::testing::Test
+{
+public:
+    callsite()
+        : lgr_(chucho::logger::get("callsite")),
+          first_line_(0),
+          second_line_(0)
+    {
+        lgr_->set_level(chucho::level::INFO_());
+        auto wrt = std::make_unique<chucho::test::string_writer>(std::make_unique<chucho::pattern_formatter>("%p %m%n"));
+        wrt_ = wrt.get();
+        lgr_->add_writer(std::move(wrt));
+    }
+
+    ~callsite()
+    {
+        chucho::callsites::reset();
+        lgr_->clear_writers();
+        lgr_.reset();
+        chucho::logger::remove_unused_loggers();
+    }
+
+protected:
+    void log()
+    {
+        first_line_ = __LINE__ + 1;
+        CHUCHO_DEBUG(lgr_, "first");
+        second_line_ = __LINE__ + 1;
+        CHUCHO_INFO(lgr_, "second");
+    }
+
+    std::shared_ptr<chucho::logger> lgr_;
+    chucho::test::string_writer* wrt_;
+    unsigned first_line_;
+    unsigned second_line_;
+};
+
+}
+
+TEST_F(callsite, bad_spec)
+{
+    EXPECT_THROW(chucho::callsites::enable("", chucho::level::TRACE_()), std::invalid_argument);
+    EXPECT_THROW(chucho::callsites::enable("callsite_test.cpp:", chucho::level::TRACE_()), std::invalid_argument);
+    EXPECT_THROW(chucho::callsites::enable("callsite_test.cpp:20-10", chucho::level::TRACE_()), std::invalid_argument);
+    EXPECT_THROW(chucho::callsites::enable("callsite_test.cpp", std::shared_ptr<chucho::level>()), std::invalid_argument);
+}
+
+TEST_F(callsite, disable)
+{
+    log();
+    EXPECT_EQ(1, wrt_->get_lines().size());
+    EXPECT_EQ(2, chucho::callsites::disable("callsite_test.cpp"));
+    log();
+    EXPECT_TRUE(wrt_->get_lines().empty());
+    chucho::callsites::reset();
+    log();
+    auto lines = wrt_->get_lines();
+    ASSERT_EQ(1, lines.size());
+    EXPECT_EQ("INFO second", lines[0]);
+}
+
+TEST_F(callsite, enable_before_registration)
+{
+    chucho::callsites::enable("*/callsite_test.cpp", chucho::level::DEBUG_());
+    log();
+    auto lines = wrt_->get_lines();
+    ASSERT_EQ(2, lines.size());
+    EXPECT_EQ("DEBUG first", lines[0]);
+    EXPECT_EQ("INFO second", lines[1]);
+}
+
+TEST_F(callsite, enable_line)
+{
+    log();
+    EXPECT_EQ(1, wrt_->get_lines().size());
+    EXPECT_EQ(1, chucho::callsites::enable("callsite_test.cpp:" + std::to_string(first_line_), chucho::level::TRACE_()));
+    log();
+    auto lines = wrt_->get_lines();
+    ASSERT_EQ(2, lines.size());
+    EXPECT_EQ("DEBUG first", lines[0]);
+    EXPECT_EQ("INFO second", lines[1]);
+    EXPECT_EQ(1, chucho::callsites::disable("call?ite_test.cpp:" + std::to_string(second_line_) + "-" + std::to_string(second_line_ + 10)));
+    log();
+    lines = wrt_->get_lines();
+    ASSERT_EQ(1, lines.size());
+    EXPECT_EQ("DEBUG first", lines[0]);
+}
+
+TEST_F(callsite, registered)
+{
+    log();
+    auto sites = chucho::callsites::get_registered();
+    unsigned found = 0;
+    for (auto site : sites)
+    {
+        std::string file(site->get_file_name());
+        if (file.find("callsite_test.cpp") != std::string::npos)
+        {
+            EXPECT_TRUE(site->get_line_number() == first_line_ || site->get_line_number() == second_line_);
+            EXPECT_FALSE(site->is_overridden());
+            ++found;
+        }
+    }
+    EXPECT_EQ(2, found);
+}
+
+TEST_F(callsite, unregister)
+{
+    auto count = chucho::callsites::get_registered().size();
+    {
+        chucho::callsite site("transient.cpp", 1, "unregister");
+        auto sites = chucho::callsites::get_registered();
+        ASSERT_EQ(count + 1, sites.size());
+        EXPECT_NE(sites.end(), std::find(sites.begin(), sites.end(), &site));
+    }
+    EXPECT_EQ(count, chucho::callsites::get_registered().size());
+    EXPECT_EQ(0, chucho::callsites::disable("transient.cpp"));
+}
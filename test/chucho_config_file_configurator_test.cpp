@@ -280,7 +280,9 @@ TEST_F(chucho_config_file_configurator, email_writer)
               "chucho.writer.em.connection_type = clear\n"
               "chucho.writer.em.user = scrumpy\n"
               "chucho.writer.em.password = lumpy\n"
-              "chucho.writer.em.buffer_size = 7000");
+              "chucho.writer.em.buffer_size = 7000\n"
+              "chucho.writer.em.coalesce_window = 2500\n"
+              "chucho.writer.em.max_backlog = 4");
     email_writer_body();
 }
 
@@ -786,6 +788,25 @@ TEST_F(chucho_config_file_configurator, syslog_writer_facility)
     syslog_writer_facility_body(tmpl);
 }
 
+#if !defined(CHUCHO_WINDOWS)
+TEST_F(chucho_config_file_configurator, syslog_writer_extended)
+{
+    configure("chucho.logger = will\n"
+              "chucho.logger.will.writer = sw\n"
+              "chucho.writer.sw = chucho::syslog_writer\n"
+              "chucho.writer.sw.formatter = pf\n"
+              "chucho.formatter.pf = chucho::pattern_formatter\n"
+              "chucho.formatter.pf.pattern = %m%n\n"
+              "chucho.writer.sw.facility = LOCAL0\n"
+              "chucho.writer.sw.host_name = localhost\n"
+              "chucho.writer.sw.protocol = tcp\n"
+              "chucho.writer.sw.format = rfc5424\n"
+              "chucho.writer.sw.batch_size = 20\n"
+              "chucho.writer.sw.structured_data_id = origin@32473");
+    syslog_writer_extended_body();
+}
+#endif
+
 #if !defined(CHUCHO_SOLARIS)
 TEST_F(chucho_config_file_configurator, syslog_writer_port)
 {
@@ -19,6 +19,18 @@
 #include <chucho/pattern_formatter.hpp>
 #include <chucho/function_name.hpp>
 #include <chucho/logger.hpp>
+#if !defined(CHUCHO_WINDOWS)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
 
 TEST(cloudwatch_writer, many)
 {
@@ -46,3 +58,164 @@ TEST(cloudwatch_writer, one)
     wrt.flush();
     EXPECT_EQ(0, wrt.get_current_batch_size());
 }
+
+#if !defined(CHUCHO_WINDOWS)
+
+namespace
+{
+
+// A stand-in for Cloudwatch Logs that throttles the first PutLogEvents
+// request and accepts the rest, and that hands out sequence tokens
+class cloudwatch_stand_in
+{
+public:
+    cloudwatch_stand_in()
+        : socket_(socket(AF_INET, SOCK_STREAM, 0)),
+          puts_(0),
+          stop_(false)
+    {
+        struct sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(socket_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+        socklen_t len = sizeof(addr);
+        getsockname(socket_, reinterpret_cast<struct sockaddr*>(&addr), &len);
+        port_ = ntohs(addr.sin_port);
+        listen(socket_, 8);
+        acceptor_ = std::thread([this] () { accept_main(); });
+    }
+
+    ~cloudwatch_stand_in()
+    {
+        stop_ = true;
+        acceptor_.join();
+        for (auto& t : handlers_)
+            t.join();
+        close(socket_);
+    }
+
+    std::string get_endpoint() const
+    {
+        return "http://127.0.0.1:" + std::to_string(port_);
+    }
+
+    std::vector<std::string> get_accepted()
+    {
+        std::lock_guard<std::mutex> lg(guard_);
+        return accepted_;
+    }
+
+    unsigned get_puts() const
+    {
+        return puts_;
+    }
+
+private:
+    void accept_main()
+    {
+        while (!stop_)
+        {
+            struct pollfd pfd = { socket_, POLLIN, 0 };
+            if (poll(&pfd, 1, 50) == 1)
+            {
+                int conn = accept(socket_, nullptr, nullptr);
+                handlers_.emplace_back([this, conn] () { handle(conn); });
+            }
+        }
+    }
+
+    std::string answer(const std::string& head, const std::string& body, int& status)
+    {
+        status = 200;
+        if (head.find("DescribeLogStreams") != std::string::npos)
+            return R"({"logStreams":[{"logStreamName":"UnitTest","uploadSequenceToken":"1"}]})";
+        if (++puts_ == 1)
+        {
+            status = 400;
+            return R"({"__type":"ThrottlingException","message":"Rate exceeded"})";
+        }
+        std::lock_guard<std::mutex> lg(guard_);
+        accepted_.push_back(body);
+        return R"({"nextSequenceToken":")" + std::to_string(puts_ + 1) + "\"}";
+    }
+
+    void handle(int conn)
+    {
+        std::string in;
+        char buf[4096];
+        while (!stop_)
+        {
+            auto end = in.find("\r\n\r\n");
+            if (end != std::string::npos)
+            {
+                std::size_t length = 0;
+                auto cl = in.find("content-length: ");
+                if (cl == std::string::npos)
+                    cl = in.find("Content-Length: ");
+                if (cl != std::string::npos && cl < end)
+                    length = std::stoul(in.substr(cl + 16));
+                if (in.length() >= end + 4 + length)
+                {
+                    int status;
+                    auto body = answer(in.substr(0, end), in.substr(end + 4, length), status);
+                    in.erase(0, end + 4 + length);
+                    auto resp = "HTTP/1.1 " + std::to_string(status) +
+                        " Whatever\r\nContent-Type: application/x-amz-json-1.1\r\nContent-Length: " +
+                        std::to_string(body.length()) + "\r\n\r\n" + body;
+                    send(conn, resp.data(), resp.length(), MSG_NOSIGNAL);
+                    continue;
+                }
+            }
+            struct pollfd pfd = { conn, POLLIN, 0 };
+            if (poll(&pfd, 1, 50) == 1)
+            {
+                auto rc = recv(conn, buf, sizeof(buf), 0);
+                if (rc <= 0)
+                    break;
+                in.append(buf, rc);
+            }
+        }
+        close(conn);
+    }
+
+    int socket_;
+    std::uint16_t port_;
+    std::vector<std::string> accepted_;
+    std::mutex guard_;
+    std::atomic<unsigned> puts_;
+    std::atomic<bool> stop_;
+    std::thread acceptor_;
+    std::vector<std::thread> handlers_;
+};
+
+}
+
+TEST(cloudwatch_writer, endpoint)
+{
+    setenv("AWS_ACCESS_KEY_ID", "chucho", 0);
+    setenv("AWS_SECRET_ACCESS_KEY", "chucho", 0);
+    cloudwatch_stand_in stand_in;
+    auto fmt = std::make_unique<chucho::pattern_formatter>("%m");
+    chucho::cloudwatch_writer wrt("cloudwatch", std::move(fmt), "Application", "UnitTest", "us-west-1",
+                                  stand_in.get_endpoint(), 10);
+    EXPECT_EQ(stand_in.get_endpoint(), wrt.get_endpoint());
+    for (int i = 0; i < 25; i++)
+    {
+        chucho::event e(chucho::logger::get("will"), chucho::level::INFO_(), "endpoint " + std::to_string(i), __FILE__, __LINE__,
+                        CHUCHO_FUNCTION_NAME);
+        wrt.write(e);
+    }
+    EXPECT_EQ(5, wrt.get_current_batch_size());
+    wrt.flush();
+    EXPECT_EQ(0, wrt.get_current_batch_size());
+    auto accepted = stand_in.get_accepted();
+    // The first batch was throttled once and then accepted
+    ASSERT_EQ(3, accepted.size());
+    EXPECT_EQ(4, stand_in.get_puts());
+    EXPECT_NE(std::string::npos, accepted[0].find("endpoint 0"));
+    EXPECT_NE(std::string::npos, accepted[1].find("endpoint 10"));
+    EXPECT_NE(std::string::npos, accepted[2].find("endpoint 24"));
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#define CHUCHO_MIN_COMPILED_LEVEL CHUCHO_COMPILED_LEVEL_INFO
+
+#include <gtest/gtest.h>
+#include <chucho/log.hpp>
+#include <chucho/pattern_formatter.hpp>
+#include <chucho/marker.hpp>
+#include "string_writer.hpp"
+#include <vector>
+
+namespace
+{
+
+class compiled_level : public ::testing::Test
+{
+public:
+    compiled_level()
+        : lgr_(chucho::logger::get("compiled_level"))
+    {
+        lgr_->set_level(chucho::level::TRACE_());
+        auto wrt = std::make_unique<chucho::test::string_writer>(std::make_unique<chucho::pattern_formatter>("%p %m%n"));
+        wrt_ = wrt.get();
+        lgr_->add_writer(std::move(wrt));
+    }
+
+    ~compiled_level()
+    {
+        chucho::callsites::reset();
+        lgr_->clear_writers();
+        lgr_.reset();
+        chucho::logger::remove_unused_loggers();
+    }
+
+protected:
+    std::shared_ptr<chucho::logger> lgr_;
+    chucho::test::string_writer* wrt_;
+};
+
+int evaluated(int& count)
+{
+    return ++count;
+}
+
+}
+
+TEST_F(compiled_level, not_evaluated)
+{
+    int count = 0;
+    CHUCHO_TRACE(lgr_, "trace " << evaluated(count));
+    CHUCHO_DEBUG(lgr_, "debug " << evaluated(count));
+    CHUCHO_DEBUG_STR(lgr_, std::string("debug ") + std::to_string(evaluated(count)));
+    CHUCHO_DEBUG_M(chucho::marker("mark"), lgr_, "debug " << evaluated(count));
+    CHUCHO_EVERY_N(DEBUG, 1, lgr_, "debug " << evaluated(count));
+    EXPECT_EQ(0, count);
+    CHUCHO_INFO(lgr_, "info " << evaluated(count));
+    EXPECT_EQ(1, count);
+}
+
+TEST_F(compiled_level, stripped)
+{
+    CHUCHO_TRACE(lgr_, "trace");
+    CHUCHO_DEBUG_STR(lgr_, "debug");
+    CHUCHO_INFO(lgr_, "info");
+    CHUCHO_WARN_STR(lgr_, "warn");
+    CHUCHO_EVERY_N(TRACE, 1, lgr_, "trace");
+    CHUCHO_EVERY_N(ERROR, 1, lgr_, "error");
+    auto lines = wrt_->get_lines();
+    ASSERT_EQ(3, lines.size());
+    EXPECT_EQ("INFO info", lines[0]);
+    EXPECT_EQ("WARN warn", lines[1]);
+    EXPECT_EQ("ERROR error", lines[2]);
+    // Stripped statements can't be turned back on at run time
+    chucho::callsites::enable("compiled_level_test.cpp", chucho::level::TRACE_());
+    CHUCHO_TRACE(lgr_, "trace");
+    EXPECT_TRUE(wrt_->get_lines().empty());
+}
@@ -21,6 +21,11 @@
 #include <chucho/cout_writer.hpp>
 #include <chucho/cerr_writer.hpp>
 #include <chucho/regex.hpp>
+#include <chucho/level.hpp>
+#include <chucho/file.hpp>
+#include <fstream>
+#include <iterator>
+#include <thread>
 
 namespace
 {
@@ -133,6 +138,24 @@ TEST_F(configuration, set_yaml)
     EXPECT_NO_THROW(get_logger()->get_writer("chucho::cerr_writer"));
 }
 
+TEST_F(configuration, set_yaml_async_writer)
+{
+    const char* tmpl = R"cfg(
+- chucho::logger:
+    name: LGR
+    chucho::async_writer:
+        chucho::cerr_writer:
+            chucho::pattern_formatter:
+                pattern: '%m%n'
+)cfg";
+    ASSERT_TRUE(set_config(tmpl));
+    auto lgr = get_logger();
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto wrt = &lgr->get_writer("chucho::async_writer");
+    ASSERT_TRUE(set_config(tmpl));
+    EXPECT_EQ(wrt, &lgr->get_writer("chucho::async_writer"));
+}
+
 TEST_F(configuration, set_yaml_error)
 {
     const char* tmpl = R"cfg(
@@ -146,3 +169,91 @@ TEST_F(configuration, set_yaml_error)
     auto wrts = get_logger()->get_writer_names();
     EXPECT_EQ(0, wrts.size());
 }
+
+TEST_F(configuration, set_yaml_keeps_unchanged_writers)
+{
+    const char* tmpl = R"cfg(
+- chucho::logger:
+    name: LGR
+    level: info
+    chucho::cerr_writer:
+        chucho::pattern_formatter:
+            pattern: '%m%n'
+    chucho::cout_writer:
+        chucho::pattern_formatter:
+            pattern: '%m%n'
+)cfg";
+    ASSERT_TRUE(set_config(tmpl));
+    auto lgr = get_logger();
+    auto ce = &lgr->get_writer("chucho::cerr_writer");
+    auto co = &lgr->get_writer("chucho::cout_writer");
+    tmpl = R"cfg(
+- chucho::logger:
+    name: LGR
+    level: warn
+    chucho::cerr_writer:
+        chucho::pattern_formatter:
+            pattern: '%m%n'
+    chucho::cout_writer:
+        chucho::pattern_formatter:
+            pattern: '%p %m%n'
+)cfg";
+    ASSERT_TRUE(set_config(tmpl));
+    EXPECT_EQ(ce, &lgr->get_writer("chucho::cerr_writer"));
+    EXPECT_NE(co, &lgr->get_writer("chucho::cout_writer"));
+    EXPECT_EQ(chucho::level::WARN_(), lgr->get_level());
+    EXPECT_EQ(2, lgr->get_writer_names().size());
+}
+
+#if defined(CHUCHO_HAVE_INOTIFY)
+
+TEST_F(configuration, watch)
+{
+    const char* tmpl = R"cfg(
+- chucho::logger:
+    name: LGR
+    level: LVL
+    chucho::WRT:
+        chucho::pattern_formatter:
+            pattern: '%m%n'
+)cfg";
+    auto write_config = [this, tmpl] (const std::string& file_name, const char* lvl, const char* wrt)
+    {
+        chucho::regex::expression lgr_re("LGR");
+        chucho::regex::expression lvl_re("LVL");
+        chucho::regex::expression wrt_re("WRT");
+        auto cfg = chucho::regex::replace(tmpl, lgr_re, get_logger_name());
+        cfg = chucho::regex::replace(cfg, lvl_re, lvl);
+        cfg = chucho::regex::replace(cfg, wrt_re, wrt);
+        std::ofstream out(file_name.c_str(), std::ios::out | std::ios::trunc);
+        out << cfg;
+    };
+    std::string fn("configuration_watch.yaml");
+    auto orig = chucho::configuration::get_file_name();
+    write_config(fn, "debug", "cout_writer");
+    std::ifstream in(fn.c_str());
+    std::string cfg((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ASSERT_TRUE(chucho::configuration::set(cfg));
+    write_config(fn, "info", "cout_writer");
+    chucho::configuration::set_file_name(fn);
+    ASSERT_TRUE(chucho::configuration::reconfigure());
+    auto lgr = get_logger();
+    EXPECT_EQ(chucho::level::INFO_(), lgr->get_level());
+    EXPECT_NO_THROW(lgr->get_writer("chucho::cout_writer"));
+    ASSERT_TRUE(chucho::configuration::set_watch(true));
+    EXPECT_TRUE(chucho::configuration::is_watching());
+    write_config(fn, "warn", "cerr_writer");
+    auto until = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (lgr->get_level() != chucho::level::WARN_() && std::chrono::steady_clock::now() < until)
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(chucho::level::WARN_(), lgr->get_level());
+    auto names = lgr->get_writer_names();
+    ASSERT_EQ(1, names.size());
+    EXPECT_EQ(std::string("chucho::cerr_writer"), names[0]);
+    EXPECT_TRUE(chucho::configuration::set_watch(false));
+    EXPECT_FALSE(chucho::configuration::is_watching());
+    chucho::configuration::set_file_name(orig);
+    chucho::file::remove(fn);
+}
+
+#endif
@@ -17,6 +17,7 @@
 #include "configurator_test.hpp"
 #include <chucho/logger.hpp>
 #include <chucho/status_manager.hpp>
+#include <chucho/binary_file_writer.hpp>
 #include <chucho/cache_and_release_filter.hpp>
 #include <chucho/cerr_writer.hpp>
 #include <chucho/cout_writer.hpp>
@@ -28,6 +29,8 @@
 #include <chucho/size_file_roll_trigger.hpp>
 #include <chucho/time_file_roller.hpp>
 #include <chucho/duplicate_message_filter.hpp>
+#include <chucho/expression_filter.hpp>
+#include <chucho/regex_filter.hpp>
 #include <chucho/syslog_writer.hpp>
 #include <chucho/json_formatter.hpp>
 #include <chucho/on_start_file_roll_trigger.hpp>
@@ -36,6 +39,7 @@
 #endif
 #if defined(CHUCHO_HAVE_ZLIB)
 #include <chucho/gzip_file_compressor.hpp>
+#include <chucho/gzip_stream_compressor.hpp>
 #endif
 #if defined(CHUCHO_HAVE_LIBARCHIVE)
 #include <chucho/zip_file_compressor.hpp>
@@ -93,6 +97,13 @@
 #if defined(CHUCHO_HAVE_RDKAFKA)
 #include <chucho/kafka_writer.hpp>
 #endif
+#if defined(CHUCHO_HAVE_IO_URING)
+#include <chucho/io_uring_file_writer.hpp>
+#endif
+#if defined(CHUCHO_HAVE_SHM_OPEN)
+#include <chucho/shm_ring_writer.hpp>
+#include <chucho/shm_ring_reader.hpp>
+#endif
 
 namespace chucho
 {
@@ -174,6 +185,68 @@ void configurator::async_writer_with_opts_body()
     EXPECT_FALSE(awrt.get_flush_on_destruct());
 }
 
+void configurator::async_writer_with_shedding_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& awrt = dynamic_cast<chucho::async_writer&>(lgr->get_writer("chucho::async_writer"));
+    auto gov = awrt.get_overload_governor();
+    ASSERT_NE(nullptr, gov);
+    ASSERT_EQ(2, gov->get_watermarks().size());
+    EXPECT_DOUBLE_EQ(0.8, gov->get_watermarks()[0].fullness);
+    EXPECT_EQ(chucho::level::DEBUG_(), gov->get_watermarks()[0].shed);
+    EXPECT_DOUBLE_EQ(0.95, gov->get_watermarks()[1].fullness);
+    EXPECT_EQ(chucho::level::INFO_(), gov->get_watermarks()[1].shed);
+    EXPECT_DOUBLE_EQ(0.05, gov->get_hysteresis());
+}
+
+void configurator::async_writer_with_shards_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& awrt = dynamic_cast<chucho::async_writer&>(lgr->get_writer("chucho::async_writer"));
+    EXPECT_EQ(4, awrt.get_shard_count());
+    EXPECT_EQ(std::string("request_id"), awrt.get_shard_key());
+    EXPECT_EQ(7000, awrt.get_shard_cache_stats(3).get_chunk_size());
+    EXPECT_EQ(&awrt.get_writer(), &awrt.get_writer(3));
+}
+
+void configurator::async_writer_with_thread_settings_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& awrt = dynamic_cast<chucho::async_writer&>(lgr->get_writer("chucho::async_writer"));
+    auto ts = awrt.get_thread_settings();
+    EXPECT_EQ(std::string("bg-log"), ts.get_name());
+    EXPECT_EQ(std::vector<unsigned>({0, 1}), ts.get_affinity());
+    ASSERT_TRUE(ts.get_nice());
+    EXPECT_EQ(5, *ts.get_nice());
+    ASSERT_TRUE(ts.get_scheduling());
+    EXPECT_EQ(chucho::thread_settings::scheduling::BATCH, *ts.get_scheduling());
+    ASSERT_TRUE(ts.get_numa_node());
+    EXPECT_EQ(0, *ts.get_numa_node());
+    auto& fwrt = dynamic_cast<chucho::file_writer&>(awrt.get_writer());
+    ts = fwrt.get_thread_settings();
+    ASSERT_TRUE(ts.get_scheduling());
+    EXPECT_EQ(chucho::thread_settings::scheduling::IDLE, *ts.get_scheduling());
+}
+
+void configurator::binary_file_writer_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& bwrt = dynamic_cast<chucho::binary_file_writer&>(lgr->get_writer("chucho::binary_file_writer"));
+    EXPECT_EQ(std::string("what.clog"), bwrt.get_file_name());
+    EXPECT_EQ(chucho::file_writer::on_start::TRUNCATE, bwrt.get_on_start());
+    EXPECT_FALSE(bwrt.get_flush());
+    ASSERT_NE(nullptr, bwrt.get_file_roller());
+    auto& nrlr = dynamic_cast<chucho::numbered_file_roller&>(*bwrt.get_file_roller());
+    EXPECT_EQ(1, nrlr.get_min_index());
+    EXPECT_EQ(3, nrlr.get_max_index());
+    auto& strg = dynamic_cast<chucho::size_file_roll_trigger&>(*bwrt.get_file_roll_trigger());
+    EXPECT_EQ(100000, strg.get_max_size());
+}
+
 #if defined(CHUCHO_HAVE_BZIP2)
 
 void configurator::bzip2_file_compressor_body()
@@ -201,6 +274,19 @@ void configurator::cache_and_release_filter_body()
     auto stats = flt.get_cache_stats();
     EXPECT_EQ(256 * 1024, stats.get_chunk_size());
     EXPECT_EQ(256 * 1024 * 7, stats.get_max_size());
+    EXPECT_FALSE(flt.is_flight_recorder());
+}
+
+void configurator::cache_and_release_filter_flight_recorder_body()
+{
+    auto& wrt = chucho::logger::get("will")->get_writer("chucho::cout_writer");
+    ASSERT_EQ(1, wrt.get_filter_names().size());
+    auto& flt = dynamic_cast<chucho::cache_and_release_filter&>(wrt.get_filter("chucho::cache_and_release_filter"));
+    EXPECT_EQ(chucho::level::TRACE_(), flt.get_cache_threshold());
+    EXPECT_EQ(chucho::level::ERROR_(), flt.get_release_threshold());
+    EXPECT_TRUE(flt.is_flight_recorder());
+    EXPECT_EQ(500, flt.get_events_per_thread());
+    EXPECT_EQ(std::chrono::milliseconds(10000), flt.get_max_age());
 }
 
 void configurator::cerr_writer_body()
@@ -268,6 +354,25 @@ void configurator::duplicate_message_filter_body()
     ASSERT_EQ(1, wrt.get_filter_names().size());
     auto& flt = dynamic_cast<chucho::duplicate_message_filter&>(wrt.get_filter("chucho::duplicate_message_filter"));
     EXPECT_STREQ("chucho::duplicate_message_filter", flt.get_name().c_str());
+    EXPECT_FALSE(flt.is_fingerprinting());
+}
+
+void configurator::duplicate_message_filter_fingerprint_body()
+{
+    auto& wrt = chucho::logger::get("will")->get_writer("chucho::cout_writer");
+    ASSERT_EQ(1, wrt.get_filter_names().size());
+    auto& flt = dynamic_cast<chucho::duplicate_message_filter&>(wrt.get_filter("chucho::duplicate_message_filter"));
+    EXPECT_TRUE(flt.is_fingerprinting());
+    EXPECT_EQ(64, flt.get_capacity());
+    EXPECT_EQ(std::chrono::milliseconds(30000), flt.get_window());
+}
+
+void configurator::expression_filter_body()
+{
+    auto& wrt = chucho::logger::get("will")->get_writer("chucho::cout_writer");
+    ASSERT_EQ(1, wrt.get_filter_names().size());
+    auto& flt = dynamic_cast<chucho::expression_filter&>(wrt.get_filter("chucho::expression_filter"));
+    EXPECT_EQ(std::string("level >= warn && logger == \"will\""), flt.get_expression());
 }
 
 #if defined(CHUCHO_HAVE_CURL)
@@ -279,6 +384,8 @@ void configurator::email_writer_body()
     auto& ewrt = dynamic_cast<chucho::email_writer&>(lgr->get_writer("chucho::email_writer"));
     EXPECT_EQ(7000, ewrt.get_buffer_capacity());
     EXPECT_EQ(0, ewrt.get_buffer_size());
+    EXPECT_EQ(std::chrono::milliseconds(2500), ewrt.get_coalesce_window());
+    EXPECT_EQ(4, ewrt.get_max_backlog());
     EXPECT_EQ(chucho::email_writer::connection_type::CLEAR, ewrt.get_connection_type());
     EXPECT_STREQ("whistler@mctweaky.com", ewrt.get_from().c_str());
     EXPECT_STREQ("mail.dummy.com", ewrt.get_host().c_str());
@@ -303,6 +410,21 @@ void configurator::loggly_writer_body()
     EXPECT_STREQ("monkey-balls", lwrt.get_token().c_str());
 }
 
+void configurator::loggly_writer_bulk_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& lwrt = dynamic_cast<chucho::loggly_writer&>(lgr->get_writer("chucho::loggly_writer"));
+    EXPECT_STREQ("monkey-balls", lwrt.get_token().c_str());
+    EXPECT_STREQ("http://127.0.0.1:1/bulk", lwrt.get_url().c_str());
+    auto bulk = lwrt.get_bulk_settings();
+    ASSERT_TRUE(bulk);
+    EXPECT_EQ(100, bulk->max_events);
+    EXPECT_EQ(65536, bulk->max_bytes);
+    EXPECT_EQ(250, bulk->linger.count());
+    EXPECT_EQ(4, bulk->max_retry_batches);
+}
+
 #endif
 
 void configurator::file_writer_body()
@@ -315,6 +437,18 @@ void configurator::file_writer_body()
     EXPECT_EQ(chucho::file_writer::on_start::TRUNCATE, fwrt.get_on_start());
 }
 
+void configurator::file_writer_durability_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& fwrt = dynamic_cast<chucho::file_writer&>(lgr->get_writer("chucho::file_writer"));
+    EXPECT_EQ(std::string("hello.log"), fwrt.get_file_name());
+    EXPECT_EQ(chucho::file_writer::durability::GROUP_COMMIT, fwrt.get_durability());
+    ASSERT_TRUE(fwrt.get_sync_level());
+    EXPECT_EQ(*chucho::level::ERROR_(), *fwrt.get_sync_level());
+    EXPECT_EQ(std::chrono::milliseconds(250), fwrt.get_sync_interval());
+}
+
 #if defined(CHUCHO_HAVE_ZLIB)
 
 void configurator::gzip_file_compressor_body()
@@ -329,6 +463,36 @@ void configurator::gzip_file_compressor_body()
     EXPECT_EQ(7, cmp->get_min_index());
 }
 
+void configurator::gzip_file_compressor_threads_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& fwrt = dynamic_cast<chucho::rolling_file_writer&>(lgr->get_writer("chucho::rolling_file_writer"));
+    auto& rlr = fwrt.get_file_roller();
+    auto cmp = rlr.get_file_compressor();
+    ASSERT_TRUE(cmp != nullptr);
+    ASSERT_EQ(typeid(chucho::gzip_file_compressor), typeid(*cmp));
+    EXPECT_EQ(4, cmp->get_threads());
+    EXPECT_EQ(10, cmp->get_nice());
+}
+
+void configurator::gzip_stream_compressor_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& fwrt = dynamic_cast<chucho::rolling_file_writer&>(lgr->get_writer("chucho::rolling_file_writer"));
+    EXPECT_EQ(std::string("what.log.gz"), fwrt.get_file_name());
+    auto cmp = fwrt.get_stream_compressor();
+    ASSERT_TRUE(cmp != nullptr);
+    ASSERT_EQ(typeid(chucho::gzip_stream_compressor), typeid(*cmp));
+    EXPECT_EQ(3, dynamic_cast<chucho::gzip_stream_compressor*>(cmp)->get_compression_level());
+    EXPECT_EQ(4096, fwrt.get_compressed_sync_bytes());
+    EXPECT_EQ(std::chrono::milliseconds(5000), fwrt.get_compressed_sync_interval());
+    auto& strg = dynamic_cast<chucho::size_file_roll_trigger&>(fwrt.get_file_roll_trigger());
+    EXPECT_EQ(1024 * 1024, strg.get_max_size());
+    EXPECT_EQ(10 * 1024 * 1024, strg.get_max_uncompressed_size());
+}
+
 #endif
 
 void configurator::interval_file_roll_trigger_body(const std::string& tmpl)
@@ -373,6 +537,24 @@ void configurator::interval_file_roll_trigger_body(const std::string& tmpl)
     }
 }
 
+#if defined(CHUCHO_HAVE_IO_URING)
+
+void configurator::io_uring_file_writer_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& iwrt = dynamic_cast<chucho::io_uring_file_writer&>(lgr->get_writer("chucho::io_uring_file_writer"));
+    EXPECT_EQ(std::string("hello.log"), iwrt.get_file_name());
+    EXPECT_FALSE(iwrt.get_flush());
+    EXPECT_EQ(4, iwrt.get_buffer_count());
+    EXPECT_EQ(16384, iwrt.get_buffer_size());
+    EXPECT_EQ(std::chrono::milliseconds(500), iwrt.get_sync_interval());
+    EXPECT_EQ(chucho::io_uring_file_writer::sync::FULL, iwrt.get_sync_kind());
+    EXPECT_EQ(nullptr, iwrt.get_file_roller());
+}
+
+#endif
+
 void configurator::json_formatter_body(const std::string& tmpl)
 {
     auto dpos = tmpl.find("DS");
@@ -436,6 +618,21 @@ void configurator::kafka_writer_config_body()
     EXPECT_STREQ("192.168.56.101", kwrt.get_config_value("bootstrap.servers").c_str());
 }
 
+void configurator::kafka_writer_delivery_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& kwrt = dynamic_cast<chucho::kafka_writer&>(lgr->get_writer("chucho::kafka_writer"));
+    auto& settings = kwrt.get_delivery_settings();
+    EXPECT_EQ(50, settings.batch_size);
+    EXPECT_EQ(std::chrono::milliseconds(250), settings.linger);
+    EXPECT_EQ(chucho::kafka_writer::partition_key::DIAGNOSTIC_CONTEXT, settings.key);
+    EXPECT_STREQ("request", settings.key_field.c_str());
+    EXPECT_EQ(chucho::kafka_writer::backpressure_policy::SPILL, settings.backpressure);
+    EXPECT_EQ(std::chrono::milliseconds(750), settings.block_timeout);
+    EXPECT_EQ(0, kwrt.get_discarded());
+}
+
 #endif
 
 void configurator::level_filter_body(const std::string& tmpl)
@@ -618,6 +815,17 @@ void configurator::rabbitmq_writer_capn_proto_body()
 
 #endif
 
+void configurator::regex_filter_body()
+{
+    auto& wrt = chucho::logger::get("will")->get_writer("chucho::cout_writer");
+    ASSERT_EQ(1, wrt.get_filter_names().size());
+    auto& flt = dynamic_cast<chucho::regex_filter&>(wrt.get_filter("chucho::regex_filter"));
+    EXPECT_EQ(std::string("^will\\.[a-z]+$"), flt.get_regex());
+    EXPECT_EQ(chucho::regex_filter::field::LOGGER, flt.get_field());
+    EXPECT_EQ(chucho::filter::result::DENY, flt.get_on_match());
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, flt.get_on_mismatch());
+}
+
 void configurator::rolling_file_writer_body()
 {
     auto lgr = chucho::logger::get("will");
@@ -657,6 +865,24 @@ void configurator::ruby_evaluator_filter_body()
 
 #endif
 
+#if defined(CHUCHO_HAVE_SHM_OPEN)
+
+void configurator::shm_ring_writer_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& sw = dynamic_cast<chucho::shm_ring_writer&>(lgr->get_writer("chucho::shm_ring_writer"));
+    EXPECT_EQ(typeid(chucho::formatted_message_serializer), typeid(sw.get_serializer()));
+    EXPECT_EQ(std::string("/chucho-configurator-test"), sw.get_ring_name());
+    EXPECT_EQ(64, sw.get_slot_count());
+    EXPECT_EQ(128, sw.get_slot_size());
+    EXPECT_EQ(chucho::shm_ring_writer::overflow_policy::DROP, sw.get_overflow_policy());
+    EXPECT_EQ(1, sw.get_coalesce_max());
+    chucho::shm_ring_reader::remove(sw.get_ring_name());
+}
+
+#endif
+
 void configurator::size_file_roll_trigger_body(const std::string& tmpl)
 {
     std::size_t pos = tmpl.find("SIZE");
@@ -776,6 +1002,21 @@ void configurator::syslog_writer_facility_body(const std::string& tmpl)
     }
 }
 
+void configurator::syslog_writer_extended_body()
+{
+    auto lgr = chucho::logger::get("will");
+    ASSERT_EQ(1, lgr->get_writer_names().size());
+    auto& wrt = dynamic_cast<chucho::syslog_writer&>(lgr->get_writer("chucho::syslog_writer"));
+    EXPECT_EQ(chucho::syslog::facility::LOCAL0, wrt.get_facility());
+    EXPECT_EQ(std::string("localhost"), wrt.get_host_name());
+    ASSERT_TRUE(wrt.get_port());
+    EXPECT_EQ(chucho::syslog::DEFAULT_TCP_PORT, *wrt.get_port());
+    EXPECT_EQ(chucho::syslog::transport_protocol::TCP, wrt.get_protocol());
+    EXPECT_EQ(chucho::syslog::message_format::RFC5424, wrt.get_message_format());
+    EXPECT_EQ(20, wrt.get_batch_size());
+    EXPECT_EQ(std::string("origin@32473"), wrt.get_structured_data_id());
+}
+
 void configurator::syslog_writer_port_body()
 {
     auto lgr = chucho::logger::get("will");
@@ -40,10 +40,15 @@ protected:
 #endif
     void async_writer_body();
     void async_writer_with_opts_body();
+    void async_writer_with_shedding_body();
+    void async_writer_with_shards_body();
+    void async_writer_with_thread_settings_body();
+    void binary_file_writer_body();
 #if defined(CHUCHO_HAVE_BZIP2)
     void bzip2_file_compressor_body();
 #endif
     void cache_and_release_filter_body();
+    void cache_and_release_filter_flight_recorder_body();
     void cerr_writer_body();
 #if defined(CHUCHO_HAVE_AWSSDK)
     void cloudwatch_writer_body();
@@ -55,20 +60,30 @@ protected:
     void door_writer_body();
 #endif
     void duplicate_message_filter_body();
+    void duplicate_message_filter_fingerprint_body();
+    void expression_filter_body();
 #if defined(CHUCHO_HAVE_CURL)
     void email_writer_body();
     void loggly_writer_body();
+    void loggly_writer_bulk_body();
 #endif
     void file_writer_body();
+    void file_writer_durability_body();
     virtual chucho::configurator& get_configurator() = 0;
 #if defined(CHUCHO_HAVE_ZLIB)
     void gzip_file_compressor_body();
+    void gzip_file_compressor_threads_body();
+    void gzip_stream_compressor_body();
 #endif
     void interval_file_roll_trigger_body(const std::string& tmpl);
+#if defined(CHUCHO_HAVE_IO_URING)
+    void io_uring_file_writer_body();
+#endif
     void json_formatter_body(const std::string &tmpl);
 #if defined(CHUCHO_HAVE_RDKAFKA)
     void kafka_writer_brokers_body();
     void kafka_writer_config_body();
+    void kafka_writer_delivery_body();
 #endif
     void level_filter_body(const std::string& tmpl);
     void level_threshold_filter_body();
@@ -88,14 +103,19 @@ protected:
     void rabbitmq_writer_capn_proto_body();
 #endif
 #endif
+    void regex_filter_body();
 #if defined(CHUCHO_HAVE_RUBY)
     void ruby_evaluator_filter_body();
 #endif
     void rolling_file_writer_body();
     void root_alias_body();
+#if defined(CHUCHO_HAVE_SHM_OPEN)
+    void shm_ring_writer_body();
+#endif
     void size_file_roll_trigger_body(const std::string& tmpl);
     void sliding_numbered_file_roller_body();
     void syslog_writer_body();
+    void syslog_writer_extended_body();
     void syslog_writer_facility_body(const std::string& tmpl);
     void syslog_writer_port_body();
     void time_file_roller_body();
@@ -37,3 +37,54 @@ TEST(database_writer, one_and_marker)
     }
 }
 
+
+namespace
+{
+
+int count_events(const std::string& connection)
+{
+    soci::session sql(connection);
+    int result;
+    sql << "SELECT COUNT(*) FROM chucho_event", soci::into(result);
+    return result;
+}
+
+void write_batches(chucho::database_writer& wrt, const std::string& connection)
+{
+    auto before = count_events(connection);
+    for (int i = 0; i < 25; i++)
+    {
+        chucho::event e(chucho::logger::get("will"), chucho::level::INFO_(), "batched " + std::to_string(i), __FILE__, __LINE__,
+                        CHUCHO_FUNCTION_NAME);
+        wrt.write(e);
+    }
+    wrt.flush();
+    EXPECT_EQ(before + 25, count_events(connection));
+}
+
+}
+
+TEST(database_writer, batched)
+{
+    auto env = chucho::environment::get("DB_CONNECTION");
+    if (env)
+    {
+        auto fmt = std::make_unique<chucho::pattern_formatter>("%m");
+        chucho::database_writer wrt("database", std::move(fmt), *env, 10);
+        EXPECT_EQ(10, wrt.get_batch_size());
+        EXPECT_FALSE(wrt.is_background());
+        write_batches(wrt, *env);
+    }
+}
+
+TEST(database_writer, background)
+{
+    auto env = chucho::environment::get("DB_CONNECTION");
+    if (env)
+    {
+        auto fmt = std::make_unique<chucho::pattern_formatter>("%m");
+        chucho::database_writer wrt("database", std::move(fmt), *env, 10, std::chrono::milliseconds(50), true);
+        EXPECT_TRUE(wrt.is_background());
+        write_batches(wrt, *env);
+    }
+}
@@ -18,6 +18,7 @@
 #include <chucho/duplicate_message_filter.hpp>
 #include <chucho/logger.hpp>
 #include <chucho/pattern_formatter.hpp>
+#include <thread>
 
 namespace
 {
@@ -96,3 +97,40 @@ TEST_F(duplicate_message_filter_test, evaluate)
     EXPECT_EQ(chucho::filter::result::NEUTRAL, f.evaluate(get_event("one")));
     EXPECT_STREQ("The last message was logged 4 times in a row", get_writer_text().c_str());
 }
+
+TEST_F(duplicate_message_filter_test, fingerprint)
+{
+    chucho::duplicate_message_filter f("dup", logger_->get_writer("string"), 2, std::chrono::seconds(60));
+    EXPECT_TRUE(f.is_fingerprinting());
+    EXPECT_EQ(2, f.get_capacity());
+    EXPECT_EQ(std::chrono::milliseconds(60000), f.get_window());
+    auto one = get_event("one");
+    auto two = get_event("two");
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, f.evaluate(one));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, f.evaluate(two));
+    // Interleaved duplicates are suppressed
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(one));
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(two));
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(one));
+    EXPECT_TRUE(get_writer_text().empty());
+    // "two" is the least recently used, so it is pushed out
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, f.evaluate(get_event("three")));
+    EXPECT_STREQ("The message \"two\" was logged 2 times", get_writer_text().c_str());
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(one));
+    // The same text from a different line is a different message
+    chucho::event other(logger_, chucho::level::INFO_(), "one", __FILE__, __LINE__, __FUNCTION__);
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, f.evaluate(other));
+    EXPECT_TRUE(get_writer_text().empty());
+}
+
+TEST_F(duplicate_message_filter_test, fingerprint_window)
+{
+    chucho::duplicate_message_filter f("dup", logger_->get_writer("string"), 10, std::chrono::milliseconds(200));
+    auto evt = get_event("one");
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, f.evaluate(evt));
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(evt));
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(evt));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, f.evaluate(get_event("two")));
+    EXPECT_STREQ("The message \"one\" was logged 3 times", get_writer_text().c_str());
+}
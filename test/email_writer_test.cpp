@@ -21,6 +21,16 @@
 #include <chucho/level_threshold_email_trigger.hpp>
 #include <chucho/environment.hpp>
 #include <chucho/text_util.hpp>
+#if !defined(CHUCHO_WINDOWS)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#endif
 
 namespace
 {
@@ -118,3 +128,221 @@ TEST_F(email_writer_test, send_one)
     chucho::event evt(get_logger(), chucho::level::ERROR_(), "Hi. This is the email writer.", __FILE__, __LINE__, __FUNCTION__);
     wrt_->write(evt);
 }
+
+#if !defined(CHUCHO_WINDOWS)
+
+namespace
+{
+
+// A stand-in for an SMTP server that accepts every message after
+// waiting for the given delay
+class smtp_stand_in
+{
+public:
+    smtp_stand_in(const std::chrono::milliseconds& delay = std::chrono::milliseconds(0))
+        : socket_(socket(AF_INET, SOCK_STREAM, 0)),
+          delay_(delay),
+          stop_(false)
+    {
+        struct sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(socket_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+        socklen_t len = sizeof(addr);
+        getsockname(socket_, reinterpret_cast<struct sockaddr*>(&addr), &len);
+        port_ = ntohs(addr.sin_port);
+        listen(socket_, 8);
+        acceptor_ = std::thread([this] () { accept_main(); });
+    }
+
+    ~smtp_stand_in()
+    {
+        stop_ = true;
+        acceptor_.join();
+        for (auto& t : handlers_)
+            t.join();
+        close(socket_);
+    }
+
+    std::vector<std::string> get_messages()
+    {
+        std::lock_guard<std::mutex> lg(guard_);
+        return messages_;
+    }
+
+    std::uint16_t get_port() const
+    {
+        return port_;
+    }
+
+private:
+    void accept_main()
+    {
+        while (!stop_)
+        {
+            struct pollfd pfd = { socket_, POLLIN, 0 };
+            if (poll(&pfd, 1, 50) == 1)
+            {
+                int conn = accept(socket_, nullptr, nullptr);
+                handlers_.emplace_back([this, conn] () { handle(conn); });
+            }
+        }
+    }
+
+    void handle(int conn)
+    {
+        reply(conn, "220 localhost ESMTP");
+        std::string in;
+        char buf[4096];
+        bool in_data = false;
+        while (!stop_)
+        {
+            if (in_data)
+            {
+                auto end = in.find("\r\n.\r\n");
+                if (end != std::string::npos)
+                {
+                    std::this_thread::sleep_for(delay_);
+                    {
+                        std::lock_guard<std::mutex> lg(guard_);
+                        messages_.push_back(in.substr(0, end + 2));
+                    }
+                    in.erase(0, end + 5);
+                    in_data = false;
+                    reply(conn, "250 OK");
+                    continue;
+                }
+            }
+            else
+            {
+                auto end = in.find("\r\n");
+                if (end != std::string::npos)
+                {
+                    auto cmd = chucho::text_util::to_lower(in.substr(0, 4));
+                    in.erase(0, end + 2);
+                    if (cmd == "data")
+                    {
+                        in_data = true;
+                        reply(conn, "354 Go ahead");
+                    }
+                    else if (cmd == "quit")
+                    {
+                        reply(conn, "221 Bye");
+                        break;
+                    }
+                    else
+                    {
+                        reply(conn, "250 OK");
+                    }
+                    continue;
+                }
+            }
+            struct pollfd pfd = { conn, POLLIN, 0 };
+            if (poll(&pfd, 1, 50) == 1)
+            {
+                auto rc = recv(conn, buf, sizeof(buf), 0);
+                if (rc <= 0)
+                    break;
+                in.append(buf, rc);
+            }
+        }
+        close(conn);
+    }
+
+    void reply(int conn, const std::string& text)
+    {
+        std::string line = text + "\r\n";
+        send(conn, line.data(), line.length(), MSG_NOSIGNAL);
+    }
+
+    int socket_;
+    std::uint16_t port_;
+    std::chrono::milliseconds delay_;
+    std::vector<std::string> messages_;
+    std::mutex guard_;
+    std::atomic<bool> stop_;
+    std::thread acceptor_;
+    std::vector<std::thread> handlers_;
+};
+
+std::unique_ptr<chucho::email_writer> create_local_writer(const smtp_stand_in& smtp)
+{
+    auto wrt = std::make_unique<chucho::email_writer>("local",
+                                                      std::make_unique<chucho::pattern_formatter>("%m"),
+                                                      "127.0.0.1",
+                                                      chucho::email_writer::connection_type::CLEAR,
+                                                      std::vector<std::string>{ "one@blubbery.com" },
+                                                      "whistler@mctweaky.com",
+                                                      "Trouble in %c",
+                                                      std::make_unique<chucho::level_threshold_email_trigger>(chucho::level::ERROR_()),
+                                                      smtp.get_port());
+    wrt->set_verbose(false);
+    return wrt;
+}
+
+void write_local(chucho::email_writer& wrt, std::shared_ptr<chucho::level> lvl, const std::string& msg)
+{
+    chucho::event evt(chucho::logger::get("email.local"), lvl, msg, __FILE__, __LINE__, __FUNCTION__);
+    wrt.write(evt);
+}
+
+}
+
+TEST(email_writer_local, backlog)
+{
+    smtp_stand_in smtp(std::chrono::milliseconds(300));
+    auto wrt = create_local_writer(smtp);
+    wrt->set_coalesce_window(std::chrono::milliseconds(0));
+    wrt->set_max_backlog(2);
+    EXPECT_EQ(2, wrt->get_max_backlog());
+    for (int i = 0; i < 6; i++)
+        write_local(*wrt, chucho::level::ERROR_(), "Error " + std::to_string(i));
+    wrt->flush();
+    auto msgs = smtp.get_messages();
+    // One is being sent while two wait, and the rest are discarded
+    EXPECT_GE(msgs.size(), 2);
+    EXPECT_LE(msgs.size(), 3);
+    EXPECT_NE(std::string::npos, msgs.back().find("Error 5"));
+}
+
+TEST(email_writer_local, coalesce)
+{
+    smtp_stand_in smtp;
+    auto wrt = create_local_writer(smtp);
+    wrt->set_coalesce_window(std::chrono::minutes(1));
+    write_local(*wrt, chucho::level::INFO_(), "Before");
+    write_local(*wrt, chucho::level::ERROR_(), "First");
+    write_local(*wrt, chucho::level::ERROR_(), "Second");
+    write_local(*wrt, chucho::level::ERROR_(), "Third");
+    EXPECT_EQ(0, wrt->get_buffer_size());
+    wrt->flush();
+    auto msgs = smtp.get_messages();
+    ASSERT_EQ(1, msgs.size());
+    auto before = msgs[0].find("Before\r\n");
+    auto first = msgs[0].find("First\r\n");
+    auto third = msgs[0].find("Third\r\n");
+    ASSERT_NE(std::string::npos, before);
+    ASSERT_NE(std::string::npos, first);
+    ASSERT_NE(std::string::npos, third);
+    EXPECT_LT(before, first);
+    EXPECT_LT(first, third);
+    EXPECT_NE(std::string::npos, msgs[0].find("Subject: Trouble in email.local\r\n"));
+    EXPECT_EQ(0, msgs[0].find("Message-ID: "));
+}
+
+TEST(email_writer_local, does_not_block)
+{
+    smtp_stand_in smtp(std::chrono::seconds(1));
+    auto wrt = create_local_writer(smtp);
+    wrt->set_coalesce_window(std::chrono::milliseconds(0));
+    auto start = std::chrono::steady_clock::now();
+    write_local(*wrt, chucho::level::ERROR_(), "Slow");
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(500));
+    wrt.reset();
+    auto msgs = smtp.get_messages();
+    ASSERT_EQ(1, msgs.size());
+    EXPECT_NE(std::string::npos, msgs[0].find("Slow\r\n"));
+}
+
+#endif
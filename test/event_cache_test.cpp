@@ -193,6 +193,22 @@ TEST(event_cache, serialization)
     EXPECT_STREQ(stream.str().c_str(), e2->get_thread_id()->c_str());
 }
 
+TEST(event_cache, tag)
+{
+    chucho::event_cache cache(1024 * 1024, 10 * 1024 * 1024);
+    chucho::event e1(chucho::logger::get("will"), chucho::level::INFO_(), "one", __FILE__, __LINE__, CHUCHO_FUNCTION_NAME);
+    cache.push(e1, "key one");
+    cache.push(e1);
+    std::string tag;
+    auto e2 = cache.pop(250ms, &tag);
+    ASSERT_TRUE(e2);
+    EXPECT_EQ(std::string("key one"), tag);
+    EXPECT_EQ(std::string("one"), e2->get_message());
+    e2 = cache.pop(250ms, &tag);
+    ASSERT_TRUE(e2);
+    EXPECT_TRUE(tag.empty());
+}
+
 TEST(event_cache, slow_write)
 {
     chucho::event_cache cache(1024 * 1024, 100 * 1024 * 1024);
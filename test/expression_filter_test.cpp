@@ -0,0 +1,147 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chucho/expression_filter.hpp>
+#include <chucho/logger.hpp>
+#include <chucho/diagnostic_context.hpp>
+#include <chucho/exception.hpp>
+
+namespace
+{
+
+class expression_filter_test : public ::testing::Test
+{
+public:
+    expression_filter_test()
+        : logger_(chucho::logger::get("expression_filter_test.child"))
+    {
+    }
+
+    chucho::event get_event(const std::string& msg)
+    {
+        return chucho::event(logger_, chucho::level::INFO_(), msg, __FILE__, __LINE__, "monkey", "marky");
+    }
+
+    chucho::filter::result evaluate(const std::string& expr, const std::string& msg = "hello there")
+    {
+        chucho::expression_filter flt("expr", expr);
+        return flt.evaluate(get_event(msg));
+    }
+
+private:
+    std::shared_ptr<chucho::logger> logger_;
+};
+
+}
+
+TEST_F(expression_filter_test, boolean)
+{
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("true"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("false"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("true && !false"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("true and not true"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("false || true"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("false or (true and true)"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("!(false || true)"));
+    // && binds more tightly than ||
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("true || false && false"));
+}
+
+TEST_F(expression_filter_test, context)
+{
+    chucho::diagnostic_context::at("expression_filter_test") = "will";
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("context(\"expression_filter_test\")"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("context(\"expression_filter_test\") == \"will\""));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("context(\"expression_filter_test\") != \"will\""));
+    chucho::diagnostic_context::erase("expression_filter_test");
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("context(\"expression_filter_test\")"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("context(\"expression_filter_test\") == \"will\""));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("context(\"expression_filter_test\") != \"will\""));
+    EXPECT_TRUE(chucho::diagnostic_context::find("expression_filter_test") == nullptr);
+}
+
+TEST_F(expression_filter_test, file_name)
+{
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate(std::string("file_name == '") + __FILE__ + "'"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("file_name ends_with 'expression_filter_test.cpp'"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("file_name matches 'filter_test\\\\.cpp$'"));
+}
+
+TEST_F(expression_filter_test, function)
+{
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("function == 'monkey'"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("function == 'monk'"));
+}
+
+TEST_F(expression_filter_test, invalid)
+{
+    EXPECT_THROW(evaluate(""), chucho::exception);
+    EXPECT_THROW(evaluate("level >= monkey"), chucho::exception);
+    EXPECT_THROW(evaluate("level contains 'info'"), chucho::exception);
+    EXPECT_THROW(evaluate("message == 'unterminated"), chucho::exception);
+    EXPECT_THROW(evaluate("message == 'a' &&"), chucho::exception);
+    EXPECT_THROW(evaluate("(true"), chucho::exception);
+    EXPECT_THROW(evaluate("true true"), chucho::exception);
+    EXPECT_THROW(evaluate("monkey == 'a'"), chucho::exception);
+    EXPECT_THROW(evaluate("line_number > 'a'"), chucho::exception);
+    EXPECT_THROW(evaluate("line_number > 99999999999999999999"), chucho::exception);
+    EXPECT_THROW(evaluate("message matches '('"), chucho::exception);
+}
+
+TEST_F(expression_filter_test, level)
+{
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("level == info"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("level == 'INFO'"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("level >= debug"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("level >= warn"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("level < error"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("level != info"));
+}
+
+TEST_F(expression_filter_test, line_number)
+{
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("line_number > 0"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("line_number == 0"));
+}
+
+TEST_F(expression_filter_test, logger)
+{
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("logger == 'expression_filter_test.child'"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("logger starts_with 'expression_filter_test.'"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("logger starts_with 'other.'"));
+}
+
+TEST_F(expression_filter_test, marker)
+{
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("marker"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("marker == 'marky'"));
+    chucho::expression_filter flt("expr", "marker");
+    chucho::event evt(chucho::logger::get("expression_filter_test"), chucho::level::INFO_(), "hi", __FILE__, __LINE__, "monkey");
+    EXPECT_EQ(chucho::filter::result::DENY, flt.evaluate(evt));
+}
+
+TEST_F(expression_filter_test, message)
+{
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("message == \"hello there\""));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("message contains 'lo th'"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("message contains 'goodbye'"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("message starts_with 'hello'"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("message ends_with 'there'"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("message matches '^h.*o t'"));
+    EXPECT_EQ(chucho::filter::result::DENY, evaluate("message matches '^there'"));
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, evaluate("message == 'it\\'s'", "it's"));
+}
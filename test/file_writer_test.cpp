@@ -17,11 +17,14 @@
 #include <gtest/gtest.h>
 #include <chucho/file_writer.hpp>
 #include <chucho/file.hpp>
+#include <chucho/line_ending.hpp>
 #include <chucho/pattern_formatter.hpp>
 #include <chucho/logger.hpp>
 #include <chucho/status_manager.hpp>
 #include <fstream>
+#include <cstring>
 #include <thread>
+#include <vector>
 #if defined(CHUCHO_WINDOWS)
 #include <windows.h>
 #endif
@@ -91,6 +94,74 @@ void make_writeable(const std::string& file_name)
 
 }
 
+TEST_F(file_writer_test, durability_group_commit)
+{
+    auto w = get_writer();
+    w->set_durability(chucho::file_writer::durability::GROUP_COMMIT);
+    EXPECT_EQ(chucho::file_writer::durability::GROUP_COMMIT, w->get_durability());
+    EXPECT_FALSE(w->get_sync_level());
+    chucho::file_writer* fw = w.get();
+    std::shared_ptr<chucho::logger> log = chucho::logger::get("file_writer_test.group_commit");
+    log->add_writer(std::move(w));
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; i++)
+    {
+        threads.emplace_back([log] ()
+        {
+            for (int j = 0; j < 50; j++)
+                log->write(chucho::event(log, chucho::level::INFO_(), "hello", __FILE__, __LINE__, __FUNCTION__));
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    auto lat = fw->get_sync_latency();
+    // Every event waited for a sync, but the threads logging through
+    // the same logger shared some of them
+    EXPECT_GE(lat.count, 50U);
+    EXPECT_LT(lat.count, 400U);
+    EXPECT_LE(lat.last, lat.max);
+    EXPECT_LE(lat.max, lat.total);
+    log->clear_writers();
+    EXPECT_EQ(400 * (5 + std::strlen(chucho::line_ending::EOL)), chucho::file::size(file_name_));
+}
+
+TEST_F(file_writer_test, durability_interval)
+{
+    auto w = get_writer();
+    EXPECT_THROW(w->set_durability(chucho::file_writer::durability::INTERVAL), std::invalid_argument);
+    w->set_durability(chucho::file_writer::durability::INTERVAL, std::chrono::milliseconds(10));
+    EXPECT_EQ(std::chrono::milliseconds(10), w->get_sync_interval());
+    EXPECT_EQ(0, w->get_sync_latency().count);
+    std::shared_ptr<chucho::logger> log = chucho::logger::get("file_writer_test");
+    w->write(chucho::event(log, chucho::level::INFO_(), "hello", __FILE__, __LINE__, __FUNCTION__));
+    for (int i = 0; i < 200 && w->get_sync_latency().count == 0; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(1, w->get_sync_latency().count);
+    // Nothing new has been written, so there is nothing to sync
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(1, w->get_sync_latency().count);
+}
+
+TEST_F(file_writer_test, durability_level)
+{
+    auto f = std::make_unique<chucho::pattern_formatter>("%m%n");
+    auto w = std::make_unique<chucho::file_writer>("fw", std::move(f), file_name_, chucho::file_writer::on_start::APPEND, false);
+    EXPECT_EQ(chucho::file_writer::durability::NONE, w->get_durability());
+    EXPECT_THROW(w->set_durability(chucho::file_writer::durability::LEVEL), std::invalid_argument);
+    w->set_durability(chucho::file_writer::durability::LEVEL, std::chrono::milliseconds(0), chucho::level::ERROR_());
+    EXPECT_EQ(*chucho::level::ERROR_(), *w->get_sync_level());
+    std::shared_ptr<chucho::logger> log = chucho::logger::get("file_writer_test");
+    w->write(chucho::event(log, chucho::level::INFO_(), "hello", __FILE__, __LINE__, __FUNCTION__));
+    EXPECT_EQ(0, w->get_sync_latency().count);
+    EXPECT_EQ(0, chucho::file::size(file_name_));
+    w->write(chucho::event(log, chucho::level::ERROR_(), "goodbye", __FILE__, __LINE__, __FUNCTION__));
+    EXPECT_EQ(1, w->get_sync_latency().count);
+    // The writer's buffer was flushed so that the error could be synced
+    EXPECT_EQ(12 + 2 * std::strlen(chucho::line_ending::EOL), chucho::file::size(file_name_));
+    w->write(chucho::event(log, chucho::level::FATAL_(), "fatal", __FILE__, __LINE__, __FUNCTION__));
+    EXPECT_EQ(2, w->get_sync_latency().count);
+}
+
 TEST_F(file_writer_test, error)
 {
     chucho::file::create_directory(file_name_);
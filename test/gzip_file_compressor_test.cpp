@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <chucho/gzip_file_compressor.hpp>
 #include <chucho/file.hpp>
+#include <zlib.h>
 #include <fstream>
 #include <algorithm>
 #include <random>
@@ -37,6 +38,36 @@ void make_file(const std::string& name)
     }
 }
 
+std::string make_big_file(const std::string& name)
+{
+    std::string text;
+    std::string chars("abcdefghijklmnopqrstuvxyzABCDEFGHIJKLMNOPQRSTUVXYZ");
+    std::mt19937 gen(7);
+    while (text.length() < 3 * 1024 * 1024)
+    {
+        std::shuffle(chars.begin(), chars.end(), gen);
+        text += chars;
+    }
+    std::ofstream stream(name.c_str(), std::ios::out | std::ios::binary);
+    stream << text;
+    return text;
+}
+
+std::string gunzip(const std::string& name)
+{
+    std::string result;
+    gzFile gz = gzopen(name.c_str(), "rb");
+    if (gz != nullptr)
+    {
+        char buf[8192];
+        int num;
+        while ((num = gzread(gz, buf, sizeof(buf))) > 0)
+            result.append(buf, num);
+        gzclose(gz);
+    }
+    return result;
+}
+
 }
 
 TEST(gzip_file_compressor, compress)
@@ -53,3 +84,19 @@ TEST(gzip_file_compressor, compress)
     EXPECT_TRUE(chucho::file::exists(name));
     chucho::file::remove(name);
 }
+
+TEST(gzip_file_compressor, parallel)
+{
+    std::string name("gzip_file_compressor_parallel_test");
+    std::string text = make_big_file(name);
+    chucho::gzip_file_compressor gz(1);
+    gz.set_threads(3);
+    EXPECT_EQ(3, gz.get_threads());
+    ASSERT_NO_THROW(gz.compress(name));
+    EXPECT_FALSE(chucho::file::exists(name));
+    name += ".gz";
+    ASSERT_TRUE(chucho::file::exists(name));
+    // Each block is its own gzip member, which gzread reads through
+    EXPECT_EQ(text, gunzip(name));
+    chucho::file::remove(name);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chucho/gzip_stream_compressor.hpp>
+#include <cstring>
+
+namespace
+{
+
+// Inflate whatever is available, returning the result of the last call
+// to inflate. The window bits of 15 + 32 accept a gzip header.
+int gunzip(const std::vector<std::uint8_t>& in, std::string& out)
+{
+    z_stream z;
+    std::memset(&z, 0, sizeof(z));
+    z.zalloc = Z_NULL;
+    z.zfree = Z_NULL;
+    z.opaque = Z_NULL;
+    int rc = inflateInit2(&z, 15 + 32);
+    if (rc != Z_OK)
+        return rc;
+    z.next_in = const_cast<std::uint8_t*>(in.data());
+    z.avail_in = in.size();
+    char buf[1024];
+    while (z.avail_in > 0)
+    {
+        z.next_out = reinterpret_cast<Bytef*>(buf);
+        z.avail_out = sizeof(buf);
+        rc = inflate(&z, Z_SYNC_FLUSH);
+        out.append(buf, sizeof(buf) - z.avail_out);
+        if (rc == Z_STREAM_END && z.avail_in > 0)
+            rc = inflateReset(&z);
+        if (rc != Z_OK && rc != Z_STREAM_END)
+            break;
+    }
+    inflateEnd(&z);
+    return rc;
+}
+
+}
+
+TEST(gzip_stream_compressor, bad_level)
+{
+    EXPECT_THROW(chucho::gzip_stream_compressor(10), std::invalid_argument);
+    EXPECT_EQ(4, chucho::gzip_stream_compressor(4).get_compression_level());
+}
+
+TEST(gzip_stream_compressor, finish)
+{
+    chucho::gzip_stream_compressor cmp;
+    std::vector<std::uint8_t> out;
+    cmp.finish(out);
+    EXPECT_TRUE(out.empty());
+    std::string one("one:hello\n");
+    cmp.compress(one.data(), one.length(), out);
+    cmp.finish(out);
+    ASSERT_GT(out.size(), 2);
+    EXPECT_EQ(0x1f, out[0]);
+    EXPECT_EQ(0x8b, out[1]);
+    std::string text;
+    EXPECT_EQ(Z_STREAM_END, gunzip(out, text));
+    EXPECT_EQ(one, text);
+    std::size_t member = out.size();
+    std::string two("two:hello\n");
+    cmp.compress(two.data(), two.length(), out);
+    cmp.finish(out);
+    ASSERT_GT(out.size(), member + 2);
+    EXPECT_EQ(0x1f, out[member]);
+    EXPECT_EQ(0x8b, out[member + 1]);
+    text.clear();
+    EXPECT_EQ(Z_STREAM_END, gunzip(out, text));
+    EXPECT_EQ(one + two, text);
+}
+
+TEST(gzip_stream_compressor, sync)
+{
+    chucho::gzip_stream_compressor cmp;
+    std::vector<std::uint8_t> out;
+    std::string expected;
+    for (int i = 0; i < 1000; i++)
+    {
+        std::string line = "line " + std::to_string(i) + "\n";
+        cmp.compress(line.data(), line.length(), out);
+        expected += line;
+    }
+    cmp.sync(out);
+    std::size_t synced = out.size();
+    cmp.sync(out);
+    EXPECT_EQ(synced, out.size());
+    std::string text;
+    EXPECT_EQ(Z_OK, gunzip(out, text));
+    EXPECT_EQ(expected, text);
+    cmp.finish(out);
+    text.clear();
+    EXPECT_EQ(Z_STREAM_END, gunzip(out, text));
+    EXPECT_EQ(expected, text);
+}
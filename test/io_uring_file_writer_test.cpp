@@ -0,0 +1,203 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chucho/io_uring_file_writer.hpp>
+#include <chucho/numbered_file_roller.hpp>
+#include <chucho/size_file_roll_trigger.hpp>
+#include <chucho/pattern_formatter.hpp>
+#include <chucho/file.hpp>
+#include <chucho/logger.hpp>
+#include <chucho/status_manager.hpp>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+
+class io_uring_file_writer_test : public ::testing::Test
+{
+protected:
+    io_uring_file_writer_test()
+        : logger_(chucho::logger::get("io_uring_file_writer_test")),
+          dir_name_("io_uring_file_writer_test")
+    {
+        if (chucho::file::exists(dir_name_))
+            chucho::file::remove_all(dir_name_);
+        chucho::file::create_directory(dir_name_);
+        chucho::status_manager::get().clear();
+    }
+
+    ~io_uring_file_writer_test()
+    {
+        try
+        {
+            chucho::file::remove_all(dir_name_);
+        }
+        catch (...)
+        {
+        }
+    }
+
+    chucho::event get_event(const std::string& msg)
+    {
+        return chucho::event(logger_, chucho::level::INFO_(), msg, __FILE__, __LINE__, __FUNCTION__);
+    }
+
+    std::string get_file_name(const std::string& base)
+    {
+        return dir_name_ + chucho::file::dir_sep + base;
+    }
+
+    std::vector<std::string> get_lines(const std::string& file_name)
+    {
+        std::vector<std::string> result;
+        std::ifstream stream(file_name);
+        std::string line;
+        while (std::getline(stream, line))
+            result.push_back(line);
+        return result;
+    }
+
+    std::unique_ptr<chucho::formatter> get_formatter()
+    {
+        return std::make_unique<chucho::pattern_formatter>("%m%n");
+    }
+
+    std::shared_ptr<chucho::logger> logger_;
+    std::string dir_name_;
+};
+
+}
+
+TEST_F(io_uring_file_writer_test, append)
+{
+    std::string fn = get_file_name("append");
+    {
+        chucho::io_uring_file_writer w("uring", get_formatter(), fn);
+        w.write(get_event("one"));
+    }
+    {
+        chucho::io_uring_file_writer w("uring", get_formatter(), fn);
+        w.write(get_event("two"));
+    }
+    auto lines = get_lines(fn);
+    ASSERT_EQ(2, lines.size());
+    EXPECT_EQ(std::string("one"), lines[0]);
+    EXPECT_EQ(std::string("two"), lines[1]);
+}
+
+TEST_F(io_uring_file_writer_test, buffered)
+{
+    std::string fn = get_file_name("buffered");
+    {
+        // Small buffers that fill often and messages that span them
+        chucho::io_uring_file_writer w("uring", get_formatter(), fn, chucho::file_writer::on_start::TRUNCATE, false, 2, 512);
+        EXPECT_EQ(2, w.get_buffer_count());
+        EXPECT_EQ(512, w.get_buffer_size());
+        for (int i = 0; i < 2000; i++)
+            w.write(get_event(std::to_string(i) + std::string(i % 700, 'x')));
+    }
+    auto lines = get_lines(fn);
+    ASSERT_EQ(2000, lines.size());
+    for (int i = 0; i < 2000; i++)
+        EXPECT_EQ(std::to_string(i) + std::string(i % 700, 'x'), lines[i]);
+}
+
+TEST_F(io_uring_file_writer_test, removed)
+{
+    std::string fn = get_file_name("removed");
+    {
+        chucho::io_uring_file_writer w("uring", get_formatter(), fn, chucho::file_writer::on_start::TRUNCATE, false);
+        for (int i = 0; i < 10; i++)
+            w.write(get_event("old"));
+        chucho::file::remove(fn);
+        std::this_thread::sleep_for(std::chrono::seconds(4));
+        // The held writes go to the removed file, not the new one
+        w.write(get_event("new"));
+    }
+    auto lines = get_lines(fn);
+    ASSERT_EQ(1, lines.size());
+    EXPECT_EQ(std::string("new"), lines[0]);
+}
+
+TEST_F(io_uring_file_writer_test, rolling)
+{
+    std::string fn = get_file_name("rolling");
+    {
+        auto trig = std::make_unique<chucho::size_file_roll_trigger>(5);
+        auto roll = std::make_unique<chucho::numbered_file_roller>(1, 5);
+        chucho::io_uring_file_writer w("uring", get_formatter(), fn, std::move(roll), std::move(trig));
+        ASSERT_NE(nullptr, w.get_file_roller());
+        for (int i = 0; i < 4; i++)
+            w.write(get_event(std::to_string(i) + ":hello"));
+    }
+    // The size on disk may lag behind what has been written, so
+    // the number of rolls can vary, but nothing may be lost or
+    // reordered.
+    std::vector<std::string> all;
+    for (int i = 5; i > 0; i--)
+    {
+        for (auto& line : get_lines(fn + "." + std::to_string(i)))
+            all.push_back(line);
+    }
+    for (auto& line : get_lines(fn))
+        all.push_back(line);
+    ASSERT_EQ(4, all.size());
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(std::to_string(i) + ":hello", all[i]);
+}
+
+TEST_F(io_uring_file_writer_test, sync)
+{
+    std::string fn = get_file_name("sync");
+    {
+        chucho::io_uring_file_writer w("uring", get_formatter(), fn, chucho::file_writer::on_start::TRUNCATE, false);
+        w.set_sync_interval(std::chrono::milliseconds(1), chucho::io_uring_file_writer::sync::FULL);
+        EXPECT_EQ(std::chrono::milliseconds(1), w.get_sync_interval());
+        EXPECT_EQ(chucho::io_uring_file_writer::sync::FULL, w.get_sync_kind());
+        for (int i = 0; i < 20; i++)
+        {
+            w.write(get_event(std::to_string(i)));
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+    EXPECT_EQ(20, get_lines(fn).size());
+    EXPECT_LT(chucho::status_manager::get().get_level(), chucho::status::level::WARNING_);
+}
+
+TEST_F(io_uring_file_writer_test, sync_idle)
+{
+    std::string fn = get_file_name("sync_idle");
+    chucho::io_uring_file_writer w("uring", get_formatter(), fn, chucho::file_writer::on_start::TRUNCATE, false);
+    if (!w.is_using_ring())
+        return;
+    w.set_sync_interval(std::chrono::milliseconds(50));
+    w.write(get_event("one"));
+    w.write(get_event("two"));
+    // Nothing else is written, but the last writes are still synced
+    auto until = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (w.get_sync_count() == 0 && std::chrono::steady_clock::now() < until)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(1, w.get_sync_count());
+    auto lines = get_lines(fn);
+    ASSERT_EQ(2, lines.size());
+    EXPECT_EQ(std::string("one"), lines[0]);
+    EXPECT_EQ(std::string("two"), lines[1]);
+    // Once synced, an idle writer does not sync again
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(1, w.get_sync_count());
+}
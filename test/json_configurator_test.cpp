@@ -45,6 +45,29 @@ json_configurator::json_configurator()
 
 }
 
+TEST_F(json_configurator, async_writer_with_shedding)
+{
+    configure(R"cnf(
+{
+    "chucho_loggers" : {
+        "will" : {
+            "writers" : [{
+                "chucho::async_writer" : {
+                    "chucho::file_writer" : {
+                        "chucho::pattern_formatter" : { "pattern" : "%m%n" },
+                        "file_name" : "hello.log"
+                    },
+                    "shed_watermarks" : "80:DEBUG,95:INFO",
+                    "shed_hysteresis" : 5
+                }
+            }]
+        }
+    }
+}
+)cnf");
+    async_writer_with_shedding_body();
+}
+
 TEST_F(json_configurator, cerr_writer)
 {
     configure(R"cnf(
@@ -82,6 +105,81 @@ TEST_F(json_configurator, duplicate_message_filter)
     duplicate_message_filter_body();
 }
 
+TEST_F(json_configurator, duplicate_message_filter_fingerprint)
+{
+    configure(R"cnf(
+{
+    "chucho_loggers" : {
+        "will" : {
+            "writers" : [{
+                "chucho::cout_writer" : {
+                    "chucho::pattern_formatter" : { "pattern" : "%m%n" },
+                    "chucho::duplicate_message_filter" : {
+                        "fingerprint" : true,
+                        "capacity" : 64,
+                        "window" : 30
+                    }
+                }
+            }]
+        }
+    }
+}
+)cnf");
+    duplicate_message_filter_fingerprint_body();
+}
+
+TEST_F(json_configurator, expression_filter)
+{
+    configure(R"cnf(
+{
+    "chucho_loggers" : {
+        "will" : {
+            "writers" : [{
+                "chucho::cout_writer" : {
+                    "chucho::pattern_formatter" : { "pattern" : "%m%n" },
+                    "chucho::expression_filter" : {
+                        "expression" : "level >= warn && logger == \"will\""
+                    }
+                }
+            }]
+        }
+    }
+}
+)cnf");
+    expression_filter_body();
+}
+
+#if defined(CHUCHO_HAVE_ZLIB)
+
+TEST_F(json_configurator, gzip_stream_compressor)
+{
+    configure(R"cnf(
+{
+    "chucho_loggers" : {
+        "will" : {
+            "writers" : [{
+                "chucho::rolling_file_writer" : {
+                    "chucho::pattern_formatter" : { "pattern" : "%m%n" },
+                    "chucho::numbered_file_roller" : { "max_index" : 5 },
+                    "chucho::size_file_roll_trigger" : {
+                        "max_size" : "1MB",
+                        "max_uncompressed_size" : "10MB"
+                    },
+                    "chucho::gzip_stream_compressor" : { "compression_level" : 3 },
+                    "compressed_sync_bytes" : 4096,
+                    "compressed_sync_interval" : 5000,
+                    "file_name" : "what.log.gz"
+                }
+            }]
+        }
+    }
+}
+)cnf");
+    gzip_stream_compressor_body();
+}
+
+#endif
+
 TEST_F(json_configurator, logger)
 {
     configure(R"cnf(
@@ -151,6 +249,30 @@ configure(R"cnf(
     multiple_writer_body();
 }
 
+TEST_F(json_configurator, regex_filter)
+{
+    configure(R"cnf(
+{
+    "chucho_loggers" : {
+        "will" : {
+            "writers" : [{
+                "chucho::cout_writer" : {
+                    "chucho::pattern_formatter" : { "pattern" : "%m%n" },
+                    "chucho::regex_filter" : {
+                        "regex" : "^will\\.[a-z]+$",
+                        "field" : "logger",
+                        "on_match" : "deny",
+                        "on_mismatch" : "neutral"
+                    }
+                }
+            }]
+        }
+    }
+}
+)cnf");
+    regex_filter_body();
+}
+
 TEST_F(json_configurator, rolling_file_writer)
 {
     configure(R"cnf(
@@ -195,3 +317,29 @@ TEST_F(json_configurator, root_alias)
 )cnf");
     root_alias_body();
 }
+
+#if !defined(CHUCHO_WINDOWS)
+TEST_F(json_configurator, syslog_writer_extended)
+{
+    configure(R"cnf(
+{
+    "chucho_loggers" : {
+        "will" : {
+            "writers" : [{
+                "chucho::syslog_writer" : {
+                    "chucho::pattern_formatter" : { "pattern" : "%m%n" },
+                    "facility" : "LOCAL0",
+                    "host_name" : "localhost",
+                    "protocol" : "tcp",
+                    "format" : "rfc5424",
+                    "batch_size" : 20,
+                    "structured_data_id" : "origin@32473"
+                }
+            }]
+        }
+    }
+}
+)cnf");
+    syslog_writer_extended_body();
+}
+#endif
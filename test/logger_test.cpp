@@ -19,6 +19,7 @@
 #include <chucho/pattern_formatter.hpp>
 #include <chucho/cout_writer.hpp>
 #include <chucho/cerr_writer.hpp>
+#include <chucho/diagnostic_context.hpp>
 #include <algorithm>
 
 class log_test : public ::testing::Test
@@ -30,6 +31,29 @@ public:
     }
 };
 
+namespace
+{
+
+class changing_writer : public chucho::writer
+{
+public:
+    changing_writer(const std::string& name, const std::string& pattern)
+        : chucho::writer(name, std::make_unique<chucho::pattern_formatter>(pattern))
+    {
+    }
+
+    std::vector<std::string> texts;
+
+protected:
+    virtual void write_impl(const chucho::event& evt) override
+    {
+        texts.push_back(formatter_->format(evt));
+        chucho::diagnostic_context::at("format_once") += "x";
+    }
+};
+
+}
+
 namespace one
 {
 
@@ -67,6 +91,38 @@ TEST_F(log_test, existing_loggers)
                               [](std::shared_ptr<chucho::logger> l) { return l->get_name() ==  "eight.nine.ten.eleven"; }) == all.end());
 }
 
+TEST_F(log_test, format_once)
+{
+    chucho::diagnostic_context::at("format_once") = "x";
+    auto parent = chucho::logger::get("format_once");
+    auto child = chucho::logger::get("format_once.child");
+    auto first = std::make_unique<changing_writer>("first", "%C{format_once}");
+    auto second = std::make_unique<changing_writer>("second", "%C{format_once}");
+    auto other = std::make_unique<changing_writer>("other", "%C{format_once} ");
+    auto first_texts = &first->texts;
+    auto second_texts = &second->texts;
+    auto other_texts = &other->texts;
+    child->add_writer(std::move(first));
+    child->add_writer(std::move(other));
+    parent->add_writer(std::move(second));
+    child->write(chucho::event(child, chucho::level::INFO_(), "hi", __FILE__, __LINE__, __FUNCTION__));
+    ASSERT_EQ(1, first_texts->size());
+    ASSERT_EQ(1, second_texts->size());
+    ASSERT_EQ(1, other_texts->size());
+    // The writer with the same pattern, even though it belongs to
+    // an ancestor, does not format the event again
+    EXPECT_EQ("x", first_texts->at(0));
+    EXPECT_EQ("x", second_texts->at(0));
+    EXPECT_EQ("xx ", other_texts->at(0));
+    child->write(chucho::event(child, chucho::level::INFO_(), "hi", __FILE__, __LINE__, __FUNCTION__));
+    ASSERT_EQ(2, first_texts->size());
+    EXPECT_EQ("xxxx", first_texts->at(1));
+    EXPECT_EQ("xxxx", second_texts->at(1));
+    child->reset();
+    parent->reset();
+    chucho::diagnostic_context::erase("format_once");
+}
+
 TEST_F(log_test, levels)
 {
     std::shared_ptr<chucho::logger> root = chucho::logger::get("");
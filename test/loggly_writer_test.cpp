@@ -20,6 +20,18 @@
 #include <chucho/pattern_formatter.hpp>
 #include <chucho/logger.hpp>
 #include <chucho/function_name.hpp>
+#if !defined(CHUCHO_WINDOWS)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
 
 TEST(loggly_writer, many)
 {
@@ -53,3 +65,202 @@ TEST(loggly_writer, one)
     chucho::event e(chucho::logger::get("will"), chucho::level::INFO_(), "Hello, World!", __FILE__, __LINE__, CHUCHO_FUNCTION_NAME);
     wrt.write(e);
 }
+
+#if !defined(CHUCHO_WINDOWS)
+
+namespace
+{
+
+// A stand-in for Loggly that answers each request with the next
+// status in its list, or 200 when the list is used up
+class http_stand_in
+{
+public:
+    http_stand_in(std::vector<int>&& statuses = std::vector<int>())
+        : socket_(socket(AF_INET, SOCK_STREAM, 0)),
+          statuses_(std::move(statuses)),
+          connections_(0),
+          stop_(false)
+    {
+        struct sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(socket_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+        socklen_t len = sizeof(addr);
+        getsockname(socket_, reinterpret_cast<struct sockaddr*>(&addr), &len);
+        port_ = ntohs(addr.sin_port);
+        listen(socket_, 8);
+        acceptor_ = std::thread([this] () { accept_main(); });
+    }
+
+    ~http_stand_in()
+    {
+        stop_ = true;
+        acceptor_.join();
+        for (auto& t : handlers_)
+            t.join();
+        close(socket_);
+    }
+
+    std::vector<std::string> get_bodies()
+    {
+        std::lock_guard<std::mutex> lg(guard_);
+        return bodies_;
+    }
+
+    unsigned get_connections() const
+    {
+        return connections_;
+    }
+
+    std::string get_url() const
+    {
+        return "http://127.0.0.1:" + std::to_string(port_) + "/bulk/token/tag/bulk/";
+    }
+
+private:
+    void accept_main()
+    {
+        while (!stop_)
+        {
+            struct pollfd pfd = { socket_, POLLIN, 0 };
+            if (poll(&pfd, 1, 50) == 1)
+            {
+                int conn = accept(socket_, nullptr, nullptr);
+                ++connections_;
+                handlers_.emplace_back([this, conn] () { handle(conn); });
+            }
+        }
+    }
+
+    void handle(int conn)
+    {
+        std::string in;
+        char buf[4096];
+        while (!stop_)
+        {
+            auto end = in.find("\r\n\r\n");
+            if (end != std::string::npos)
+            {
+                std::size_t length = 0;
+                auto cl = in.find("Content-Length: ");
+                if (cl != std::string::npos && cl < end)
+                    length = std::stoul(in.substr(cl + 16));
+                if (in.length() >= end + 4 + length)
+                {
+                    int status = 200;
+                    {
+                        std::lock_guard<std::mutex> lg(guard_);
+                        if (next_status_ < statuses_.size())
+                            status = statuses_[next_status_++];
+                        if (status == 200)
+                            bodies_.push_back(in.substr(end + 4, length));
+                    }
+                    in.erase(0, end + 4 + length);
+                    std::string body = status == 200 ? "{\"response\" : \"ok\"}" : "{}";
+                    auto resp = "HTTP/1.1 " + std::to_string(status) + " Whatever\r\nContent-Length: " +
+                        std::to_string(body.length()) + "\r\n\r\n" + body;
+                    send(conn, resp.data(), resp.length(), MSG_NOSIGNAL);
+                    continue;
+                }
+            }
+            struct pollfd pfd = { conn, POLLIN, 0 };
+            if (poll(&pfd, 1, 50) == 1)
+            {
+                auto rc = recv(conn, buf, sizeof(buf), 0);
+                if (rc <= 0)
+                    break;
+                in.append(buf, rc);
+            }
+        }
+        close(conn);
+    }
+
+    int socket_;
+    std::uint16_t port_;
+    std::vector<int> statuses_;
+    std::size_t next_status_ = 0;
+    std::vector<std::string> bodies_;
+    std::mutex guard_;
+    std::atomic<unsigned> connections_;
+    std::atomic<bool> stop_;
+    std::thread acceptor_;
+    std::vector<std::thread> handlers_;
+};
+
+void write_events(chucho::loggly_writer& wrt, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        chucho::event e(chucho::logger::get("will"), chucho::level::INFO_(), std::to_string(i), __FILE__, __LINE__,
+                        CHUCHO_FUNCTION_NAME);
+        wrt.write(e);
+    }
+}
+
+std::vector<std::string> split_lines(const std::vector<std::string>& bodies)
+{
+    std::vector<std::string> result;
+    for (const auto& b : bodies)
+    {
+        std::size_t pos = 0;
+        std::size_t found;
+        while ((found = b.find('\n', pos)) != std::string::npos)
+        {
+            result.push_back(b.substr(pos, found - pos));
+            pos = found + 1;
+        }
+    }
+    return result;
+}
+
+}
+
+TEST(loggly_writer, bulk)
+{
+    http_stand_in server;
+    chucho::cloud_writer::bulk_settings bulk;
+    bulk.max_events = 10;
+    bulk.linger = std::chrono::milliseconds(50);
+    {
+        chucho::loggly_writer wrt("loggly",
+                                  std::make_unique<chucho::pattern_formatter>("%m"),
+                                  "token",
+                                  bulk,
+                                  server.get_url());
+        ASSERT_TRUE(wrt.get_bulk_settings());
+        EXPECT_EQ(10, wrt.get_bulk_settings()->max_events);
+        EXPECT_EQ(server.get_url(), wrt.get_url());
+        write_events(wrt, 25);
+        wrt.flush();
+        auto bodies = server.get_bodies();
+        EXPECT_EQ(3, bodies.size());
+        auto lines = split_lines(bodies);
+        ASSERT_EQ(25, lines.size());
+        std::sort(lines.begin(), lines.end(), [] (const std::string& l, const std::string& r) { return std::stoi(l) < std::stoi(r); });
+        for (int i = 0; i < 25; i++)
+            EXPECT_EQ(std::to_string(i), lines[i]);
+        // Connections are reused
+        EXPECT_GE(2U, server.get_connections());
+    }
+}
+
+TEST(loggly_writer, bulk_retry)
+{
+    http_stand_in server({503, 429});
+    chucho::cloud_writer::bulk_settings bulk;
+    bulk.max_events = 5;
+    bulk.linger = std::chrono::milliseconds(50);
+    chucho::loggly_writer wrt("loggly",
+                              std::make_unique<chucho::pattern_formatter>("%m"),
+                              "token",
+                              bulk,
+                              server.get_url());
+    write_events(wrt, 5);
+    wrt.flush();
+    auto lines = split_lines(server.get_bodies());
+    EXPECT_EQ(5, lines.size());
+}
+
+#endif
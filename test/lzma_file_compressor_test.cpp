@@ -17,6 +17,8 @@
 #include <gtest/gtest.h>
 #include <chucho/lzma_file_compressor.hpp>
 #include <chucho/file.hpp>
+#include <lzma.h>
+#include <iterator>
 #include <fstream>
 #include <algorithm>
 #include <random>
@@ -37,6 +39,44 @@ void make_file(const std::string& name)
     }
 }
 
+std::string make_big_file(const std::string& name)
+{
+    std::string text;
+    std::string chars("abcdefghijklmnopqrstuvxyzABCDEFGHIJKLMNOPQRSTUVXYZ");
+    std::mt19937 gen(7);
+    while (text.length() < 3 * 1024 * 1024)
+    {
+        std::shuffle(chars.begin(), chars.end(), gen);
+        text += chars;
+    }
+    std::ofstream stream(name.c_str(), std::ios::out | std::ios::binary);
+    stream << text;
+    return text;
+}
+
+std::string unxz(const std::string& name)
+{
+    std::ifstream stream(name.c_str(), std::ios::in | std::ios::binary);
+    std::string in((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    std::string result;
+    lzma_stream lz = LZMA_STREAM_INIT;
+    if (lzma_stream_decoder(&lz, UINT64_MAX, 0) != LZMA_OK)
+        return result;
+    lz.next_in = reinterpret_cast<const std::uint8_t*>(in.data());
+    lz.avail_in = in.length();
+    std::uint8_t buf[8192];
+    lzma_ret rc;
+    do
+    {
+        lz.next_out = buf;
+        lz.avail_out = sizeof(buf);
+        rc = lzma_code(&lz, LZMA_FINISH);
+        result.append(reinterpret_cast<char*>(buf), sizeof(buf) - lz.avail_out);
+    } while (rc == LZMA_OK);
+    lzma_end(&lz);
+    return result;
+}
+
 }
 
 TEST(lzma_file_compressor, compress)
@@ -54,3 +94,17 @@ TEST(lzma_file_compressor, compress)
     chucho::file::remove(name);
 }
 
+TEST(lzma_file_compressor, parallel)
+{
+    std::string name("lzma_file_compressor_parallel_test");
+    std::string text = make_big_file(name);
+    chucho::lzma_file_compressor xz(1);
+    xz.set_threads(3);
+    EXPECT_EQ(3, xz.get_threads());
+    ASSERT_NO_THROW(xz.compress(name));
+    EXPECT_FALSE(chucho::file::exists(name));
+    name += ".xz";
+    ASSERT_TRUE(chucho::file::exists(name));
+    EXPECT_EQ(text, unxz(name));
+    chucho::file::remove(name);
+}
@@ -94,6 +94,12 @@ TEST(optional_features, simple)
 #endif
 #if defined(CHUCHO_HAVE_RDKAFKA)
     EXPECT_FEATURE(chucho::optional_features::KAFKA_WRITER);
+#endif
+#if defined(CHUCHO_HAVE_SHM_OPEN)
+    EXPECT_FEATURE(chucho::optional_features::SHM_RING_WRITER);
+#endif
+#if defined(CHUCHO_HAVE_IO_URING)
+    EXPECT_FEATURE(chucho::optional_features::IO_URING_FILE_WRITER);
 #endif
     EXPECT_TRUE(fs.none());
 }
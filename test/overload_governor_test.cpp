@@ -0,0 +1,98 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chucho/overload_governor.hpp>
+#include <chucho/exception.hpp>
+
+namespace
+{
+
+std::vector<chucho::overload_governor::watermark> marks()
+{
+    return chucho::overload_governor::parse_watermarks("80:DEBUG,95:INFO");
+}
+
+}
+
+TEST(overload_governor, bad_watermarks)
+{
+    EXPECT_THROW(chucho::overload_governor::parse_watermarks(""), std::invalid_argument);
+    EXPECT_THROW(chucho::overload_governor::parse_watermarks("80"), std::invalid_argument);
+    EXPECT_THROW(chucho::overload_governor::parse_watermarks("eighty:DEBUG"), std::invalid_argument);
+    EXPECT_THROW(chucho::overload_governor::parse_watermarks("80:CHUCK"), chucho::exception);
+    EXPECT_THROW(chucho::overload_governor(chucho::overload_governor::parse_watermarks("95:DEBUG,80:INFO")), std::invalid_argument);
+    EXPECT_THROW(chucho::overload_governor(chucho::overload_governor::parse_watermarks("80:INFO,95:DEBUG")), std::invalid_argument);
+    EXPECT_THROW(chucho::overload_governor(chucho::overload_governor::parse_watermarks("180:INFO")), std::invalid_argument);
+    EXPECT_THROW(chucho::overload_governor(marks(), 1.0), std::invalid_argument);
+}
+
+TEST(overload_governor, parse)
+{
+    auto mks = chucho::overload_governor::parse_watermarks(" 80 : debug , 95:INFO ");
+    ASSERT_EQ(2, mks.size());
+    EXPECT_DOUBLE_EQ(0.8, mks[0].fullness);
+    EXPECT_EQ(chucho::level::DEBUG_(), mks[0].shed);
+    EXPECT_DOUBLE_EQ(0.95, mks[1].fullness);
+    EXPECT_EQ(chucho::level::INFO_(), mks[1].shed);
+}
+
+TEST(overload_governor, shed)
+{
+    chucho::overload_governor gov(marks());
+    EXPECT_FALSE(gov.get_shed_level());
+    EXPECT_TRUE(chucho::overload_governor::admits(*chucho::level::TRACE_()));
+    gov.update(0.79);
+    EXPECT_FALSE(gov.get_shed_level());
+    gov.update(0.8);
+    EXPECT_EQ(chucho::level::DEBUG_(), gov.get_shed_level());
+    EXPECT_FALSE(chucho::overload_governor::admits(*chucho::level::TRACE_()));
+    EXPECT_FALSE(chucho::overload_governor::admits(*chucho::level::DEBUG_()));
+    EXPECT_TRUE(chucho::overload_governor::admits(*chucho::level::INFO_()));
+    // Asking doesn't count
+    EXPECT_TRUE(chucho::overload_governor::sheds(*chucho::level::DEBUG_()));
+    EXPECT_FALSE(chucho::overload_governor::sheds(*chucho::level::INFO_()));
+    gov.update(0.97);
+    EXPECT_EQ(chucho::level::INFO_(), gov.get_shed_level());
+    EXPECT_FALSE(chucho::overload_governor::admits(*chucho::level::INFO_()));
+    EXPECT_TRUE(chucho::overload_governor::admits(*chucho::level::WARN_()));
+    // Hysteresis keeps the watermark until 85%
+    gov.update(0.9);
+    EXPECT_EQ(chucho::level::INFO_(), gov.get_shed_level());
+    gov.update(0.84);
+    EXPECT_EQ(chucho::level::DEBUG_(), gov.get_shed_level());
+    EXPECT_FALSE(gov.take_summary());
+    gov.update(0.75);
+    EXPECT_EQ(chucho::level::DEBUG_(), gov.get_shed_level());
+    gov.update(0.69);
+    EXPECT_FALSE(gov.get_shed_level());
+    EXPECT_TRUE(chucho::overload_governor::admits(*chucho::level::TRACE_()));
+    auto summary = gov.take_summary();
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(0, summary->find("Events at or below INFO were shed for "));
+    EXPECT_NE(std::string::npos, summary->find(": TRACE 1, DEBUG 1, INFO 1"));
+    EXPECT_FALSE(gov.take_summary());
+}
+
+TEST(overload_governor, destroyed_while_shedding)
+{
+    {
+        chucho::overload_governor gov(marks());
+        gov.update(1.0);
+        EXPECT_FALSE(chucho::overload_governor::admits(*chucho::level::INFO_()));
+    }
+    EXPECT_TRUE(chucho::overload_governor::admits(*chucho::level::INFO_()));
+}
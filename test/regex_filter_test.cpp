@@ -0,0 +1,77 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chucho/regex_filter.hpp>
+#include <chucho/logger.hpp>
+#include <chucho/exception.hpp>
+
+namespace
+{
+
+class regex_filter_test : public ::testing::Test
+{
+protected:
+    regex_filter_test()
+        : logger_(chucho::logger::get("regex_filter_test.net"))
+    {
+    }
+
+    chucho::event get_event(const std::string& msg)
+    {
+        return chucho::event(logger_, chucho::level::INFO_(), msg, __FILE__, __LINE__, __FUNCTION__);
+    }
+
+private:
+    std::shared_ptr<chucho::logger> logger_;
+};
+
+}
+
+TEST_F(regex_filter_test, invalid)
+{
+    EXPECT_THROW(chucho::regex_filter("regex", "(unclosed"), chucho::exception);
+}
+
+TEST_F(regex_filter_test, logger)
+{
+    chucho::regex_filter f("regex", "\\.net$", chucho::regex_filter::field::LOGGER, chucho::filter::result::DENY, chucho::filter::result::NEUTRAL);
+    EXPECT_EQ(chucho::regex_filter::field::LOGGER, f.get_field());
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(get_event("hello")));
+    chucho::event evt(chucho::logger::get("regex_filter_test"), chucho::level::INFO_(), "hello", __FILE__, __LINE__, __FUNCTION__);
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, f.evaluate(evt));
+}
+
+TEST_F(regex_filter_test, message)
+{
+    chucho::regex_filter f("regex", "heartbeat [0-9]+");
+    EXPECT_EQ(std::string("regex"), f.get_name());
+    EXPECT_EQ(std::string("heartbeat [0-9]+"), f.get_regex());
+    EXPECT_EQ(chucho::regex_filter::field::MESSAGE, f.get_field());
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, f.get_on_match());
+    EXPECT_EQ(chucho::filter::result::DENY, f.get_on_mismatch());
+    EXPECT_EQ(chucho::filter::result::NEUTRAL, f.evaluate(get_event("got heartbeat 17 from peer")));
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(get_event("got heartbeat from peer")));
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(get_event("nothing to see")));
+}
+
+TEST_F(regex_filter_test, message_groups)
+{
+    chucho::regex_filter f("regex", "(disk|memory) (full|low)", chucho::regex_filter::field::MESSAGE, chucho::filter::result::ACCEPT);
+    EXPECT_EQ(chucho::filter::result::ACCEPT, f.evaluate(get_event("the disk full alarm")));
+    EXPECT_EQ(chucho::filter::result::ACCEPT, f.evaluate(get_event("memory low")));
+    EXPECT_EQ(chucho::filter::result::DENY, f.evaluate(get_event("memory is fine")));
+}
@@ -73,12 +73,76 @@ TEST(regex, replace)
     EXPECT_EQ(std::string("hello, doggy, check trailing"), rep);
 }
 
+TEST(regex, replace_literal)
+{
+    chucho::regex::expression re("::");
+    EXPECT_EQ(std::string("one.two.three"), chucho::regex::replace("one::two::three", re, "."));
+    EXPECT_EQ(std::string("nothing"), chucho::regex::replace("nothing", re, "."));
+    EXPECT_EQ(std::string("ab"), chucho::regex::replace("::a::::b::", re, ""));
+}
+
 TEST(regex, search)
 {
     chucho::regex::expression re("d.g");
     EXPECT_TRUE(chucho::regex::search("my dog has fleas", re));
 }
 
+TEST(regex, search_fast_paths)
+{
+    struct
+    {
+        const char* re;
+        const char* text;
+        bool expected;
+    } cases[] =
+    {
+        // Literals
+        { "dog", "my dog has fleas", true },
+        { "dog", "my cat has fleas", false },
+        { "^my", "my dog", true },
+        { "^dog", "my dog", false },
+        { "fleas$", "has fleas", true },
+        { "fleas$", "fleas here", false },
+        { "^dog$", "dog", true },
+        { "^dog$", "dogs", false },
+        { "a\\.b", "a.b", true },
+        { "a\\.b", "axb", false },
+        // The automaton
+        { "d.g", "my dg has", false },
+        { "^h.*o t", "hello there", true },
+        { "^h.*o t", "ahello there", false },
+        { "colou?r", "color", true },
+        { "colou?r", "colour", true },
+        { "colou?r", "colouur", false },
+        { "ab+c", "ac", false },
+        { "ab+c", "abbbc", true },
+        { "ab*c", "ac", true },
+        { "x[0-9]{2,3}y", "x12y", true },
+        { "x[0-9]{2,3}y", "x1234y", false },
+        { "x[0-9]{2}", "x1a", false },
+        { "[^a-z]+$", "abc123", true },
+        { "^[[:digit:]]+$", "12345", true },
+        { "^[[:digit:]]+$", "123a45", false },
+        { "[]x]", "a]b", true },
+        { "a.*b.*c$", "a b c d", false },
+        { "a.*b.*c$", "xx a bb c", true },
+        { "", "anything", true },
+        { ".", "", false },
+        // Too many states for the automaton
+        { "x{1000}y", "xy", false },
+        { "^a{0,1000}b", "aab", true },
+        // Left to the engine, but with a required literal
+        { "(one|two) three", "two three", true },
+        { "(one|two) three", "two thre", false },
+        { "one|two", "it is two", true }
+    };
+    for (const auto& c : cases)
+    {
+        chucho::regex::expression re(c.re);
+        EXPECT_EQ(c.expected, chucho::regex::search(c.text, re)) << c.re << " in " << c.text;
+    }
+}
+
 TEST(regex, search_with_match)
 {
     chucho::regex::expression re("(d.g).*(f.*s)");
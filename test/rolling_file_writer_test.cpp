@@ -25,11 +25,89 @@
 #include <chucho/time_file_roller.hpp>
 #include <chucho/status_manager.hpp>
 #include <chucho/gzip_file_compressor.hpp>
+#if defined(CHUCHO_HAVE_ZLIB)
+#include <chucho/gzip_stream_compressor.hpp>
+#endif
 #include <chucho/sliding_numbered_file_roller.hpp>
 #include <chucho/exception.hpp>
 #include <array>
 #include <algorithm>
 #include <fstream>
+#include <mutex>
+#include <thread>
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+namespace
+{
+
+#if defined(__linux__)
+
+class thread_name_compressor : public chucho::file_compressor
+{
+public:
+    thread_name_compressor();
+
+    virtual void compress(const std::string& file_name) override;
+    std::string get_helper_name();
+    int get_helper_scheduling_policy();
+    std::string get_thread_name();
+
+private:
+    std::mutex guard_;
+    std::string thread_name_;
+    std::string helper_name_;
+    int helper_scheduling_policy_;
+};
+
+thread_name_compressor::thread_name_compressor()
+    : chucho::file_compressor(1, ".named"),
+      helper_scheduling_policy_(-1)
+{
+    // A niceness makes the work happen on a helper thread
+    set_nice(1);
+}
+
+void thread_name_compressor::compress(const std::string&)
+{
+    char name[16];
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    std::lock_guard<std::mutex> lg(guard_);
+    thread_name_ = name;
+    run_at_nice([this] ()
+    {
+        char helper[16];
+        pthread_getname_np(pthread_self(), helper, sizeof(helper));
+        int policy;
+        sched_param param;
+        pthread_getschedparam(pthread_self(), &policy, &param);
+        helper_name_ = helper;
+        helper_scheduling_policy_ = policy;
+    });
+}
+
+std::string thread_name_compressor::get_helper_name()
+{
+    std::lock_guard<std::mutex> lg(guard_);
+    return helper_name_;
+}
+
+int thread_name_compressor::get_helper_scheduling_policy()
+{
+    std::lock_guard<std::mutex> lg(guard_);
+    return helper_scheduling_policy_;
+}
+
+std::string thread_name_compressor::get_thread_name()
+{
+    std::lock_guard<std::mutex> lg(guard_);
+    return thread_name_;
+}
+
+#endif
+
+}
 
 class rolling_file_writer_test : public ::testing::Test
 {
@@ -65,6 +143,26 @@ protected:
         return dir_name_ + chucho::file::dir_sep + base;
     }
 
+#if defined(CHUCHO_HAVE_ZLIB)
+    std::string get_gzip_text(const std::string& file_name, bool& complete)
+    {
+        std::string text;
+        gzFile gz = gzopen(file_name.c_str(), "rb");
+        if (gz != nullptr)
+        {
+            char buf[1024];
+            int num;
+            while ((num = gzread(gz, buf, sizeof(buf))) > 0)
+                text.append(buf, num);
+            int err;
+            gzerror(gz, &err);
+            complete = err == Z_OK;
+            gzclose(gz);
+        }
+        return text;
+    }
+#endif
+
     std::string get_line(const std::string& file_name)
     {
         std::ifstream stream(file_name);
@@ -117,6 +215,31 @@ TEST_F(rolling_file_writer_test, numbered)
     EXPECT_FALSE(chucho::file::exists(fn + ".3"));
 }
 
+#if defined(__linux__)
+
+TEST_F(rolling_file_writer_test, numbered_thread_settings)
+{
+    auto trig = std::make_unique<chucho::size_file_roll_trigger>(5);
+    auto comp = std::make_unique<thread_name_compressor>();
+    auto& named = *comp;
+    auto roll = std::make_unique<chucho::numbered_file_roller>(1, std::move(comp));
+    auto fn = get_file_name("num_thread");
+    auto fmt = std::make_unique<chucho::pattern_formatter>("%m%n");
+    chucho::rolling_file_writer w("my_rolling_writer", std::move(fmt), fn, std::move(roll), std::move(trig));
+    chucho::thread_settings ts;
+    ts.set_scheduling(chucho::thread_settings::scheduling::BATCH);
+    w.set_thread_settings(ts);
+    w.write(get_event("one:hello"));
+    w.write(get_event("two:hello"));
+    w.get_file_roller().wait_for_compression();
+    // The compressing thread and its helper belong to the writer
+    EXPECT_EQ(std::string("compress:writer"), named.get_thread_name());
+    EXPECT_EQ(std::string("compress:writer"), named.get_helper_name());
+    EXPECT_EQ(SCHED_BATCH, named.get_helper_scheduling_policy());
+}
+
+#endif
+
 #if defined(CHUCHO_HAVE_ZLIB)
 
 TEST_F(rolling_file_writer_test, numbered_gzip)
@@ -131,9 +254,66 @@ TEST_F(rolling_file_writer_test, numbered_gzip)
     w.write(get_event("two:hello"));
     EXPECT_TRUE(chucho::file::exists(fn));
     EXPECT_STREQ("two:hello", get_line(fn).c_str());
+    w.get_file_roller().wait_for_compression();
     EXPECT_TRUE(chucho::file::exists(fn + ".1.gz"));
 }
 
+TEST_F(rolling_file_writer_test, numbered_gzip_stream)
+{
+    auto trig = std::make_unique<chucho::size_file_roll_trigger>(chucho::size_file_roll_trigger::UNLIMITED, 10);
+    auto roll = std::make_unique<chucho::numbered_file_roller>(1);
+    auto fn = get_file_name("num_gzip_stream.gz");
+    auto fmt = std::make_unique<chucho::pattern_formatter>("%m%n");
+    chucho::rolling_file_writer w("rolling", std::move(fmt), fn, std::move(roll), std::move(trig));
+    w.set_stream_compressor(std::make_unique<chucho::gzip_stream_compressor>());
+    // Sync after every event
+    w.set_compressed_sync(0, std::chrono::milliseconds(0));
+    w.write(get_event("one:hello"));
+    EXPECT_EQ(10, w.get_uncompressed_size());
+    bool complete = true;
+    // The stream is open, but what has been flushed can be read
+    EXPECT_EQ(std::string("one:hello\n"), get_gzip_text(fn, complete));
+    EXPECT_FALSE(complete);
+    w.write(get_event("two:hello"));
+    EXPECT_EQ(10, w.get_uncompressed_size());
+    EXPECT_EQ(std::string("two:hello\n"), get_gzip_text(fn, complete));
+    ASSERT_TRUE(chucho::file::exists(fn + ".1"));
+    EXPECT_EQ(std::string("one:hello\n"), get_gzip_text(fn + ".1", complete));
+    EXPECT_TRUE(complete);
+    EXPECT_FALSE(chucho::file::exists(fn + ".1.gz"));
+}
+
+TEST_F(rolling_file_writer_test, numbered_gzip_stream_sync)
+{
+    auto trig = std::make_unique<chucho::size_file_roll_trigger>(1024 * 1024);
+    auto roll = std::make_unique<chucho::numbered_file_roller>(1);
+    auto fn = get_file_name("num_gzip_stream_sync.gz");
+    auto fmt = std::make_unique<chucho::pattern_formatter>("%m%n");
+    chucho::rolling_file_writer w("rolling", std::move(fmt), fn, std::move(roll), std::move(trig));
+    w.set_stream_compressor(std::make_unique<chucho::gzip_stream_compressor>());
+    EXPECT_EQ(chucho::file_writer::DEFAULT_COMPRESSED_SYNC_BYTES, w.get_compressed_sync_bytes());
+    EXPECT_EQ(chucho::file_writer::DEFAULT_COMPRESSED_SYNC_INTERVAL, w.get_compressed_sync_interval());
+    w.set_compressed_sync(100, std::chrono::hours(1));
+    std::string expected;
+    bool complete;
+    for (int i = 0; i < 9; i++)
+    {
+        w.write(get_event("123456789"));
+        expected += "123456789\n";
+    }
+    // Nothing is readable until enough has been written
+    EXPECT_EQ(std::string(), get_gzip_text(fn, complete));
+    w.write(get_event("123456789"));
+    expected += "123456789\n";
+    EXPECT_EQ(expected, get_gzip_text(fn, complete));
+    w.set_compressed_sync(1024 * 1024, std::chrono::milliseconds(50));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // Or until enough time has passed
+    w.write(get_event("later"));
+    expected += "later\n";
+    EXPECT_EQ(expected, get_gzip_text(fn, complete));
+}
+
 TEST_F(rolling_file_writer_test, numbered_gzip_with_gap)
 {
     auto trig = std::make_unique<chucho::size_file_roll_trigger>(5);
@@ -150,6 +330,7 @@ TEST_F(rolling_file_writer_test, numbered_gzip_with_gap)
     EXPECT_STREQ("four:hello", get_line(fn).c_str());
     EXPECT_TRUE(chucho::file::exists(fn + ".-1"));
     EXPECT_STREQ("three:hello", get_line(fn + ".-1").c_str());
+    w.get_file_roller().wait_for_compression();
     EXPECT_TRUE(chucho::file::exists(fn + ".0.gz"));
     EXPECT_TRUE(chucho::file::exists(fn + ".1.gz"));
 }
@@ -207,6 +388,7 @@ TEST_F(rolling_file_writer_test, sliding_numbered_gzip)
     std::string fnn = fn + ".1";
     EXPECT_TRUE(chucho::file::exists(fnn));
     EXPECT_STREQ("two:hello", get_line(fnn).c_str());
+    w.get_file_roller().wait_for_compression();
     EXPECT_TRUE(chucho::file::exists(fn + ".gz"));
 }
 
@@ -228,6 +410,7 @@ TEST_F(rolling_file_writer_test, sliding_numbered_gzip_with_gap)
     fnn = fn + ".0";
     EXPECT_TRUE(chucho::file::exists(fnn));
     EXPECT_STREQ("three:hello", get_line(fnn).c_str());
+    w.get_file_roller().wait_for_compression();
     EXPECT_TRUE(chucho::file::exists(fn + ".-1.gz"));
     EXPECT_TRUE(chucho::file::exists(fn + ".gz"));
 }
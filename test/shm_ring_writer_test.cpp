@@ -0,0 +1,211 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chucho/shm_ring_writer.hpp>
+#include <chucho/shm_ring_reader.hpp>
+#include <chucho/formatted_message_serializer.hpp>
+#include <chucho/pattern_formatter.hpp>
+#include <chucho/logger.hpp>
+#include <set>
+#include <thread>
+#include <unistd.h>
+
+namespace
+{
+
+class shm_ring_writer_test : public ::testing::Test
+{
+protected:
+    shm_ring_writer_test()
+        : ring_name_("chucho-shm-ring-test-" + std::to_string(getpid()))
+    {
+    }
+
+    std::unique_ptr<chucho::shm_ring_writer> get_writer(std::uint32_t slot_count,
+                                                        std::uint32_t slot_size,
+                                                        chucho::shm_ring_writer::overflow_policy ovr = chucho::shm_ring_writer::overflow_policy::OVERWRITE)
+    {
+        return std::make_unique<chucho::shm_ring_writer>("shm_ring_writer_test",
+                                                         std::make_unique<chucho::pattern_formatter>("%m"),
+                                                         std::make_unique<chucho::formatted_message_serializer>(),
+                                                         ring_name_,
+                                                         slot_count,
+                                                         slot_size,
+                                                         ovr);
+    }
+
+    std::string read(chucho::shm_ring_reader& rdr)
+    {
+        std::vector<std::uint8_t> rec;
+        return rdr.read(rec) ? std::string(rec.begin(), rec.end()) : std::string("<none>");
+    }
+
+    virtual void SetUp() override
+    {
+        chucho::shm_ring_reader::remove(ring_name_);
+    }
+
+    virtual void TearDown() override
+    {
+        chucho::shm_ring_reader::remove(ring_name_);
+    }
+
+    void write(chucho::writer& wrt, const std::string& msg)
+    {
+        chucho::event evt(chucho::logger::get("shm_ring_writer_test"),
+                          chucho::level::INFO_(),
+                          msg,
+                          __FILE__,
+                          __LINE__,
+                          __FUNCTION__);
+        wrt.write(evt);
+    }
+
+    std::string ring_name_;
+};
+
+}
+
+TEST_F(shm_ring_writer_test, concurrent)
+{
+    auto wrt = get_writer(64, 64, chucho::shm_ring_writer::overflow_policy::DROP);
+    chucho::shm_ring_reader rdr(ring_name_);
+    const std::size_t threads = 4;
+    const std::size_t per_thread = 2000;
+    std::vector<std::unique_ptr<chucho::shm_ring_writer>> writers;
+    for (std::size_t i = 0; i < threads; i++)
+        writers.push_back(get_writer(64, 64, chucho::shm_ring_writer::overflow_policy::DROP));
+    std::vector<std::thread> producers;
+    for (std::size_t i = 0; i < threads; i++)
+    {
+        producers.emplace_back([this, i, per_thread, &writers] ()
+        {
+            for (std::size_t j = 0; j < per_thread; j++)
+                write(*writers[i], std::to_string(i) + ':' + std::to_string(j) + ':' + std::string(j % 100, 'x'));
+        });
+    }
+    std::set<std::string> seen;
+    std::vector<std::uint8_t> rec;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (seen.size() + wrt->get_dropped() < threads * per_thread &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        if (rdr.read(rec, std::chrono::milliseconds(100)))
+        {
+            std::string text(rec.begin(), rec.end());
+            auto first = text.find(':');
+            auto second = text.find(':', first + 1);
+            ASSERT_NE(std::string::npos, second);
+            EXPECT_EQ(std::stoul(text.substr(first + 1, second - first - 1)) % 100, text.length() - second - 1);
+            EXPECT_TRUE(seen.insert(text).second);
+        }
+    }
+    for (auto& p : producers)
+        p.join();
+    EXPECT_EQ(threads * per_thread, seen.size() + wrt->get_dropped());
+    EXPECT_EQ(0, rdr.get_lost());
+}
+
+TEST_F(shm_ring_writer_test, drop)
+{
+    auto wrt = get_writer(8, 64, chucho::shm_ring_writer::overflow_policy::DROP);
+    EXPECT_EQ(chucho::shm_ring_writer::overflow_policy::DROP, wrt->get_overflow_policy());
+    for (int i = 0; i < 20; i++)
+        write(*wrt, "drop " + std::to_string(i));
+    EXPECT_EQ(12, wrt->get_dropped());
+    EXPECT_EQ(0, wrt->get_overwritten());
+    chucho::shm_ring_reader rdr(ring_name_);
+    for (int i = 0; i < 8; i++)
+        EXPECT_EQ("drop " + std::to_string(i), read(rdr));
+    EXPECT_EQ(std::string("<none>"), read(rdr));
+    // The reader has made room
+    write(*wrt, "after");
+    EXPECT_EQ(std::string("after"), read(rdr));
+    EXPECT_EQ(0, rdr.get_lost());
+}
+
+TEST_F(shm_ring_writer_test, existing)
+{
+    auto wrt = get_writer(16, 128);
+    auto wrt2 = get_writer(32, 64, chucho::shm_ring_writer::overflow_policy::DROP);
+    EXPECT_EQ(16, wrt2->get_slot_count());
+    EXPECT_EQ(128, wrt2->get_slot_size());
+    EXPECT_EQ(chucho::shm_ring_writer::overflow_policy::OVERWRITE, wrt2->get_overflow_policy());
+    write(*wrt, "one");
+    write(*wrt2, "two");
+    chucho::shm_ring_reader rdr(ring_name_);
+    EXPECT_EQ(std::string("one"), read(rdr));
+    EXPECT_EQ(std::string("two"), read(rdr));
+}
+
+TEST_F(shm_ring_writer_test, large)
+{
+    auto wrt = get_writer(64, 64);
+    std::string msg;
+    for (int i = 0; msg.length() < 1000; i++)
+        msg += std::to_string(i) + ' ';
+    write(*wrt, msg);
+    write(*wrt, "small");
+    chucho::shm_ring_reader rdr(ring_name_);
+    EXPECT_EQ(msg, read(rdr));
+    EXPECT_EQ(std::string("small"), read(rdr));
+    EXPECT_EQ(0, wrt->get_truncated());
+    // Half of the ring is the most a record may have
+    write(*wrt, std::string(2000, 'z'));
+    EXPECT_EQ(1, wrt->get_truncated());
+    EXPECT_EQ(std::string(32 * 48, 'z'), read(rdr));
+}
+
+TEST_F(shm_ring_writer_test, overwrite)
+{
+    auto wrt = get_writer(8, 64);
+    EXPECT_EQ(chucho::shm_ring_writer::overflow_policy::OVERWRITE, wrt->get_overflow_policy());
+    for (int i = 0; i < 20; i++)
+        write(*wrt, "overwrite " + std::to_string(i));
+    EXPECT_EQ(12, wrt->get_overwritten());
+    EXPECT_EQ(0, wrt->get_dropped());
+    chucho::shm_ring_reader rdr(ring_name_);
+    EXPECT_EQ(12, rdr.get_lost());
+    EXPECT_EQ(8, rdr.get_unread());
+    for (int i = 12; i < 20; i++)
+        EXPECT_EQ("overwrite " + std::to_string(i), read(rdr));
+    EXPECT_EQ(std::string("<none>"), read(rdr));
+    // Lapped by the writer while attached
+    for (int i = 0; i < 10; i++)
+        write(*wrt, "again " + std::to_string(i));
+    EXPECT_EQ(std::string("again 2"), read(rdr));
+    EXPECT_EQ(14, rdr.get_lost());
+}
+
+TEST_F(shm_ring_writer_test, resume)
+{
+    auto wrt = get_writer(16, 64);
+    write(*wrt, "one");
+    write(*wrt, "two");
+    {
+        chucho::shm_ring_reader rdr(ring_name_);
+        EXPECT_EQ(std::string("one"), read(rdr));
+    }
+    chucho::shm_ring_reader rdr(ring_name_);
+    EXPECT_EQ(1, rdr.get_unread());
+    EXPECT_EQ(std::string("two"), read(rdr));
+    write(*wrt, "three");
+    write(*wrt, "four");
+    rdr.seek_to_end();
+    write(*wrt, "five");
+    EXPECT_EQ(std::string("five"), read(rdr));
+}
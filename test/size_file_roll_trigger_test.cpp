@@ -17,6 +17,8 @@
 #include <gtest/gtest.h>
 #include <chucho/size_file_roll_trigger.hpp>
 #include <chucho/logger.hpp>
+#include <chucho/file_writer.hpp>
+#include <chucho/pattern_formatter.hpp>
 #include <fstream>
 
 TEST(size_file_roll_trigger_test, trigger)
@@ -47,3 +49,34 @@ TEST(size_file_roll_trigger_test, trigger)
     stream.close();
     std::remove(name.c_str());
 }
+
+TEST(size_file_roll_trigger_test, uncompressed)
+{
+    chucho::size_file_roll_trigger t(chucho::size_file_roll_trigger::UNLIMITED, 20);
+    EXPECT_EQ(chucho::size_file_roll_trigger::UNLIMITED, t.get_max_size());
+    EXPECT_EQ(20, t.get_max_uncompressed_size());
+    chucho::event evt(chucho::logger::get("size_file_roll_trigger_test"),
+                      chucho::level::INFO_(),
+                      "hello",
+                      __FILE__,
+                      __LINE__,
+                      __FUNCTION__);
+    std::string name("size_file_roll_trigger_test");
+    {
+        // Without a compressor the file's size is the uncompressed size
+        chucho::file_writer w("size_file_roll_trigger_test",
+                              std::make_unique<chucho::pattern_formatter>("%m%n"),
+                              name,
+                              chucho::file_writer::on_start::TRUNCATE);
+        w.write(evt);
+        EXPECT_FALSE(t.is_triggered(w, evt));
+        w.write(evt);
+        EXPECT_FALSE(t.is_triggered(w, evt));
+        w.write(evt);
+        EXPECT_FALSE(t.is_triggered(w, evt));
+        w.write(evt);
+        EXPECT_TRUE(t.is_triggered(w, evt));
+        EXPECT_FALSE(t.is_triggered(name, evt));
+    }
+    std::remove(name.c_str());
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#if !defined(CHUCHO_STRING_WRITER_HPP_)
+#define CHUCHO_STRING_WRITER_HPP_
+
+#include <chucho/writer.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace chucho
+{
+
+namespace test
+{
+
+class string_writer : public writer
+{
+public:
+    string_writer(std::unique_ptr<formatter>&& fmt)
+        : writer("string", std::move(fmt)) { }
+
+    std::vector<std::string> get_lines()
+    {
+        std::vector<std::string> result;
+        std::string line;
+        while (std::getline(stream_, line))
+        {
+            if (!line.empty())
+                result.push_back(line);
+        }
+        stream_.clear();
+        return result;
+    }
+
+protected:
+    void write_impl(const event& evt) override
+    {
+        stream_ << formatter_->format(evt);
+    }
+
+private:
+    std::stringstream stream_;
+};
+
+}
+
+}
+
+#endif
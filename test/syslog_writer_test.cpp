@@ -20,10 +20,185 @@
 #include <chucho/logger.hpp>
 #include <chucho/host.hpp>
 #include <chucho/environment.hpp>
+#include <chrono>
 #include <iostream>
+#include <cstring>
+#if !defined(CHUCHO_WINDOWS)
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
 
 #if !defined(CHUCHO_WINDOWS)
 
+namespace
+{
+
+class loopback_listener
+{
+public:
+    loopback_listener(int type)
+        : socket_(socket(AF_INET, type, 0)),
+          accepted_(-1)
+    {
+        struct sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(socket_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+        socklen_t len = sizeof(addr);
+        getsockname(socket_, reinterpret_cast<struct sockaddr*>(&addr), &len);
+        port_ = ntohs(addr.sin_port);
+        if (type == SOCK_STREAM)
+            listen(socket_, 1);
+        set_timeout(socket_);
+    }
+
+    ~loopback_listener()
+    {
+        if (accepted_ != -1)
+            close(accepted_);
+        close(socket_);
+    }
+
+    std::uint16_t get_port() const
+    {
+        return port_;
+    }
+
+    std::string receive_datagram(bool wait = true)
+    {
+        char buf[2048];
+        auto rc = recv(socket_, buf, sizeof(buf), wait ? 0 : MSG_DONTWAIT);
+        return rc > 0 ? std::string(buf, rc) : std::string();
+    }
+
+    std::string receive_stream(std::size_t len)
+    {
+        if (accepted_ == -1)
+        {
+            accepted_ = accept(socket_, nullptr, nullptr);
+            set_timeout(accepted_);
+        }
+        std::string result;
+        char buf[2048];
+        while (result.length() < len)
+        {
+            auto rc = recv(accepted_, buf, sizeof(buf), 0);
+            if (rc <= 0)
+                break;
+            result.append(buf, rc);
+        }
+        return result;
+    }
+
+private:
+    void set_timeout(int sock)
+    {
+        struct timeval tv;
+        tv.tv_sec = 5;
+        tv.tv_usec = 0;
+        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    }
+
+    int socket_;
+    int accepted_;
+    std::uint16_t port_;
+};
+
+}
+
+TEST(syslog_writer_test, batched_udp)
+{
+    loopback_listener lis(SOCK_DGRAM);
+    chucho::syslog_writer wrt("syslog3",
+                              std::make_unique<chucho::pattern_formatter>("%m"),
+                              chucho::syslog::facility::LOCAL0,
+                              "127.0.0.1",
+                              lis.get_port(),
+                              chucho::syslog::transport_protocol::UDP,
+                              chucho::syslog::message_format::RFC5424,
+                              3,
+                              "origin@32473");
+    EXPECT_EQ(3, wrt.get_batch_size());
+    auto log = chucho::logger::get("syslog_writer_test");
+    for (int i = 0; i < 2; i++)
+        wrt.write(chucho::event(log, chucho::level::ERROR_(), "batched " + std::to_string(i), __FILE__, __LINE__, __FUNCTION__));
+    EXPECT_TRUE(lis.receive_datagram(false).empty());
+    wrt.write(chucho::event(log, chucho::level::ERROR_(), "batched 2", __FILE__, __LINE__, __FUNCTION__));
+    for (int i = 0; i < 3; i++)
+    {
+        auto msg = lis.receive_datagram();
+        // LOCAL0 | ERROR == 131
+        EXPECT_EQ(0, msg.find("<131>1 ")) << msg;
+        EXPECT_NE(std::string::npos, msg.find("[origin@32473 logger=\"syslog_writer_test\"")) << msg;
+        EXPECT_EQ(msg.length() - 9, msg.rfind("batched " + std::to_string(i))) << msg;
+    }
+    wrt.write(chucho::event(log, chucho::level::INFO_(), "flushed", __FILE__, __LINE__, __FUNCTION__));
+    EXPECT_TRUE(lis.receive_datagram(false).empty());
+    wrt.flush();
+    auto msg = lis.receive_datagram();
+    EXPECT_EQ(0, msg.find("<134>1 ")) << msg;
+    // Nothing else is written, so the held message goes out on its own
+    wrt.write(chucho::event(log, chucho::level::INFO_(), "aged", __FILE__, __LINE__, __FUNCTION__));
+    msg = lis.receive_datagram();
+    EXPECT_EQ(msg.length() - 4, msg.rfind("aged")) << msg;
+}
+
+TEST(syslog_writer_test, tcp)
+{
+    loopback_listener lis(SOCK_STREAM);
+    chucho::syslog_writer wrt("syslog4",
+                              std::make_unique<chucho::pattern_formatter>("%m"),
+                              chucho::syslog::facility::LOCAL0,
+                              "127.0.0.1",
+                              lis.get_port(),
+                              chucho::syslog::transport_protocol::TCP);
+    EXPECT_EQ(chucho::syslog::transport_protocol::TCP, wrt.get_protocol());
+    auto log = chucho::logger::get("syslog_writer_test");
+    wrt.write(chucho::event(log, chucho::level::ERROR_(), "one", __FILE__, __LINE__, __FUNCTION__));
+    wrt.write(chucho::event(log, chucho::level::WARN_(), "two", __FILE__, __LINE__, __FUNCTION__));
+    auto host = chucho::host::get_base_name();
+    // "<131>Mmm dd hh:mm:ss host one"
+    std::size_t len1 = 5 + 15 + 1 + host.length() + 1 + 3;
+    std::size_t len2 = len1;
+    auto frames = std::to_string(len1) + ' ' + std::string(len1, 'x') + std::to_string(len2) + ' ' + std::string(len2, 'x');
+    auto got = lis.receive_stream(frames.length());
+    ASSERT_EQ(frames.length(), got.length()) << got;
+    auto space = got.find(' ');
+    ASSERT_EQ(std::to_string(len1), got.substr(0, space));
+    auto first = got.substr(space + 1, len1);
+    EXPECT_EQ(0, first.find("<131>")) << first;
+    EXPECT_EQ(len1 - 3, first.rfind("one")) << first;
+    auto rest = got.substr(space + 1 + len1);
+    space = rest.find(' ');
+    ASSERT_EQ(std::to_string(len2), rest.substr(0, space));
+    auto second = rest.substr(space + 1);
+    EXPECT_EQ(0, second.find("<132>")) << second;
+    EXPECT_EQ(len2 - 3, second.rfind("two")) << second;
+}
+
+TEST(syslog_writer_test, tcp_stalled)
+{
+    // The collector accepts the connection but never reads
+    loopback_listener lis(SOCK_STREAM);
+    chucho::syslog_writer wrt("syslog5",
+                              std::make_unique<chucho::pattern_formatter>("%m"),
+                              chucho::syslog::facility::LOCAL0,
+                              "127.0.0.1",
+                              lis.get_port(),
+                              chucho::syslog::transport_protocol::TCP);
+    auto log = chucho::logger::get("syslog_writer_test");
+    std::string text(1024, 'x');
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 5000; i++)
+        wrt.write(chucho::event(log, chucho::level::INFO_(), text, __FILE__, __LINE__, __FUNCTION__));
+    // Writing never waits for the network
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
 TEST(syslog_wrtier_test, same_host)
 {
     chucho::logger::remove_unused_loggers();
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chucho/thread_settings.hpp>
+#include <chucho/configuration.hpp>
+
+TEST(thread_settings, cpu_list)
+{
+    std::vector<unsigned> expected({0, 1, 2, 3, 8, 10, 11});
+    EXPECT_EQ(expected, chucho::thread_settings::parse_cpu_list("0-3,8,10-11"));
+    EXPECT_EQ(expected, chucho::thread_settings::parse_cpu_list(" 10 - 11, 8,0-3 ,2"));
+    EXPECT_EQ(std::vector<unsigned>({5}), chucho::thread_settings::parse_cpu_list("5"));
+    EXPECT_THROW(chucho::thread_settings::parse_cpu_list(""), std::invalid_argument);
+    EXPECT_THROW(chucho::thread_settings::parse_cpu_list("3-1"), std::invalid_argument);
+    EXPECT_THROW(chucho::thread_settings::parse_cpu_list("one"), std::invalid_argument);
+    EXPECT_THROW(chucho::thread_settings::parse_cpu_list("1,-2"), std::invalid_argument);
+    EXPECT_THROW(chucho::thread_settings::parse_cpu_list("4096"), std::invalid_argument);
+}
+
+TEST(thread_settings, global)
+{
+    chucho::thread_settings ts;
+    ts.set_name("everything");
+    ts.set_scheduling(chucho::thread_settings::scheduling::BATCH);
+    chucho::configuration::set_thread_settings(ts);
+    auto glob = chucho::configuration::get_thread_settings();
+    // Global settings never name threads
+    EXPECT_TRUE(glob.get_name().empty());
+    ASSERT_TRUE(glob.get_scheduling());
+    EXPECT_EQ(chucho::thread_settings::scheduling::BATCH, *glob.get_scheduling());
+    chucho::configuration::set_thread_settings(chucho::thread_settings());
+    EXPECT_TRUE(chucho::configuration::get_thread_settings().is_empty());
+}
+
+TEST(thread_settings, nice)
+{
+    chucho::thread_settings ts;
+    EXPECT_FALSE(ts.get_nice());
+    ts.set_nice(19);
+    ASSERT_TRUE(ts.get_nice());
+    EXPECT_EQ(19, *ts.get_nice());
+    EXPECT_THROW(ts.set_nice(20), std::invalid_argument);
+    EXPECT_THROW(ts.set_nice(-21), std::invalid_argument);
+    EXPECT_EQ(19, *ts.get_nice());
+}
+
+TEST(thread_settings, scheduling)
+{
+    EXPECT_EQ(chucho::thread_settings::scheduling::NORMAL, chucho::thread_settings::parse_scheduling("normal"));
+    EXPECT_EQ(chucho::thread_settings::scheduling::BATCH, chucho::thread_settings::parse_scheduling("Batch"));
+    EXPECT_EQ(chucho::thread_settings::scheduling::IDLE, chucho::thread_settings::parse_scheduling(" IDLE "));
+    EXPECT_THROW(chucho::thread_settings::parse_scheduling("fifo"), std::invalid_argument);
+}
+
+TEST(thread_settings, with_defaults)
+{
+    chucho::thread_settings glob;
+    glob.set_affinity({2, 3});
+    glob.set_nice(5);
+    glob.set_numa_node(1);
+    glob.set_name("global");
+    chucho::thread_settings mine;
+    EXPECT_TRUE(mine.is_empty());
+    mine.set_nice(10);
+    mine.set_scheduling(chucho::thread_settings::scheduling::IDLE);
+    auto both = mine.with_defaults(glob);
+    EXPECT_EQ(std::vector<unsigned>({2, 3}), both.get_affinity());
+    EXPECT_EQ(10, *both.get_nice());
+    EXPECT_EQ(1, *both.get_numa_node());
+    EXPECT_EQ(chucho::thread_settings::scheduling::IDLE, *both.get_scheduling());
+    EXPECT_TRUE(both.get_name().empty());
+}
@@ -159,6 +159,69 @@ TEST_F(yaml_configurator, async_writer_with_opts)
     async_writer_with_opts_body();
 }
 
+TEST_F(yaml_configurator, async_writer_with_shedding)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::async_writer:\n"
+              "        chucho::file_writer:\n"
+              "            chucho::pattern_formatter:\n"
+              "                pattern: '%m%n'\n"
+              "            file_name: hello.log\n"
+              "        shed_watermarks: '80:DEBUG, 95:INFO'\n"
+              "        shed_hysteresis: 5");
+    async_writer_with_shedding_body();
+}
+
+TEST_F(yaml_configurator, async_writer_with_shards)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::async_writer:\n"
+              "        chucho::file_writer:\n"
+              "            chucho::pattern_formatter:\n"
+              "                pattern: '%m%n'\n"
+              "            file_name: hello.log\n"
+              "        chunk_size: 7000\n"
+              "        shards: 4\n"
+              "        shard_key: request_id");
+    async_writer_with_shards_body();
+}
+
+TEST_F(yaml_configurator, async_writer_with_thread_settings)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::async_writer:\n"
+              "        chucho::file_writer:\n"
+              "            chucho::pattern_formatter:\n"
+              "                pattern: '%m%n'\n"
+              "            file_name: hello.log\n"
+              "            thread_scheduling: idle\n"
+              "        thread_name: bg-log\n"
+              "        thread_affinity: 0-1\n"
+              "        thread_nice: 5\n"
+              "        thread_scheduling: batch\n"
+              "        thread_numa_node: 0");
+    async_writer_with_thread_settings_body();
+}
+
+TEST_F(yaml_configurator, binary_file_writer)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::binary_file_writer:\n"
+              "        chucho::numbered_file_roller:\n"
+              "            min_index: 1\n"
+              "            max_index: 3\n"
+              "        chucho::size_file_roll_trigger:\n"
+              "            max_size: 100000\n"
+              "        file_name: what.clog\n"
+              "        on_start: truncate\n"
+              "        flush: false");
+    binary_file_writer_body();
+}
+
 #if defined(CHUCHO_HAVE_BZIP2)
 
 TEST_F(yaml_configurator, bzip2_file_compressor)
@@ -198,6 +261,24 @@ chucho::logger:
     cache_and_release_filter_body();
 }
 
+TEST_F(yaml_configurator, cache_and_release_filter_flight_recorder)
+{
+    configure(R"cnf(
+chucho::logger:
+    name: will
+    chucho::cout_writer:
+        - chucho::pattern_formatter:
+            pattern: '%m%n'
+        - chucho::cache_and_release_filter:
+            cache_threshold: trace
+            release_threshold: error
+            flight_recorder: true
+            events_per_thread: 500
+            max_age: 10
+)cnf");
+    cache_and_release_filter_flight_recorder_body();
+}
+
 TEST_F(yaml_configurator, cerr_writer)
 {
     configure("chucho::logger:\n"
@@ -289,6 +370,43 @@ TEST_F(yaml_configurator, duplicate_message_filter)
     duplicate_message_filter_body();
 }
 
+TEST_F(yaml_configurator, duplicate_message_filter_fingerprint)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::cout_writer:\n"
+              "        - chucho::pattern_formatter:\n"
+              "            pattern: '%m%n'\n"
+              "        - chucho::duplicate_message_filter:\n"
+              "            fingerprint: true\n"
+              "            capacity: 64\n"
+              "            window: 30");
+    duplicate_message_filter_fingerprint_body();
+}
+
+TEST_F(yaml_configurator, expression_filter)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::cout_writer:\n"
+              "        - chucho::pattern_formatter:\n"
+              "            pattern: '%m%n'\n"
+              "        - chucho::expression_filter:\n"
+              "            expression: 'level >= warn && logger == \"will\"'");
+    expression_filter_body();
+}
+
+TEST_F(yaml_configurator, expression_filter_invalid)
+{
+    configure_with_error("chucho::logger:\n"
+                         "    name: will\n"
+                         "    chucho::cout_writer:\n"
+                         "        - chucho::pattern_formatter:\n"
+                         "            pattern: '%m%n'\n"
+                         "        - chucho::expression_filter:\n"
+                         "            expression: 'level >= monkey'");
+}
+
 #if defined(CHUCHO_HAVE_CURL)
 
 TEST_F(yaml_configurator, email_writer)
@@ -308,7 +426,9 @@ TEST_F(yaml_configurator, email_writer)
               "        - connection_type: clear\n"
               "        - user: scrumpy\n"
               "        - password: lumpy\n"
-              "        - buffer_size: 7000\n");
+              "        - buffer_size: 7000\n"
+              "        - coalesce_window: 2500\n"
+              "        - max_backlog: 4\n");
     email_writer_body();
 }
 
@@ -323,6 +443,23 @@ TEST_F(yaml_configurator, loggly_writer)
     loggly_writer_body();
 }
 
+TEST_F(yaml_configurator, loggly_writer_bulk)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::loggly_writer:\n"
+              "        - chucho::pattern_formatter:\n"
+              "            pattern: '%m'\n"
+              "        - token: monkey-balls\n"
+              "        - bulk: true\n"
+              "        - max_batch_events: 100\n"
+              "        - max_batch_bytes: 65536\n"
+              "        - linger: 250\n"
+              "        - max_retry_batches: 4\n"
+              "        - url: 'http://127.0.0.1:1/bulk'\n");
+    loggly_writer_bulk_body();
+}
+
 #endif
 
 TEST_F(yaml_configurator, file_writer)
@@ -338,6 +475,20 @@ TEST_F(yaml_configurator, file_writer)
     file_writer_body();
 }
 
+TEST_F(yaml_configurator, file_writer_durability)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::file_writer:\n"
+              "        chucho::pattern_formatter:\n"
+              "            pattern: '%m%n'\n"
+              "        file_name: hello.log\n"
+              "        durability: group_commit\n"
+              "        sync_level: error\n"
+              "        sync_interval: 250");
+    file_writer_durability_body();
+}
+
 TEST_F(yaml_configurator, file_writer_invalid_1)
 {
     configure_with_error("chucho::logger:\n"
@@ -379,6 +530,43 @@ TEST_F(yaml_configurator, gzip_file_compressor)
     gzip_file_compressor_body();
 }
 
+TEST_F(yaml_configurator, gzip_file_compressor_threads)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::rolling_file_writer:\n"
+              "        chucho::pattern_formatter:\n"
+              "            pattern: '%m%n'\n"
+              "        chucho::time_file_roller:\n"
+              "            file_name_pattern: '%d{%d}'\n"
+              "            max_history: 5\n"
+              "            chucho::gzip_file_compressor:\n"
+              "                min_index: 7\n"
+              "                threads: 4\n"
+              "                nice: 10");
+    gzip_file_compressor_threads_body();
+}
+
+TEST_F(yaml_configurator, gzip_stream_compressor)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::rolling_file_writer:\n"
+              "        chucho::pattern_formatter:\n"
+              "            pattern: '%m%n'\n"
+              "        chucho::numbered_file_roller:\n"
+              "            max_index: 5\n"
+              "        chucho::size_file_roll_trigger:\n"
+              "            max_size: 1MB\n"
+              "            max_uncompressed_size: 10MB\n"
+              "        chucho::gzip_stream_compressor:\n"
+              "            compression_level: 3\n"
+              "        compressed_sync_bytes: 4096\n"
+              "        compressed_sync_interval: 5000\n"
+              "        file_name: what.log.gz");
+    gzip_stream_compressor_body();
+}
+
 #endif
 
 TEST_F(yaml_configurator, interval_file_roll_trigger)
@@ -402,6 +590,26 @@ TEST_F(yaml_configurator, invalid_utf8)
                                "    name: \x81\x82\x83"));
 }
 
+#if defined(CHUCHO_HAVE_IO_URING)
+
+TEST_F(yaml_configurator, io_uring_file_writer)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::io_uring_file_writer:\n"
+              "        chucho::pattern_formatter:\n"
+              "            pattern: '%m%n'\n"
+              "        file_name: hello.log\n"
+              "        flush: false\n"
+              "        buffer_count: 4\n"
+              "        buffer_size: 16384\n"
+              "        sync_interval: 500\n"
+              "        sync: FULL");
+    io_uring_file_writer_body();
+}
+
+#endif
+
 TEST_F(yaml_configurator, json_formatter)
 {
     std::string tmpl(R"tmpl(
@@ -449,6 +657,27 @@ chucho::logger:
     kafka_writer_config_body();
 }
 
+TEST_F(yaml_configurator, kafka_writer_delivery)
+{
+    configure(R"cnf(
+chucho::logger:
+    name: will
+    chucho::kafka_writer:
+        - chucho::pattern_formatter:
+            - pattern: '%m'
+        - chucho::formatted_message_serializer
+        - brokers: 192.168.56.101
+        - topic: monkeyballs
+        - batch_size: 50
+        - linger: 250
+        - partition_key: diagnostic_context
+        - partition_key_field: request
+        - backpressure: spill
+        - block_timeout: 750
+)cnf");
+    kafka_writer_delivery_body();
+}
+
 #endif
 
 TEST_F(yaml_configurator, level_filter)
@@ -627,6 +856,33 @@ TEST_F(yaml_configurator, rabbitmq_writer_capn_proto)
 
 #endif
 
+TEST_F(yaml_configurator, regex_filter)
+{
+    configure("chucho::logger:\n"
+              "    name: will\n"
+              "    chucho::cout_writer:\n"
+              "        - chucho::pattern_formatter:\n"
+              "            pattern: '%m%n'\n"
+              "        - chucho::regex_filter:\n"
+              "            regex: '^will\\.[a-z]+$'\n"
+              "            field: logger\n"
+              "            on_match: deny\n"
+              "            on_mismatch: neutral");
+    regex_filter_body();
+}
+
+TEST_F(yaml_configurator, regex_filter_invalid)
+{
+    configure_with_error("chucho::logger:\n"
+                         "    name: will\n"
+                         "    chucho::cout_writer:\n"
+                         "        - chucho::pattern_formatter:\n"
+                         "            pattern: '%m%n'\n"
+                         "        - chucho::regex_filter:\n"
+                         "            regex: 'monkey'\n"
+                         "            field: banana");
+}
+
 TEST_F(yaml_configurator, rolling_file_writer)
 {
     configure("chucho::logger:\n"
@@ -672,6 +928,25 @@ TEST_F(yaml_configurator, ruby_evaluator_filter)
 
 #endif
 
+#if defined(CHUCHO_HAVE_SHM_OPEN)
+
+TEST_F(yaml_configurator, shm_ring_writer)
+{
+    configure("- chucho::logger:\n"
+              "    - name: will\n"
+              "    - chucho::shm_ring_writer:\n"
+              "        - chucho::pattern_formatter:\n"
+              "            - pattern: '%m'\n"
+              "        - chucho::formatted_message_serializer\n"
+              "        - ring_name: chucho-configurator-test\n"
+              "        - slot_count: 64\n"
+              "        - slot_size: 128\n"
+              "        - overflow: DROP");
+    shm_ring_writer_body();
+}
+
+#endif
+
 TEST_F(yaml_configurator, size_file_roll_trigger)
 {
     std::string tmpl("chucho::logger:\n"
@@ -726,6 +1001,24 @@ TEST_F(yaml_configurator, syslog_writer_facility)
     syslog_writer_facility_body(tmpl);
 }
 
+#if !defined(CHUCHO_WINDOWS)
+TEST_F(yaml_configurator, syslog_writer_extended)
+{
+    configure("chucho::logger:\n"
+              "    - name: will\n"
+              "    - chucho::syslog_writer:\n"
+              "        - chucho::pattern_formatter:\n"
+              "            - pattern: '%m%n'\n"
+              "        - facility: LOCAL0\n"
+              "        - host_name: localhost\n"
+              "        - protocol: tcp\n"
+              "        - format: rfc5424\n"
+              "        - batch_size: 20\n"
+              "        - structured_data_id: origin@32473");
+    syslog_writer_extended_body();
+}
+#endif
+
 #if !defined(CHUCHO_SOLARIS)
 TEST_F(yaml_configurator, syslog_writer_port)
 {
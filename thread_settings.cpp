@@ -0,0 +1,110 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/thread_settings.hpp>
+#include <chucho/text_util.hpp>
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+namespace
+{
+
+// The largest CPU number that a cpu_set_t holds by default
+constexpr unsigned MAX_CPU = 1023;
+
+unsigned parse_cpu(const std::string& text)
+{
+    if (text.empty() || !std::all_of(text.begin(), text.end(), [] (char c) { return std::isdigit(static_cast<unsigned char>(c)); }))
+        throw std::invalid_argument("The CPU \"" + text + "\" is not a number");
+    unsigned long result = std::stoul(text);
+    if (result > MAX_CPU)
+        throw std::invalid_argument("The CPU " + text + " is larger than " + std::to_string(MAX_CPU));
+    return static_cast<unsigned>(result);
+}
+
+}
+
+namespace chucho
+{
+
+std::vector<unsigned> thread_settings::parse_cpu_list(const std::string& text)
+{
+    std::vector<unsigned> result;
+    for (auto range : text_util::tokenize(text, ','))
+    {
+        text_util::trim(range);
+        auto dash = range.find('-');
+        if (dash == std::string::npos)
+        {
+            result.push_back(parse_cpu(range));
+        }
+        else
+        {
+            std::string first = range.substr(0, dash);
+            std::string last = range.substr(dash + 1);
+            text_util::trim(first);
+            text_util::trim(last);
+            unsigned lo = parse_cpu(first);
+            unsigned hi = parse_cpu(last);
+            if (lo > hi)
+                throw std::invalid_argument("The CPU range " + range + " is backward");
+            for (unsigned i = lo; i <= hi; i++)
+                result.push_back(i);
+        }
+    }
+    if (result.empty())
+        throw std::invalid_argument("The CPU list is empty");
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+thread_settings::scheduling thread_settings::parse_scheduling(const std::string& text)
+{
+    std::string low = text_util::to_lower(text);
+    text_util::trim(low);
+    if (low == "normal")
+        return scheduling::NORMAL;
+    if (low == "batch")
+        return scheduling::BATCH;
+    if (low == "idle")
+        return scheduling::IDLE;
+    throw std::invalid_argument("The scheduling policy must be normal, batch or idle, not \"" + text + "\"");
+}
+
+void thread_settings::set_nice(int nice)
+{
+    if (nice < -20 || nice > 19)
+        throw std::invalid_argument("The niceness must be in the range [-20, 19]");
+    nice_ = nice;
+}
+
+thread_settings thread_settings::with_defaults(const thread_settings& dflt) const
+{
+    thread_settings result(*this);
+    if (result.affinity_.empty())
+        result.affinity_ = dflt.affinity_;
+    if (!result.nice_)
+        result.nice_ = dflt.nice_;
+    if (!result.numa_node_)
+        result.numa_node_ = dflt.numa_node_;
+    if (!result.scheduling_)
+        result.scheduling_ = dflt.scheduling_;
+    return result;
+}
+
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/thread_util.hpp>
+#include <chucho/status_reporter.hpp>
+#include <atomic>
+#include <mutex>
+
+namespace
+{
+
+class reporter : public chucho::status_reporter
+{
+public:
+    reporter();
+
+    void warn(const std::string& message) const;
+};
+
+reporter::reporter()
+{
+    set_status_origin("thread_util");
+}
+
+void reporter::warn(const std::string& message) const
+{
+    report_warning(message);
+}
+
+struct static_data
+{
+    static_data();
+
+    std::mutex guard_;
+    chucho::thread_settings global_;
+    std::atomic<std::uint32_t> version_;
+    reporter reporter_;
+};
+
+static_data::static_data()
+    : version_(0)
+{
+}
+
+static_data& data()
+{
+    // Threads may still be running at exit, so this is never destroyed
+    static static_data* sd = new static_data();
+    return *sd;
+}
+
+struct applied_settings
+{
+    applied_settings();
+
+    bool configured_;
+    chucho::thread_settings settings_;
+};
+
+applied_settings::applied_settings()
+    : configured_(false)
+{
+}
+
+applied_settings& applied()
+{
+    thread_local applied_settings as;
+    return as;
+}
+
+}
+
+namespace chucho
+{
+
+namespace thread_util
+{
+
+void configure(const thread_settings& ts, const std::string& name)
+{
+    auto& rep = data().reporter_;
+    std::string thread_name = ts.get_name().empty() ? name : ts.get_name();
+    // Not every platform can name threads, so only complain about
+    // names that were asked for
+    bool named = set_name(thread_name);
+    if (!named && !ts.get_name().empty())
+        rep.warn("The thread " + thread_name + " could not be named");
+    auto cpus = ts.get_affinity();
+    if (ts.get_numa_node())
+    {
+        if (!set_numa_node(*ts.get_numa_node()))
+            rep.warn("The thread " + thread_name + " could not prefer NUMA node " + std::to_string(*ts.get_numa_node()));
+        // Without explicit affinity, stay on the node
+        if (cpus.empty())
+            cpus = get_numa_node_cpus(*ts.get_numa_node());
+    }
+    if (!cpus.empty() && !set_affinity(cpus))
+        rep.warn("The CPU affinity of the thread " + thread_name + " could not be set");
+    if (ts.get_scheduling() && !set_scheduling(*ts.get_scheduling()))
+        rep.warn("The scheduling policy of the thread " + thread_name + " could not be set");
+    if (ts.get_nice() && !set_nice(*ts.get_nice()))
+        rep.warn("The niceness of the thread " + thread_name + " could not be set to " + std::to_string(*ts.get_nice()));
+    auto& app = applied();
+    app.configured_ = true;
+    app.settings_ = ts;
+    if (named)
+        app.settings_.set_name(thread_name);
+}
+
+void configure(const thread_settings& ts, const std::string& name, const thread_settings& previous)
+{
+    auto& rep = data().reporter_;
+    std::string thread_name = ts.get_name().empty() ? name : ts.get_name();
+    if (previous.get_numa_node() && !ts.get_numa_node() && !clear_numa_node())
+        rep.warn("The NUMA node preference of the thread " + thread_name + " could not be cleared");
+    bool had_cpus = !previous.get_affinity().empty() || previous.get_numa_node();
+    bool has_cpus = !ts.get_affinity().empty() || ts.get_numa_node();
+    if (had_cpus && !has_cpus && !clear_affinity())
+        rep.warn("The CPU affinity of the thread " + thread_name + " could not be cleared");
+    if (previous.get_scheduling() && !ts.get_scheduling() && !set_scheduling(thread_settings::scheduling::NORMAL))
+        rep.warn("The scheduling policy of the thread " + thread_name + " could not be restored");
+    if (previous.get_nice() && !ts.get_nice() && !set_nice(0))
+        rep.warn("The niceness of the thread " + thread_name + " could not be restored");
+    configure(ts, name);
+}
+
+thread_settings get_applied_settings()
+{
+    auto& app = applied();
+    return app.configured_ ? app.settings_ : get_global_settings();
+}
+
+thread_settings get_global_settings()
+{
+    std::lock_guard<std::mutex> lg(data().guard_);
+    return data().global_;
+}
+
+std::uint32_t get_global_version()
+{
+    return data().version_.load();
+}
+
+void set_global_settings(const thread_settings& ts)
+{
+    std::lock_guard<std::mutex> lg(data().guard_);
+    data().global_ = ts;
+    data().global_.set_name(std::string());
+    data().version_++;
+}
+
+}
+
+}
@@ -255,6 +255,7 @@ void time_file_roller::roll()
     }
     else
     {
+        wait_for_compression();
         time_type now = clock_type::now();
         std::string target = resolve_file_name(now);
         try
@@ -276,7 +277,7 @@ void time_file_roller::roll()
                 cmp++;
             std::string to_compress = resolve_file_name(relative(now, cmp));
             if (file::exists(to_compress))
-                compressor_->compress(to_compress);
+                compress(to_compress);
         }
         compute_next_roll(now);
         cleaner_->clean(now, get_active_file_name());
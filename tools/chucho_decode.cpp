@@ -0,0 +1,115 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/binary_file_reader.hpp>
+#include <chucho/pattern_formatter.hpp>
+#include <chucho/json_formatter.hpp>
+#include <chucho/exception.hpp>
+#include <chucho/configuration.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <unistd.h>
+
+namespace
+{
+
+void usage()
+{
+    std::cerr << "Usage: chucho-decode [-p pattern | -j | -J] [-u] file..." << std::endl
+              << "  -p  Format events with this pattern_formatter pattern" << std::endl
+              << "  -j  Format events as compact JSON" << std::endl
+              << "  -J  Format events as pretty JSON" << std::endl
+              << "  -u  Use UTC times with the default pattern and JSON" << std::endl
+              << "JSON leaves out the host name, process id and diagnostic context, and in" << std::endl
+              << "patterns %h, %H, %i and %C are those of chucho-decode, not of the writer." << std::endl
+              << "Rolled files that were compressed must be decompressed first." << std::endl;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    std::string pattern;
+    bool json = false;
+    auto style = chucho::serialization_formatter::style::COMPACT;
+    bool utc = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "p:jJu")) != -1)
+    {
+        switch (opt)
+        {
+        case 'p':
+            pattern = optarg;
+            break;
+        case 'j':
+            json = true;
+            break;
+        case 'J':
+            json = true;
+            style = chucho::serialization_formatter::style::PRETTY;
+            break;
+        case 'u':
+            utc = true;
+            break;
+        default:
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind == argc || (json && !pattern.empty()))
+    {
+        usage();
+        return EXIT_FAILURE;
+    }
+    // Loggers are only needed to carry their names
+    chucho::configuration::set_style(chucho::configuration::style::OFF);
+    try
+    {
+        std::unique_ptr<chucho::formatter> fmt;
+        if (json)
+        {
+            // These would describe this process rather than the writer
+            fmt = std::make_unique<chucho::json_formatter>(chucho::serialization_formatter::field_disposition::EXCLUDED,
+                                                           std::vector<chucho::serialization_formatter::field>{ chucho::serialization_formatter::field::DIAGNOSTIC_CONTEXT,
+                                                                                                                chucho::serialization_formatter::field::HOST_NAME,
+                                                                                                                chucho::serialization_formatter::field::PROCESS_ID },
+                                                           style,
+                                                           utc ? chucho::serialization_formatter::time_zone::UTC : chucho::serialization_formatter::time_zone::LOCAL);
+        }
+        else
+        {
+            if (pattern.empty())
+                pattern = utc ? "%d %-5p %c [%t] %b:%L %m%n" : "%D %-5p %c [%t] %b:%L %m%n";
+            fmt = std::make_unique<chucho::pattern_formatter>(pattern);
+        }
+        for (int i = optind; i < argc; i++)
+        {
+            chucho::binary_file_reader rdr(argv[i]);
+            while (auto evt = rdr.read())
+            {
+                std::cout << fmt->format(*evt);
+                if (json)
+                    std::cout << std::endl;
+            }
+        }
+    }
+    catch (chucho::exception& e)
+    {
+        std::cerr << "chucho-decode: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/shm_ring_reader.hpp>
+#include <chucho/exception.hpp>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <unistd.h>
+
+namespace
+{
+
+volatile std::sig_atomic_t stop = 0;
+
+void handle_signal(int)
+{
+    stop = 1;
+}
+
+void usage()
+{
+    std::cerr << "Usage: chucho-shm-tail [-f] [-e] [-s] [-t stall_ms] ring_name" << std::endl
+              << "  -f  Keep reading as records are written" << std::endl
+              << "  -e  Skip unread records and start with the next one written" << std::endl
+              << "  -s  Print the ring's layout and counters instead of reading" << std::endl
+              << "  -t  How long a claimed slot may stay unwritten before it is skipped" << std::endl;
+}
+
+void print_stats(const chucho::shm_ring_reader& rdr)
+{
+    std::cout << "ring:        " << rdr.get_ring_name() << std::endl
+              << "slots:       " << rdr.get_slot_count() << " x " << rdr.get_slot_size() << " bytes" << std::endl
+              << "unread:      " << rdr.get_unread() << " slots" << std::endl
+              << "dropped:     " << rdr.get_dropped() << std::endl
+              << "overwritten: " << rdr.get_overwritten() << std::endl
+              << "truncated:   " << rdr.get_truncated() << std::endl;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    bool follow = false;
+    bool from_end = false;
+    bool stats = false;
+    std::chrono::milliseconds stall = chucho::shm_ring_reader::DEFAULT_STALL_TIMEOUT;
+    int opt;
+    while ((opt = getopt(argc, argv, "fest:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'f':
+            follow = true;
+            break;
+        case 'e':
+            from_end = true;
+            break;
+        case 's':
+            stats = true;
+            break;
+        case 't':
+            stall = std::chrono::milliseconds(std::strtoul(optarg, nullptr, 10));
+            break;
+        default:
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind != argc - 1)
+    {
+        usage();
+        return EXIT_FAILURE;
+    }
+    try
+    {
+        chucho::shm_ring_reader rdr(argv[optind], stall);
+        if (stats)
+        {
+            print_stats(rdr);
+            return EXIT_SUCCESS;
+        }
+        if (from_end)
+            rdr.seek_to_end();
+        std::signal(SIGINT, handle_signal);
+        std::signal(SIGTERM, handle_signal);
+        std::vector<std::uint8_t> rec;
+        while (stop == 0)
+        {
+            if (rdr.read(rec, std::chrono::milliseconds(follow ? 250 : 0)))
+            {
+                std::fwrite(rec.data(), 1, rec.size(), stdout);
+            }
+            else
+            {
+                std::fflush(stdout);
+                if (!follow)
+                    break;
+            }
+        }
+        std::fflush(stdout);
+        if (rdr.get_lost() > 0)
+            std::cerr << "chucho-shm-tail: " << rdr.get_lost() << " slots were lost" << std::endl;
+    }
+    catch (chucho::exception& e)
+    {
+        std::cerr << "chucho-shm-tail: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
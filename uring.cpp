@@ -0,0 +1,155 @@
+/*
+ * Copyright 2013-2021 Will Mason
+ * 
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chucho/uring.hpp>
+#include <chucho/exception.hpp>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace
+{
+
+template <typename type>
+type* at_offset(void* base, unsigned off)
+{
+    return reinterpret_cast<type*>(static_cast<char*>(base) + off);
+}
+
+}
+
+namespace chucho
+{
+
+uring::uring(unsigned entries)
+    : sq_ptr_(MAP_FAILED),
+      cq_ptr_(MAP_FAILED),
+      sqes_(static_cast<io_uring_sqe*>(MAP_FAILED)),
+      to_submit_(0)
+{
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd_ < 0)
+        throw exception(std::string("Could not create an io_uring: ") + std::strerror(errno));
+    sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single)
+    {
+        if (cq_size_ > sq_size_)
+            sq_size_ = cq_size_;
+        cq_size_ = sq_size_;
+    }
+    sq_ptr_ = mmap(nullptr, sq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+    if (sq_ptr_ != MAP_FAILED)
+    {
+        cq_ptr_ = single ? sq_ptr_ : mmap(nullptr, cq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+        if (cq_ptr_ != MAP_FAILED)
+        {
+            sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+            sqes_ = static_cast<io_uring_sqe*>(mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES));
+        }
+    }
+    if (sqes_ == MAP_FAILED)
+    {
+        int err = errno;
+        release();
+        throw exception(std::string("Could not map an io_uring: ") + std::strerror(err));
+    }
+    sq_head_ = at_offset<unsigned>(sq_ptr_, params.sq_off.head);
+    sq_tail_ = at_offset<unsigned>(sq_ptr_, params.sq_off.tail);
+    sq_mask_ = at_offset<unsigned>(sq_ptr_, params.sq_off.ring_mask);
+    sq_entries_ = at_offset<unsigned>(sq_ptr_, params.sq_off.ring_entries);
+    sq_array_ = at_offset<unsigned>(sq_ptr_, params.sq_off.array);
+    cq_head_ = at_offset<unsigned>(cq_ptr_, params.cq_off.head);
+    cq_tail_ = at_offset<unsigned>(cq_ptr_, params.cq_off.tail);
+    cq_mask_ = at_offset<unsigned>(cq_ptr_, params.cq_off.ring_mask);
+    cqes_ = at_offset<io_uring_cqe>(cq_ptr_, params.cq_off.cqes);
+}
+
+uring::~uring()
+{
+    release();
+}
+
+void uring::release()
+{
+    if (sqes_ != MAP_FAILED)
+        munmap(sqes_, sqes_size_);
+    if (cq_ptr_ != MAP_FAILED && cq_ptr_ != sq_ptr_)
+        munmap(cq_ptr_, cq_size_);
+    if (sq_ptr_ != MAP_FAILED)
+        munmap(sq_ptr_, sq_size_);
+    close(fd_);
+}
+
+io_uring_sqe* uring::get_sqe()
+{
+    unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    unsigned tail = *sq_tail_;
+    if (tail - head >= *sq_entries_)
+        return nullptr;
+    unsigned idx = tail & *sq_mask_;
+    io_uring_sqe* sqe = &sqes_[idx];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sq_array_[idx] = idx;
+    // Without a polling thread the kernel only reads entries when
+    // they are submitted, so the caller can fill it after this.
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    ++to_submit_;
+    return sqe;
+}
+
+bool uring::peek(io_uring_cqe& cqe)
+{
+    unsigned head = *cq_head_;
+    if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE))
+        return false;
+    cqe = cqes_[head & *cq_mask_];
+    __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool uring::register_buffers(const std::vector<iovec>& bufs)
+{
+    return syscall(__NR_io_uring_register, fd_, IORING_REGISTER_BUFFERS, bufs.data(), bufs.size()) == 0;
+}
+
+void uring::submit(unsigned wait_for)
+{
+    while (true)
+    {
+        long rc = syscall(__NR_io_uring_enter,
+                          fd_,
+                          to_submit_,
+                          wait_for,
+                          wait_for > 0 ? IORING_ENTER_GETEVENTS : 0,
+                          nullptr,
+                          0);
+        if (rc >= 0)
+        {
+            to_submit_ -= static_cast<unsigned>(rc);
+            return;
+        }
+        if (errno != EINTR)
+            throw exception(std::string("Could not submit to an io_uring: ") + std::strerror(errno));
+    }
+}
+
+}
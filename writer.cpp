@@ -16,6 +16,7 @@
 
 #include <chucho/writer.hpp>
 #include <chucho/exception.hpp>
+#include <chucho/thread_util.hpp>
 #include <stdexcept>
 #include <algorithm>
 
@@ -24,7 +25,8 @@ namespace chucho
 
 writer::writer(const std::string& name, std::unique_ptr<formatter>&& fmt)
     : formatter_(std::move(fmt)),
-      name_(name)
+      name_(name),
+      thread_settings_version_(1)
 {
     if (!formatter_)
         throw std::invalid_argument("The formatter cannot be a nullptr");
@@ -46,6 +48,60 @@ void writer::clear_filters()
     filters_.clear();
 }
 
+writer::thread_state::thread_state()
+    : version(0),
+      global_version(0)
+{
+}
+
+void writer::configure_thread(const std::string& role, thread_state& state)
+{
+    auto ver = thread_settings_version_.load();
+    auto global_ver = thread_util::get_global_version();
+    if (ver != state.version || global_ver != state.global_version)
+    {
+        auto ts = get_thread_settings().with_defaults(thread_util::get_global_settings());
+        auto name = thread_util::make_name(role, get_name());
+        if (state.version == 0)
+            thread_util::configure(ts, name);
+        else
+            thread_util::configure(ts, name, state.applied);
+        state.version = ver;
+        state.global_version = global_ver;
+        state.applied = ts;
+    }
+}
+
+bool writer::deliver(const event& evt)
+{
+    std::lock_guard<std::mutex> lg(guard_);
+    try
+    {
+        if (permits(evt))
+        {
+            write_impl(evt);
+            return true;
+        }
+    }
+    catch (std::exception& e)
+    {
+        report_error("Error writing event: " + exception::nested_whats(e));
+    }
+    return false;
+}
+
+void writer::delivered(const event& evt)
+{
+    try
+    {
+        written(evt);
+    }
+    catch (std::exception& e)
+    {
+        report_error("Error after writing event: " + exception::nested_whats(e));
+    }
+}
+
 void writer::flush()
 {
 }
@@ -84,24 +140,33 @@ bool writer::permits(const event& evt)
     return true;
 }
 
+thread_settings writer::get_thread_settings()
+{
+    std::lock_guard<std::mutex> lg(thread_settings_guard_);
+    return thread_settings_;
+}
+
 void writer::remove_filter(const std::string& name)
 {
     std::lock_guard<std::mutex> lg(guard_);
     filters_.remove_if([&name] (const std::unique_ptr<filter>& f) { return f->get_name() == name; });
 }
 
+void writer::set_thread_settings(const thread_settings& ts)
+{
+    std::lock_guard<std::mutex> lg(thread_settings_guard_);
+    thread_settings_ = ts;
+    thread_settings_version_++;
+}
+
 void writer::write(const event& evt)
 {
-    std::lock_guard<std::mutex> lg(guard_);
-    try
-    {
-        if (permits(evt))
-            write_impl(evt);
-    }
-    catch (std::exception& e)
-    {
-        report_error("Error writing event: " + exception::nested_whats(e));
-    }
+    if (deliver(evt))
+        delivered(evt);
+}
+
+void writer::written(const event&)
+{
 }
 
 }
@@ -21,6 +21,11 @@
 namespace chucho
 {
 
+bool writer_factory::creates_writer() const
+{
+    return true;
+}
+
 void writer_factory::set_filters(configurable& cnf, writer_memento& mnto)
 {
     auto wrt = dynamic_cast<writer*>(&cnf);
@@ -34,4 +39,12 @@ void writer_factory::set_filters(configurable& cnf, writer_memento& mnto)
     }
 }
 
+void writer_factory::set_thread_settings(configurable& cnf, writer_memento& mnto)
+{
+    auto wrt = dynamic_cast<writer*>(&cnf);
+    assert(wrt != nullptr);
+    if (!mnto.get_thread_settings().is_empty())
+        wrt->set_thread_settings(mnto.get_thread_settings());
+}
+
 }
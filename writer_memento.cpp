@@ -25,6 +25,18 @@ writer_memento::writer_memento(configurator& cfg)
     : nameable_memento(cfg)
 {
     set_status_origin("writer_memento");
+    cfg.get_security_policy().set_text("thread_settings::affinity", 256);
+    cfg.get_security_policy().set_text("thread_settings::name", 64);
+    cfg.get_security_policy().set_integer("thread_settings::nice", -20, 19);
+    cfg.get_security_policy().set_text("thread_settings::nice(text)", 3);
+    cfg.get_security_policy().set_integer("thread_settings::numa_node", 0, 1023);
+    cfg.get_security_policy().set_text("thread_settings::numa_node(text)", 4);
+    cfg.get_security_policy().set_text("thread_settings::scheduling", 6);
+    set_handler("thread_affinity", [this] (const std::string& val) { thread_settings_.set_affinity(thread_settings::parse_cpu_list(validate("thread_settings::affinity", val))); });
+    set_handler("thread_name", [this] (const std::string& val) { thread_settings_.set_name(validate("thread_settings::name", val)); });
+    set_handler("thread_nice", [this] (const std::string& val) { thread_settings_.set_nice(validate("thread_settings::nice", std::stoi(validate("thread_settings::nice(text)", val)))); });
+    set_handler("thread_numa_node", [this] (const std::string& val) { thread_settings_.set_numa_node(validate("thread_settings::numa_node", std::stoul(validate("thread_settings::numa_node(text)", val)))); });
+    set_handler("thread_scheduling", [this] (const std::string& val) { thread_settings_.set_scheduling(thread_settings::parse_scheduling(validate("thread_settings::scheduling", val))); });
 }
 
 void writer_memento::handle(std::unique_ptr<configurable>&& cnf)
@@ -127,8 +127,8 @@ void yaml_configurator::handle(yaml_document_t& doc,
             std::string val(resolve_variables(reinterpret_cast<const char*>(node.data.scalar.value)));
             if (mnto)
             {
-                auto found = get_factories().find(val);
-                if (found == get_factories().end())
+                auto found = get_current_factories().find(val);
+                if (found == get_current_factories().end())
                 {
                     if (key.empty()) 
                     {
@@ -167,8 +167,8 @@ void yaml_configurator::handle(yaml_document_t& doc,
                     }
                     else
                     {
-                        auto found = get_factories().find(key);
-                        if (found == get_factories().end())
+                        auto found = get_current_factories().find(key);
+                        if (found == get_current_factories().end())
                         {
                             yaml_node_t* val = yaml_document_get_node(&doc, p->value);
                             if (mnto)
@@ -34,6 +34,11 @@ void* get_zmq_context()
     return ctx;
 }
 
+void free_blob(void*, void* hint)
+{
+    delete static_cast<std::vector<std::uint8_t>*>(hint);
+}
+
 }
 
 namespace chucho
@@ -96,7 +101,7 @@ zeromq_writer::~zeromq_writer()
     zmq_close(socket_);
 }
 
-void zeromq_writer::flush_impl(const std::vector<std::uint8_t>& bytes)
+void zeromq_writer::flush_blob(std::vector<std::uint8_t>&& bytes)
 {
     if (socket_ != nullptr)
     {
@@ -110,21 +115,32 @@ void zeromq_writer::flush_impl(const std::vector<std::uint8_t>& bytes)
             if (rc != prefix_.size())
             {
                 zmq_msg_close(&pre);
-                throw exception(std::string("Error sending zeromq message prefix: ") + zmq_strerror(rc));
+                throw exception(std::string("Error sending zeromq message prefix: ") + zmq_strerror(zmq_errno()));
             }
         }
+        // ZeroMQ takes ownership of the bytes and calls free_blob when it is done with them
+        auto owned = new std::vector<std::uint8_t>(std::move(bytes));
         zmq_msg_t msg;
-        zmq_msg_init_size(&msg, bytes.size());
-        std::memcpy(zmq_msg_data(&msg), &bytes[0], bytes.size());
+        if (zmq_msg_init_data(&msg, owned->data(), owned->size(), free_blob, owned) != 0)
+        {
+            delete owned;
+            throw exception(std::string("Error creating zeromq message: ") + zmq_strerror(zmq_errno()));
+        }
+        int size = static_cast<int>(owned->size());
         rc = zmq_msg_send(&msg, socket_, 0);
-        if (rc != bytes.size())
+        if (rc != size)
         {
             zmq_msg_close(&msg);
-            throw exception(std::string("Error sending zeromq message: ") + zmq_strerror(rc));
+            throw exception(std::string("Error sending zeromq message: ") + zmq_strerror(zmq_errno()));
         }
     }
 }
 
+void zeromq_writer::flush_impl(const std::vector<std::uint8_t>& bytes)
+{
+    flush_blob(std::vector<std::uint8_t>(bytes));
+}
+
 void zeromq_writer::init()
 {
     socket_ = zmq_socket(get_zmq_context(), ZMQ_PUB);
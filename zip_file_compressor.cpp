@@ -32,6 +32,13 @@ zip_file_compressor::zip_file_compressor(unsigned min_idx)
 }
 
 void zip_file_compressor::compress(const std::string& file_name)
+{
+    // libarchive writes a zip entry with one thread, so only the
+    // niceness applies
+    run_at_nice([this, &file_name] () { compress_impl(file_name); });
+}
+
+void zip_file_compressor::compress_impl(const std::string& file_name)
 {
     std::string to_write = file_name + get_extension();
     try
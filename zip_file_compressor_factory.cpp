@@ -42,6 +42,7 @@ std::unique_ptr<configurable> zip_file_compressor_factory::create_configurable(s
         mi = 1;
     }
     auto zfc = std::make_unique<zip_file_compressor>(mi);
+    set_threads(*zfc, *fcm);
     report_info("Created a " + demangle::get_demangled_name(typeid(*zfc)));
     return std::move(zfc);
 }